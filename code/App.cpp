@@ -1,6 +1,15 @@
 #include "Precompiled.h"
 #include "App.h"
 #include "Time.h"
+#include "Benchmarks.h"
+#include "MERLMaterial.h"
+#include "MERLSampler.h"
+#include "MERLFit.h"
+#include "Cubemap.h"
+#include "EnvSampler.h"
+#include "SphericalHarmonics.h"
+#include "SpecularPrefilter.h"
+#include "EnvCache.h"
 
 static const char* kModelsPath[kObjectTypesCount] = {"models\\sphere.obj", "models\\cube.obj", "models\\shader_ball.obj"};
 
@@ -18,6 +27,32 @@ static void AppendXmlLine(std::string& xml, const char* format, ...)
 }
 
 
+// Writes the measured eta/k so Mitsuba renders the same data, falls back to Mitsuba's own table of that name
+static void AppendConductorIOR(std::string& xml, const char* ior)
+{
+	SpectralIOR<SpectralPowerDistribution> spds;
+	if (!GetSpectralLibrary().Get(ior, spds))
+	{
+		AppendXmlLine(xml, "			<string name=\"material\" value=\"%s\"/>", ior);
+		return;
+	}
+
+	auto appendSpectrum = [&xml](const char* name, const SpectralPowerDistribution& spd) {
+		char buf[64];
+		sprintf(buf, "			<spectrum name=\"%s\" value=\"", name);
+		xml.append(buf);
+		for (size_t i = 0; i < spd.Size(); i++)
+		{
+			sprintf(buf, i ? ", %.3f:%f" : "%.3f:%f", spd.Wavelength()[i], spd.Values()[i]);
+			xml.append(buf);
+		}
+		xml.append("\"/>\r\n");
+	};
+	appendSpectrum("eta", *spds.eta);
+	appendSpectrum("k", *spds.k);
+}
+
+
 App::App()
 {
 }
@@ -242,7 +277,7 @@ void App::OnRender()
 		barriers.clear();
 
 		m_envEmitter.BakeCubemap(cmdList);
-		if (m_samplingType == kSamplingTypeBakedSplitSumNV && m_globalConstBuffer.SamplesProcessed == 0)
+		if (m_samplingType == kSamplingTypeBakedSplitSumNV && m_globalConstBuffer.SamplesProcessed == 0 && !LoadCachedEnvMaps())
 			m_envMapFilter.FilterEnvMap(cmdList, m_envEmitter.GetCubeMapSRV());
 		RenderScene(cmdList);
 
@@ -318,6 +353,76 @@ PerspectiveCamera* App::GetCurrentCamera()
 }
 
 
+// The products of the environment from EnvCache, prewarmed by the envcache command, false when the GPU has to filter them
+bool App::LoadCachedEnvMaps()
+{
+	if (m_envEmitter.GetType() != EnvEmitter::kTypeTexture || m_envEmitter.GetTextureHash() == 0)
+	{
+		m_envMapFilter.UseFiltered();
+		return false;
+	}
+
+	EnvCacheParameters parameters;
+	parameters.scale = m_envEmitter.GetScale();
+	parameters.samplesNum = m_samplesCount;
+	return m_envMapFilter.LoadCached(m_envEmitter.GetTextureHash(), parameters);
+}
+
+
+// Filter every environment of data\HDRs missing from EnvCache like the first frame showing it, and save what the GPU produced
+bool App::PrewarmEnvCache(const EnvCacheParameters& parameters)
+{
+	m_envEmitter.SetType(EnvEmitter::kTypeTexture);
+	m_envEmitter.SetScale(parameters.scale);
+	m_samplesCount = parameters.samplesNum;
+	m_envMapFilter.UseFiltered();
+
+	uint32_t bakedNum = 0;
+	bool result = true;
+	for (const FilePath& file : m_hdrFiles)
+	{
+		m_envEmitter.SetTexture(file.c_str());
+		uint64_t sourceHash = m_envEmitter.GetTextureHash();
+		if (sourceHash == 0)
+		{
+			LogStdErr("Failed to load environment '%s'\n", file.c_str());
+			result = false;
+			continue;
+		}
+
+		bool cached = true;
+		for (uint32_t product = 0; product < kEnvCacheProductsNum; product++)
+			cached &= IsEnvCached((EEnvCacheProduct)product, GetEnvCacheKey((EEnvCacheProduct)product, sourceHash, parameters));
+		if (cached)
+			continue;
+
+		// the passes of OnRender() that fill the products, the filter reads EnvironmentMap and TotalSamples from the global constants
+		UpdateGlobalConstBuffer(XMMatrixIdentity());
+		m_device.BeginFrame();
+		ID3D12GraphicsCommandList* cmdList = m_device.GetCommandList();
+		D3D12_GPU_VIRTUAL_ADDRESS globalCb = m_device.UpdateConstantBuffer(&m_globalConstBuffer, sizeof(m_globalConstBuffer));
+		cmdList->SetGraphicsRootConstantBufferView(0, globalCb);
+		cmdList->SetComputeRootConstantBufferView(0, globalCb);
+		m_envEmitter.BakeCubemap(cmdList);
+		m_envMapFilter.FilterEnvMap(cmdList, m_envEmitter.GetCubeMapSRV());
+		m_device.EndFrame();
+
+		if (!m_envMapFilter.SaveToCache(sourceHash, parameters))
+		{
+			result = false;
+			continue;
+		}
+
+		LogStdOut("  %s: %016llx\n", file.c_str(), (unsigned long long)sourceHash);
+		bakedNum++;
+	}
+
+	LogStdOut("Baked %u of %u environments into data\\EnvCache, scale %.2f, %u samples\n", bakedNum, (uint32_t)m_hdrFiles.size(), parameters.scale,
+	          parameters.samplesNum);
+	return result;
+}
+
+
 void App::RenderScene(ID3D12GraphicsCommandList* cmdList)
 {
 	// shadow pass
@@ -444,13 +549,13 @@ void App::ExportToMitsuba()
 		else if (instance.MaterialType == kMaterialSmoothConductor)
 		{
 			AppendXmlLine(xml, "		<bsdf type=\"conductor\">");
-			AppendXmlLine(xml, "			<string name=\"material\" value=\"%s\"/>", m_singleObjScene.ior);
+			AppendConductorIOR(xml, m_singleObjScene.ior);
 			AppendXmlLine(xml, "		</bsdf>");
 		}
 		else if (instance.MaterialType == kMaterialRoughConductor)
 		{
 			AppendXmlLine(xml, "		<bsdf type=\"roughconductor\">");
-			AppendXmlLine(xml, "			<string name=\"material\" value=\"%s\"/>", m_singleObjScene.ior);
+			AppendConductorIOR(xml, m_singleObjScene.ior);
 			AppendXmlLine(xml, "			<string name=\"distribution\" value=\"ggx\"/>");
 			AppendXmlLine(xml, "			<float name=\"alpha\" value=\"%f\"/>", instance.Roughness * instance.Roughness);
 			AppendXmlLine(xml, "		</bsdf>");
@@ -535,22 +640,19 @@ void App::ExportToMitsuba()
 
 XMVECTOR App::ComputeF0(const char* ior)
 {
-	SpectralPowerDistribution etaSPD;
-	FilePath path = ior;
-	path.SetExtension(".eta.spd");
-	etaSPD.InitFromFile(path.c_str());
-
-	SpectralPowerDistribution kSPD;
-	path = ior;
-	path.SetExtension(".k.spd");
-	kSPD.InitFromFile(path.c_str());
-
-	Spectrum eta(etaSPD), k(kSPD);
-	Spectrum F0 = FresnelConductorExact(1.0f - 1e-3f, eta, k);
-	F0 *= GetD65Normalized();
-	float r, g, b;
-	F0.ToLinearRGB(r, g, b);
-	return XMVectorSet(r, g, b, 1.0f);
+	// the database is baked at the 1 nm resolution
+	const ConductorReflectance* conductor = GetConductorDatabase().Find(ior);
+	if (conductor && m_spectralResolution == kSpectralResolution1nm)
+		return XMVectorSetW(XMLoadFloat3(&conductor->F0), 1.0f);
+
+	XMVECTOR F0 = XMVectorZero();
+	DispatchSpectralResolution(m_spectralResolution, [&](auto tag) {
+		using S = std::remove_pointer_t<decltype(tag)>;
+		SpectralIOR<S> spectralIOR;
+		if (GetSpectralLibrary().Get(ior, spectralIOR))
+			F0 = FresnelConductorRGB(1.0f, *spectralIOR.eta, *spectralIOR.k);
+	});
+	return XMVectorSetW(F0, 1.0f);
 }
 
 
@@ -677,6 +779,34 @@ int WINAPI wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
 			return -1;
 		}
 
+		// float inputs are linear Rec.709 and 8 bit ones sRGB encoded, an optional color space converts them before they are saved
+		EColorSpace colorSpace = kColorSpaceRec709;
+		if (argc > 2 && !FindColorSpace(argv[2], colorSpace))
+		{
+			LogStdErr("Unknown color space '%S'\n", argv[2]);
+			return -1;
+		}
+
+		if (colorSpace != kColorSpaceRec709)
+		{
+			if (data.format != DXGI_FORMAT_R32G32B32A32_FLOAT)
+			{
+				// the matrices of ConvertColors() take linear colors, LDR images like PNG or JPG are decoded from sRGB first
+				TEX_FILTER_FLAGS filter = FormatDataType(data.format) == FORMAT_TYPE_FLOAT ? TEX_FILTER_DEFAULT : TEX_FILTER_SRGB_IN;
+				ScratchImage convertedImage;
+				if (FAILED(Convert(*image.GetImage(0, 0, 0), DXGI_FORMAT_R32G32B32A32_FLOAT, filter, 0.0f, convertedImage)))
+				{
+					LogStdErr("Failed to convert texture\n");
+					return -1;
+				}
+				image = std::move(convertedImage);
+			}
+
+			// rows of a ScratchImage are tightly packed, the whole image is one batch split across threads
+			const Image* pixels = image.GetImage(0, 0, 0);
+			ConvertColors(kColorSpaceRec709, colorSpace, (float*)pixels->pixels, pixels->width * pixels->height);
+		}
+
 		FilePathW output = input;
 		output.SetExtension(L".hdr");
 		if (FAILED(SaveToHDRFile(*image.GetImage(0, 0, 0), output.c_str())))
@@ -687,8 +817,209 @@ int WINAPI wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
 
 		return 0;
 	}
+	else if (argc > 1 && wcscmp(argv[0], L"cubemap") == 0)
+	{
+		// an environment of data\HDRs as a cube texture with mips, in the layout EnvEmitter can load without baking it on the GPU
+		FilePathW input = L"data";
+		input /= L"HDRs";
+		input /= argv[1];
+
+		uint32_t resolution = argc > 2 ? (uint32_t)_wtoi(argv[2]) : Cubemap::kDefaultResolution;
+		if (resolution == 0 || (resolution & (resolution - 1)) != 0)
+		{
+			LogStdErr("The cubemap resolution has to be a power of two\n");
+			return -1;
+		}
+
+		ECubemapFilter filter = kCubemapFilterBilinear;
+		if (argc > 3 && wcscmp(argv[3], L"bicubic") == 0)
+			filter = kCubemapFilterBicubic;
+		else if (argc > 3 && wcscmp(argv[3], L"bilinear") != 0)
+		{
+			LogStdErr("Unknown cubemap filter '%S'\n", argv[3]);
+			return -1;
+		}
+
+		ScratchImage image;
+		if (!LoadEquirect(input, image))
+			return -1;
+
+		const Image* pixels = image.GetImage(0, 0, 0);
+		Cubemap cubemap;
+		cubemap.Init(resolution);
+		cubemap.ConvertFromEquirect({(const XMFLOAT4*)pixels->pixels, (uint32_t)pixels->width, (uint32_t)pixels->height}, filter);
+
+		FilePathW output = GetDerivedEnvMapPath(input, L".cube.dds");
+		if (!cubemap.SaveToDDS(output.c_str()))
+		{
+			LogStdErr("Failed to save output file '%S'\n", output.c_str());
+			return -1;
+		}
+
+		return 0;
+	}
+	else if (argc > 1 && wcscmp(argv[0], L"envsample") == 0)
+	{
+		// luminance sampling tables of an environment of data\HDRs, saved next to it
+		FilePathW input = L"data";
+		input /= L"HDRs";
+		input /= argv[1];
+
+		ScratchImage image;
+		if (!LoadEquirect(input, image))
+			return -1;
+
+		const Image* pixels = image.GetImage(0, 0, 0);
+		EnvSampler sampler;
+		if (!sampler.Build({(const XMFLOAT4*)pixels->pixels, (uint32_t)pixels->width, (uint32_t)pixels->height}))
+		{
+			LogStdErr("Failed to build environment sampling tables\n");
+			return -1;
+		}
+
+		FilePathW output = input;
+		output.SetExtension(L".envs");
+		if (!sampler.Save(ConvertPath(output).c_str()))
+		{
+			LogStdErr("Failed to save output file '%S'\n", output.c_str());
+			return -1;
+		}
+
+		return 0;
+	}
+	else if (argc > 1 && wcscmp(argv[0], L"irradiance") == 0)
+	{
+		// the diffuse cube of EnvMapFilter for an environment of data\HDRs, through L2 spherical harmonics instead of the GPU convolution
+		FilePathW input = L"data";
+		input /= L"HDRs";
+		input /= argv[1];
+
+		ScratchImage image;
+		if (!LoadEquirect(input, image))
+			return -1;
+
+		const Image* pixels = image.GetImage(0, 0, 0);
+		SHColor radiance = ProjectToSH(EquirectImage{(const XMFLOAT4*)pixels->pixels, (uint32_t)pixels->width, (uint32_t)pixels->height});
+		// the diffuse cube of EnvMapFilter has no mips
+		Cubemap cubemap;
+		cubemap.Init(kDiffuseEnvMapResolution, 1);
+		EvalSH(ConvolveDiffuse(radiance), cubemap);
+
+		FilePathW output = GetDerivedEnvMapPath(input, L".irradiance.dds");
+		if (!cubemap.SaveToDDS(output.c_str()))
+		{
+			LogStdErr("Failed to save output file '%S'\n", output.c_str());
+			return -1;
+		}
+
+		return 0;
+	}
+	else if (argc > 1 && wcscmp(argv[0], L"prefilter") == 0)
+	{
+		// the prefiltered specular cube of EnvMapFilter for an environment of data\HDRs, the same bits on every run
+		FilePathW input = L"data";
+		input /= L"HDRs";
+		input /= argv[1];
+
+		uint32_t samplesNum = argc > 2 ? (uint32_t)_wtoi(argv[2]) : SpecularPrefilter::kDefaultSamplesNum;
+		if (samplesNum == 0)
+		{
+			LogStdErr("The samples count has to be positive\n");
+			return -1;
+		}
+
+		ScratchImage image;
+		if (!LoadEquirect(input, image))
+			return -1;
+
+		// the source is the cube EnvEmitter bakes, with its mips
+		const Image* pixels = image.GetImage(0, 0, 0);
+		Cubemap environment;
+		environment.Init(Cubemap::kDefaultResolution);
+		environment.ConvertFromEquirect({(const XMFLOAT4*)pixels->pixels, (uint32_t)pixels->width, (uint32_t)pixels->height}, kCubemapFilterBilinear);
+
+		SpecularPrefilter prefilter;
+		prefilter.Init(SpecularPrefilter::kDefaultResolution, environment.GetResolution(), samplesNum);
+		Cubemap cubemap;
+		cubemap.Init(SpecularPrefilter::kDefaultResolution);
+		prefilter.Prefilter(environment, cubemap);
+
+		FilePathW output = GetDerivedEnvMapPath(input, L".specular.dds");
+		if (!cubemap.SaveToDDS(output.c_str()))
+		{
+			LogStdErr("Failed to save output file '%S'\n", output.c_str());
+			return -1;
+		}
+
+		return 0;
+	}
+	else if (argc > 0 && wcscmp(argv[0], L"envcache") == 0)
+	{
+		// filter every environment of data\HDRs on the GPU, at the emitter scale and samples count of the UI
+		EnvCacheParameters parameters;
+		if (argc > 1)
+			parameters.scale = (float)_wtof(argv[1]);
+		if (argc > 2)
+			parameters.samplesNum = (uint32_t)_wtoi(argv[2]);
+		if (parameters.samplesNum == 0)
+		{
+			LogStdErr("The samples count has to be positive\n");
+			return -1;
+		}
+
+		InitSpectralArchive();
+		InitConductorDatabase();
+		InitRGBToSpectrumTable();
+
+		App app;
+		if (!app.Init())
+			return -1;
+		return app.PrewarmEnvCache(parameters) ? 0 : -1;
+	}
+	else if (argc > 0 && wcscmp(argv[0], L"bench") == 0)
+	{
+		InitSpectralArchive();
+		InitConductorDatabase();
+		InitRGBToSpectrumTable();
+		return RunBenchmark(argc > 1 ? argv[1] : nullptr) ? 0 : -1;
+	}
+	else if (argc > 0 && wcscmp(argv[0], L"spdpack") == 0)
+	{
+		return SpectralArchive::Build() ? 0 : -1;
+	}
+	else if (argc > 1 && wcscmp(argv[0], L"spectables") == 0)
+	{
+		return GenerateSpectrumTables(ConvertPath(FilePathW(argv[1])).c_str()) ? 0 : -1;
+	}
+	else if (argc > 0 && wcscmp(argv[0], L"rgb2spec") == 0)
+	{
+		uint32_t resolution = argc > 1 ? (uint32_t)_wtoi(argv[1]) : RGBToSpectrumTable::kDefaultResolution;
+		return RGBToSpectrumTable::Build(resolution) ? 0 : -1;
+	}
+	else if (argc > 0 && wcscmp(argv[0], L"merlpack") == 0)
+	{
+		EMERLEncoding encoding = kMERLEncodingHalf;
+		if (argc > 1 && wcscmp(argv[1], L"log10bit") == 0)
+			encoding = kMERLEncodingLog10Bit;
+		else if (argc > 1 && wcscmp(argv[1], L"half") != 0)
+		{
+			LogStdErr("Unknown MERL encoding '%S'\n", argv[1]);
+			return -1;
+		}
+		return CompactMERLMaterial::BuildDirectory(encoding) ? 0 : -1;
+	}
+	else if (argc > 0 && wcscmp(argv[0], L"merlsample") == 0)
+	{
+		return MERLSampler::BuildDirectory() ? 0 : -1;
+	}
+	else if (argc > 0 && wcscmp(argv[0], L"merlfit") == 0)
+	{
+		return GGXFitTable::FitDirectory() ? 0 : -1;
+	}
 
-	InitSpectrum();
+	InitSpectralArchive();
+	InitConductorDatabase();
+	InitRGBToSpectrumTable();
 
 	App app;
 	if (!app.Init())
@@ -11,6 +11,11 @@
 #include "PostProcess.h"
 #include "SpectralPowerDistribution.h"
 #include "Fresnel.h"
+#include "SpectralLibrary.h"
+#include "ConductorDatabase.h"
+#include "RGBToSpectrum.h"
+#include "ColorSpace.h"
+#include <future>
 
 
 __declspec(align(16)) struct GlobalConstBuffer
@@ -133,11 +138,15 @@ private:
 	bool m_opened = false;
 	const char* selectorIOR = "";
 
-	Spectrum m_etaSpectrum;
+	SpectralIOR<Spectrum> m_ior;
 	float m_etaSpectrumMaxVal = 0.0f;
-	Spectrum m_kSpectrum;
 	float m_kSpectrumMaxVal = 0.0f;
+	ESpectralResolution m_fresnelRGBPlotResolution = kSpectralResolution1nm;
 	std::vector<XMVECTOR> m_fresnelRGBPlot;
+	// bumped when the IOR, the resolution or the color space changes, results of older jobs are dropped
+	uint32_t m_fresnelRGBPlotVersion = 0;
+	uint32_t m_fresnelRGBPlotJobVersion = 0;
+	std::future<std::vector<XMVECTOR>> m_fresnelRGBPlotJob;
 	bool m_drawFresnelRGBPlot = true;
 	bool m_drawSchlickPlot = true;
 	bool m_fresnelDrawRGB[3] = {true, true, true};
@@ -145,6 +154,7 @@ private:
 	std::vector<float> m_fresnelSpectralPlot;
 	Spectrum m_customRGBSpectrum;
 	Spectrum::ESpectrumType m_customRGBSpectrumType = Spectrum::kReflectance;
+	Spectrum::EUplifting m_customRGBUplifting = Spectrum::kSigmoidUplifting;
 	XMFLOAT3 m_customRGB = {0.5f, 0.5f, 0.5f};
 	XMFLOAT2 m_cieMinMax = {0.0f, -FLT_MAX};
 	XMFLOAT2 m_rgbSpectrumsMinMax = {0.0f, -FLT_MAX};
@@ -171,6 +181,7 @@ public:
 
 	bool Init();
 	void Run();
+	bool PrewarmEnvCache(const EnvCacheParameters& parameters);
 
 private:
 	Device m_device;
@@ -205,7 +216,7 @@ private:
 
 	bool m_enableEnvEmitter = true;
 
-	uint32_t m_samplesCount = 128;
+	uint32_t m_samplesCount = kEnvFilterSamplesNum;
 	uint32_t m_samplesPerFrame = 16;
 	ESamplingType m_samplingType = kSamplingTypeFIS;
 	DirectX::XMMATRIX m_prevFrameViewProj;
@@ -216,6 +227,7 @@ private:
 
 	ESceneType m_sceneType = kSceneSingleObject;
 	SingleObjectSceneControls m_singleObjScene;
+	ESpectralResolution m_spectralResolution = kSpectralResolution1nm;
 	ObjRenderer::InstanceData m_singleObjInstanceData;
 	ObjectsGridSceneControls m_objsGridScene;
 	std::vector<ObjRenderer::InstanceData> m_objsGridInstancesData;
@@ -234,6 +246,7 @@ private:
 	void UpdateGlobalConstBuffer(const DirectX::XMMATRIX& viewProj);
 	PerspectiveCamera* GetCurrentCamera();
 	void RenderScene(ID3D12GraphicsCommandList* cmdList);
+	bool LoadCachedEnvMaps();
 	void ExportToMitsuba();
 	XMVECTOR ComputeF0(const char* ior);
 };
@@ -0,0 +1,2516 @@
+#include "Precompiled.h"
+#include "Benchmarks.h"
+#include "SpectralPowerDistribution.h"
+#include "Fresnel.h"
+#include "SpectralLibrary.h"
+#include "ConductorDatabase.h"
+#include "RGBToSpectrum.h"
+#include "ColorSpace.h"
+#include "MERLMaterial.h"
+#include "MERLEvaluator.h"
+#include "MERLSampler.h"
+#include "MERLFit.h"
+#include "Cubemap.h"
+#include "EnvSampler.h"
+#include "SphericalHarmonics.h"
+#include "SpecularPrefilter.h"
+#include "EnvCache.h"
+#include <DirectXPackedVector.h>
+#include <thread>
+#include <fstream>
+#include <sstream>
+
+
+static double GetTimeMs()
+{
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	LARGE_INTEGER count;
+	QueryPerformanceCounter(&count);
+	return count.QuadPart * 1000.0 / frequency.QuadPart;
+}
+
+
+template <typename LAMBDA>
+static double MeasureMs(uint32_t iterations, const LAMBDA& lambda)
+{
+	double start = GetTimeMs();
+	for (uint32_t i = 0; i < iterations; i++)
+		lambda(i);
+	return (GetTimeMs() - start) / iterations;
+}
+
+
+static bool LoadIOR(const char* ior, SpectralPowerDistribution& eta, SpectralPowerDistribution& k)
+{
+	FilePath path = ior;
+	path.SetExtension(".eta.spd");
+	if (!eta.InitFromFile(path.c_str()))
+		return false;
+
+	path = ior;
+	path.SetExtension(".k.spd");
+	return k.InitFromFile(path.c_str());
+}
+
+
+static bool LoadIOR(const char* ior, Spectrum& eta, Spectrum& k)
+{
+	SpectralPowerDistribution etaSPD, kSPD;
+	if (!LoadIOR(ior, etaSPD, kSPD))
+		return false;
+
+	eta = Spectrum(etaSPD);
+	k = Spectrum(kSPD);
+	return true;
+}
+
+
+// Au, or a constant IOR of its magnitude on machines without data\SPDs
+static void LoadGoldIOR(Spectrum& eta, Spectrum& k)
+{
+	if (!LoadIOR("Au", eta, k))
+	{
+		eta = Spectrum(0.2f);
+		k = Spectrum(3.0f);
+	}
+}
+
+
+// Conductors of data\SPDs the sweeps run over, the ones missing on disk are skipped
+static const char* const kBenchmarkConductors[] = {"Ag", "Al", "Au", "Cr", "Cu", "Ir", "Mo", "Rh"};
+
+
+struct Conductor
+{
+	const char* name;
+	SpectralPowerDistribution eta;
+	SpectralPowerDistribution k;
+	// 1 nm RGB Fresnel at the angles of a benchmark, for the ones comparing against it
+	std::vector<XMVECTOR> reference;
+};
+
+
+static bool LoadConductors(const char* benchmark, std::vector<Conductor>& conductors)
+{
+	for (const char* name : kBenchmarkConductors)
+	{
+		Conductor conductor;
+		conductor.name = name;
+		if (LoadIOR(name, conductor.eta, conductor.k))
+			conductors.push_back(std::move(conductor));
+	}
+	if (!conductors.empty())
+		return true;
+
+	LogStdErr("%s: no conductor SPDs found\n", benchmark);
+	return false;
+}
+
+
+// LCG of Numerical Recipes, the same uniform floats in [0, 1) on every run
+static float Random(uint32_t& seed)
+{
+	seed = seed * 1664525u + 1013904223u;
+	return (seed >> 8) * (1.0f / (1 << 24));
+}
+
+
+// Materializes every operator into its own Spectrum, the way the eager operators did.
+// Each eager operator copied its left operand and then ran an in-place loop, i.e.
+// streamed 4 spectra for a scalar operand and 5 for a spectrum operand.
+struct EagerSpectrumOps
+{
+	uint64_t bytes = 0;
+	uint32_t temporaries = 0;
+
+	template <typename E>
+	Spectrum Op(const SpectrumExpr<E>& expr, uint32_t streams)
+	{
+		bytes += streams * sizeof(Spectrum);
+		temporaries++;
+		return Spectrum(expr);
+	}
+
+	Spectrum FresnelConductorExact(float cosThetaI, const Spectrum& eta, const Spectrum& k, float outterMediaIOR = kAirIOR)
+	{
+		const uint32_t kScalarOp = 4;
+		const uint32_t kSpectrumOp = 5;
+
+		float cosThetaI2 = cosThetaI * cosThetaI;
+		float sinThetaI2 = 1.0f - cosThetaI2;
+		Spectrum eta2 = Op(Op(eta * eta, kSpectrumOp) / (outterMediaIOR * outterMediaIOR), kScalarOp);
+		Spectrum etak2 = Op(Op(k * k, kSpectrumOp) / (outterMediaIOR * outterMediaIOR), kScalarOp);
+
+		Spectrum t0 = Op(Op(eta2 - etak2, kSpectrumOp) - sinThetaI2, kScalarOp);
+		Spectrum t0Sqr = Op(t0 * t0, kSpectrumOp);
+		Spectrum eta2k2 = Op(Op(eta2 * etak2, kSpectrumOp) * 4.0f, kScalarOp);
+		Spectrum a2plusb2 = Op(Op(t0Sqr + eta2k2, kSpectrumOp).safe_sqrt(), kScalarOp);
+		Spectrum t1 = Op(a2plusb2 + cosThetaI2, kScalarOp);
+		Spectrum a = Op(Op(Op(a2plusb2 + t0, kSpectrumOp) * 0.5f, kScalarOp).safe_sqrt(), kScalarOp);
+		Spectrum t2 = Op(Op(a * 2.0f, kScalarOp) * cosThetaI, kScalarOp);
+		Spectrum Rs = Op(Op(t1 - t2, kSpectrumOp) / Op(t1 + t2, kSpectrumOp), kSpectrumOp);
+
+		Spectrum t3 = Op(Op(a2plusb2 * cosThetaI2, kScalarOp) + sinThetaI2 * sinThetaI2, kScalarOp);
+		Spectrum t4 = Op(t2 * sinThetaI2, kScalarOp);
+		Spectrum Rp = Op(Op(Rs * Op(t3 - t4, kSpectrumOp), kSpectrumOp) / Op(t3 + t4, kSpectrumOp), kSpectrumOp);
+
+		return Op(Op(Rp + Rs, kSpectrumOp) * 0.5f, kScalarOp);
+	}
+};
+
+
+static bool BenchmarkSpectrumExpr()
+{
+	Spectrum eta, k;
+	LoadGoldIOR(eta, k);
+
+	const uint32_t kAnglesNum = 4096;
+	std::vector<float> cosThetas(kAnglesNum);
+	for (uint32_t i = 0; i < kAnglesNum; i++)
+		cosThetas[i] = cosf(XM_PIDIV2 * i / (kAnglesNum - 1)) - 1e-06f;
+
+	EagerSpectrumOps eager;
+	float maxDiff = 0.0f;
+	for (uint32_t i = 0; i < kAnglesNum; i++)
+	{
+		Spectrum reference = eager.FresnelConductorExact(cosThetas[i], eta, k);
+		Spectrum fused = FresnelConductorExact(cosThetas[i], eta, k);
+		for (uint32_t s = 0; s < kSpectrumSamples; s++)
+			maxDiff = std::max(maxDiff, fabsf(reference[s] - fused[s]));
+	}
+	uint32_t eagerTemporaries = eager.temporaries / kAnglesNum;
+	uint64_t eagerBytes = eager.bytes / kAnglesNum;
+
+	// the fused version runs 4 loops: a2plusb2 (reads eta, k), t2 (eta, k, a2plusb2),
+	// Rs (a2plusb2, t2) and the result (a2plusb2, t2, Rs), each writing one spectrum
+	const uint32_t kFusedTemporaries = 4;
+	const uint64_t kFusedBytes = (3 + 4 + 3 + 4) * sizeof(Spectrum);
+
+	Spectrum sink(0.0f);
+	double eagerMs = MeasureMs(kAnglesNum, [&](uint32_t i) { sink += eager.FresnelConductorExact(cosThetas[i], eta, k); });
+	double fusedMs = MeasureMs(kAnglesNum, [&](uint32_t i) { sink += FresnelConductorExact(cosThetas[i], eta, k); });
+
+	LogStdOut("spectrum_expr: FresnelConductorExact over %u angles\n", kAnglesNum);
+	LogStdOut("  eager: %.4f ms/call, %u temporaries, %llu KB streamed per call\n", eagerMs, eagerTemporaries, eagerBytes / 1024);
+	LogStdOut("  fused: %.4f ms/call, %u temporaries, %llu KB streamed per call\n", fusedMs, kFusedTemporaries, kFusedBytes / 1024);
+	LogStdOut("  max abs difference: %g (sink %f)\n", maxDiff, sink[0]);
+
+	return maxDiff <= 1e-6f;
+}
+
+
+static bool BenchmarkSpectrumSimd()
+{
+	Spectrum eta, k;
+	LoadGoldIOR(eta, k);
+
+	const uint32_t kAnglesNum = 1024;
+	std::vector<float> cosThetas(kAnglesNum);
+	for (uint32_t i = 0; i < kAnglesNum; i++)
+		cosThetas[i] = cosf(XM_PIDIV2 * i / (kAnglesNum - 1)) - 1e-06f;
+
+	ESimdLevel supportedLevel = GetSupportedSimdLevel();
+	LogStdOut("spectrum_simd: FresnelConductorExact and ToXYZ over %u angles, %u samples per spectrum\n", kAnglesNum, kSpectrumSamples);
+
+	// The scalar path is the reference, elementwise results have to match it bit for bit,
+	// ToXYZ sums in a different order and is compared with a relative tolerance
+	const float kXYZTolerance = 1e-5f;
+	std::vector<Spectrum> reference(kAnglesNum);
+	std::vector<XMFLOAT3> referenceXYZ(kAnglesNum);
+	double referenceFresnelMs = 0.0;
+	double referenceXYZMs = 0.0;
+	bool passed = true;
+	for (uint32_t level = kSimdScalar; level <= supportedLevel; level++)
+	{
+		SetSimdLevel((ESimdLevel)level);
+
+		uint32_t mismatches = 0;
+		float maxXYZError = 0.0f;
+		for (uint32_t i = 0; i < kAnglesNum; i++)
+		{
+			Spectrum f = FresnelConductorExact(cosThetas[i], eta, k);
+			XMFLOAT3 xyz;
+			f.ToXYZ(xyz.x, xyz.y, xyz.z);
+			if (level == kSimdScalar)
+			{
+				reference[i] = f;
+				referenceXYZ[i] = xyz;
+				continue;
+			}
+
+			for (uint32_t s = 0; s < kSpectrumSamples; s++)
+				mismatches += memcmp(&f[s], &reference[i][s], sizeof(float)) != 0;
+
+			const float* a = &xyz.x;
+			const float* b = &referenceXYZ[i].x;
+			for (uint32_t c = 0; c < 3; c++)
+				maxXYZError = std::max(maxXYZError, fabsf(a[c] - b[c]) / std::max(fabsf(b[c]), 1e-6f));
+		}
+
+		Spectrum sink(0.0f);
+		float xyzSink = 0.0f;
+		double fresnelMs = MeasureMs(kAnglesNum, [&](uint32_t i) { sink += FresnelConductorExact(cosThetas[i], eta, k); });
+		double xyzMs = MeasureMs(kAnglesNum, [&](uint32_t i) {
+			float x, y, z;
+			reference[i].ToXYZ(x, y, z);
+			xyzSink += x + y + z;
+		});
+
+		if (level == kSimdScalar)
+		{
+			referenceFresnelMs = fresnelMs;
+			referenceXYZMs = xyzMs;
+		}
+
+		LogStdOut("  %-8s: Fresnel %.4f ms/call (%.2fx), ToXYZ %.5f ms/call (%.2fx), %u mismatched samples, max XYZ rel error %g (sink %f)\n",
+		          GetSimdLevelName((ESimdLevel)level), fresnelMs, referenceFresnelMs / fresnelMs, xyzMs, referenceXYZMs / xyzMs, mismatches, maxXYZError,
+		          sink[0] + xyzSink);
+
+		passed &= mismatches == 0 && maxXYZError <= kXYZTolerance;
+	}
+
+	SetSimdLevel(supportedLevel);
+	return passed;
+}
+
+
+static bool BenchmarkFresnelBatch()
+{
+	Spectrum eta, k;
+	LoadGoldIOR(eta, k);
+
+	// a typical plot width, see PlotsWindow::BuildFresnelRGBPlot
+	const uint32_t kAnglesNum = 301;
+	std::vector<float> cosThetas(kAnglesNum);
+	for (uint32_t i = 0; i < kAnglesNum; i++)
+		cosThetas[i] = cosf(XM_PIDIV2 * i / (kAnglesNum - 1)) - 1e-06f;
+
+	LogStdOut("fresnel_batch: RGB Fresnel of %u angles\n", kAnglesNum);
+
+	std::vector<XMVECTOR> reference(kAnglesNum), batch(kAnglesNum);
+	for (uint32_t i = 0; i < kAnglesNum; i++)
+		reference[i] = FresnelConductorRGB(cosThetas[i], eta, k);
+	double perAngleMs = MeasureMs(8, [&](uint32_t) {
+		for (uint32_t i = 0; i < kAnglesNum; i++)
+			reference[i] = FresnelConductorRGB(cosThetas[i], eta, k);
+	});
+	LogStdOut("  per angle         : %.3f ms\n", perAngleMs);
+
+	// summation order differs from ToXYZ, so the results are compared with a tolerance
+	const float kTolerance = 1e-4f;
+	bool passed = true;
+	ESimdLevel supportedLevel = GetSupportedSimdLevel();
+	for (uint32_t level = kSimdScalar; level <= supportedLevel; level++)
+	{
+		SetSimdLevel((ESimdLevel)level);
+		double batchMs = MeasureMs(8, [&](uint32_t) { FresnelConductorRGB(cosThetas.data(), kAnglesNum, eta, k, batch.data()); });
+
+		float maxError = 0.0f;
+		for (uint32_t i = 0; i < kAnglesNum; i++)
+		{
+			XMVECTOR error = XMVectorAbs(XMVectorSubtract(batch[i], reference[i]));
+			maxError = std::max({maxError, XMVectorGetX(error), XMVectorGetY(error), XMVectorGetZ(error)});
+		}
+
+		LogStdOut("  batched %-10s: %.3f ms (%.1fx), max error %g\n", GetSimdLevelName((ESimdLevel)level), batchMs, perAngleMs / batchMs, maxError);
+		passed &= maxError <= kTolerance;
+	}
+	SetSimdLevel(supportedLevel);
+
+	return passed;
+}
+
+
+static bool BenchmarkSpectrumResolution()
+{
+	const uint32_t kAnglesNum = 64;
+
+	std::vector<Conductor> conductors;
+	if (!LoadConductors("spectrum_resolution", conductors))
+		return false;
+
+	auto cosTheta = [kAnglesNum](uint32_t i) { return cosf(XM_PIDIV2 * i / (kAnglesNum - 1)) - 1e-06f; };
+
+	for (Conductor& conductor : conductors)
+	{
+		Spectrum eta(conductor.eta), k(conductor.k);
+		for (uint32_t i = 0; i < kAnglesNum; i++)
+			conductor.reference.push_back(FresnelConductorRGB(cosTheta(i), eta, k));
+	}
+
+	LogStdOut("spectrum_resolution: D65 lit Fresnel RGB of %u conductors over %u angles against the 1 nm reference\n", (uint32_t)conductors.size(),
+	          kAnglesNum);
+
+	double referenceMs = 0.0;
+	for (int resolution = kSpectralResolutionsNum - 1; resolution >= 0; resolution--)
+	{
+		DispatchSpectralResolution((ESpectralResolution)resolution, [&](auto tag) {
+			using S = std::remove_pointer_t<decltype(tag)>;
+
+			std::vector<S> etas, ks;
+			for (const Conductor& conductor : conductors)
+			{
+				etas.emplace_back(conductor.eta);
+				ks.emplace_back(conductor.k);
+			}
+
+			float maxError = 0.0f;
+			double sumError = 0.0;
+			for (size_t c = 0; c < conductors.size(); c++)
+			{
+				for (uint32_t i = 0; i < kAnglesNum; i++)
+				{
+					XMVECTOR diff = XMVectorAbs(XMVectorSubtract(FresnelConductorRGB(cosTheta(i), etas[c], ks[c]), conductors[c].reference[i]));
+					float error = std::max(XMVectorGetX(diff), std::max(XMVectorGetY(diff), XMVectorGetZ(diff)));
+					maxError = std::max(maxError, error);
+					sumError += error;
+				}
+			}
+
+			const uint32_t kCallsNum = (uint32_t)conductors.size() * kAnglesNum;
+			XMVECTOR sink = XMVectorZero();
+			double ms = MeasureMs(kCallsNum, [&](uint32_t i) {
+				uint32_t c = i / kAnglesNum;
+				sink = XMVectorAdd(sink, FresnelConductorRGB(cosTheta(i % kAnglesNum), etas[c], ks[c]));
+			});
+			if (resolution == kSpectralResolution1nm)
+				referenceMs = ms;
+
+			LogStdOut("  %-8s: %5u bytes per spectrum, %.5f ms/call (%.1fx), RGB error max %.5f mean %.6f (sink %f)\n", kSpectralResolutionNames[resolution],
+			          (uint32_t)sizeof(S), ms, referenceMs / ms, maxError, sumError / kCallsNum, XMVectorGetX(sink));
+		});
+	}
+
+	return true;
+}
+
+
+static bool BenchmarkSPDResample()
+{
+	std::vector<FilePath> files;
+	EnumerateFiles("data\\SPDs\\*.spd", files);
+	std::vector<SpectralPowerDistribution> spds;
+	for (const FilePath& file : files)
+	{
+		SpectralPowerDistribution spd;
+		if (spd.InitFromFile(file.c_str()) && spd.Size() > 0)
+			spds.push_back(std::move(spd));
+	}
+	if (spds.empty())
+	{
+		LogStdErr("spd_resample: no SPDs found\n");
+		return false;
+	}
+
+	// Batches are SPDs sharing a wavelength grid, e.g. the eta and k files of most conductors
+	std::vector<std::vector<uint32_t>> batches;
+	for (uint32_t i = 0; i < (uint32_t)spds.size(); i++)
+	{
+		auto sameGrid = [&](const std::vector<uint32_t>& batch) {
+			const SpectralPowerDistribution& first = spds[batch.front()];
+			return first.Size() == spds[i].Size() && memcmp(first.Wavelength(), spds[i].Wavelength(), first.Size() * sizeof(float)) == 0;
+		};
+		auto batch = std::find_if(batches.begin(), batches.end(), sameGrid);
+		if (batch != batches.end())
+			batch->push_back(i);
+		else
+			batches.push_back({i});
+	}
+
+	size_t entriesNum = 0;
+	for (const SpectralPowerDistribution& spd : spds)
+		entriesNum += spd.Size();
+	LogStdOut("spd_resample: %u SPDs, %u entries on average, %u distinct wavelength grids\n", (uint32_t)spds.size(), (uint32_t)(entriesNum / spds.size()),
+	          (uint32_t)batches.size());
+
+	bool passed = true;
+	for (int resolution = kSpectralResolutionsNum - 1; resolution >= 0; resolution--)
+	{
+		DispatchSpectralResolution((ESpectralResolution)resolution, [&](auto tag) {
+			using S = std::remove_pointer_t<decltype(tag)>;
+
+			// The previous resampler, every bin searches its first segment from the start of the SPD
+			auto resampleLegacy = [](const SpectralPowerDistribution& spd, S& result) {
+				for (uint32_t i = 0; i < S::kSamples; i++)
+				{
+					float lambda0 = Lerp(float(i) / S::kSamples, S::kMinWavelength, S::kMaxWavelength);
+					float lambda1 = Lerp(float(i + 1) / S::kSamples, S::kMinWavelength, S::kMaxWavelength);
+					result[i] = spd.Average(lambda0, lambda1);
+				}
+			};
+
+			auto resampleBatches = [&](std::vector<S>& results) {
+				std::vector<const float*> values;
+				std::vector<S> batchResults;
+				for (const std::vector<uint32_t>& batch : batches)
+				{
+					values.clear();
+					for (uint32_t i : batch)
+						values.push_back(spds[i].Values());
+					batchResults.resize(batch.size());
+					const SpectralPowerDistribution& first = spds[batch.front()];
+					S::Resample(first.Wavelength(), values.data(), (uint32_t)first.Size(), (uint32_t)batch.size(), batchResults.data());
+					for (size_t b = 0; b < batch.size(); b++)
+						results[batch[b]] = batchResults[b];
+				}
+			};
+
+			std::vector<S> legacy(spds.size()), sweep(spds.size()), batched(spds.size());
+			for (size_t i = 0; i < spds.size(); i++)
+			{
+				resampleLegacy(spds[i], legacy[i]);
+				sweep[i] = S(spds[i]);
+			}
+			resampleBatches(batched);
+
+			uint32_t mismatches = 0;
+			for (size_t i = 0; i < spds.size(); i++)
+			{
+				mismatches += memcmp(&legacy[i], &sweep[i], sizeof(S)) != 0;
+				mismatches += memcmp(&legacy[i], &batched[i], sizeof(S)) != 0;
+			}
+
+			const uint32_t kIterations = 8;
+			double legacyMs = MeasureMs(kIterations, [&](uint32_t) {
+				for (size_t i = 0; i < spds.size(); i++)
+					resampleLegacy(spds[i], legacy[i]);
+			});
+			double sweepMs = MeasureMs(kIterations, [&](uint32_t) {
+				for (size_t i = 0; i < spds.size(); i++)
+					sweep[i] = S(spds[i]);
+			});
+			double batchMs = MeasureMs(kIterations, [&](uint32_t) { resampleBatches(batched); });
+
+			LogStdOut("  %-8s: per-bin search %.3f ms, single sweep %.3f ms (%.1fx), batched %.3f ms (%.1fx), %u mismatches\n",
+			          kSpectralResolutionNames[resolution], legacyMs, sweepMs, legacyMs / sweepMs, batchMs, legacyMs / batchMs, mismatches);
+
+			passed &= mismatches == 0;
+		});
+	}
+
+	return passed;
+}
+
+
+// The getline + istringstream loader SpectralPowerDistribution::InitFromFile used to be
+static bool LoadSPDLegacy(const char* filename, std::vector<float>& wavelengths, std::vector<float>& values)
+{
+	auto trimString = [](const std::string& str) {
+		std::string::size_type start = str.find_first_not_of(" \t\r\n"), end = str.find_last_not_of(" \t\r\n");
+		return str.substr(start == std::string::npos ? 0 : start, end == std::string::npos ? str.length() - 1 : end - start + 1);
+	};
+
+	FilePath fullPath = "data\\SPDs";
+	fullPath /= filename;
+
+	std::ifstream fileStream(fullPath.c_str());
+	if (fileStream.bad() || fileStream.fail())
+		return false;
+
+	std::string line;
+	while (true)
+	{
+		if (!std::getline(fileStream, line))
+			break;
+		line = trimString(line);
+		if (line.length() == 0 || line[0] == '#')
+			continue;
+		std::istringstream iss(line);
+		float lambda, value;
+		if (!(iss >> lambda >> value))
+			break;
+		wavelengths.push_back(lambda);
+		values.push_back(value);
+	}
+
+	return true;
+}
+
+
+static bool BenchmarkSPDLoad()
+{
+	std::vector<FilePath> files;
+	EnumerateFiles("data\\SPDs\\*.spd", files);
+	if (files.empty())
+	{
+		LogStdErr("spd_load: no SPDs found\n");
+		return false;
+	}
+
+	uint32_t mismatches = 0;
+	size_t entriesNum = 0;
+	for (const FilePath& file : files)
+	{
+		std::vector<float> wavelengths, values;
+		bool legacyLoaded = LoadSPDLegacy(file.c_str(), wavelengths, values);
+		SpectralPowerDistribution spd;
+		bool loaded = spd.InitFromFile(file.c_str());
+		bool same = legacyLoaded == loaded && wavelengths.size() == spd.Size() && values.size() == spd.Size() &&
+		            memcmp(wavelengths.data(), spd.Wavelength(), spd.Size() * sizeof(float)) == 0 &&
+		            memcmp(values.data(), spd.Values(), spd.Size() * sizeof(float)) == 0;
+		if (!same)
+		{
+			LogStdErr("spd_load: %s parsed differently, %u entries before, %u now\n", file.c_str(), (uint32_t)values.size(), (uint32_t)spd.Size());
+			mismatches++;
+		}
+		entriesNum += spd.Size();
+	}
+
+	// malformed input has to stop the parse at the same line as before, a line of whitespace only is blank
+	const char* kMalformed = "# comment\n\n 400 1.5 trailing\r\n\t410\t+1.25\r\n\r\n420 -.5\n  \t \n430 2\n440\n450 3\n";
+	SpectralPowerDistribution malformed;
+	malformed.InitFromMemory(kMalformed, strlen(kMalformed));
+	if (malformed.Size() != 4 || malformed.Wavelength()[1] != 410.0f || malformed.Values()[1] != 1.25f || malformed.Values()[2] != -0.5f ||
+	    malformed.Wavelength()[3] != 430.0f)
+	{
+		LogStdErr("spd_load: malformed input parsed into %u entries\n", (uint32_t)malformed.Size());
+		mismatches++;
+	}
+
+	const uint32_t kIterations = 4;
+	double legacyMs = MeasureMs(kIterations, [&](uint32_t) {
+		for (const FilePath& file : files)
+		{
+			std::vector<float> wavelengths, values;
+			LoadSPDLegacy(file.c_str(), wavelengths, values);
+		}
+	});
+	double loadMs = MeasureMs(kIterations, [&](uint32_t) {
+		SpectralPowerDistribution spd;
+		for (const FilePath& file : files)
+			spd.InitFromFile(file.c_str());
+	});
+
+	LogStdOut("spd_load: %u files, %u entries\n", (uint32_t)files.size(), (uint32_t)entriesNum);
+	LogStdOut("  getline + istringstream: %.3f ms\n", legacyMs);
+	LogStdOut("  from_chars in place:     %.3f ms (%.1fx), %u mismatches\n", loadMs, legacyMs / loadMs, mismatches);
+
+	return mismatches == 0;
+}
+
+
+static bool BenchmarkSPDEval()
+{
+	std::vector<FilePath> files;
+	EnumerateFiles("data\\SPDs\\*.spd", files);
+	std::vector<SpectralPowerDistribution> spds(files.size());
+	for (size_t i = 0; i < files.size(); i++)
+		spds[i].InitFromFile(files[i].c_str());
+	if (spds.empty())
+	{
+		LogStdErr("spd_eval: no SPDs found\n");
+		return false;
+	}
+
+	// a dense sweep past both ends of every file, plus the entries themselves to hit them exactly
+	const uint32_t kSweepNum = 4096;
+	std::vector<std::vector<float>> queries(spds.size());
+	size_t queriesNum = 0, maxQueriesNum = 0;
+	for (size_t i = 0; i < spds.size(); i++)
+	{
+		for (uint32_t j = 0; j < kSweepNum; j++)
+			queries[i].push_back(Lerp((float)j / (kSweepNum - 1), 250.0f, 950.0f));
+		queries[i].insert(queries[i].end(), spds[i].Wavelength(), spds[i].Wavelength() + spds[i].Size());
+		std::sort(queries[i].begin(), queries[i].end());
+		queriesNum += queries[i].size();
+		maxQueriesNum = std::max(maxQueriesNum, queries[i].size());
+	}
+
+	// the merged pass has to match Eval() bit for bit, the slopes up to rounding
+	uint32_t mismatches = 0;
+	float maxSlopeError = 0.0f;
+	std::vector<float> expected, sorted, sloped;
+	for (size_t i = 0; i < spds.size(); i++)
+	{
+		const std::vector<float>& lambdas = queries[i];
+		expected.resize(lambdas.size());
+		sorted.resize(lambdas.size());
+		sloped.resize(lambdas.size());
+		for (size_t j = 0; j < lambdas.size(); j++)
+			expected[j] = spds[i].Eval(lambdas[j]);
+		spds[i].EvalSorted(lambdas.data(), lambdas.size(), sorted.data());
+		SpectralPowerDistribution withSlopes = spds[i];
+		withSlopes.PrecomputeSlopes();
+		withSlopes.EvalSorted(lambdas.data(), lambdas.size(), sloped.data());
+
+		if (memcmp(expected.data(), sorted.data(), expected.size() * sizeof(float)) != 0)
+		{
+			LogStdErr("spd_eval: %s evaluates differently\n", files[i].c_str());
+			mismatches++;
+		}
+		for (size_t j = 0; j < lambdas.size(); j++)
+			maxSlopeError = std::max(maxSlopeError, fabsf(sloped[j] - expected[j]) / std::max(fabsf(expected[j]), 1e-3f));
+	}
+
+	float sink = 0.0f;
+	sorted.resize(maxQueriesNum);
+	const uint32_t kIterations = 16;
+	double evalMs = MeasureMs(kIterations, [&](uint32_t) {
+		for (size_t i = 0; i < spds.size(); i++)
+		{
+			for (size_t j = 0; j < queries[i].size(); j++)
+				sorted[j] = spds[i].Eval(queries[i][j]);
+			sink += sorted[queries[i].size() / 2];
+		}
+	});
+	double sortedMs = MeasureMs(kIterations, [&](uint32_t) {
+		for (size_t i = 0; i < spds.size(); i++)
+		{
+			spds[i].EvalSorted(queries[i].data(), queries[i].size(), sorted.data());
+			sink += sorted[queries[i].size() / 2];
+		}
+	});
+	for (SpectralPowerDistribution& spd : spds)
+		spd.PrecomputeSlopes();
+	double slopesMs = MeasureMs(kIterations, [&](uint32_t) {
+		for (size_t i = 0; i < spds.size(); i++)
+		{
+			spds[i].EvalSorted(queries[i].data(), queries[i].size(), sorted.data());
+			sink += sorted[queries[i].size() / 2];
+		}
+	});
+
+	// SetValue() refreshes the slopes next to the entry, EvalSorted() interpolates the new value up to rounding
+	uint32_t staleSlopes = 0;
+	for (size_t i = 0; i < spds.size(); i++)
+	{
+		if (spds[i].Size() == 0)
+			continue;
+		spds[i].SetValue(0, spds[i][0] + 1.0f);
+		const std::vector<float>& lambdas = queries[i];
+		spds[i].EvalSorted(lambdas.data(), lambdas.size(), sorted.data());
+		bool stale = false;
+		for (size_t j = 0; j < lambdas.size(); j++)
+		{
+			float value = spds[i].Eval(lambdas[j]);
+			stale |= fabsf(sorted[j] - value) / std::max(fabsf(value), 1e-3f) >= 1e-4f;
+		}
+		staleSlopes += stale;
+	}
+
+	LogStdOut("spd_eval: %u SPDs, %u sorted queries\n", (uint32_t)spds.size(), (uint32_t)queriesNum);
+	LogStdOut("  Eval per query:      %.3f ms\n", evalMs);
+	LogStdOut("  EvalSorted:          %.3f ms (%.1fx), %u mismatches\n", sortedMs, evalMs / sortedMs, mismatches);
+	LogStdOut("  EvalSorted + slopes: %.3f ms (%.1fx), max relative error %g (sink %f)\n", slopesMs, evalMs / slopesMs, maxSlopeError, sink);
+	LogStdOut("  after a write:       %u SPDs with stale slopes\n", staleSlopes);
+
+	return mismatches == 0 && maxSlopeError < 1e-4f && staleSlopes == 0;
+}
+
+
+static bool BenchmarkSpectralArchive()
+{
+	const SpectralArchive& archive = GetSpectralArchive();
+	if (!archive.IsOpened() || archive.GetMaterialsNum() == 0)
+	{
+		LogStdErr("spectral_archive: the archive failed to open\n");
+		return false;
+	}
+
+	// the archived spectra have to match the ones resampled from the .spd files bit for bit
+	uint32_t materialsNum = archive.GetMaterialsNum();
+	uint32_t mismatches = 0;
+	for (uint32_t i = 0; i < materialsNum; i++)
+	{
+		SpectralArchive::Material material = archive.GetMaterial(i);
+		SpectralArchive::Material found;
+		Spectrum eta, k;
+		bool same = archive.Find(material.name, found) && found.eta == material.eta && LoadIOR(material.name, eta, k) &&
+		            memcmp(&eta, material.eta, sizeof(Spectrum)) == 0 && memcmp(&k, material.k, sizeof(Spectrum)) == 0;
+		if (!same)
+		{
+			LogStdErr("spectral_archive: %s differs from its .spd files\n", material.name);
+			mismatches++;
+		}
+	}
+
+	SpectralArchive reopened;
+	double openMs = MeasureMs(16, [&](uint32_t) { reopened.Open(); });
+
+	const uint32_t kIterations = 16;
+	double loadMs = MeasureMs(kIterations, [&](uint32_t i) {
+		Spectrum eta, k;
+		LoadIOR(archive.GetMaterial(i % materialsNum).name, eta, k);
+	});
+	double findMs = MeasureMs(kIterations * 1024, [&](uint32_t i) {
+		SpectralArchive::Material material;
+		archive.Find(archive.GetMaterial(i % materialsNum).name, material);
+	});
+
+	LogStdOut("spectral_archive: %u IORs\n", materialsNum);
+	LogStdOut("  open and validate:   %.3f ms\n", openMs);
+	LogStdOut("  parse + resample:    %.4f ms per IOR\n", loadMs);
+	LogStdOut("  archive lookup:      %.6f ms per IOR (%.0fx), %u mismatches\n", findMs, loadMs / findMs, mismatches);
+
+	return mismatches == 0;
+}
+
+
+static bool BenchmarkSpectralLibrary()
+{
+	const SpectralArchive& archive = GetSpectralArchive();
+	uint32_t materialsNum = archive.GetMaterialsNum();
+	if (materialsNum == 0)
+	{
+		LogStdErr("spectral_library: no IORs in the archive\n");
+		return false;
+	}
+
+	SpectralLibrary& library = GetSpectralLibrary();
+	library.Clear();
+	uint64_t hits = library.GetHits();
+	uint64_t misses = library.GetMisses();
+
+	// every thread asks for every IOR, each one has to be loaded exactly once and shared by all threads
+	const uint32_t kThreadsNum = 8;
+	std::vector<std::vector<const Spectrum*>> handles(kThreadsNum);
+	std::vector<std::thread> threads;
+	double start = GetTimeMs();
+	for (uint32_t t = 0; t < kThreadsNum; t++)
+	{
+		threads.emplace_back([&, t]() {
+			for (uint32_t i = 0; i < materialsNum; i++)
+			{
+				SpectralIOR<Spectrum> ior;
+				library.Get(archive.GetMaterial((i + t) % materialsNum).name, ior);
+				handles[t].push_back(ior.eta.get());
+			}
+		});
+	}
+	for (std::thread& thread : threads)
+		thread.join();
+	double concurrentMs = GetTimeMs() - start;
+
+	uint32_t mismatches = 0;
+	for (uint32_t t = 0; t < kThreadsNum; t++)
+	{
+		for (uint32_t i = 0; i < materialsNum; i++)
+		{
+			if (handles[t][i] == nullptr || handles[t][i] != handles[0][(i + t) % materialsNum])
+				mismatches++;
+		}
+	}
+	hits = library.GetHits() - hits;
+	misses = library.GetMisses() - misses;
+	if (misses != materialsNum || hits != (kThreadsNum - 1) * materialsNum)
+	{
+		LogStdErr("spectral_library: %u loads for %u IORs\n", (uint32_t)misses, materialsNum);
+		mismatches++;
+	}
+
+	const uint32_t kIterations = 1024;
+	double loadMs = MeasureMs(16, [&](uint32_t i) {
+		Spectrum eta, k;
+		LoadIOR(archive.GetMaterial(i % materialsNum).name, eta, k);
+	});
+	double getMs = MeasureMs(kIterations, [&](uint32_t i) {
+		SpectralIOR<Spectrum> ior;
+		library.Get(archive.GetMaterial(i % materialsNum).name, ior);
+	});
+
+	LogStdOut("spectral_library: %u IORs, %u threads\n", materialsNum, kThreadsNum);
+	LogStdOut("  concurrent first use: %.3f ms, %llu hits, %llu misses\n", concurrentMs, hits, misses);
+	LogStdOut("  parse + resample:     %.4f ms per IOR\n", loadMs);
+	LogStdOut("  library hit:          %.6f ms per IOR (%.0fx), %u mismatches\n", getMs, loadMs / getMs, mismatches);
+
+	return mismatches == 0;
+}
+
+
+static bool BenchmarkConductorDatabase()
+{
+	const SpectralArchive& archive = GetSpectralArchive();
+	const ConductorDatabase& database = GetConductorDatabase();
+	uint32_t conductorsNum = database.GetConductorsNum();
+	if (conductorsNum == 0 || conductorsNum != archive.GetMaterialsNum())
+	{
+		LogStdErr("conductor_database: %u conductors for %u IORs\n", conductorsNum, archive.GetMaterialsNum());
+		return false;
+	}
+
+	std::vector<ConductorReflectance> serial, parallel;
+	double serialMs = MeasureMs(1, [&](uint32_t) { ConductorDatabase::Bake(archive, serial, 1); });
+	double parallelMs = MeasureMs(1, [&](uint32_t) { ConductorDatabase::Bake(archive, parallel); });
+
+	// the threaded bake and the table loaded at startup have to match a serial bake bit for bit
+	uint32_t mismatches = 0;
+	float maxCurveError = 0.0f;
+	for (uint32_t i = 0; i < conductorsNum; i++)
+	{
+		const ConductorReflectance& conductor = database.GetConductor(i);
+		if (memcmp(&serial[i], &parallel[i], sizeof(ConductorReflectance)) != 0 || memcmp(&serial[i], &conductor, sizeof(ConductorReflectance)) != 0 ||
+		    database.Find(conductor.name) != &conductor)
+		{
+			LogStdErr("conductor_database: %s differs\n", conductor.name);
+			mismatches++;
+		}
+
+		// error of the interpolated curve in between its samples
+		SpectralArchive::Material material = archive.GetMaterial(i);
+		for (uint32_t j = 0; j < 256; j++)
+		{
+			float cosTheta = (j + 0.5f) / 256;
+			XMVECTOR exact = FresnelConductorRGB(cosTheta, *material.eta, *material.k);
+			XMVECTOR error = XMVectorAbs(XMVectorSubtract(conductor.Eval(cosTheta), exact));
+			maxCurveError = std::max({maxCurveError, XMVectorGetX(error), XMVectorGetY(error), XMVectorGetZ(error)});
+		}
+	}
+
+	const uint32_t kIterations = 4096;
+	XMVECTOR sink = XMVectorZero();
+	double computeMs = MeasureMs(64, [&](uint32_t i) {
+		SpectralArchive::Material material = archive.GetMaterial(i % conductorsNum);
+		sink = XMVectorAdd(sink, FresnelConductorRGB(1.0f, *material.eta, *material.k));
+	});
+	double lookupMs = MeasureMs(kIterations, [&](uint32_t i) {
+		const ConductorReflectance* conductor = database.Find(database.GetConductor(i % conductorsNum).name);
+		sink = XMVectorAdd(sink, XMLoadFloat3(&conductor->F0));
+	});
+
+	LogStdOut("conductor_database: %u conductors, %u threads\n", conductorsNum, std::max(std::thread::hardware_concurrency(), 1u));
+	LogStdOut("  bake serial:   %.3f ms\n", serialMs);
+	LogStdOut("  bake parallel: %.3f ms (%.1fx), %u mismatches\n", parallelMs, serialMs / parallelMs, mismatches);
+	LogStdOut("  spectral F0:   %.5f ms, table F0 %.6f ms (%.0fx) (sink %f)\n", computeMs, lookupMs, computeMs / lookupMs, XMVectorGetX(sink));
+	LogStdOut("  max error of the interpolated Fresnel curve: %g\n", maxCurveError);
+
+	return mismatches == 0;
+}
+
+
+static bool BenchmarkSpectrumTables()
+{
+	// VerifySpectrumTables() resamples all tables from scratch, which is what startup used to do
+	uint32_t mismatches = 0;
+	double computeMs = MeasureMs(4, [&](uint32_t) { mismatches += VerifySpectrumTables(); });
+
+	const uint32_t kIterations = 4096;
+	float sink = 0.0f;
+	double lookupMs = MeasureMs(kIterations, [&](uint32_t i) {
+		sink += GetCIE_Y<Spectrum>()[i % Spectrum::kSamples] + GetCIE_Y<Spectrum16>()[i % Spectrum16::kSamples];
+	});
+
+	LogStdOut("spectrum_tables: CIE, D65 and RGB basis tables for %u resolutions\n", 4u);
+	LogStdOut("  runtime resampling: %.3f ms, %u values differ from SpectrumTables.inl\n", computeMs, mismatches);
+	LogStdOut("  generated tables:   %.6f ms per lookup (sink %f)\n", lookupMs, sink);
+
+	return mismatches == 0;
+}
+
+
+static bool BenchmarkRGBUplifting()
+{
+	// the table of the data directory, or a coarse one fitted here
+	RGBToSpectrumTable bakedTable;
+	const RGBToSpectrumTable* table = &GetRGBToSpectrumTable();
+	double bakeMs = 0.0;
+	if (!table->IsOpened())
+	{
+		const uint32_t kBakeResolution = 32;
+		bakeMs = MeasureMs(1, [&](uint32_t) { bakedTable.Bake(kBakeResolution); });
+		table = &bakedTable;
+	}
+
+	const uint32_t kColorsNum = 4096;
+	std::vector<XMFLOAT3> colors(kColorsNum);
+	uint32_t seed = 1;
+	for (XMFLOAT3& color : colors)
+		color = {Random(seed), Random(seed), Random(seed)};
+
+	// Smits spectra round trip without an illuminant, the sigmoid ones are fitted lit by D65
+	const Spectrum& d65 = GetD65Normalized<Spectrum>();
+	float smitsError = 0.0f;
+	float sigmoidError = 0.0f;
+	for (const XMFLOAT3& color : colors)
+	{
+		float r, g, b;
+		Spectrum smits;
+		smits.FromLinearRGB(color.x, color.y, color.z, Spectrum::kReflectance, Spectrum::kSmitsUplifting);
+		smits.ToLinearRGB(r, g, b);
+		smitsError = std::max({smitsError, fabsf(r - color.x), fabsf(g - color.y), fabsf(b - color.z)});
+
+		Spectrum sigmoid = table->Lookup(color.x, color.y, color.z).ToSpectrum<Spectrum>() * d65;
+		sigmoid.ToLinearRGB(r, g, b);
+		sigmoidError = std::max({sigmoidError, fabsf(r - color.x), fabsf(g - color.y), fabsf(b - color.z)});
+	}
+
+	float sink = 0.0f;
+	double smitsMs = MeasureMs(kColorsNum, [&](uint32_t i) {
+		Spectrum spectrum;
+		spectrum.FromLinearRGB(colors[i].x, colors[i].y, colors[i].z, Spectrum::kReflectance, Spectrum::kSmitsUplifting);
+		sink += spectrum[i % kSpectrumSamples];
+	});
+	double sigmoidMs = MeasureMs(kColorsNum, [&](uint32_t i) {
+		Spectrum spectrum = table->Lookup(colors[i].x, colors[i].y, colors[i].z).ToSpectrum<Spectrum>();
+		sink += spectrum[i % kSpectrumSamples];
+	});
+	double sigmoid16Ms = MeasureMs(kColorsNum, [&](uint32_t i) {
+		Spectrum16 spectrum = table->Lookup(colors[i].x, colors[i].y, colors[i].z).ToSpectrum<Spectrum16>();
+		sink += spectrum[i % Spectrum16::kSamples];
+	});
+	double lookupMs = MeasureMs(kColorsNum, [&](uint32_t i) {
+		sink += table->Lookup(colors[i].x, colors[i].y, colors[i].z).Eval(kSpectrumMinWavelength + i % kSpectrumSamples);
+	});
+
+	LogStdOut("rgb_uplifting: %u random reflectances, %u^3 sigmoid table\n", kColorsNum, table->GetResolution());
+	if (bakeMs > 0.0)
+		LogStdOut("  fit (no table in data):  %.1f ms\n", bakeMs);
+	LogStdOut("  Smits, 1 nm:             %.5f ms, max RGB round trip error %g\n", smitsMs, smitsError);
+	LogStdOut("  sigmoid, 1 nm:           %.5f ms (%.1fx), max RGB round trip error %g\n", sigmoidMs, smitsMs / sigmoidMs, sigmoidError);
+	LogStdOut("  sigmoid, 16 bins:        %.5f ms (%.1fx)\n", sigmoid16Ms, smitsMs / sigmoid16Ms);
+	LogStdOut("  sigmoid, one wavelength: %.6f ms (%.0fx) (sink %f)\n", lookupMs, smitsMs / lookupMs, sink);
+
+	return sigmoidError < 0.01f;
+}
+
+
+static bool BenchmarkHeroWavelength()
+{
+	const uint32_t kAnglesNum = 16;
+	const uint32_t kSampleCounts[] = {1, 4, 16, 64, 256};
+
+	std::vector<Conductor> conductors;
+	if (!LoadConductors("hero_wavelength", conductors))
+		return false;
+	for (Conductor& conductor : conductors)
+		conductor.reference.resize(kAnglesNum);
+
+	auto cosTheta = [kAnglesNum](uint32_t i) { return cosf(XM_PIDIV2 * i / (kAnglesNum - 1)) - 1e-06f; };
+
+	XMVECTOR sink = XMVectorZero();
+	double spectrumMs = MeasureMs(1, [&](uint32_t) {
+		for (Conductor& conductor : conductors)
+		{
+			Spectrum eta(conductor.eta), k(conductor.k);
+			for (uint32_t i = 0; i < kAnglesNum; i++)
+				conductor.reference[i] = FresnelConductorRGB(cosTheta(i), eta, k);
+		}
+	});
+	double spectrum16Ms = MeasureMs(1, [&](uint32_t) {
+		for (const Conductor& conductor : conductors)
+		{
+			Spectrum16 eta(conductor.eta), k(conductor.k);
+			for (uint32_t i = 0; i < kAnglesNum; i++)
+				sink = XMVectorAdd(sink, FresnelConductorRGB(cosTheta(i), eta, k));
+		}
+	});
+	uint32_t estimatesNum = (uint32_t)conductors.size() * kAnglesNum;
+
+	LogStdOut("hero_wavelength: D65 lit Fresnel RGB of %u conductors over %u angles against the 1 nm reference\n", (uint32_t)conductors.size(),
+	          kAnglesNum);
+	LogStdOut("  full spectrum, 1 nm:   %.5f ms per estimate\n", spectrumMs / estimatesNum);
+	LogStdOut("  full spectrum, 16 bins: %.5f ms per estimate\n", spectrum16Ms / estimatesNum);
+
+	// RMS error of the RGB average over samplesNum stratified hero samples
+	bool converged = true;
+	auto converge = [&](auto packet, const char* name) {
+		using P = decltype(packet);
+		for (uint32_t samplesNum : kSampleCounts)
+		{
+			uint32_t seed = 1;
+
+			double sumError2 = 0.0;
+			double ms = MeasureMs(1, [&](uint32_t) {
+				for (const Conductor& conductor : conductors)
+				{
+					for (uint32_t i = 0; i < kAnglesNum; i++)
+					{
+						XMVECTOR estimate = XMVectorZero();
+						for (uint32_t s = 0; s < samplesNum; s++)
+						{
+							SampledWavelengths<P> wavelengths = SampledWavelengths<P>::Sample((s + Random(seed)) / samplesNum);
+							estimate = XMVectorAdd(estimate, FresnelConductorRGB(cosTheta(i), conductor.eta, conductor.k, wavelengths));
+						}
+						XMVECTOR error = XMVectorSubtract(XMVectorScale(estimate, 1.0f / samplesNum), conductor.reference[i]);
+						error = XMVectorMultiply(error, error);
+						sumError2 += XMVectorGetX(error) + XMVectorGetY(error) + XMVectorGetZ(error);
+					}
+				}
+			});
+			double rmsError = sqrt(sumError2 / (3.0 * estimatesNum));
+			LogStdOut("  %s x %3u samples: %.5f ms per estimate, RGB RMS error %.5f\n", name, samplesNum, ms / estimatesNum, rmsError);
+			if (samplesNum == kSampleCounts[_countof(kSampleCounts) - 1])
+				converged = converged && rmsError < 0.01;
+		}
+	};
+	converge(0.0f, "1 lane ");
+#if SIMD_X64 || SIMD_NEON
+	converge(Float4(), "4 lanes");
+#endif
+#if SIMD_X64
+	if (GetSupportedSimdLevel() >= kSimd256)
+		converge(Float8(), "8 lanes");
+#endif
+	LogStdOut("  (sink %f)\n", XMVectorGetX(sink));
+
+	return converged;
+}
+
+
+static bool BenchmarkThinFilm()
+{
+	const float kThicknessesNm[] = {0.0f, 100.0f, 250.0f, 500.0f, 1000.0f};
+	const float kFilmIOR = 1.5f;
+	const uint32_t kAnglesNum = 16;
+
+	// error budget per channel of linear reflectance, about what the sensitivity fits alone cost on a bare conductor
+	const float kMaxErrorBudget = 1.0f / 16.0f;
+	// two steps of an 8 bit channel
+	const float kMeanErrorBudget = 1.0f / 128.0f;
+
+	std::vector<Conductor> conductors;
+	if (!LoadConductors("thin_film", conductors))
+		return false;
+
+	// the 1 nm spectra of the Airy sum and the quadrature nodes of the closed form
+	std::vector<Spectrum> etas, ks;
+	std::vector<ThinFilmBase> bases;
+	for (const Conductor& conductor : conductors)
+	{
+		etas.emplace_back(conductor.eta);
+		ks.emplace_back(conductor.k);
+		bases.push_back(ThinFilmBase::FromSpectra(conductor.eta, conductor.k));
+	}
+	// an absorption edge inside the lobes, outside of the regime of the closed form, see FresnelThinFilmRGB()
+	auto colored = [&](size_t c) { return strcmp(conductors[c].name, "Au") == 0 || strcmp(conductors[c].name, "Cu") == 0; };
+
+	auto cosTheta = [kAnglesNum](uint32_t i) { return cosf(XM_PIDIV2 * i / (kAnglesNum - 1)) - 1e-06f; };
+	auto reference = [&](float cosThetaI, float thicknessNm, size_t c) {
+		Spectrum spectrum = FresnelThinFilmSpectral(cosThetaI, kFilmIOR, thicknessNm, etas[c], ks[c]) * GetD65Normalized<Spectrum>();
+		XMFLOAT3 color;
+		spectrum.ToLinearRGB(color.x, color.y, color.z);
+		return XMLoadFloat3(&color);
+	};
+
+	// without a film the Airy sum has to reduce to the bare conductor, and the closed form to the bare conductor up to the fits of the sensitivities
+	float bareError = 0.0f;
+	float bareRGBError = 0.0f;
+	for (size_t c = 0; c < conductors.size(); c++)
+	{
+		for (uint32_t i = 0; i < kAnglesNum; i++)
+		{
+			Spectrum bare = FresnelConductorExact(cosTheta(i), etas[c], ks[c]);
+			Spectrum film = FresnelThinFilmSpectral(cosTheta(i), kFilmIOR, 0.0f, etas[c], ks[c]);
+			for (uint32_t j = 0; j < kSpectrumSamples; j++)
+				bareError = std::max(bareError, fabsf(bare[j] - film[j]));
+
+			XMVECTOR bareRGB = FresnelConductorRGB(cosTheta(i), etas[c], ks[c]);
+			XMVECTOR error = XMVectorAbs(XMVectorSubtract(FresnelThinFilmRGB(cosTheta(i), kFilmIOR, 0.0f, bases[c]), bareRGB));
+			bareRGBError = std::max({bareRGBError, XMVectorGetX(error), XMVectorGetY(error), XMVectorGetZ(error)});
+		}
+	}
+
+	LogStdOut("thin_film: %u conductors under a film of IOR %.2f over %u angles, closed form against the 1 nm Airy sum\n",
+	          (uint32_t)conductors.size(), kFilmIOR, kAnglesNum);
+	LogStdOut("  no film against the bare conductor: max error %g, closed form against the bare conductor RGB: max error %.4f\n", bareError, bareRGBError);
+	float sweepMaxError = 0.0f;
+	double sweepSumError = 0.0;
+	float regimeMaxError = 0.0f;
+	double regimeSumError = 0.0;
+	uint32_t regimeSamplesNum = 0;
+	for (float thicknessNm : kThicknessesNm)
+	{
+		float maxError = 0.0f;
+		double sumError = 0.0;
+		for (size_t c = 0; c < conductors.size(); c++)
+		{
+			for (uint32_t i = 0; i < kAnglesNum; i++)
+			{
+				XMVECTOR closedForm = FresnelThinFilmRGB(cosTheta(i), kFilmIOR, thicknessNm, bases[c]);
+				XMVECTOR error = XMVectorAbs(XMVectorSubtract(closedForm, reference(cosTheta(i), thicknessNm, c)));
+				float channelMaxError = std::max({XMVectorGetX(error), XMVectorGetY(error), XMVectorGetZ(error)});
+				float channelSumError = XMVectorGetX(error) + XMVectorGetY(error) + XMVectorGetZ(error);
+				maxError = std::max(maxError, channelMaxError);
+				sumError += channelSumError;
+
+				// up to 60 degrees, the truncated orders matter at grazing angles
+				if (!colored(c) && 90.0f * i / (kAnglesNum - 1) <= 60.0f)
+				{
+					regimeMaxError = std::max(regimeMaxError, channelMaxError);
+					regimeSumError += channelSumError;
+					regimeSamplesNum++;
+				}
+			}
+		}
+		LogStdOut("  %4.0f nm: RGB error max %.4f mean %.5f\n", thicknessNm, maxError, sumError / (3.0 * conductors.size() * kAnglesNum));
+		sweepMaxError = std::max(sweepMaxError, maxError);
+		sweepSumError += sumError;
+	}
+	// the closed form tracks the color of the film, not every fringe of the spectrum
+	float sweepMeanError = (float)(sweepSumError / (3.0 * conductors.size() * kAnglesNum * _countof(kThicknessesNm)));
+	float regimeMeanError = regimeSamplesNum ? (float)(regimeSumError / (3.0 * regimeSamplesNum)) : 0.0f;
+	LogStdOut("  sweep: RGB error max %.4f mean %.5f\n", sweepMaxError, sweepMeanError);
+	LogStdOut("  sweep without Au, Cu and grazing angles: RGB error max %.4f mean %.5f, budget %.4f and %.5f\n", regimeMaxError, regimeMeanError,
+	          kMaxErrorBudget, kMeanErrorBudget);
+
+	const uint32_t kIterations = 4096;
+	XMVECTOR sink = XMVectorZero();
+	auto conductor = [&](uint32_t i) { return i % conductors.size(); };
+	double referenceMs = MeasureMs(64, [&](uint32_t i) { sink = XMVectorAdd(sink, reference(cosTheta(i % kAnglesNum), 250.0f, conductor(i))); });
+	double bareMs = MeasureMs(64, [&](uint32_t i) {
+		sink = XMVectorAdd(sink, FresnelConductorRGB(cosTheta(i % kAnglesNum), etas[conductor(i)], ks[conductor(i)]));
+	});
+	double closedFormMs = MeasureMs(kIterations, [&](uint32_t i) {
+		sink = XMVectorAdd(sink, FresnelThinFilmRGB(cosTheta(i % kAnglesNum), kFilmIOR, 250.0f, bases[conductor(i)]));
+	});
+
+	LogStdOut("  1 nm Airy sum:            %.5f ms\n", referenceMs);
+	LogStdOut("  bare conductor RGB, 1 nm: %.5f ms\n", bareMs);
+	LogStdOut("  closed form:              %.6f ms (%.0fx the Airy sum) (sink %f)\n", closedFormMs, referenceMs / closedFormMs, XMVectorGetX(sink));
+
+	// inside the regime of the closed form the budget holds, outside of it the error is bounded so that it can't grow unnoticed
+	bool regimeValid = regimeMaxError < kMaxErrorBudget && regimeMeanError < kMeanErrorBudget;
+	bool sweepValid = sweepMaxError < 3.0f * kMaxErrorBudget && sweepMeanError < 1.5f * kMeanErrorBudget;
+	return bareError < 1e-4f && bareRGBError < kMaxErrorBudget && regimeValid && sweepValid;
+}
+
+
+// Synthetic MERL BRDF for machines without the database, every 97th sample is missing like below the horizon in measured files
+static bool WriteSyntheticMERL(const char* filename)
+{
+	File file(filename, File::kOpenWrite);
+	if (!file.IsOpened())
+		return false;
+
+	const int32_t dims[3] = {MERLMaterial::kThetaHalfRes, MERLMaterial::kThetaDiffRes, MERLMaterial::kPhiDiffRes};
+	std::vector<double> samples(MERLMaterial::kChannelsNum * MERLMaterial::kSamplesNum);
+	for (uint32_t i = 0; i < (uint32_t)samples.size(); i++)
+	{
+		uint32_t thetaHalf = i % MERLMaterial::kSamplesNum / (MERLMaterial::kThetaDiffRes * MERLMaterial::kPhiDiffRes);
+		samples[i] = i % 97 == 0 ? -1.0 : 1500.0 * (0.05 + 4.0 * exp(-0.1 * thetaHalf)) * (1.0 + 0.1 * (i / MERLMaterial::kSamplesNum));
+	}
+
+	uint32_t samplesSize = (uint32_t)(samples.size() * sizeof(double));
+	return file.Write(dims, sizeof(dims)) == sizeof(dims) && file.Write(samples.data(), samplesSize) == samplesSize;
+}
+
+
+static const char* kSyntheticMERLPath = "merl_bench.binary";
+
+
+// First BRDF of data\MERL, or a synthetic one written to kSyntheticMERLPath
+static bool FindBenchmarkMERL(FilePath& path)
+{
+	std::vector<FilePath> files;
+	EnumerateFiles("data\\MERL\\*.binary", files);
+	if (!files.empty())
+	{
+		path = "data\\MERL";
+		path /= files[0];
+		return true;
+	}
+
+	path = kSyntheticMERLPath;
+	if (WriteSyntheticMERL(kSyntheticMERLPath))
+		return true;
+
+	LogStdErr("Failed to write '%s'\n", kSyntheticMERLPath);
+	return false;
+}
+
+
+static bool BenchmarkMERLLoad()
+{
+	FilePath path;
+	if (!FindBenchmarkMERL(path))
+		return false;
+
+	const uint32_t kValuesNum = MERLMaterial::kChannelsNum * MERLMaterial::kSamplesNum;
+
+	// the disabled loader read every double into one buffer and narrowed them into a second one, merl.h scaled them
+	std::vector<float> legacy;
+	double legacyMs = MeasureMs(4, [&](uint32_t) {
+		File file(path.c_str(), File::kOpenRead);
+		int32_t dims[3];
+		file.Read(dims, sizeof(dims));
+		std::vector<double> samples(kValuesNum);
+		file.Read(samples.data(), kValuesNum * sizeof(double));
+		legacy.resize(kValuesNum);
+		for (uint32_t i = 0; i < kValuesNum; i++)
+			legacy[i] = (float)samples[i];
+	});
+
+	MERLMaterial material;
+	double loadMs = MeasureMs(16, [&](uint32_t) { material.Load(path.c_str()); });
+	if (!material.IsLoaded())
+	{
+		LogStdErr("merl_load: failed to load '%s'\n", path.c_str());
+		return false;
+	}
+
+	// the mapped samples are the ones the old loader read
+	uint32_t rawMismatches = 0;
+	for (uint32_t i = 0; i < kValuesNum; i++)
+		rawMismatches += (float)material.GetChannel(i / MERLMaterial::kSamplesNum)[i % MERLMaterial::kSamplesNum] != legacy[i];
+
+	// the conversions scale and clamp them for the CPU consumers
+	std::vector<float> scaled(kValuesNum);
+	for (uint32_t c = 0; c < MERLMaterial::kChannelsNum; c++)
+		for (uint32_t i = 0; i < MERLMaterial::kSamplesNum; i++)
+			scaled[c * MERLMaterial::kSamplesNum + i] = (float)std::max(material.GetChannel(c)[i] * MERLMaterial::kChannelScales[c], 0.0);
+
+	// random lookups only fault in the pages they land on
+	const uint32_t kLookupsNum = 4096;
+	float lookupSink = 0.0f;
+	uint32_t lookupMismatches = 0;
+	double lookupMs = MeasureMs(1, [&](uint32_t) {
+		for (uint32_t i = 0; i < kLookupsNum; i++)
+		{
+			uint32_t index = (i * 2654435761u) % MERLMaterial::kSamplesNum;
+			uint32_t channel = i % MERLMaterial::kChannelsNum;
+			float value = material.GetValue(channel, index);
+			lookupMismatches += value != scaled[channel * MERLMaterial::kSamplesNum + index];
+			lookupSink += value;
+		}
+	});
+
+	std::vector<float> values(kValuesNum);
+	double floatMs = MeasureMs(4, [&](uint32_t) { material.ConvertToFloat(values.data(), 1); });
+	double floatThreadedMs = MeasureMs(4, [&](uint32_t) { material.ConvertToFloat(values.data()); });
+	uint32_t floatMismatches = 0;
+	for (uint32_t i = 0; i < kValuesNum; i++)
+		floatMismatches += memcmp(&values[i], &scaled[i], sizeof(float)) != 0;
+
+	std::vector<uint16_t> halfs(kValuesNum);
+	double halfMs = MeasureMs(4, [&](uint32_t) { material.ConvertToHalf(halfs.data()); });
+	float halfError = 0.0f;
+	for (uint32_t i = 0; i < kValuesNum; i++)
+		halfError = std::max(halfError, fabsf(PackedVector::XMConvertHalfToFloat(halfs[i]) - scaled[i]) / std::max(scaled[i], 1e-3f));
+
+	material.Close();
+	if (path == kSyntheticMERLPath)
+		remove(kSyntheticMERLPath);
+
+	LogStdOut("merl_load: %s, %u samples per channel\n", path.c_str(), MERLMaterial::kSamplesNum);
+	LogStdOut("  read + narrow:        %.3f ms\n", legacyMs);
+	LogStdOut("  map + header:         %.4f ms (%.0fx), %u raw mismatches\n", loadMs, legacyMs / loadMs, rawMismatches);
+	LogStdOut("  %u lookups:         %.4f ms, %u mismatches (sink %f)\n", kLookupsNum, lookupMs, lookupMismatches, lookupSink);
+	LogStdOut("  to float, 1 thread:   %.3f ms, %u mismatches\n", floatMs, floatMismatches);
+	LogStdOut("  to float, threaded:   %.3f ms\n", floatThreadedMs);
+	LogStdOut("  to half, threaded:    %.3f ms, max rel error %g\n", halfMs, halfError);
+
+	return rawMismatches == 0 && lookupMismatches == 0 && floatMismatches == 0 && halfError < 1e-3f;
+}
+
+
+static bool BenchmarkMERLCompact()
+{
+	FilePath path;
+	MERLMaterial material;
+	if (!FindBenchmarkMERL(path) || !material.Load(path.c_str()))
+		return false;
+
+	const char* kCompactPath = "merl_bench.merlc";
+	const uint32_t kValuesNum = MERLMaterial::kChannelsNum * MERLMaterial::kSamplesNum;
+	const float kMaxErrors[kMERLEncodingsNum] = {1e-3f, 1e-2f};
+	const uint32_t kLookupsNum = 1 << 20;
+	auto lookupIndex = [](uint32_t i) { return (i * 2654435761u) % MERLMaterial::kSamplesNum; };
+
+	float sink = 0.0f;
+	double floatLookupMs = MeasureMs(1, [&](uint32_t) {
+		for (uint32_t i = 0; i < kLookupsNum; i++)
+			sink += material.GetValue(i % MERLMaterial::kChannelsNum, lookupIndex(i));
+	});
+
+	LogStdOut("merl_compact: %s, %.2f MB as float\n", path.c_str(), kValuesNum * sizeof(float) / (1024.0 * 1024.0));
+	LogStdOut("  mapped doubles: %u lookups %.3f ms\n", kLookupsNum, floatLookupMs);
+
+	bool passed = true;
+	std::vector<float> decoded(kValuesNum);
+	for (uint32_t encoding = 0; encoding < kMERLEncodingsNum; encoding++)
+	{
+		CompactMERLMaterial compact;
+		double encodeMs = MeasureMs(1, [&](uint32_t) { compact.Encode(material, (EMERLEncoding)encoding); });
+		MERLEncodingError error = compact.ComputeError(material);
+		double decodeMs = MeasureMs(4, [&](uint32_t) { compact.Decode(decoded.data()); });
+		double lookupMs = MeasureMs(1, [&](uint32_t) {
+			for (uint32_t i = 0; i < kLookupsNum; i++)
+				sink += compact.GetValue(i % MERLMaterial::kChannelsNum, lookupIndex(i));
+		});
+
+		// the saved file maps back to the same values
+		CompactMERLMaterial loaded;
+		uint32_t mismatches = 0;
+		if (compact.Save(kCompactPath) && loaded.Load(kCompactPath))
+		{
+			for (uint32_t i = 0; i < kValuesNum; i++)
+			{
+				float value = loaded.GetValue(i / MERLMaterial::kSamplesNum, i % MERLMaterial::kSamplesNum);
+				mismatches += memcmp(&value, &decoded[i], sizeof(float)) != 0;
+			}
+		}
+		else
+		{
+			mismatches = kValuesNum;
+		}
+		loaded.Close();
+		remove(kCompactPath);
+
+		LogStdOut("  %-8s: %.2f MB, encode %.2f ms, decode %.2f ms, %u lookups %.3f ms\n", kMERLEncodingNames[encoding], compact.GetSize() / (1024.0 * 1024.0),
+		          encodeMs, decodeMs, kLookupsNum, lookupMs);
+		LogStdOut("            relative error max %.5f mean %.6f, absolute error max %g, %u mismatches once loaded\n", error.maxRelative, error.meanRelative,
+		          error.maxAbsolute, mismatches);
+		passed &= error.maxRelative < kMaxErrors[encoding] && error.maxAbsolute < kMERLRelativeErrorThreshold && mismatches == 0;
+	}
+	LogStdOut("  (sink %f)\n", sink);
+
+	material.Close();
+	if (path == kSyntheticMERLPath)
+		remove(kSyntheticMERLPath);
+	return passed;
+}
+
+
+// Material whose every channel holds the sample index, so evaluations tell which bin they read
+struct MERLIndexMaterial
+{
+	float GetValue(uint32_t, uint32_t index) const { return (float)index; }
+};
+
+
+static bool BenchmarkMERLEval()
+{
+	FilePath path;
+	MERLMaterial material;
+	if (!FindBenchmarkMERL(path) || !material.Load(path.c_str()))
+		return false;
+
+	MERLEvaluator evaluator;
+	double initMs = MeasureMs(1, [&](uint32_t) { evaluator.Init(material); });
+	material.Close();
+	if (path == kSyntheticMERLPath)
+		remove(kSyntheticMERLPath);
+
+	MERLEvaluator indexEvaluator;
+	indexEvaluator.Init(MERLIndexMaterial());
+
+	// uniform directions over the upper hemisphere
+	const uint32_t kDirectionsNum = 1 << 18;
+	uint32_t seed = 1;
+	std::vector<float> planes[6];
+	for (std::vector<float>& plane : planes)
+		plane.resize(kDirectionsNum);
+	for (uint32_t i = 0; i < kDirectionsNum; i++)
+	{
+		for (uint32_t d = 0; d < 2; d++)
+		{
+			float z = Random(seed);
+			float r = sqrtf(std::max(1.0f - z * z, 0.0f));
+			float phi = 2.0f * XM_PI * Random(seed);
+			planes[d * 3 + 0][i] = r * cosf(phi);
+			planes[d * 3 + 1][i] = r * sinf(phi);
+			planes[d * 3 + 2][i] = z;
+		}
+	}
+	MERLDirections toLight = {planes[0].data(), planes[1].data(), planes[2].data()};
+	MERLDirections toViewer = {planes[3].data(), planes[4].data(), planes[5].data()};
+
+	std::vector<XMFLOAT3> reference(kDirectionsNum);
+	double referenceMs = MeasureMs(4, [&](uint32_t) {
+		for (uint32_t i = 0; i < kDirectionsNum; i++)
+			reference[i] = indexEvaluator.EvalReference({toLight.x[i], toLight.y[i], toLight.z[i]}, {toViewer.x[i], toViewer.y[i], toViewer.z[i]});
+	});
+
+	LogStdOut("merl_eval: %s, %u direction pairs, interleaved table built in %.2f ms\n", path.c_str(), kDirectionsNum, initMs);
+	LogStdOut("  reference:  %.3f ms\n", referenceMs);
+
+	// the polynomial arc cosines move a few angles over a bin boundary, those read a neighbour bin
+	const float kMaxMismatchRate = 1e-3f;
+	bool passed = true;
+	std::vector<float> rgb[3];
+	for (std::vector<float>& channel : rgb)
+		channel.resize(kDirectionsNum);
+	ESimdLevel supportedLevel = GetSupportedSimdLevel();
+	for (uint32_t level = 0; level <= supportedLevel; level++)
+	{
+		SetSimdLevel((ESimdLevel)level);
+		double evalMs = MeasureMs(4, [&](uint32_t) { evaluator.Eval(toLight, toViewer, kDirectionsNum, rgb[0].data(), rgb[1].data(), rgb[2].data()); });
+
+		indexEvaluator.Eval(toLight, toViewer, kDirectionsNum, rgb[0].data(), rgb[1].data(), rgb[2].data());
+		uint32_t mismatches = 0;
+		for (uint32_t i = 0; i < kDirectionsNum; i++)
+			mismatches += rgb[0][i] != reference[i].x;
+
+		float mismatchRate = (float)mismatches / kDirectionsNum;
+		LogStdOut("  %-10s: %.3f ms (%.1fx), %u bin mismatches (%.4f%%)\n", GetSimdLevelName((ESimdLevel)level), evalMs, referenceMs / evalMs, mismatches,
+		          mismatchRate * 100.0f);
+		passed &= mismatchRate < kMaxMismatchRate;
+	}
+	SetSimdLevel(supportedLevel);
+
+	evaluator.Release();
+	indexEvaluator.Release();
+	return passed;
+}
+
+
+static bool BenchmarkMERLSampling()
+{
+	FilePath path;
+	MERLMaterial material;
+	if (!FindBenchmarkMERL(path) || !material.Load(path.c_str()))
+		return false;
+
+	MERLEvaluator evaluator;
+	evaluator.Init(material);
+	material.Close();
+	if (path == kSyntheticMERLPath)
+		remove(kSyntheticMERLPath);
+
+	MERLSampler built;
+	double buildMs = MeasureMs(1, [&](uint32_t) { built.Build(evaluator); });
+
+	// the saved tables map back to the same ones
+	const char* kSamplerPath = "merl_bench.merls";
+	MERLSampler sampler;
+	if (!built.Save(kSamplerPath) || !sampler.Load(kSamplerPath))
+	{
+		remove(kSamplerPath);
+		return false;
+	}
+	built.Close();
+
+	LogStdOut("merl_sampling: %s, %ux%ux%u tables built in %.2f ms\n", path.c_str(), MERLSampler::kViewBinsNum, MERLSampler::kThetaHalfBinsNum,
+	          MERLSampler::kPhiHalfBinsNum, buildMs);
+
+	uint32_t seed = 1;
+	auto luminance = [](const XMFLOAT3& rgb) { return 0.2126f * rgb.x + 0.7152f * rgb.y + 0.0722f * rgb.z; };
+
+	// albedo of the BRDF under a white environment, estimated with both strategies at the same sample count
+	const uint32_t kSamplesNum = 16;
+	const uint32_t kEstimatesNum = 4096;
+	const float kViewAngles[] = {0.0f, 30.0f, 60.0f, 80.0f};
+	bool passed = true;
+	for (float viewAngle : kViewAngles)
+	{
+		float theta = XMConvertToRadians(viewAngle);
+		// an arbitrary azimuth, the tables are relative to it
+		const float kPhi = 0.7f;
+		XMFLOAT3 toViewer = {sinf(theta) * cosf(kPhi), sinf(theta) * sinf(kPhi), cosf(theta)};
+
+		double sums[2] = {};
+		double squareSums[2] = {};
+		double sampleMs[2];
+		for (uint32_t strategy = 0; strategy < 2; strategy++)
+		{
+			sampleMs[strategy] = MeasureMs(1, [&](uint32_t) {
+				for (uint32_t e = 0; e < kEstimatesNum; e++)
+				{
+					double estimate = 0.0;
+					for (uint32_t s = 0; s < kSamplesNum; s++)
+					{
+						float u0 = Random(seed);
+						float u1 = Random(seed);
+						MERLSample sample;
+						if (strategy == 0)
+						{
+							float r = sqrtf(u1);
+							sample.toLight = {r * cosf(2.0f * XM_PI * u0), r * sinf(2.0f * XM_PI * u0), sqrtf(1.0f - u1)};
+							sample.pdf = sample.toLight.z / XM_PI;
+						}
+						else
+						{
+							sample = sampler.Sample(toViewer, u0, u1);
+						}
+						if (sample.pdf > 0.0f)
+							estimate += luminance(evaluator.EvalReference(sample.toLight, toViewer)) / sample.pdf;
+					}
+					estimate /= kSamplesNum;
+					sums[strategy] += estimate;
+					squareSums[strategy] += estimate * estimate;
+				}
+			});
+		}
+
+		double means[2];
+		double variances[2];
+		for (uint32_t strategy = 0; strategy < 2; strategy++)
+		{
+			means[strategy] = sums[strategy] / kEstimatesNum;
+			variances[strategy] = std::max(squareSums[strategy] / kEstimatesNum - means[strategy] * means[strategy], 0.0);
+		}
+
+		// both estimators are unbiased, so the means agree within a few standard errors
+		double standardError = sqrt((variances[0] + variances[1]) / kEstimatesNum);
+		bool agree = fabs(means[0] - means[1]) < 5.0 * standardError + 1e-4 * means[0];
+		LogStdOut("  view %2.0f deg, %u spp: albedo cosine %.4f tables %.4f, variance cosine %.3g (%.2f ms) tables %.3g (%.2f ms), %.1fx lower\n", viewAngle,
+		          kSamplesNum, means[0], means[1], variances[0], sampleMs[0], variances[1], sampleMs[1], variances[0] / std::max(variances[1], 1e-30));
+		passed &= agree && variances[1] < variances[0];
+	}
+
+	sampler.Close();
+	remove(kSamplerPath);
+	evaluator.Release();
+	return passed;
+}
+
+
+static bool BenchmarkMERLFit()
+{
+	// sample centers map back to their own sample. Below theta_h sample 3 phi_diff is dropped or lost to the cancellation of the float Gram-Schmidt
+	uint32_t indexMismatches = 0;
+	for (uint32_t i = 3 * MERLMaterial::kThetaDiffRes * MERLMaterial::kPhiDiffRes; i < MERLMaterial::kSamplesNum; i++)
+	{
+		XMFLOAT3 toLight, toViewer;
+		GetMERLSampleDirections(i, toLight, toViewer);
+		indexMismatches += MERLEvaluator::GetIndexReference(toLight, toViewer) != i;
+	}
+
+	// a table made of the model itself has to give its parameters back
+	GGXParameters expected;
+	expected.roughness = 0.15f;
+	expected.F0 = {0.9f, 0.6f, 0.3f};
+	expected.albedo = {0.05f, 0.1f, 0.2f};
+	const char* kGGXPath = "merl_ggx.binary";
+	{
+		const int32_t dims[3] = {MERLMaterial::kThetaHalfRes, MERLMaterial::kThetaDiffRes, MERLMaterial::kPhiDiffRes};
+		std::vector<double> samples(MERLMaterial::kChannelsNum * MERLMaterial::kSamplesNum, -1.0);
+		for (uint32_t i = 0; i < MERLMaterial::kSamplesNum; i++)
+		{
+			XMFLOAT3 toLight, toViewer;
+			GetMERLSampleDirections(i, toLight, toViewer);
+			if (toLight.z <= 0.0f || toViewer.z <= 0.0f)
+				continue;
+
+			XMFLOAT3 value = EvalGGX(expected, toLight, toViewer);
+			samples[i] = value.x / toLight.z / MERLMaterial::kChannelScales[0];
+			samples[MERLMaterial::kSamplesNum + i] = value.y / toLight.z / MERLMaterial::kChannelScales[1];
+			samples[2 * MERLMaterial::kSamplesNum + i] = value.z / toLight.z / MERLMaterial::kChannelScales[2];
+		}
+
+		File file(kGGXPath, File::kOpenWrite);
+		uint32_t samplesSize = (uint32_t)(samples.size() * sizeof(double));
+		if (file.Write(dims, sizeof(dims)) != sizeof(dims) || file.Write(samples.data(), samplesSize) != samplesSize)
+			return false;
+	}
+
+	MERLMaterial material;
+	GGXParameters fitted;
+	GGXFitError fitError;
+	bool fittedGGX = material.Load(kGGXPath) && FitGGX(material, fitted, fitError);
+	double fitMs = MeasureMs(1, [&](uint32_t) { fittedGGX &= FitGGX(material, fitted, fitError); });
+	material.Close();
+	remove(kGGXPath);
+
+	float parameterError = fabsf(fitted.roughness - expected.roughness);
+	parameterError = std::max({parameterError, fabsf(fitted.F0.x - expected.F0.x), fabsf(fitted.F0.y - expected.F0.y), fabsf(fitted.F0.z - expected.F0.z)});
+	parameterError = std::max({parameterError, fabsf(fitted.albedo.x - expected.albedo.x), fabsf(fitted.albedo.y - expected.albedo.y),
+	                           fabsf(fitted.albedo.z - expected.albedo.z)});
+
+	LogStdOut("merl_fit: Levenberg-Marquardt fit of GGX + Smith joint + Schlick + Lambert\n");
+	LogStdOut("  sample centers back to their index: %u mismatches\n", indexMismatches);
+	LogStdOut("  GGX table: roughness %.4f F0 %.4f %.4f %.4f albedo %.4f %.4f %.4f in %.1f ms, %u iterations, rms %.2g, max parameter error %g\n",
+	          fitted.roughness, fitted.F0.x, fitted.F0.y, fitted.F0.z, fitted.albedo.x, fitted.albedo.y, fitted.albedo.z, fitMs, fitError.iterations,
+	          fitError.rms, parameterError);
+
+	// a measured or synthetic material has no exact answer, the fit only has to be sane
+	FilePath path;
+	bool fittedMERL = FindBenchmarkMERL(path) && material.Load(path.c_str());
+	double merlMs = MeasureMs(1, [&](uint32_t) { fittedMERL &= FitGGX(material, fitted, fitError); });
+	material.Close();
+	if (path == kSyntheticMERLPath)
+		remove(kSyntheticMERLPath);
+	LogStdOut("  %s: roughness %.4f F0 %.4f %.4f %.4f albedo %.4f %.4f %.4f in %.1f ms, rms %.4f, energy error %+.2f%%\n", path.c_str(), fitted.roughness,
+	          fitted.F0.x, fitted.F0.y, fitted.F0.z, fitted.albedo.x, fitted.albedo.y, fitted.albedo.z, merlMs, fitError.rms, fitError.energy * 100.0f);
+
+	return indexMismatches == 0 && fittedGGX && parameterError < 1e-3f && fittedMERL;
+}
+
+
+// Equirect of a radiance function of the direction, the inverse of the mapping of env_emitter.hlsl
+template <typename LAMBDA>
+static std::vector<XMFLOAT4> FillEquirect(uint32_t width, uint32_t height, const LAMBDA& radiance)
+{
+	std::vector<XMFLOAT4> pixels((size_t)width * height);
+	for (uint32_t y = 0; y < height; y++)
+	{
+		float theta = (y + 0.5f) / height * XM_PI;
+		for (uint32_t x = 0; x < width; x++)
+		{
+			float phi = (x + 0.5f) / width * 2.0f * XM_PI;
+			XMFLOAT3 color = radiance({sinf(theta) * sinf(phi), cosf(theta), sinf(theta) * cosf(phi)});
+			pixels[(size_t)y * width + x] = {color.x, color.y, color.z, 1.0f};
+		}
+	}
+	return pixels;
+}
+
+
+static const XMFLOAT3 kTestLobeDirection = {0.6f, 0.48f, 0.64f};
+
+
+// Smooth sky and a warm lobe, the environment the diffuse and specular filters are measured on
+static XMFLOAT3 GetTestRadiance(const XMFLOAT3& d)
+{
+	float lobe = std::max(d.x * kTestLobeDirection.x + d.y * kTestLobeDirection.y + d.z * kTestLobeDirection.z, 0.0f);
+	lobe = lobe * lobe;
+	lobe = 4.0f * lobe * lobe * lobe * lobe;
+	float sky = 1.0f + 0.5f * d.y;
+	return {0.4f * sky + lobe, 0.6f * sky + 0.8f * lobe, 0.9f * sky + 0.5f * lobe};
+}
+
+
+static bool BenchmarkCubemap()
+{
+	// the converter and the GPU bake agree on where every face texel looks
+	float orientationError = 0.0f;
+	float roundTripError = 0.0f;
+	for (uint32_t face = 0; face < Cubemap::kFacesNum; face++)
+	{
+		XMMATRIX view = Cubemap::GetFaceViewMatrix(face);
+		for (uint32_t i = 0; i < 64; i++)
+		{
+			float s = (i % 8 + 0.5f) / 8.0f;
+			float t = (i / 8 + 0.5f) / 8.0f;
+			XMFLOAT3 direction = Cubemap::GetDirection(face, s, t);
+			XMFLOAT3 viewDirection;
+			XMStoreFloat3(&viewDirection, XMVector3TransformCoord(XMLoadFloat3(&direction), view));
+			orientationError = std::max({orientationError, fabsf(viewDirection.x / viewDirection.z - (2.0f * s - 1.0f)),
+			                             fabsf(viewDirection.y / viewDirection.z - (1.0f - 2.0f * t)), viewDirection.z > 0.0f ? 0.0f : 1.0f});
+
+			float roundTripS, roundTripT;
+			uint32_t roundTripFace = Cubemap::GetFaceCoords(direction, roundTripS, roundTripT);
+			roundTripError = std::max({roundTripError, fabsf(roundTripS - s), fabsf(roundTripT - t), roundTripFace == face ? 0.0f : 1.0f});
+		}
+	}
+
+	// smooth radiance of the direction, so both filters reproduce it closely
+	const uint32_t kWidth = 2048;
+	const uint32_t kHeight = 1024;
+	auto radiance = [](const XMFLOAT3& d) -> XMFLOAT3 { return {1.0f + d.x, 1.0f + d.y * d.y, 1.0f + d.z * d.x}; };
+	std::vector<XMFLOAT4> pixels = FillEquirect(kWidth, kHeight, radiance);
+	EquirectImage image = {pixels.data(), kWidth, kHeight};
+
+	LogStdOut("cubemap: %ux%u equirect to %u^2 faces and mips\n", kWidth, kHeight, Cubemap::kDefaultResolution);
+	LogStdOut("  face texels against the bake view matrices: max error %g, face coords round trip max error %g\n", orientationError, roundTripError);
+
+	bool passed = orientationError < 1e-5f && roundTripError < 1e-5f;
+	Cubemap cubemap;
+	cubemap.Init(Cubemap::kDefaultResolution);
+	for (uint32_t filter = 0; filter < kCubemapFiltersNum; filter++)
+	{
+		double singleMs = MeasureMs(4, [&](uint32_t) { cubemap.ConvertFromEquirect(image, (ECubemapFilter)filter, 1); });
+		double threadedMs = MeasureMs(4, [&](uint32_t) { cubemap.ConvertFromEquirect(image, (ECubemapFilter)filter); });
+
+		float maxError = 0.0f;
+		for (uint32_t face = 0; face < Cubemap::kFacesNum; face++)
+		{
+			const XMFLOAT4* texels = cubemap.GetFace(0, face);
+			for (uint32_t i = 0; i < Cubemap::kDefaultResolution * Cubemap::kDefaultResolution; i++)
+			{
+				float s = (i % Cubemap::kDefaultResolution + 0.5f) / Cubemap::kDefaultResolution;
+				float t = (i / Cubemap::kDefaultResolution + 0.5f) / Cubemap::kDefaultResolution;
+				XMFLOAT3 d = Cubemap::GetDirection(face, s, t);
+				float length = sqrtf(d.x * d.x + d.y * d.y + d.z * d.z);
+				XMFLOAT3 expected = radiance({d.x / length, d.y / length, d.z / length});
+				maxError = std::max({maxError, fabsf(texels[i].x - expected.x), fabsf(texels[i].y - expected.y), fabsf(texels[i].z - expected.z)});
+			}
+		}
+
+		// the last mip averages the whole face
+		const uint32_t lastMip = cubemap.GetMipLevels() - 1;
+		float mipError = 0.0f;
+		for (uint32_t face = 0; face < Cubemap::kFacesNum; face++)
+		{
+			double sum = 0.0;
+			const XMFLOAT4* texels = cubemap.GetFace(0, face);
+			for (uint32_t i = 0; i < Cubemap::kDefaultResolution * Cubemap::kDefaultResolution; i++)
+				sum += texels[i].x;
+			mipError = std::max(mipError, fabsf(cubemap.GetFace(lastMip, face)->x - (float)(sum / (Cubemap::kDefaultResolution * Cubemap::kDefaultResolution))));
+		}
+
+		LogStdOut("  %-8s: 1 thread %.2f ms, threaded %.2f ms (%.1fx), max error %g, last mip error %g\n", kCubemapFilterNames[filter], singleMs, threadedMs,
+		          singleMs / threadedMs, maxError, mipError);
+		passed &= maxError < 1e-3f && mipError < 1e-4f;
+	}
+	cubemap.Release();
+	return passed;
+}
+
+
+static bool BenchmarkEnvSampling()
+{
+	// dim sky, darker ground and a sun of 1 degree radius holding most of the energy, like grace-new.hdr or pisa.hdr
+	const uint32_t kWidth = 2048;
+	const uint32_t kHeight = 1024;
+	// 30 degrees above the horizon
+	const float kSunElevation = XMConvertToRadians(30.0f);
+	const XMFLOAT3 kSunDirection = {cosf(kSunElevation) * cosf(0.7f), sinf(kSunElevation), cosf(kSunElevation) * sinf(0.7f)};
+	const float kSunCosRadius = cosf(XMConvertToRadians(1.0f));
+	std::vector<XMFLOAT4> pixels = FillEquirect(kWidth, kHeight, [&](const XMFLOAT3& d) -> XMFLOAT3 {
+		if (d.x * kSunDirection.x + d.y * kSunDirection.y + d.z * kSunDirection.z > kSunCosRadius)
+			return {50000.0f, 45000.0f, 40000.0f};
+		if (d.y > 0.0f)
+			return {0.3f + 0.3f * d.y, 0.5f + 0.3f * d.y, 1.0f};
+		return {0.1f, 0.08f, 0.05f};
+	});
+	EquirectImage image = {pixels.data(), kWidth, kHeight};
+
+	EnvSampler built;
+	double singleMs = MeasureMs(1, [&](uint32_t) { built.Build(image, 1); });
+	double threadedMs = MeasureMs(1, [&](uint32_t) { built.Build(image); });
+
+	// the saved tables map back to the same ones
+	const char* kSamplerPath = "env_bench.envs";
+	EnvSampler sampler;
+	if (!built.Save(kSamplerPath) || !sampler.Load(kSamplerPath))
+	{
+		remove(kSamplerPath);
+		return false;
+	}
+
+	LogStdOut("env_sampling: %ux%u equirect, tables built with 1 thread in %.2f ms, threaded in %.2f ms (%.1fx)\n", kWidth, kHeight, singleMs, threadedMs,
+	          singleMs / threadedMs);
+
+	uint32_t seed = 1;
+	const float(&luminanceWeights)[3] = GetColorSpaceMatrix(kColorSpaceRec709, kColorSpaceXYZ).m[1];
+	auto luminance = [&](const XMFLOAT3& d) {
+		XMFLOAT2 uv = Cubemap::GetEquirectCoords(d);
+		uint32_t x = std::min((uint32_t)(uv.x * kWidth), kWidth - 1);
+		uint32_t y = std::min((uint32_t)(uv.y * kHeight), kHeight - 1);
+		const XMFLOAT4& pixel = pixels[(size_t)y * kWidth + x];
+		return luminanceWeights[0] * pixel.x + luminanceWeights[1] * pixel.y + luminanceWeights[2] * pixel.z;
+	};
+
+	// sampled directions come with the pdf Pdf() gives them, the loaded tables sample like the built ones
+	const uint32_t kChecksNum = 1 << 16;
+	uint32_t pdfMismatches = 0;
+	uint32_t loadMismatches = 0;
+	for (uint32_t i = 0; i < kChecksNum; i++)
+	{
+		float u0 = Random(seed);
+		float u1 = Random(seed);
+		EnvSample sample = sampler.Sample(u0, u1);
+		EnvSample builtSample = built.Sample(u0, u1);
+		// a direction rounded across a pixel edge takes the pdf of the neighbor
+		pdfMismatches += fabsf(sampler.Pdf(sample.direction) - sample.pdf) > 1e-3f * sample.pdf;
+		loadMismatches += memcmp(&sample, &builtSample, sizeof(EnvSample)) != 0;
+	}
+	built.Close();
+
+	// the pdf integrates to 1 over the sphere, dw = 2 * pi^2 * sin(theta) * du * dv
+	const uint32_t kSubsamples = 4;
+	double integral = 0.0;
+	for (uint32_t y = 0; y < kHeight * kSubsamples; y++)
+	{
+		float theta = (y + 0.5f) / (kHeight * kSubsamples) * XM_PI;
+		for (uint32_t x = 0; x < kWidth * kSubsamples; x++)
+		{
+			float phi = (x + 0.5f) / (kWidth * kSubsamples) * 2.0f * XM_PI;
+			integral += sampler.Pdf({sinf(theta) * sinf(phi), cosf(theta), sinf(theta) * cosf(phi)}) * sinf(theta);
+		}
+	}
+	integral *= 2.0 * XM_PI * XM_PI / ((double)kWidth * kHeight * kSubsamples * kSubsamples);
+
+	double sampleMs = MeasureMs(kChecksNum, [&](uint32_t) {
+		EnvSample sample = sampler.Sample(Random(seed), Random(seed));
+		seed += sample.pdf > 0.0f;
+	});
+
+	LogStdOut("  %.1f ns per sample, pdf of samples against Pdf(): %u/%u mismatches, loaded against built: %u mismatches, pdf integral %.5f\n",
+	          sampleMs * 1e6, pdfMismatches, kChecksNum, loadMismatches, integral);
+	bool passed = pdfMismatches < kChecksNum / 1000 && loadMismatches == 0 && fabs(integral - 1.0) < 1e-3;
+
+	// luminance of the irradiance of a few normals, estimated with both strategies at the same sample count
+	const uint32_t kSamplesNum = 16;
+	const uint32_t kEstimatesNum = 4096;
+	const XMFLOAT3 kNormals[] = {{0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {-0.6f, 0.0f, -0.8f}};
+	for (const XMFLOAT3& normal : kNormals)
+	{
+		// any frame around the normal does for the cosine
+		XMVECTOR up = fabsf(normal.y) < 0.9f ? XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f) : XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f);
+		XMFLOAT3 tangent;
+		XMStoreFloat3(&tangent, XMVector3Normalize(XMVector3Cross(up, XMLoadFloat3(&normal))));
+		XMFLOAT3 bitangent;
+		XMStoreFloat3(&bitangent, XMVector3Cross(XMLoadFloat3(&normal), XMLoadFloat3(&tangent)));
+
+		double sums[2] = {};
+		double squareSums[2] = {};
+		double strategyMs[2];
+		for (uint32_t strategy = 0; strategy < 2; strategy++)
+		{
+			strategyMs[strategy] = MeasureMs(1, [&](uint32_t) {
+				for (uint32_t e = 0; e < kEstimatesNum; e++)
+				{
+					double estimate = 0.0;
+					for (uint32_t s = 0; s < kSamplesNum; s++)
+					{
+						float u0 = Random(seed);
+						float u1 = Random(seed);
+						EnvSample sample;
+						if (strategy == 0)
+						{
+							float r = sqrtf(u1);
+							float x = r * cosf(2.0f * XM_PI * u0);
+							float y = r * sinf(2.0f * XM_PI * u0);
+							float z = sqrtf(1.0f - u1);
+							sample.direction = {x * tangent.x + y * bitangent.x + z * normal.x, x * tangent.y + y * bitangent.y + z * normal.y,
+							                    x * tangent.z + y * bitangent.z + z * normal.z};
+							sample.pdf = z / XM_PI;
+						}
+						else
+						{
+							sample = sampler.Sample(u0, u1);
+						}
+						float NoL = sample.direction.x * normal.x + sample.direction.y * normal.y + sample.direction.z * normal.z;
+						if (sample.pdf > 0.0f && NoL > 0.0f)
+							estimate += luminance(sample.direction) * NoL / sample.pdf;
+					}
+					estimate /= kSamplesNum;
+					sums[strategy] += estimate;
+					squareSums[strategy] += estimate * estimate;
+				}
+			});
+		}
+
+		double means[2];
+		double variances[2];
+		for (uint32_t strategy = 0; strategy < 2; strategy++)
+		{
+			means[strategy] = sums[strategy] / kEstimatesNum;
+			variances[strategy] = std::max(squareSums[strategy] / kEstimatesNum - means[strategy] * means[strategy], 0.0);
+		}
+
+		// both estimators are unbiased, so the means agree within a few standard errors
+		double standardError = sqrt((variances[0] + variances[1]) / kEstimatesNum);
+		bool agree = fabs(means[0] - means[1]) < 5.0 * standardError + 1e-4 * means[0];
+		LogStdOut("  normal (%4.1f %4.1f %4.1f), %u spp: irradiance cosine %.3f tables %.3f, variance cosine %.3g (%.2f ms) tables %.3g (%.2f ms), %.1fx lower\n",
+		          normal.x, normal.y, normal.z, kSamplesNum, means[0], means[1], variances[0], strategyMs[0], variances[1], strategyMs[1],
+		          variances[0] / std::max(variances[1], 1e-30));
+		// away from the sun most samples land below the horizon of the normal, the case MIS with the BRDF samples covers
+		bool seesSun = normal.x * kSunDirection.x + normal.y * kSunDirection.y + normal.z * kSunDirection.z > 0.0f;
+		passed &= agree && (!seesSun || variances[1] < variances[0]);
+	}
+
+	sampler.Close();
+	remove(kSamplerPath);
+	return passed;
+}
+
+
+static bool BenchmarkSHIrradiance()
+{
+	// a positive L2 function comes back from both projections up to the quadrature error of the texels
+	SHColor known;
+	for (uint32_t c = 0; c < 3; c++)
+	{
+		known.coefficients[c][0] = 10.0f + c;
+		for (uint32_t k = 1; k < kSHCoefficientsNum; k++)
+			known.coefficients[c][k] = 0.3f * sinf(1.7f * k + 0.9f * c);
+	}
+
+	const uint32_t kWidth = 1024;
+	const uint32_t kHeight = 512;
+	auto maxCoefficientError = [](const SHColor& a, const SHColor& b) {
+		float error = 0.0f;
+		for (uint32_t c = 0; c < 3; c++)
+			for (uint32_t k = 0; k < kSHCoefficientsNum; k++)
+				error = std::max(error, fabsf(a.coefficients[c][k] - b.coefficients[c][k]));
+		return error;
+	};
+
+	std::vector<XMFLOAT4> knownPixels = FillEquirect(kWidth, kHeight, [&](const XMFLOAT3& d) { return EvalSH(known, d); });
+	float equirectError = maxCoefficientError(ProjectToSH(EquirectImage{knownPixels.data(), kWidth, kHeight}), known);
+
+	Cubemap cubemap;
+	cubemap.Init(128, 1);
+	EvalSH(known, cubemap);
+	float cubemapError = maxCoefficientError(ProjectToSH(cubemap), known);
+
+	LogStdOut("sh_irradiance: L2 projection and diffuse convolution of environments\n");
+	LogStdOut("  L2 function back from a %ux%u equirect: max coefficient error %g, from 128^2 faces: %g\n", kWidth, kHeight, equirectError, cubemapError);
+	bool passed = equirectError < 1e-3f && cubemapError < 1e-3f;
+
+	std::vector<XMFLOAT4> pixels = FillEquirect(kWidth, kHeight, GetTestRadiance);
+	EquirectImage image = {pixels.data(), kWidth, kHeight};
+
+	// the environment cube of EnvEmitter
+	cubemap.Init(Cubemap::kDefaultResolution);
+	cubemap.ConvertFromEquirect(image, kCubemapFilterBilinear);
+
+	// per SIMD level, the projection of the environment cube and the 128^2 diffuse cube of EnvMapFilter evaluated from it
+	const uint32_t kDiffuseResolution = 128;
+	Cubemap diffuse;
+	diffuse.Init(kDiffuseResolution, 1);
+	SHColor radiance;
+	double shSingleMs = 0.0;
+	double shThreadedMs = 0.0;
+	ESimdLevel supportedLevel = GetSupportedSimdLevel();
+	for (uint32_t level = 0; level <= supportedLevel; level++)
+	{
+		SetSimdLevel((ESimdLevel)level);
+		double projectMs = MeasureMs(4, [&](uint32_t) { radiance = ProjectToSH(cubemap, 1); });
+		double threadedProjectMs = MeasureMs(4, [&](uint32_t) { radiance = ProjectToSH(cubemap); });
+		double evalMs = MeasureMs(4, [&](uint32_t) { EvalSH(ConvolveDiffuse(radiance), diffuse, 1); });
+		double threadedEvalMs = MeasureMs(4, [&](uint32_t) { EvalSH(ConvolveDiffuse(radiance), diffuse); });
+
+		// packets against one direction at a time
+		float evalError = 0.0f;
+		const float* texels = &diffuse.GetFace(0, 0)->x;
+		SHColor irradiance = ConvolveDiffuse(radiance);
+		for (uint32_t i = 0; i < kDiffuseResolution * kDiffuseResolution; i++)
+		{
+			XMFLOAT3 expected = EvalSH(irradiance, Cubemap::GetDirection(0, (i % kDiffuseResolution + 0.5f) / kDiffuseResolution,
+			                                                               (i / kDiffuseResolution + 0.5f) / kDiffuseResolution));
+			evalError = std::max({evalError, fabsf(texels[i * 4] - expected.x), fabsf(texels[i * 4 + 1] - expected.y), fabsf(texels[i * 4 + 2] - expected.z)});
+		}
+
+		LogStdOut("  %-10s: project %u^2 faces 1 thread %.3f ms, threaded %.3f ms (%.1fx), evaluate %u^2 faces 1 thread %.3f ms, threaded %.3f ms, max error "
+		          "against single %g\n",
+		          GetSimdLevelName((ESimdLevel)level), Cubemap::kDefaultResolution, projectMs, threadedProjectMs, projectMs / threadedProjectMs,
+		          kDiffuseResolution, evalMs, threadedEvalMs, evalError);
+		passed &= evalError < 1e-5f;
+		shSingleMs = projectMs + evalMs;
+		shThreadedMs = threadedProjectMs + threadedEvalMs;
+	}
+	SetSimdLevel(supportedLevel);
+	SHColor irradiance = ConvolveDiffuse(radiance);
+
+	// what PrefilterDiffuseEnvMap() means to estimate, cosine samples with its lod rule on the mips of the cube, nearest texels.
+	// ImportanceSampleDiffuse() in lighting.h draws uniform hemisphere directions with the cosine pdf, the GPU bake averages the hemisphere instead
+	auto prefilterDiffuse = [&](const XMFLOAT3& normal, uint32_t samplesNum) {
+		XMVECTOR up = fabsf(normal.z) < 0.999f ? XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f) : XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f);
+		XMFLOAT3 tangentX, tangentY;
+		XMStoreFloat3(&tangentX, XMVector3Normalize(XMVector3Cross(up, XMLoadFloat3(&normal))));
+		XMStoreFloat3(&tangentY, XMVector3Cross(XMLoadFloat3(&normal), XMLoadFloat3(&tangentX)));
+		float solidAngleTexel = 4.0f * XM_PI / (6.0f * cubemap.GetResolution() * cubemap.GetResolution());
+
+		XMFLOAT3 sum = {0.0f, 0.0f, 0.0f};
+		for (uint32_t i = 0; i < samplesNum; i++)
+		{
+			float u0, u1;
+			SpecularPrefilter::Hammersley(i, samplesNum, u0, u1);
+
+			float cosTheta = sqrtf(1.0f - u1);
+			float sinTheta = sqrtf(u1);
+			float phi = 2.0f * XM_PI * u0;
+			float x = sinTheta * cosf(phi);
+			float y = sinTheta * sinf(phi);
+			XMFLOAT3 L = {x * tangentX.x + y * tangentY.x + cosTheta * normal.x, x * tangentX.y + y * tangentY.y + cosTheta * normal.y,
+			              x * tangentX.z + y * tangentY.z + cosTheta * normal.z};
+
+			float solidAngleSample = XM_PI / (samplesNum * std::max(cosTheta, 1e-6f));
+			float lod = std::max(0.5f * log2f(solidAngleSample / solidAngleTexel), 0.0f);
+			uint32_t mip = std::min((uint32_t)(lod + 0.5f), cubemap.GetMipLevels() - 1);
+			uint32_t resolution = cubemap.GetMipResolution(mip);
+			float s, t;
+			uint32_t face = Cubemap::GetFaceCoords(L, s, t);
+			uint32_t tx = std::min((uint32_t)(s * resolution), resolution - 1);
+			uint32_t ty = std::min((uint32_t)(t * resolution), resolution - 1);
+			const XMFLOAT4& texel = cubemap.GetFace(mip, face)[ty * resolution + tx];
+			sum.x += texel.x;
+			sum.y += texel.y;
+			sum.z += texel.z;
+		}
+		return XMFLOAT3{sum.x / samplesNum, sum.y / samplesNum, sum.z / samplesNum};
+	};
+
+	// normals on a spiral over the sphere
+	const uint32_t kNormalsNum = 16;
+	std::vector<XMFLOAT3> normals(kNormalsNum);
+	for (uint32_t n = 0; n < kNormalsNum; n++)
+	{
+		float y = 1.0f - (2.0f * n + 1.0f) / kNormalsNum;
+		float r = sqrtf(1.0f - y * y);
+		normals[n] = {r * cosf(2.4f * n), y, r * sinf(2.4f * n)};
+	}
+
+	// reference: the cosine over pi integrated over every pixel of an equirect
+	auto integrateDiffuse = [&](const std::vector<XMFLOAT4>& source) {
+		std::vector<double> sums((size_t)kNormalsNum * 3);
+		for (uint32_t y = 0; y < kHeight; y++)
+		{
+			float theta = (y + 0.5f) / kHeight * XM_PI;
+			double weight = 2.0 * XM_PI / kWidth * (cos((double)y / kHeight * XM_PI) - cos((y + 1.0) / kHeight * XM_PI)) / XM_PI;
+			for (uint32_t x = 0; x < kWidth; x++)
+			{
+				float phi = (x + 0.5f) / kWidth * 2.0f * XM_PI;
+				XMFLOAT3 d = {sinf(theta) * sinf(phi), cosf(theta), sinf(theta) * cosf(phi)};
+				const XMFLOAT4& pixel = source[(size_t)y * kWidth + x];
+				for (uint32_t n = 0; n < kNormalsNum; n++)
+				{
+					float cosine = d.x * normals[n].x + d.y * normals[n].y + d.z * normals[n].z;
+					if (cosine > 0.0f)
+					{
+						sums[n * 3] += pixel.x * cosine * weight;
+						sums[n * 3 + 1] += pixel.y * cosine * weight;
+						sums[n * 3 + 2] += pixel.z * cosine * weight;
+					}
+				}
+			}
+		}
+		std::vector<XMFLOAT3> references(kNormalsNum);
+		for (uint32_t n = 0; n < kNormalsNum; n++)
+			references[n] = {(float)sums[n * 3], (float)sums[n * 3 + 1], (float)sums[n * 3 + 2]};
+		return references;
+	};
+	auto relativeError = [](const XMFLOAT3& value, const XMFLOAT3& reference) {
+		return std::max({fabsf(value.x - reference.x) / reference.x, fabsf(value.y - reference.y) / reference.y, fabsf(value.z - reference.z) / reference.z});
+	};
+
+	// the convolution is exact for L2 radiance, the rest of the error is the truncation of the series
+	float convolutionError = 0.0f;
+	std::vector<XMFLOAT3> references = integrateDiffuse(knownPixels);
+	for (uint32_t n = 0; n < kNormalsNum; n++)
+		convolutionError = std::max(convolutionError, relativeError(EvalSH(ConvolveDiffuse(known), normals[n]), references[n]));
+
+	float shError = 0.0f;
+	references = integrateDiffuse(pixels);
+	for (uint32_t n = 0; n < kNormalsNum; n++)
+		shError = std::max(shError, relativeError(EvalSH(irradiance, normals[n]), references[n]));
+	LogStdOut("  SH diffuse against the integrated equirect: max rel error %g for the L2 function, %.4f for the sky over %u normals\n", convolutionError, shError,
+	          kNormalsNum);
+	LogStdOut("  SH path: %.3f ms for the whole diffuse cube on 1 thread, %.3f ms threaded\n", shSingleMs, shThreadedMs);
+	passed &= convolutionError < 1e-4f;
+
+	const uint32_t kSampleCounts[] = {16, 64, 256};
+	for (uint32_t samplesNum : kSampleCounts)
+	{
+		float mcError = 0.0f;
+		for (uint32_t n = 0; n < kNormalsNum; n++)
+			mcError = std::max(mcError, relativeError(prefilterDiffuse(normals[n], samplesNum), references[n]));
+
+		// a single thread, the GPU bake runs the same loop for every texel
+		const uint32_t kTexelsNum = Cubemap::kFacesNum * kDiffuseResolution * kDiffuseResolution;
+		double mcMs = MeasureMs(1, [&](uint32_t) {
+			float sink = 0.0f;
+			for (uint32_t i = 0; i < kTexelsNum; i += 64)
+				sink += prefilterDiffuse(normals[i % kNormalsNum], samplesNum).x;
+			diffuse.GetFace(0, 0)->w = sink;
+		}) * 64.0;
+		LogStdOut("  MC %4u spp: max rel error %.4f, %.1f ms for the whole diffuse cube on 1 thread (%.0fx the SH path on 1 thread)\n", samplesNum, mcError,
+		          mcMs, mcMs / shSingleMs);
+	}
+
+	cubemap.Release();
+	diffuse.Release();
+	return passed;
+}
+
+
+static bool BenchmarkSpecularPrefilter()
+{
+	// a smaller cube than the one of EnvMapFilter keeps the single thread run short
+	const uint32_t kResolution = 128;
+	const uint32_t kSamplesNum = 64;
+	const uint32_t kWidth = 1024;
+	const uint32_t kHeight = 512;
+	std::vector<XMFLOAT4> pixels = FillEquirect(kWidth, kHeight, GetTestRadiance);
+
+	Cubemap source;
+	source.Init(kResolution);
+	source.ConvertFromEquirect({pixels.data(), kWidth, kHeight}, kCubemapFilterBilinear);
+
+	SpecularPrefilter prefilter;
+	prefilter.Init(kResolution, kResolution, kSamplesNum);
+	Cubemap single, threaded;
+	single.Init(kResolution);
+	threaded.Init(kResolution);
+	double singleMs = MeasureMs(1, [&](uint32_t) { prefilter.Prefilter(source, single, 1); });
+	double threadedMs = MeasureMs(1, [&](uint32_t) { prefilter.Prefilter(source, threaded, 4); });
+
+	// the threads do not change a bit, and the mirror mip is the source
+	bool identical = true;
+	float mirrorError = 0.0f;
+	for (uint32_t mip = 0; mip < single.GetMipLevels(); mip++)
+	{
+		uint32_t resolution = single.GetMipResolution(mip);
+		for (uint32_t face = 0; face < Cubemap::kFacesNum; face++)
+		{
+			identical &= memcmp(single.GetFace(mip, face), threaded.GetFace(mip, face), (size_t)resolution * resolution * sizeof(XMFLOAT4)) == 0;
+			if (mip > 0)
+				continue;
+			const XMFLOAT4* texels = single.GetFace(0, face);
+			const XMFLOAT4* sourceTexels = source.GetFace(0, face);
+			for (uint32_t i = 0; i < resolution * resolution; i++)
+				mirrorError = std::max({mirrorError, fabsf(texels[i].x - sourceTexels[i].x), fabsf(texels[i].y - sourceTexels[i].y),
+				                        fabsf(texels[i].z - sourceTexels[i].z)});
+		}
+	}
+
+	LogStdOut("specular_prefilter: %u^2 faces, %u mips, %u spp, 1 thread %.1f ms, 4 threads %.1f ms (%.1fx), %s, mirror mip against the source max error %g\n",
+	          kResolution, single.GetMipLevels(), kSamplesNum, singleMs, threadedMs, singleMs / threadedMs, identical ? "identical" : "DIFFERENT", mirrorError);
+	bool passed = identical && mirrorError < 1e-5f;
+
+	// per mip, texels against the converged GGX average of the radiance itself, without the lod of the filtered samples.
+	// The Hammersley estimate converges as 1 / samples, every mip stays below 3 / samples at 64 and at 256 samples
+	const uint32_t kReferenceSamplesNum = 16384;
+	const uint32_t kTexelsPerFace = 4;
+	const float kMaxMipError = 4.0f / kSamplesNum;
+	for (uint32_t mip = 1; mip < single.GetMipLevels(); mip++)
+	{
+		float roughness = SpecularPrefilter::GetMipRoughness(mip, single.GetMipLevels());
+		uint32_t resolution = single.GetMipResolution(mip);
+		float maxError = 0.0f;
+		for (uint32_t face = 0; face < Cubemap::kFacesNum; face++)
+		{
+			for (uint32_t i = 0; i < kTexelsPerFace; i++)
+			{
+				uint32_t x = (i * 7 + face * 3) % resolution;
+				uint32_t y = (i * 5 + face) % resolution;
+				XMFLOAT3 N = Cubemap::GetDirection(face, (x + 0.5f) / resolution, (y + 0.5f) / resolution);
+				XMStoreFloat3(&N, XMVector3Normalize(XMLoadFloat3(&N)));
+				XMVECTOR up = fabsf(N.z) < 0.999f ? XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f) : XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f);
+				XMFLOAT3 tangentX, tangentY;
+				XMStoreFloat3(&tangentX, XMVector3Normalize(XMVector3Cross(up, XMLoadFloat3(&N))));
+				XMStoreFloat3(&tangentY, XMVector3Cross(XMLoadFloat3(&N), XMLoadFloat3(&tangentX)));
+
+				double sum[3] = {};
+				double weight = 0.0;
+				for (uint32_t s = 0; s < kReferenceSamplesNum; s++)
+				{
+					// stratified in both dimensions
+					float u0 = (s % 128 + 0.5f) / 128.0f;
+					float u1 = (s / 128 + 0.5f) / 128.0f;
+					float m2 = roughness * roughness;
+					float cosTheta = sqrtf((1.0f - u1) / (1.0f + (m2 - 1.0f) * u1));
+					float sinTheta = sqrtf(1.0f - cosTheta * cosTheta);
+					float phi = 2.0f * XM_PI * u0;
+					XMFLOAT3 l = {2.0f * cosTheta * sinTheta * cosf(phi), 2.0f * cosTheta * sinTheta * sinf(phi), 2.0f * cosTheta * cosTheta - 1.0f};
+					if (l.z <= 0.0f)
+						continue;
+					XMFLOAT3 L = {tangentX.x * l.x + tangentY.x * l.y + N.x * l.z, tangentX.y * l.x + tangentY.y * l.y + N.y * l.z,
+					              tangentX.z * l.x + tangentY.z * l.y + N.z * l.z};
+					XMFLOAT3 color = GetTestRadiance(L);
+					sum[0] += color.x * l.z;
+					sum[1] += color.y * l.z;
+					sum[2] += color.z * l.z;
+					weight += l.z;
+				}
+
+				const XMFLOAT4& texel = single.GetFace(mip, face)[y * resolution + x];
+				maxError = std::max({maxError, fabsf(texel.x / (float)(sum[0] / weight) - 1.0f), fabsf(texel.y / (float)(sum[1] / weight) - 1.0f),
+				                     fabsf(texel.z / (float)(sum[2] / weight) - 1.0f)});
+			}
+		}
+		LogStdOut("  mip %u, roughness %.3f: max rel error %.4f against the converged average, bound %.4f\n", mip, roughness, maxError, kMaxMipError);
+		passed &= maxError < kMaxMipError;
+	}
+
+	// a constant environment stays constant in every mip
+	for (uint32_t mip = 0; mip < source.GetMipLevels(); mip++)
+		for (uint32_t face = 0; face < Cubemap::kFacesNum; face++)
+			std::fill(source.GetFace(mip, face), source.GetFace(mip, face) + source.GetMipResolution(mip) * source.GetMipResolution(mip),
+			          XMFLOAT4{2.0f, 1.0f, 0.5f, 1.0f});
+	prefilter.Prefilter(source, single);
+	float constantError = 0.0f;
+	for (uint32_t mip = 0; mip < single.GetMipLevels(); mip++)
+	{
+		for (uint32_t face = 0; face < Cubemap::kFacesNum; face++)
+		{
+			const XMFLOAT4* texels = single.GetFace(mip, face);
+			for (uint32_t i = 0; i < single.GetMipResolution(mip) * single.GetMipResolution(mip); i++)
+				constantError = std::max({constantError, fabsf(texels[i].x - 2.0f), fabsf(texels[i].y - 1.0f), fabsf(texels[i].z - 0.5f)});
+		}
+	}
+	LogStdOut("  constant environment: max error %g\n", constantError);
+	passed &= constantError < 1e-5f;
+
+	// CPU reference of the LUT of EnvMapFilter, the same bits on any number of threads
+	const uint32_t kLutSize = kBRDFLutResolution;
+	const uint32_t kLutSamplesNum = SpecularPrefilter::kDefaultSamplesNum;
+	std::vector<XMFLOAT4> singleLut((size_t)kLutSize * kLutSize), threadedLut((size_t)kLutSize * kLutSize);
+	double singleLutMs = MeasureMs(1, [&](uint32_t) { SpecularPrefilter::GenerateBRDFLut(kLutSize, kLutSamplesNum, singleLut.data(), 1); });
+	double threadedLutMs = MeasureMs(1, [&](uint32_t) { SpecularPrefilter::GenerateBRDFLut(kLutSize, kLutSamplesNum, threadedLut.data(), 4); });
+	bool identicalLut = memcmp(singleLut.data(), threadedLut.data(), singleLut.size() * sizeof(XMFLOAT4)) == 0;
+
+	// a mirror seen head on reflects everything, and the rest against a converged stratified estimate within the same 1 / samples bound as the mips
+	const XMFLOAT4& mirror = singleLut[(size_t)(kLutSize - 1) * kLutSize];
+	float lutMirrorError = std::max(fabsf(mirror.x - 1.0f), fabsf(mirror.y));
+	const float kMaxLutError = 4.0f / kLutSamplesNum;
+	float lutError = 0.0f;
+	for (uint32_t i = 0; i < 16; i++)
+	{
+		uint32_t x = (i * 37 + 11) % kLutSize;
+		uint32_t y = (i * 53 + 29) % kLutSize;
+		float roughness = (float)x / (kLutSize - 1);
+		float NoV = (float)y / (kLutSize - 1);
+		float m2 = roughness * roughness;
+		double scale = 0.0;
+		double bias = 0.0;
+		for (uint32_t s = 0; s < kReferenceSamplesNum; s++)
+		{
+			float u0 = (s % 128 + 0.5f) / 128.0f;
+			float u1 = (s / 128 + 0.5f) / 128.0f;
+			float cosTheta = sqrtf((1.0f - u1) / (1.0f + (m2 - 1.0f) * u1));
+			float sinTheta = sqrtf(1.0f - cosTheta * cosTheta);
+			float VoH = sqrtf(1.0f - NoV * NoV) * sinTheta * cosf(2.0f * XM_PI * u0) + NoV * cosTheta;
+			float NoL = 2.0f * VoH * cosTheta - NoV;
+			if (NoL <= 0.0f || VoH <= 0.0f)
+				continue;
+			float lambdaV = NoL * (NoV * (1.0f - roughness) + roughness);
+			float lambdaL = NoV * (NoL * (1.0f - roughness) + roughness);
+			double vis = 0.5 / (lambdaV + lambdaL) * NoL * 4.0 * VoH / cosTheta;
+			double fc = pow(1.0 - VoH, 5.0);
+			scale += vis * (1.0 - fc);
+			bias += vis * fc;
+		}
+		const XMFLOAT4& texel = singleLut[(size_t)y * kLutSize + x];
+		lutError = std::max({lutError, fabsf(texel.x - (float)(scale / kReferenceSamplesNum)), fabsf(texel.y - (float)(bias / kReferenceSamplesNum))});
+	}
+
+	LogStdOut("  brdf lut: %u^2, %u spp, 1 thread %.1f ms, 4 threads %.1f ms (%.1fx), %s, mirror error %g, max abs error %.4f against %u samples, bound %.4f\n",
+	          kLutSize, kLutSamplesNum, singleLutMs, threadedLutMs, singleLutMs / threadedLutMs, identicalLut ? "identical" : "DIFFERENT", lutMirrorError,
+	          lutError, kReferenceSamplesNum, kMaxLutError);
+	passed &= identicalLut && lutMirrorError < 1e-5f && lutError < kMaxLutError;
+
+	prefilter.Release();
+	source.Release();
+	single.Release();
+	threaded.Release();
+	return passed;
+}
+
+
+static bool BenchmarkEnvCache()
+{
+	// keys follow every parameter of a product and nothing else
+	EnvCacheParameters parameters;
+	EnvCacheParameters scaled = parameters;
+	scaled.scale = 2.0f;
+	EnvCacheParameters resampled = parameters;
+	resampled.samplesNum = 256;
+	const uint64_t kSourceHash = 0x0123456789abcdefull;
+	bool keysPassed = true;
+	for (uint32_t i = 0; i < kEnvCacheProductsNum; i++)
+	{
+		EEnvCacheProduct product = (EEnvCacheProduct)i;
+		uint64_t key = GetEnvCacheKey(product, kSourceHash, parameters);
+		bool lut = product == kEnvCacheBRDFLut;
+		keysPassed &= key == GetEnvCacheKey(product, kSourceHash, parameters);
+		keysPassed &= (key == GetEnvCacheKey(product, kSourceHash + 1, parameters)) == lut;
+		keysPassed &= (key == GetEnvCacheKey(product, kSourceHash, scaled)) == lut;
+		keysPassed &= key != GetEnvCacheKey(product, kSourceHash, resampled);
+		for (uint32_t j = 0; j < i; j++)
+			keysPassed &= key != GetEnvCacheKey((EEnvCacheProduct)j, kSourceHash, parameters);
+	}
+
+	// FNV-1a of "a"
+	const char* kHashPath = "envcache_bench.bin";
+	uint64_t fileHash = 0;
+	{
+		File file(kHashPath, File::kOpenWrite);
+		keysPassed &= file.Write("a", 1) == 1;
+	}
+	keysPassed &= HashEnvCacheSource(kHashPath, fileHash) && fileHash == 0xaf63dc4c8601ec8cull;
+	remove(kHashPath);
+	LogStdOut("env_cache: keys %s, source hash %016llx\n", keysPassed ? "ok" : "WRONG", (unsigned long long)fileHash);
+
+	// a product comes back with the bits it was stored with, and only under its own key
+	const EEnvCacheProduct kProduct = kEnvCacheDiffuse;
+	uint32_t resolution = kEnvCacheResolutions[kProduct];
+	ScratchImage stored;
+	bool roundTripPassed = SUCCEEDED(stored.InitializeCube(DXGI_FORMAT_R16G16B16A16_FLOAT, resolution, resolution, 1, 1));
+	for (size_t i = 0; i < stored.GetImageCount(); i++)
+		for (size_t j = 0; j < stored.GetImages()[i].slicePitch; j++)
+			stored.GetImages()[i].pixels[j] = (uint8_t)(j * 31 + i * 7);
+
+	// a file left by another version is never read
+	uint64_t key = GetEnvCacheKey(kProduct, kSourceHash, parameters);
+	uint64_t staleKey = GetEnvCacheKey(kProduct, kSourceHash, parameters, kEnvCacheVersion - 1);
+	ScratchImage loaded;
+	roundTripPassed &= SaveEnvCacheProduct(kProduct, staleKey, stored);
+	bool versionMissed = !IsEnvCached(kProduct, key) && !LoadEnvCacheProduct(kProduct, key, 1, loaded);
+
+	roundTripPassed &= SaveEnvCacheProduct(kProduct, key, stored) && LoadEnvCacheProduct(kProduct, key, 1, loaded);
+	roundTripPassed &= loaded.GetImageCount() == stored.GetImageCount();
+	for (size_t i = 0; roundTripPassed && i < stored.GetImageCount(); i++)
+	{
+		const Image& storedImage = stored.GetImages()[i];
+		const Image& loadedImage = loaded.GetImages()[i];
+		roundTripPassed &= loadedImage.slicePitch == storedImage.slicePitch && memcmp(loadedImage.pixels, storedImage.pixels, storedImage.slicePitch) == 0;
+	}
+
+	// nor a product of other parameters
+	ScratchImage missed;
+	bool keyMissed = !LoadEnvCacheProduct(kProduct, GetEnvCacheKey(kProduct, kSourceHash, scaled), 1, missed);
+	remove(GetEnvCachePath(kProduct, key).c_str());
+	remove(GetEnvCachePath(kProduct, staleKey).c_str());
+	LogStdOut("  round trip of the %s product: %s, other parameters %s, other version %s\n", kEnvCacheProductNames[kProduct],
+	          roundTripPassed ? "identical" : "DIFFERENT", keyMissed ? "miss" : "HIT", versionMissed ? "miss" : "HIT");
+
+	return keysPassed && roundTripPassed && keyMissed && versionMissed;
+}
+
+
+static bool BenchmarkColorSpace()
+{
+	const uint32_t kWidth = 1920;
+	const uint32_t kHeight = 1080;
+	const size_t kColorsNum = (size_t)kWidth * kHeight;
+
+	LogStdOut("color_space: %ux%u colors, Bradford adapted 3x3 transforms\n", kWidth, kHeight);
+
+	// the Rec.709 matrix has to agree with the one the spectral code hardcodes
+	const ColorMatrix& toXYZ = GetColorSpaceMatrix(kColorSpaceRec709, kColorSpaceXYZ);
+	float matrixError = 0.0f;
+	for (uint32_t c = 0; c < 3; c++)
+	{
+		float rgb[3] = {c == 0 ? 1.0f : 0.0f, c == 1 ? 1.0f : 0.0f, c == 2 ? 1.0f : 0.0f};
+		float a[3], b[3];
+		toXYZ.Transform(rgb[0], rgb[1], rgb[2], a[0], a[1], a[2]);
+		LinearRGBToXYZ(rgb[0], rgb[1], rgb[2], b[0], b[1], b[2]);
+		for (uint32_t i = 0; i < 3; i++)
+			matrixError = std::max(matrixError, fabsf(a[i] - b[i]));
+	}
+
+	// D65 white stays white in every RGB space, Bradford moves it to the ACES white
+	float whiteError = 0.0f;
+	for (uint32_t to = kColorSpaceRec709; to < kColorSpacesNum; to++)
+	{
+		float white[3];
+		GetColorSpaceMatrix(kColorSpaceRec709, (EColorSpace)to).Transform(1.0f, 1.0f, 1.0f, white[0], white[1], white[2]);
+		for (uint32_t i = 0; i < 3; i++)
+			whiteError = std::max(whiteError, fabsf(white[i] - 1.0f));
+	}
+
+	std::vector<float> source[3];
+	for (uint32_t c = 0; c < 3; c++)
+	{
+		source[c].resize(kColorsNum);
+		for (size_t i = 0; i < kColorsNum; i++)
+			source[c][i] = (float)((i * 7919 + c * 104729) % 65536) / 4096.0f;
+	}
+
+	// Rec.709 -> Rec.2020 -> ACEScg -> XYZ -> Rec.709
+	std::vector<float> planes[3] = {source[0], source[1], source[2]};
+	const EColorSpace kRoundTrip[] = {kColorSpaceRec709, kColorSpaceRec2020, kColorSpaceACEScg, kColorSpaceXYZ, kColorSpaceRec709};
+	for (uint32_t i = 0; i + 1 < _countof(kRoundTrip); i++)
+		ConvertColors(kRoundTrip[i], kRoundTrip[i + 1], planes[0].data(), planes[1].data(), planes[2].data(), kColorsNum);
+	float roundTripError = 0.0f;
+	for (uint32_t c = 0; c < 3; c++)
+		for (size_t i = 0; i < kColorsNum; i++)
+			roundTripError = std::max(roundTripError, fabsf(planes[c][i] - source[c][i]) / std::max(source[c][i], 1.0f));
+
+	LogStdOut("  Rec.709 against LinearRGBToXYZ: max coefficient error %g\n", matrixError);
+	LogStdOut("  D65 white in every RGB space: max error %g\n", whiteError);
+	LogStdOut("  round trip through all spaces: max rel error %g\n", roundTripError);
+
+	// one color at a time on one thread, the way the per color helpers convert
+	const ColorMatrix& matrix = GetColorSpaceMatrix(kColorSpaceRec709, kColorSpaceACEScg);
+	std::vector<float> reference[3] = {source[0], source[1], source[2]};
+	double referenceMs = MeasureMs(1, [&](uint32_t) {
+		for (size_t i = 0; i < kColorsNum; i++)
+			matrix.Transform(source[0][i], source[1][i], source[2][i], reference[0][i], reference[1][i], reference[2][i]);
+	});
+	LogStdOut("  per color, 1 thread : %.3f ms\n", referenceMs);
+
+	const float kTolerance = 1e-6f;
+	ESimdLevel supportedLevel = GetSupportedSimdLevel();
+	std::vector<float> interleaved(kColorsNum * 4);
+	bool passed = matrixError < 1e-3f && whiteError < 1e-5f && roundTripError < 1e-5f;
+	for (uint32_t level = kSimdScalar; level <= supportedLevel; level++)
+	{
+		SetSimdLevel((ESimdLevel)level);
+
+		for (uint32_t c = 0; c < 3; c++)
+			planes[c] = source[c];
+		double planesMs = MeasureMs(1, [&](uint32_t) {
+			ConvertColors(kColorSpaceRec709, kColorSpaceACEScg, planes[0].data(), planes[1].data(), planes[2].data(), kColorsNum);
+		});
+
+		for (size_t i = 0; i < kColorsNum; i++)
+		{
+			for (uint32_t c = 0; c < 3; c++)
+				interleaved[i * 4 + c] = source[c][i];
+			interleaved[i * 4 + 3] = 1.0f;
+		}
+		double interleavedMs = MeasureMs(1, [&](uint32_t) { ConvertColors(kColorSpaceRec709, kColorSpaceACEScg, interleaved.data(), kColorsNum); });
+
+		float maxError = 0.0f;
+		for (uint32_t c = 0; c < 3; c++)
+		{
+			for (size_t i = 0; i < kColorsNum; i++)
+			{
+				float scale = std::max(fabsf(reference[c][i]), 1.0f);
+				maxError = std::max({maxError, fabsf(planes[c][i] - reference[c][i]) / scale, fabsf(interleaved[i * 4 + c] - reference[c][i]) / scale});
+			}
+		}
+
+		LogStdOut("  %-8s, threaded: SoA %.3f ms (%.1fx), RGBA %.3f ms (%.1fx), max rel error %g\n", GetSimdLevelName((ESimdLevel)level), planesMs,
+		          referenceMs / planesMs, interleavedMs, referenceMs / interleavedMs, maxError);
+		passed &= maxError <= kTolerance;
+	}
+	SetSimdLevel(supportedLevel);
+
+	// spectra go through XYZ, the Rec.709 result matches ToLinearRGB() up to its rounded matrix
+	const uint32_t kSpectraNum = 256;
+	std::vector<Spectrum> spectra(kSpectraNum);
+	for (uint32_t i = 0; i < kSpectraNum; i++)
+		spectra[i] = FresnelConductorExact(cosf(XM_PIDIV2 * i / kSpectraNum), Spectrum(0.2f + i * 0.01f), Spectrum(3.0f));
+	std::vector<float> spectraColors[3];
+	for (uint32_t c = 0; c < 3; c++)
+		spectraColors[c].resize(kSpectraNum);
+	SpectraToColorSpace(spectra.data(), kSpectraNum, kColorSpaceRec709, spectraColors[0].data(), spectraColors[1].data(), spectraColors[2].data());
+	float spectraError = 0.0f;
+	for (uint32_t i = 0; i < kSpectraNum; i++)
+	{
+		float rgb[3];
+		spectra[i].ToLinearRGB(rgb[0], rgb[1], rgb[2]);
+		for (uint32_t c = 0; c < 3; c++)
+			spectraError = std::max(spectraError, fabsf(spectraColors[c][i] - rgb[c]));
+	}
+	LogStdOut("  %u spectra to Rec.709 against ToLinearRGB: max error %g\n", kSpectraNum, spectraError);
+
+	return passed && spectraError < 1e-3f;
+}
+
+
+struct Benchmark
+{
+	const wchar_t* name;
+	bool (*func)();
+};
+
+
+static const Benchmark kBenchmarks[] = {
+    {L"spectrum_expr", BenchmarkSpectrumExpr},
+    {L"spectrum_simd", BenchmarkSpectrumSimd},
+    {L"spectrum_resolution", BenchmarkSpectrumResolution},
+    {L"fresnel_batch", BenchmarkFresnelBatch},
+    {L"hero_wavelength", BenchmarkHeroWavelength},
+    {L"thin_film", BenchmarkThinFilm},
+    {L"spd_resample", BenchmarkSPDResample},
+    {L"spd_load", BenchmarkSPDLoad},
+    {L"spd_eval", BenchmarkSPDEval},
+    {L"spectral_archive", BenchmarkSpectralArchive},
+    {L"spectral_library", BenchmarkSpectralLibrary},
+    {L"conductor_database", BenchmarkConductorDatabase},
+    {L"spectrum_tables", BenchmarkSpectrumTables},
+    {L"rgb_uplifting", BenchmarkRGBUplifting},
+    {L"color_space", BenchmarkColorSpace},
+    {L"merl_load", BenchmarkMERLLoad},
+    {L"merl_compact", BenchmarkMERLCompact},
+    {L"merl_eval", BenchmarkMERLEval},
+    {L"merl_sampling", BenchmarkMERLSampling},
+    {L"merl_fit", BenchmarkMERLFit},
+    {L"cubemap", BenchmarkCubemap},
+    {L"env_sampling", BenchmarkEnvSampling},
+    {L"sh_irradiance", BenchmarkSHIrradiance},
+    {L"specular_prefilter", BenchmarkSpecularPrefilter},
+    {L"env_cache", BenchmarkEnvCache},
+};
+
+
+bool RunBenchmark(const wchar_t* name)
+{
+	bool found = false;
+	bool passed = true;
+	for (const Benchmark& benchmark : kBenchmarks)
+	{
+		if (name && wcscmp(name, L"all") != 0 && wcscmp(name, benchmark.name) != 0)
+			continue;
+
+		found = true;
+		if (!benchmark.func())
+		{
+			LogStdErr("Benchmark '%S' failed\n", benchmark.name);
+			passed = false;
+		}
+	}
+
+	if (!found)
+		LogStdErr("Unknown benchmark '%S'\n", name);
+
+	return found && passed;
+}
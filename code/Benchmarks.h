@@ -0,0 +1,5 @@
+#pragma once
+
+// Runs the benchmark with the given name or all of them if name is null.
+// Returns false if the benchmark is unknown or one of its checks failed.
+bool RunBenchmark(const wchar_t* name);
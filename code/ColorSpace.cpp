@@ -0,0 +1,272 @@
+#include "Precompiled.h"
+#include "ColorSpace.h"
+#include "Simd.h"
+#include "Parallel.h"
+#include <cwctype>
+
+
+struct ColorSpaceDesc
+{
+	// xy chromaticities of the red, green and blue primaries and of the white point
+	double primaries[3][2];
+	double white[2];
+};
+
+static const double kD65White[2] = {0.3127, 0.3290};
+
+static const ColorSpaceDesc kRec709 = {{{0.64, 0.33}, {0.30, 0.60}, {0.15, 0.06}}, {0.3127, 0.3290}};
+static const ColorSpaceDesc kRec2020 = {{{0.708, 0.292}, {0.170, 0.797}, {0.131, 0.046}}, {0.3127, 0.3290}};
+// ACES AP1 primaries with the ACES white point
+static const ColorSpaceDesc kACEScg = {{{0.713, 0.293}, {0.165, 0.830}, {0.128, 0.044}}, {0.32168, 0.33767}};
+
+// Cone response matrix of the Bradford transform
+static const double kBradford[3][3] = {{0.8951, 0.2664, -0.1614}, {-0.7502, 1.7135, 0.0367}, {0.0389, -0.0685, 1.0296}};
+
+// Conversions are split in tasks of this many colors
+static const size_t kColorsPerTask = 16384;
+
+static EColorSpace s_workingColorSpace = kColorSpaceRec709;
+
+
+struct Matrix3d
+{
+	double m[3][3];
+};
+
+
+static Matrix3d Multiply(const Matrix3d& a, const Matrix3d& b)
+{
+	Matrix3d result = {};
+	for (uint32_t i = 0; i < 3; i++)
+		for (uint32_t j = 0; j < 3; j++)
+			for (uint32_t k = 0; k < 3; k++)
+				result.m[i][j] += a.m[i][k] * b.m[k][j];
+	return result;
+}
+
+
+static Matrix3d Inverse(const Matrix3d& a)
+{
+	const double(&m)[3][3] = a.m;
+	double c00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+	double c01 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+	double c02 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+	double invDet = 1.0 / (m[0][0] * c00 + m[0][1] * c01 + m[0][2] * c02);
+
+	Matrix3d result;
+	result.m[0][0] = c00 * invDet;
+	result.m[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * invDet;
+	result.m[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * invDet;
+	result.m[1][0] = c01 * invDet;
+	result.m[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * invDet;
+	result.m[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * invDet;
+	result.m[2][0] = c02 * invDet;
+	result.m[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * invDet;
+	result.m[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * invDet;
+	return result;
+}
+
+
+static void WhiteToXYZ(const double white[2], double xyz[3])
+{
+	xyz[0] = white[0] / white[1];
+	xyz[1] = 1.0;
+	xyz[2] = (1.0 - white[0] - white[1]) / white[1];
+}
+
+
+// Von Kries scaling of the Bradford cone responses from one white to another
+static Matrix3d BradfordAdaptation(const double fromWhite[2], const double toWhite[2])
+{
+	Matrix3d bradford;
+	memcpy(bradford.m, kBradford, sizeof(kBradford));
+
+	double fromXYZ[3], toXYZ[3];
+	WhiteToXYZ(fromWhite, fromXYZ);
+	WhiteToXYZ(toWhite, toXYZ);
+
+	Matrix3d scale = {};
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		double fromCone = kBradford[i][0] * fromXYZ[0] + kBradford[i][1] * fromXYZ[1] + kBradford[i][2] * fromXYZ[2];
+		double toCone = kBradford[i][0] * toXYZ[0] + kBradford[i][1] * toXYZ[1] + kBradford[i][2] * toXYZ[2];
+		scale.m[i][i] = toCone / fromCone;
+	}
+	return Multiply(Inverse(bradford), Multiply(scale, bradford));
+}
+
+
+// RGB to D65 relative XYZ, the columns are the primaries scaled so RGB white maps to the white point
+static Matrix3d RGBToXYZ(const ColorSpaceDesc& desc)
+{
+	Matrix3d primaries;
+	for (uint32_t c = 0; c < 3; c++)
+	{
+		double x = desc.primaries[c][0];
+		double y = desc.primaries[c][1];
+		primaries.m[0][c] = x / y;
+		primaries.m[1][c] = 1.0;
+		primaries.m[2][c] = (1.0 - x - y) / y;
+	}
+
+	double white[3];
+	WhiteToXYZ(desc.white, white);
+	Matrix3d inverse = Inverse(primaries);
+	for (uint32_t c = 0; c < 3; c++)
+	{
+		double scale = inverse.m[c][0] * white[0] + inverse.m[c][1] * white[1] + inverse.m[c][2] * white[2];
+		for (uint32_t r = 0; r < 3; r++)
+			primaries.m[r][c] *= scale;
+	}
+
+	if (desc.white[0] == kD65White[0] && desc.white[1] == kD65White[1])
+		return primaries;
+	return Multiply(BradfordAdaptation(desc.white, kD65White), primaries);
+}
+
+
+static Matrix3d ToXYZ(EColorSpace colorSpace)
+{
+	switch (colorSpace)
+	{
+		case kColorSpaceRec709:
+			return RGBToXYZ(kRec709);
+		case kColorSpaceRec2020:
+			return RGBToXYZ(kRec2020);
+		case kColorSpaceACEScg:
+			return RGBToXYZ(kACEScg);
+		default:
+			return {{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}};
+	}
+}
+
+
+struct ColorMatrices
+{
+	ColorMatrix matrices[kColorSpacesNum][kColorSpacesNum];
+
+	ColorMatrices()
+	{
+		for (uint32_t from = 0; from < kColorSpacesNum; from++)
+		{
+			for (uint32_t to = 0; to < kColorSpacesNum; to++)
+			{
+				// composed in double, so round trips through several spaces only round once per conversion
+				Matrix3d m = Multiply(Inverse(ToXYZ((EColorSpace)to)), ToXYZ((EColorSpace)from));
+				for (uint32_t i = 0; i < 3; i++)
+					for (uint32_t j = 0; j < 3; j++)
+						matrices[from][to].m[i][j] = (float)m.m[i][j];
+			}
+		}
+	}
+};
+
+
+const ColorMatrix& GetColorSpaceMatrix(EColorSpace from, EColorSpace to)
+{
+	static const ColorMatrices s_matrices;
+	return s_matrices.matrices[from][to];
+}
+
+
+EColorSpace GetWorkingColorSpace()
+{
+	return s_workingColorSpace;
+}
+
+
+void SetWorkingColorSpace(EColorSpace colorSpace)
+{
+	s_workingColorSpace = colorSpace;
+}
+
+
+bool FindColorSpace(const wchar_t* name, EColorSpace& colorSpace)
+{
+	for (uint32_t i = 0; i < kColorSpacesNum; i++)
+	{
+		const char* c = kColorSpaceNames[i];
+		const wchar_t* w = name;
+		while (*c && towlower(*w) == (wchar_t)tolower(*c))
+		{
+			c++;
+			w++;
+		}
+
+		if (*c == 0 && *w == 0)
+		{
+			colorSpace = (EColorSpace)i;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+// Transform the colors in [begin, end) a whole packet at a time, returns where the packets stopped
+template <typename P>
+static size_t TransformPlanes(const ColorMatrix& matrix, float* c0, float* c1, float* c2, size_t begin, size_t end)
+{
+	P m[3][3];
+	for (uint32_t i = 0; i < 3; i++)
+		for (uint32_t j = 0; j < 3; j++)
+			m[i][j] = SimdTraits<P>::Set(matrix.m[i][j]);
+
+	size_t i = begin;
+	for (; i + SimdTraits<P>::kWidth <= end; i += SimdTraits<P>::kWidth)
+	{
+		P a = SimdTraits<P>::Load(c0 + i);
+		P b = SimdTraits<P>::Load(c1 + i);
+		P c = SimdTraits<P>::Load(c2 + i);
+		SimdTraits<P>::Store(c0 + i, MulAdd(m[0][0], a, MulAdd(m[0][1], b, m[0][2] * c)));
+		SimdTraits<P>::Store(c1 + i, MulAdd(m[1][0], a, MulAdd(m[1][1], b, m[1][2] * c)));
+		SimdTraits<P>::Store(c2 + i, MulAdd(m[2][0], a, MulAdd(m[2][1], b, m[2][2] * c)));
+	}
+	return i;
+}
+
+
+static void TransformPlanes(const ColorMatrix& matrix, float* c0, float* c1, float* c2, size_t count)
+{
+	DispatchSimd([&](auto packet) {
+		using P = decltype(packet);
+		size_t i = TransformPlanes<P>(matrix, c0, c1, c2, 0, count);
+		TransformPlanes<float>(matrix, c0, c1, c2, i, count);
+	});
+}
+
+
+// Call func(begin, end) over the ranges of every task, the calling thread takes part
+template <typename FUNC>
+static void ForEachTask(size_t count, const FUNC& func)
+{
+	uint32_t tasksNum = (uint32_t)((count + kColorsPerTask - 1) / kColorsPerTask);
+	ParallelFor(tasksNum, [&](uint32_t task) {
+		size_t begin = task * kColorsPerTask;
+		func(begin, std::min(begin + kColorsPerTask, count));
+	});
+}
+
+
+void ConvertColors(EColorSpace from, EColorSpace to, float* c0, float* c1, float* c2, size_t count)
+{
+	if (from == to)
+		return;
+
+	const ColorMatrix& matrix = GetColorSpaceMatrix(from, to);
+	ForEachTask(count, [&](size_t begin, size_t end) { TransformPlanes(matrix, c0 + begin, c1 + begin, c2 + begin, end - begin); });
+}
+
+
+void ConvertColors(EColorSpace from, EColorSpace to, float* colors, size_t count, uint32_t stride)
+{
+	if (from == to)
+		return;
+
+	// gathering interleaved colors into SoA packets costs more than the 3x3 transform itself, the pass is bound by memory
+	const ColorMatrix& matrix = GetColorSpaceMatrix(from, to);
+	ForEachTask(count, [&](size_t begin, size_t end) {
+		for (float* color = colors + begin * stride; begin < end; begin++, color += stride)
+			matrix.Transform(color[0], color[1], color[2], color[0], color[1], color[2]);
+	});
+}
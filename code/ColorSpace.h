@@ -0,0 +1,63 @@
+#pragma once
+#include "SpectralPowerDistribution.h"
+
+
+enum EColorSpace
+{
+	kColorSpaceXYZ = 0,
+	kColorSpaceRec709,
+	kColorSpaceRec2020,
+	kColorSpaceACEScg,
+	kColorSpacesNum
+};
+
+static const char* const kColorSpaceNames[kColorSpacesNum] = {"XYZ", "Rec.709", "Rec.2020", "ACEScg"};
+
+
+// Color space picked by the command line or the UI, RGB results are converted to it. Defaults to Rec.709
+EColorSpace GetWorkingColorSpace();
+void SetWorkingColorSpace(EColorSpace colorSpace);
+
+// Case insensitive match of a command line argument against kColorSpaceNames, false when nothing matches
+bool FindColorSpace(const wchar_t* name, EColorSpace& colorSpace);
+
+
+/**
+ * \brief 3x3 transform between two color spaces, rows produce the output channels.
+ *
+ * XYZ is relative to D65 white like the rest of the spectral code, so
+ * Rec.709 and Rec.2020 convert to it directly and ACEScg, whose white is
+ * close to D60, goes through a Bradford chromatic adaptation.
+ */
+struct ColorMatrix
+{
+	float m[3][3];
+
+	void Transform(float c0, float c1, float c2, float& out0, float& out1, float& out2) const;
+};
+
+
+inline void ColorMatrix::Transform(float c0, float c1, float c2, float& out0, float& out1, float& out2) const
+{
+	out0 = m[0][0] * c0 + m[0][1] * c1 + m[0][2] * c2;
+	out1 = m[1][0] * c0 + m[1][1] * c1 + m[1][2] * c2;
+	out2 = m[2][0] * c0 + m[2][1] * c1 + m[2][2] * c2;
+}
+
+
+const ColorMatrix& GetColorSpaceMatrix(EColorSpace from, EColorSpace to);
+
+// Convert in place SoA planes of count colors, batches above a few thousand colors are split across threads
+void ConvertColors(EColorSpace from, EColorSpace to, float* c0, float* c1, float* c2, size_t count);
+// Convert in place the first three channels of count interleaved colors, stride floats apart, e.g. RGBA float images or XMVECTOR arrays
+void ConvertColors(EColorSpace from, EColorSpace to, float* colors, size_t count, uint32_t stride = 4);
+
+
+// Colors of count spectra in a color space, written to SoA planes
+template <typename S>
+void SpectraToColorSpace(const S* spectra, size_t count, EColorSpace colorSpace, float* c0, float* c1, float* c2)
+{
+	for (size_t i = 0; i < count; i++)
+		spectra[i].ToXYZ(c0[i], c1[i], c2[i]);
+	ConvertColors(kColorSpaceXYZ, colorSpace, c0, c1, c2, count);
+}
@@ -0,0 +1,150 @@
+#include "Precompiled.h"
+#include "ConductorDatabase.h"
+#include "Fresnel.h"
+#include "Parallel.h"
+
+
+static const char* kDatabasePath = "data\\Conductors.bin";
+
+// bump on any change of ConductorReflectance or of the way it is baked
+static const uint32_t kDatabaseVersion = 4;
+static const uint32_t kDatabaseMagic = 0x42444E43;  // "CNDB"
+static const float kF82CosTheta = 1.0f / 7.0f;
+static const uint32_t kAlbedoSamples = 64;
+
+
+struct DatabaseHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t archiveHash;
+	uint32_t curveSamples;
+	uint32_t conductorsNum;
+};
+
+
+static ConductorDatabase s_conductorDatabase;
+
+
+XMVECTOR ConductorReflectance::Eval(float cosTheta) const
+{
+	float t = std::min(std::max(cosTheta, 0.0f), 1.0f) * (kCurveSamples - 1);
+	uint32_t i = std::min((uint32_t)t, kCurveSamples - 2);
+	XMVECTOR a = XMLoadFloat3(&curve[i]);
+	XMVECTOR b = XMLoadFloat3(&curve[i + 1]);
+	return XMVectorAdd(a, XMVectorScale(XMVectorSubtract(b, a), t - i));
+}
+
+
+void ConductorDatabase::Bake(const SpectralArchive::Material& material, ConductorReflectance& conductor)
+{
+	const Spectrum& eta = *material.eta;
+	const Spectrum& k = *material.k;
+
+	memset(&conductor, 0, sizeof(conductor));
+	strncpy(conductor.name, material.name, ConductorReflectance::kNameLength - 1);
+
+	XMVECTOR F0 = FresnelConductorRGB(1.0f, eta, k);
+	XMVECTOR F82 = FresnelConductorRGB(kF82CosTheta, eta, k);
+	XMStoreFloat3(&conductor.F0, F0);
+	XMStoreFloat3(&conductor.F82, F82);
+	XMStoreFloat3(&conductor.F82Tint, XMVectorDivide(F82, FresnelSchlick(F0, kF82CosTheta)));
+
+	float cosThetas[ConductorReflectance::kCurveSamples + kAlbedoSamples];
+	XMVECTOR fresnel[ConductorReflectance::kCurveSamples + kAlbedoSamples];
+	for (uint32_t i = 0; i < ConductorReflectance::kCurveSamples; i++)
+		cosThetas[i] = (float)i / (ConductorReflectance::kCurveSamples - 1);
+	for (uint32_t i = 0; i < kAlbedoSamples; i++)
+		cosThetas[ConductorReflectance::kCurveSamples + i] = (i + 0.5f) / kAlbedoSamples;
+	FresnelConductorRGB(cosThetas, (uint32_t)_countof(cosThetas), eta, k, fresnel);
+
+	for (uint32_t i = 0; i < ConductorReflectance::kCurveSamples; i++)
+		XMStoreFloat3(&conductor.curve[i], fresnel[i]);
+
+	// 2 * integral of F(mu) * mu dmu over [0, 1], midpoint rule
+	XMVECTOR albedo = XMVectorZero();
+	for (uint32_t i = ConductorReflectance::kCurveSamples; i < _countof(cosThetas); i++)
+		albedo = XMVectorAdd(albedo, XMVectorScale(fresnel[i], cosThetas[i]));
+	XMStoreFloat3(&conductor.albedo, XMVectorScale(albedo, 2.0f / kAlbedoSamples));
+}
+
+
+void ConductorDatabase::Bake(const SpectralArchive& archive, std::vector<ConductorReflectance>& conductors, uint32_t threadsNum)
+{
+	conductors.resize(archive.GetMaterialsNum());
+	ParallelFor(
+	    archive.GetMaterialsNum(), [&](uint32_t i) { Bake(archive.GetMaterial(i), conductors[i]); }, threadsNum);
+}
+
+
+static bool ReadDatabase(const SpectralArchive& archive, std::vector<ConductorReflectance>& conductors)
+{
+	File file(kDatabasePath, File::kOpenRead);
+	if (!file.IsOpened())
+		return false;
+
+	DatabaseHeader header;
+	if (file.Read(&header, sizeof(header)) != sizeof(header) || header.magic != kDatabaseMagic || header.version != kDatabaseVersion ||
+	    header.archiveHash != archive.GetHash() || header.curveSamples != ConductorReflectance::kCurveSamples ||
+	    header.conductorsNum != archive.GetMaterialsNum() || file.GetSize() != sizeof(header) + header.conductorsNum * sizeof(ConductorReflectance))
+		return false;
+
+	conductors.resize(header.conductorsNum);
+	uint32_t size = header.conductorsNum * sizeof(ConductorReflectance);
+	return file.Read(conductors.data(), size) == size;
+}
+
+
+bool ConductorDatabase::Init(const SpectralArchive& archive)
+{
+	m_conductors.clear();
+	if (!archive.IsOpened())
+		return false;
+
+	if (ReadDatabase(archive, m_conductors))
+		return true;
+
+	Bake(archive, m_conductors);
+
+	DatabaseHeader header = {};
+	header.magic = kDatabaseMagic;
+	header.version = kDatabaseVersion;
+	header.archiveHash = archive.GetHash();
+	header.curveSamples = ConductorReflectance::kCurveSamples;
+	header.conductorsNum = (uint32_t)m_conductors.size();
+
+	// a read-only data directory only costs a rebake on the next start
+	File output(kDatabasePath, File::kOpenWrite);
+	if (output.IsOpened())
+	{
+		output.Write(&header, sizeof(header));
+		output.Write(m_conductors.data(), (uint32_t)(m_conductors.size() * sizeof(ConductorReflectance)));
+		LogStdOut("Baked %u conductors into '%s'\n", header.conductorsNum, kDatabasePath);
+	}
+
+	return true;
+}
+
+
+const ConductorReflectance* ConductorDatabase::Find(const char* name) const
+{
+	// baked in the order of the archive, i.e. sorted by name
+	auto it = std::lower_bound(m_conductors.begin(), m_conductors.end(), name,
+	                           [](const ConductorReflectance& conductor, const char* name) { return strcmp(conductor.name, name) < 0; });
+	if (it == m_conductors.end() || strcmp(it->name, name) != 0)
+		return nullptr;
+
+	return &*it;
+}
+
+
+bool InitConductorDatabase()
+{
+	return s_conductorDatabase.Init(GetSpectralArchive());
+}
+
+
+const ConductorDatabase& GetConductorDatabase()
+{
+	return s_conductorDatabase;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "SpectralArchive.h"
+
+
+/**
+ * \brief Linear RGB reflectances of a conductor under D65, baked from its
+ * spectral eta/k at the 1 nm resolution.
+ */
+struct ConductorReflectance
+{
+	static const uint32_t kNameLength = 64;
+	// the Fresnel curve is sampled uniformly in cos theta, which puts most samples near grazing angles
+	static const uint32_t kCurveSamples = 64;
+
+	char name[kNameLength];
+	// Fresnel at normal incidence
+	XMFLOAT3 F0;
+	// Fresnel at the angle where the Schlick error peaks, cos theta = 1/7 (~82 degrees)
+	XMFLOAT3 F82;
+	// F82 / Schlick(F0, 1/7), the tint of the F82 model of Kutz et al. 2021
+	XMFLOAT3 F82Tint;
+	// Fresnel averaged over the cosine weighted hemisphere
+	XMFLOAT3 albedo;
+	XMFLOAT3 curve[kCurveSamples];
+
+	XMVECTOR Eval(float cosTheta) const;
+};
+
+
+/**
+ * \brief Reflectances of every IOR of the spectral archive, baked in
+ * parallel once and stored in data\Conductors.bin, so looking one up costs
+ * nothing at runtime. The table is rebaked when the archive changes.
+ */
+class ConductorDatabase
+{
+public:
+	bool Init(const SpectralArchive& archive);
+
+	// Bake every material of the archive, on all hardware threads when threadsNum is 0
+	static void Bake(const SpectralArchive& archive, std::vector<ConductorReflectance>& conductors, uint32_t threadsNum = 0);
+	static void Bake(const SpectralArchive::Material& material, ConductorReflectance& conductor);
+
+	uint32_t GetConductorsNum() const;
+	const ConductorReflectance& GetConductor(uint32_t index) const;
+	const ConductorReflectance* Find(const char* name) const;
+
+private:
+	std::vector<ConductorReflectance> m_conductors;
+};
+
+
+inline uint32_t ConductorDatabase::GetConductorsNum() const
+{
+	return (uint32_t)m_conductors.size();
+}
+
+
+inline const ConductorReflectance& ConductorDatabase::GetConductor(uint32_t index) const
+{
+	return m_conductors[index];
+}
+
+
+bool InitConductorDatabase();
+const ConductorDatabase& GetConductorDatabase();
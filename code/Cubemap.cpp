@@ -0,0 +1,329 @@
+#include "Precompiled.h"
+#include "Cubemap.h"
+#include "Parallel.h"
+#include <DirectXPackedVector.h>
+
+
+// faces are split in square tiles of this many texels per side, one task each
+static const uint32_t kTileSize = 32;
+
+// view directions and up vectors of the faces
+static const XMFLOAT3 kFaceDirs[Cubemap::kFacesNum] = {
+    {1.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f},
+};
+static const XMFLOAT3 kFaceUps[Cubemap::kFacesNum] = {
+    {0.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f},
+};
+
+
+// Basis of the view matrix of a face, as XMMatrixLookAtLH() builds it
+struct FaceFrame
+{
+	XMFLOAT3 right;
+	XMFLOAT3 up;
+	XMFLOAT3 forward;
+};
+
+
+static XMFLOAT3 Cross(const XMFLOAT3& a, const XMFLOAT3& b)
+{
+	return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+
+static float Dot(const XMFLOAT3& a, const XMFLOAT3& b)
+{
+	return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+
+XMMATRIX Cubemap::GetFaceViewMatrix(uint32_t face)
+{
+	return XMMatrixLookAtLH(XMVectorZero(), XMLoadFloat3(&kFaceDirs[face]), XMLoadFloat3(&kFaceUps[face]));
+}
+
+
+static FaceFrame GetFaceFrame(uint32_t face)
+{
+	// the inputs are unit and orthogonal, so the cross products need no normalization
+	FaceFrame frame;
+	frame.forward = kFaceDirs[face];
+	frame.right = Cross(kFaceUps[face], frame.forward);
+	frame.up = Cross(frame.forward, frame.right);
+	return frame;
+}
+
+
+XMFLOAT3 Cubemap::GetDirection(uint32_t face, float s, float t)
+{
+	// clip space x grows with s and y with 1 - t, the projection has a 90 degree field of view
+	FaceFrame frame = GetFaceFrame(face);
+	float x = 2.0f * s - 1.0f;
+	float y = 1.0f - 2.0f * t;
+	return {frame.forward.x + x * frame.right.x + y * frame.up.x, frame.forward.y + x * frame.right.y + y * frame.up.y,
+	        frame.forward.z + x * frame.right.z + y * frame.up.z};
+}
+
+
+uint32_t Cubemap::GetFaceCoords(const XMFLOAT3& direction, float& s, float& t)
+{
+	float ax = fabsf(direction.x);
+	float ay = fabsf(direction.y);
+	float az = fabsf(direction.z);
+	uint32_t face;
+	if (ax >= ay && ax >= az)
+		face = direction.x >= 0.0f ? 0 : 1;
+	else if (ay >= az)
+		face = direction.y >= 0.0f ? 2 : 3;
+	else
+		face = direction.z >= 0.0f ? 4 : 5;
+
+	FaceFrame frame = GetFaceFrame(face);
+	float invDepth = 1.0f / Dot(direction, frame.forward);
+	s = 0.5f + 0.5f * Dot(direction, frame.right) * invDepth;
+	t = 0.5f - 0.5f * Dot(direction, frame.up) * invDepth;
+	return face;
+}
+
+
+XMFLOAT2 Cubemap::GetEquirectCoords(const XMFLOAT3& direction)
+{
+	float length = sqrtf(Dot(direction, direction));
+	float u = atan2f(direction.x, direction.z) / (2.0f * XM_PI);
+	float v = acosf(std::min(std::max(direction.y / length, -1.0f), 1.0f)) / XM_PI;
+	return {u >= 0.0f ? u : u + 1.0f, v};
+}
+
+
+// Longitude wraps around, latitude clamps at the poles
+static const XMFLOAT4& GetPixel(const EquirectImage& image, int32_t x, int32_t y)
+{
+	x %= (int32_t)image.width;
+	x = x < 0 ? x + (int32_t)image.width : x;
+	y = std::min(std::max(y, 0), (int32_t)image.height - 1);
+	return image.pixels[(size_t)y * image.width + x];
+}
+
+
+static void Accumulate(XMFLOAT4& sum, const XMFLOAT4& value, float weight)
+{
+	sum.x += value.x * weight;
+	sum.y += value.y * weight;
+	sum.z += value.z * weight;
+	sum.w += value.w * weight;
+}
+
+
+static XMFLOAT4 SampleBilinear(const EquirectImage& image, const XMFLOAT2& uv)
+{
+	float x = uv.x * image.width - 0.5f;
+	float y = uv.y * image.height - 0.5f;
+	float x0 = floorf(x);
+	float y0 = floorf(y);
+	float fx = x - x0;
+	float fy = y - y0;
+
+	XMFLOAT4 result = {0.0f, 0.0f, 0.0f, 0.0f};
+	Accumulate(result, GetPixel(image, (int32_t)x0, (int32_t)y0), (1.0f - fx) * (1.0f - fy));
+	Accumulate(result, GetPixel(image, (int32_t)x0 + 1, (int32_t)y0), fx * (1.0f - fy));
+	Accumulate(result, GetPixel(image, (int32_t)x0, (int32_t)y0 + 1), (1.0f - fx) * fy);
+	Accumulate(result, GetPixel(image, (int32_t)x0 + 1, (int32_t)y0 + 1), fx * fy);
+	return result;
+}
+
+
+static void CatmullRomWeights(float t, float weights[4])
+{
+	weights[0] = t * (-0.5f + t * (1.0f - 0.5f * t));
+	weights[1] = 1.0f + t * t * (-2.5f + 1.5f * t);
+	weights[2] = t * (0.5f + t * (2.0f - 1.5f * t));
+	weights[3] = t * t * (-0.5f + 0.5f * t);
+}
+
+
+static XMFLOAT4 SampleBicubic(const EquirectImage& image, const XMFLOAT2& uv)
+{
+	float x = uv.x * image.width - 0.5f;
+	float y = uv.y * image.height - 0.5f;
+	float x0 = floorf(x);
+	float y0 = floorf(y);
+	float wx[4], wy[4];
+	CatmullRomWeights(x - x0, wx);
+	CatmullRomWeights(y - y0, wy);
+
+	XMFLOAT4 result = {0.0f, 0.0f, 0.0f, 0.0f};
+	for (int32_t j = 0; j < 4; j++)
+		for (int32_t i = 0; i < 4; i++)
+			Accumulate(result, GetPixel(image, (int32_t)x0 + i - 1, (int32_t)y0 + j - 1), wx[i] * wy[j]);
+
+	// the negative lobes ring around bright spots like the sun, radiance cannot go below 0
+	return {std::max(result.x, 0.0f), std::max(result.y, 0.0f), std::max(result.z, 0.0f), std::max(result.w, 0.0f)};
+}
+
+
+// Call func(face, x0, y0, x1, y1) over the tiles of every face of a mip, the calling thread takes part
+template <typename FUNC>
+static void ForEachTile(uint32_t resolution, uint32_t threadsNum, const FUNC& func)
+{
+	uint32_t tilesPerAxis = (resolution + kTileSize - 1) / kTileSize;
+	uint32_t tilesPerFace = tilesPerAxis * tilesPerAxis;
+	ParallelFor(
+	    Cubemap::kFacesNum * tilesPerFace,
+	    [&](uint32_t task) {
+		    uint32_t tile = task % tilesPerFace;
+		    uint32_t x0 = tile % tilesPerAxis * kTileSize;
+		    uint32_t y0 = tile / tilesPerAxis * kTileSize;
+		    func(task / tilesPerFace, x0, y0, std::min(x0 + kTileSize, resolution), std::min(y0 + kTileSize, resolution));
+	    },
+	    threadsNum);
+}
+
+
+void Cubemap::Init(uint32_t resolution, uint32_t mipLevels)
+{
+	Assert(resolution > 0 && (resolution & (resolution - 1)) == 0);
+	uint32_t fullChain = 1;
+	while ((resolution >> fullChain) > 0)
+		fullChain++;
+
+	m_resolution = resolution;
+	m_mipLevels = mipLevels == 0 ? fullChain : std::min(mipLevels, fullChain);
+	m_mipOffsets.resize(m_mipLevels);
+	size_t texelsNum = 0;
+	for (uint32_t mip = 0; mip < m_mipLevels; mip++)
+	{
+		m_mipOffsets[mip] = texelsNum;
+		texelsNum += (size_t)kFacesNum * GetMipResolution(mip) * GetMipResolution(mip);
+	}
+	m_texels.assign(texelsNum, {0.0f, 0.0f, 0.0f, 0.0f});
+}
+
+
+void Cubemap::Release()
+{
+	m_resolution = 0;
+	m_mipLevels = 0;
+	m_texels.clear();
+	m_texels.shrink_to_fit();
+	m_mipOffsets.clear();
+}
+
+
+XMFLOAT4 Cubemap::SampleMip(const XMFLOAT3& direction, uint32_t mip) const
+{
+	uint32_t resolution = GetMipResolution(mip);
+	float s, t;
+	uint32_t face = GetFaceCoords(direction, s, t);
+	float x = s * resolution - 0.5f;
+	float y = t * resolution - 0.5f;
+	float x0 = floorf(x);
+	float y0 = floorf(y);
+	float fx = x - x0;
+	float fy = y - y0;
+
+	XMFLOAT4 result = {0.0f, 0.0f, 0.0f, 0.0f};
+	const float weights[4] = {(1.0f - fx) * (1.0f - fy), fx * (1.0f - fy), (1.0f - fx) * fy, fx * fy};
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		int32_t tx = (int32_t)x0 + (int32_t)(i & 1);
+		int32_t ty = (int32_t)y0 + (int32_t)(i >> 1);
+		uint32_t tapFace = face;
+		if (tx < 0 || ty < 0 || tx >= (int32_t)resolution || ty >= (int32_t)resolution)
+		{
+			// the center of the tap on the plane of the face lies on the neighbor, take the texel there
+			float tapS, tapT;
+			tapFace = GetFaceCoords(GetDirection(face, (tx + 0.5f) / resolution, (ty + 0.5f) / resolution), tapS, tapT);
+			tx = std::min((int32_t)(tapS * resolution), (int32_t)resolution - 1);
+			ty = std::min((int32_t)(tapT * resolution), (int32_t)resolution - 1);
+		}
+		Accumulate(result, GetFace(mip, tapFace)[ty * resolution + tx], weights[i]);
+	}
+	return result;
+}
+
+
+XMFLOAT4 Cubemap::Sample(const XMFLOAT3& direction, float lod) const
+{
+	Assert(!m_texels.empty());
+	lod = std::min(std::max(lod, 0.0f), (float)(m_mipLevels - 1));
+	uint32_t mip = (uint32_t)lod;
+	float fraction = lod - mip;
+	XMFLOAT4 result = SampleMip(direction, mip);
+	if (fraction > 0.0f)
+	{
+		XMFLOAT4 next = SampleMip(direction, mip + 1);
+		result = {Lerp(fraction, result.x, next.x), Lerp(fraction, result.y, next.y), Lerp(fraction, result.z, next.z), Lerp(fraction, result.w, next.w)};
+	}
+	return result;
+}
+
+
+void Cubemap::ConvertFromEquirect(const EquirectImage& image, ECubemapFilter filter, uint32_t threadsNum)
+{
+	Assert(!m_texels.empty() && image.width > 0 && image.height > 0);
+	ForEachTile(m_resolution, threadsNum, [&](uint32_t face, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1) {
+		XMFLOAT4* texels = GetFace(0, face);
+		float invResolution = 1.0f / m_resolution;
+		for (uint32_t y = y0; y < y1; y++)
+		{
+			for (uint32_t x = x0; x < x1; x++)
+			{
+				XMFLOAT2 uv = GetEquirectCoords(GetDirection(face, (x + 0.5f) * invResolution, (y + 0.5f) * invResolution));
+				texels[y * m_resolution + x] = filter == kCubemapFilterBicubic ? SampleBicubic(image, uv) : SampleBilinear(image, uv);
+			}
+		}
+	});
+	GenerateMips(threadsNum);
+}
+
+
+void Cubemap::GenerateMips(uint32_t threadsNum)
+{
+	for (uint32_t mip = 1; mip < m_mipLevels; mip++)
+	{
+		uint32_t resolution = GetMipResolution(mip);
+		uint32_t sourceResolution = GetMipResolution(mip - 1);
+		ForEachTile(resolution, threadsNum, [&](uint32_t face, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1) {
+			const XMFLOAT4* source = GetFace(mip - 1, face);
+			XMFLOAT4* texels = GetFace(mip, face);
+			for (uint32_t y = y0; y < y1; y++)
+			{
+				for (uint32_t x = x0; x < x1; x++)
+				{
+					const XMFLOAT4* row = source + (size_t)y * 2 * sourceResolution + x * 2;
+					XMFLOAT4 sum = {0.0f, 0.0f, 0.0f, 0.0f};
+					Accumulate(sum, row[0], 0.25f);
+					Accumulate(sum, row[1], 0.25f);
+					Accumulate(sum, row[sourceResolution], 0.25f);
+					Accumulate(sum, row[sourceResolution + 1], 0.25f);
+					texels[y * resolution + x] = sum;
+				}
+			}
+		});
+	}
+}
+
+
+bool Cubemap::SaveToDDS(const wchar_t* filename) const
+{
+	if (m_texels.empty())
+		return false;
+
+	ScratchImage image;
+	if (FAILED(image.InitializeCube(DXGI_FORMAT_R16G16B16A16_FLOAT, m_resolution, m_resolution, 1, m_mipLevels)))
+		return false;
+
+	for (uint32_t face = 0; face < kFacesNum; face++)
+	{
+		for (uint32_t mip = 0; mip < m_mipLevels; mip++)
+		{
+			const Image* destination = image.GetImage(mip, face, 0);
+			const XMFLOAT4* texels = GetFace(mip, face);
+			uint32_t resolution = GetMipResolution(mip);
+			for (uint32_t y = 0; y < resolution; y++)
+				PackedVector::XMConvertFloatToHalfStream((PackedVector::HALF*)(destination->pixels + y * destination->rowPitch), sizeof(PackedVector::HALF),
+				                                         &texels[y * resolution].x, sizeof(float), resolution * 4);
+		}
+	}
+	return SUCCEEDED(SaveToDDSFile(image.GetImages(), image.GetImageCount(), image.GetMetadata(), DDS_FLAGS_NONE, filename));
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+
+enum ECubemapFilter
+{
+	kCubemapFilterBilinear = 0,
+	// Catmull-Rom, sharper than bilinear when a face texel covers less than a source pixel
+	kCubemapFilterBicubic,
+	kCubemapFiltersNum
+};
+
+static const char* const kCubemapFilterNames[kCubemapFiltersNum] = {"bilinear", "bicubic"};
+
+
+// Latitude-longitude image of RGBA floats with tightly packed rows, as env_emitter.hlsl samples it
+struct EquirectImage
+{
+	const XMFLOAT4* pixels;
+	uint32_t width;
+	uint32_t height;
+};
+
+
+/**
+ * \brief CPU cubemap with its mip chain, the counterpart of the cubemap
+ * EnvEmitter::BakeCubemap() renders on the GPU.
+ *
+ * Faces follow GetFaceViewMatrix(), which the GPU bake uses as well, the
+ * usual D3D layout. An equirect image maps onto them exactly like
+ * env_emitter.hlsl does. Work is split across threads in tiles of a face,
+ * mips are 2x2 box filtered like mips_generator.hlsl. The texels of a mip
+ * are stored face after face.
+ */
+class Cubemap
+{
+public:
+	static const uint32_t kFacesNum = 6;
+	// resolution of the cubemap EnvEmitter bakes
+	static const uint32_t kDefaultResolution = 256;
+
+	// A power of two resolution, with the full mip chain when mipLevels is 0
+	void Init(uint32_t resolution, uint32_t mipLevels = 0);
+	void Release();
+
+	// Fill the first mip from an equirect image and generate the others, on all hardware threads when threadsNum is 0
+	void ConvertFromEquirect(const EquirectImage& image, ECubemapFilter filter, uint32_t threadsNum = 0);
+	void GenerateMips(uint32_t threadsNum = 0);
+
+	// R16G16B16A16_FLOAT cube texture with every mip, the format of the baked cubemap
+	bool SaveToDDS(const wchar_t* filename) const;
+
+	uint32_t GetResolution() const;
+	uint32_t GetMipLevels() const;
+	uint32_t GetMipResolution(uint32_t mip) const;
+	XMFLOAT4* GetFace(uint32_t mip, uint32_t face);
+	const XMFLOAT4* GetFace(uint32_t mip, uint32_t face) const;
+
+	// Trilinear like SampleLevel() with a linear sampler, bilinear taps past a face edge are taken from the neighboring face
+	XMFLOAT4 Sample(const XMFLOAT3& direction, float lod) const;
+
+	// View matrix of a face, shared with the GPU bake of EnvEmitter
+	static XMMATRIX GetFaceViewMatrix(uint32_t face);
+	// Unnormalized direction through a point of a face, s and t in [0, 1] from the top left corner
+	static XMFLOAT3 GetDirection(uint32_t face, float s, float t);
+	// Face and position on it of a direction, the inverse of GetDirection()
+	static uint32_t GetFaceCoords(const XMFLOAT3& direction, float& s, float& t);
+	// Equirect coordinates in [0, 1] of a direction, the mapping of env_emitter.hlsl
+	static XMFLOAT2 GetEquirectCoords(const XMFLOAT3& direction);
+
+private:
+	uint32_t m_resolution = 0;
+	uint32_t m_mipLevels = 0;
+	std::vector<XMFLOAT4> m_texels;
+	std::vector<size_t> m_mipOffsets;
+
+	XMFLOAT4 SampleMip(const XMFLOAT3& direction, uint32_t mip) const;
+};
+
+
+inline uint32_t Cubemap::GetResolution() const
+{
+	return m_resolution;
+}
+
+
+inline uint32_t Cubemap::GetMipLevels() const
+{
+	return m_mipLevels;
+}
+
+
+inline uint32_t Cubemap::GetMipResolution(uint32_t mip) const
+{
+	return std::max(m_resolution >> mip, 1u);
+}
+
+
+inline XMFLOAT4* Cubemap::GetFace(uint32_t mip, uint32_t face)
+{
+	uint32_t resolution = GetMipResolution(mip);
+	return m_texels.data() + m_mipOffsets[mip] + (size_t)face * resolution * resolution;
+}
+
+
+inline const XMFLOAT4* Cubemap::GetFace(uint32_t mip, uint32_t face) const
+{
+	uint32_t resolution = GetMipResolution(mip);
+	return m_texels.data() + m_mipOffsets[mip] + (size_t)face * resolution * resolution;
+}
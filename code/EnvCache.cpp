@@ -0,0 +1,78 @@
+#include "Precompiled.h"
+#include "EnvCache.h"
+
+
+static const char* const kEnvCacheDirectory = "data\\EnvCache";
+
+
+bool HashEnvCacheSource(const char* filename, uint64_t& hash)
+{
+	MappedFile file;
+	if (!file.Open(filename))
+		return false;
+
+	hash = HashBytes(file.GetData(), file.GetSize());
+	return true;
+}
+
+
+uint64_t GetEnvCacheKey(EEnvCacheProduct product, uint64_t sourceHash, const EnvCacheParameters& parameters, uint32_t version)
+{
+	// the diffuse filter draws TotalSamples like the specular one and the LUT
+	uint32_t fields[] = {version, (uint32_t)product, kEnvCacheResolutions[product], parameters.samplesNum};
+	uint64_t hash = HashBytes(fields, sizeof(fields));
+	if (product != kEnvCacheBRDFLut)
+	{
+		hash = HashBytes(&sourceHash, sizeof(sourceHash), hash);
+		hash = HashBytes(&parameters.scale, sizeof(parameters.scale), hash);
+	}
+	return hash;
+}
+
+
+FilePath GetEnvCachePath(EEnvCacheProduct product, uint64_t key)
+{
+	char name[64];
+	snprintf(name, sizeof(name), "%016llx.%s.dds", (unsigned long long)key, kEnvCacheProductNames[product]);
+	FilePath path = kEnvCacheDirectory;
+	path /= name;
+	return path;
+}
+
+
+bool IsEnvCached(EEnvCacheProduct product, uint64_t key)
+{
+	File file(GetEnvCachePath(product, key).c_str(), File::kOpenRead);
+	return file.IsOpened();
+}
+
+
+bool SaveEnvCacheProduct(EEnvCacheProduct product, uint64_t key, const ScratchImage& image)
+{
+	// fails when it already exists, a missing directory shows up as a failed save
+	CreateDirectoryA(kEnvCacheDirectory, nullptr);
+	FilePathW path = ConvertPath(GetEnvCachePath(product, key));
+	if (SUCCEEDED(SaveToDDSFile(image.GetImages(), image.GetImageCount(), image.GetMetadata(), DDS_FLAGS_NONE, path.c_str())))
+		return true;
+
+	LogStdErr("Failed to save output file '%S'\n", path.c_str());
+	return false;
+}
+
+
+bool LoadEnvCacheProduct(EEnvCacheProduct product, uint64_t key, uint32_t mipLevels, ScratchImage& image)
+{
+	FilePathW path = ConvertPath(GetEnvCachePath(product, key));
+	TexMetadata metadata;
+	if (!IsEnvCached(product, key) || FAILED(LoadFromDDSFile(path.c_str(), DDS_FLAGS_NONE, &metadata, image)))
+		return false;
+
+	bool cube = product != kEnvCacheBRDFLut;
+	if (metadata.format != DXGI_FORMAT_R16G16B16A16_FLOAT || metadata.width != kEnvCacheResolutions[product] ||
+	    metadata.height != kEnvCacheResolutions[product] || metadata.IsCubemap() != cube || metadata.mipLevels != mipLevels)
+	{
+		LogStdErr("Unexpected layout of cached environment '%S'\n", path.c_str());
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "EnvFilterConstants.h"
+
+
+enum EEnvCacheProduct
+{
+	// the prefiltered specular cube of EnvMapFilter, with its mips
+	kEnvCacheSpecular = 0,
+	// the diffuse cube of EnvMapFilter
+	kEnvCacheDiffuse,
+	// the BRDF LUT of EnvMapFilter, shared by every environment
+	kEnvCacheBRDFLut,
+	kEnvCacheProductsNum
+};
+
+// bump on any change of how a product is baked, every key covers it
+static const uint32_t kEnvCacheVersion = 2;
+static const char* const kEnvCacheProductNames[kEnvCacheProductsNum] = {"specular", "diffuse", "brdflut"};
+// resolution of every product, EnvMapFilter allocates its render targets with them
+static const uint32_t kEnvCacheResolutions[kEnvCacheProductsNum] = {kSpecularEnvMapResolution, kDiffuseEnvMapResolution, kBRDFLutResolution};
+
+
+// What a bake depends on besides the environment
+struct EnvCacheParameters
+{
+	// scale of EnvEmitter, applied to the radiance before filtering
+	float scale = 1.0f;
+	// TotalSamples of the GPU filter, the "Samples count" of the UI
+	uint32_t samplesNum = kEnvFilterSamplesNum;
+};
+
+
+/**
+ * \brief Content addressed cache of the products of EnvMapFilter, DDS files
+ * in data\EnvCache named after a key of everything they depend on.
+ *
+ * The key hashes the bytes of the HDR rather than its name, a renamed file
+ * still hits and an edited one misses. It also covers the emitter scale,
+ * the samples count, the resolution of the product and a version bumped on
+ * any change of a bake, so a stale file is never read, only left behind.
+ * Products are the render targets of EnvMapFilter read back after the GPU
+ * ran FilterEnvMap(), so a hit renders the same as a miss. The envcache
+ * command fills them, the app only reads them. Only environments loaded
+ * from a file have a key, a constant one is always filtered.
+ */
+
+// FNV-1a of the bytes of an environment file, false when it cannot be read
+bool HashEnvCacheSource(const char* filename, uint64_t& hash);
+// The key of the LUT ignores the source and the scale, keys of an older version name the files it left behind
+uint64_t GetEnvCacheKey(EEnvCacheProduct product, uint64_t sourceHash, const EnvCacheParameters& parameters, uint32_t version = kEnvCacheVersion);
+FilePath GetEnvCachePath(EEnvCacheProduct product, uint64_t key);
+bool IsEnvCached(EEnvCacheProduct product, uint64_t key);
+
+// Write a product read back from EnvMapFilter, creating data\EnvCache when it is missing
+bool SaveEnvCacheProduct(EEnvCacheProduct product, uint64_t key, const DirectX::ScratchImage& image);
+// Read a product with mipLevels mips, false on a miss or a file of another layout than the render target of EnvMapFilter
+bool LoadEnvCacheProduct(EEnvCacheProduct product, uint64_t key, uint32_t mipLevels, DirectX::ScratchImage& image);
@@ -1,10 +1,12 @@
 #include "Precompiled.h"
 #include "EnvEmitter.h"
+#include "Cubemap.h"
+#include "EnvCache.h"
 
 using namespace DirectX;
 
 
-static const uint32_t kCubemapResolution = 256;
+static const uint32_t kCubemapResolution = Cubemap::kDefaultResolution;
 
 
 struct MipGenConstBuffer
@@ -15,24 +17,6 @@ struct MipGenConstBuffer
 };
 
 
-static XMMATRIX BuildCubemapMatrix(uint32_t faceIdx)
-{
-	const XMVECTORF32 camPos = {0.0f, 0.0f, 0.0f, 0.0f};
-
-	const XMVECTORF32 kDir[] = {
-	    {1.0f, 0.0f, 0.0f, 0.0f},  {-1.0f, 0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f, 0.0f},
-	    {0.0f, -1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f, 0.0f},  {0.0f, 0.0f, -1.0f, 0.0f},
-	};
-
-	const XMVECTORF32 kUp[] = {
-	    {0.0f, 1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f, 0.0f},
-	    {0.0f, 0.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f, 0.0f},
-	};
-
-	return XMMatrixLookAtLH(camPos, kDir[faceIdx], kUp[faceIdx]);
-}
-
-
 bool EnvEmitter::Init(Device* device)
 {
 	PIXScopedEvent(0, "EnvEmitter::Init");
@@ -43,7 +27,7 @@ bool EnvEmitter::Init(Device* device)
 
 	for (int i = 0; i < 6; i++)
 	{
-		XMMATRIX view = BuildCubemapMatrix(i);
+		XMMATRIX view = Cubemap::GetFaceViewMatrix(i);
 		XMMATRIX proj = XMMatrixPerspectiveFovLH(XM_PI / 2.0f, 1.0f, 1.0f, 5000.0f);
 		m_constBufferData.BakeViewProj[i] = XMMatrixMultiply(view, proj);
 	}
@@ -307,6 +291,7 @@ void EnvEmitter::SetTexture(const char* filename)
 	m_device->DestroyResource(m_texture);
 
 	m_textureFileName = filename;
+	m_textureHash = 0;
 	FilePathW filenameW = ConvertPath(filename);
 
 	FilePathW filepath = L"data";
@@ -370,4 +355,9 @@ void EnvEmitter::SetTexture(const char* filename)
 	}
 	m_textureSRV = m_device->CreateSRV(m_texture, &srvDesc);
 	m_constBufferData.UseCubeTexture = metadata.IsCubemap() ? 1 : 0;
+
+	FilePath hashedPath = "data\\HDRs";
+	hashedPath /= filename;
+	if (!HashEnvCacheSource(hashedPath.c_str(), m_textureHash))
+		m_textureHash = 0;
 }
\ No newline at end of file
@@ -31,6 +31,8 @@ public:
 	const DirectX::XMVECTOR& GetConstLuminanceColor();
 	float GetConstLuminance();
 	const char* GetTextureFileName() const;
+	// EnvCache hash of the texture file, 0 when there is none
+	uint64_t GetTextureHash() const;
 	SRVHandle GetCubeMapSRV() const;
 
 private:
@@ -59,6 +61,7 @@ private:
 	SRVHandle m_dummyCubeSRV;
 	SRVHandle m_dummy2DSRV;
 	FilePath m_textureFileName;
+	uint64_t m_textureHash = 0;
 	ID3D12Resource* m_texture = nullptr;
 	SRVHandle m_textureSRV;
 	ConstBuffer m_constBufferData;
@@ -122,6 +125,12 @@ inline const char* EnvEmitter::GetTextureFileName() const
 }
 
 
+inline uint64_t EnvEmitter::GetTextureHash() const
+{
+	return m_textureHash;
+}
+
+
 inline SRVHandle EnvEmitter::GetCubeMapSRV() const
 {
 	return m_cubemap.srv;
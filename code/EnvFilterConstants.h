@@ -0,0 +1,9 @@
+#pragma once
+
+
+// Sizes of the render targets of EnvMapFilter, the CPU references and the cache use the same ones
+static const uint32_t kSpecularEnvMapResolution = 256;
+static const uint32_t kDiffuseEnvMapResolution = 128;
+static const uint32_t kBRDFLutResolution = 256;
+// default "Samples count" of the UI, the TotalSamples of the GPU filter
+static const uint32_t kEnvFilterSamplesNum = 128;
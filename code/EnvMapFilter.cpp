@@ -3,9 +3,9 @@
 #include "EnvMapFilter.h"
 
 
-const uint32_t SPEC_CUBEMAP_RESOLUTION = 256;
-const uint32_t DIFF_CUBEMAP_RESOLUTION = 128;
-const uint32_t BRDF_LUT_SIZE = 256;
+const uint32_t SPEC_CUBEMAP_RESOLUTION = kEnvCacheResolutions[kEnvCacheSpecular];
+const uint32_t DIFF_CUBEMAP_RESOLUTION = kEnvCacheResolutions[kEnvCacheDiffuse];
+const uint32_t BRDF_LUT_SIZE = kEnvCacheResolutions[kEnvCacheBRDFLut];
 const uint32_t THREAD_GROUP_SIZE = 32;
 
 
@@ -87,6 +87,9 @@ void EnvMapFilter::Shutdown()
 
 	m_device->DestroyUAV(m_prefilteredDiffEnvMapUAV);
 	m_prefilteredDiffEnvMap.Release(m_device);
+
+	for (uint32_t product = 0; product < kEnvCacheProductsNum; product++)
+		ReleaseCachedProduct((EEnvCacheProduct)product);
 }
 
 
@@ -182,3 +185,137 @@ void EnvMapFilter::FilterEnvMap(ID3D12GraphicsCommandList* cmdList, SRVHandle en
 	m_prefilteredDiffEnvMap.TransitionTo(finalState, barriers);
 	cmdList->ResourceBarrier(barriers.size(), barriers.data());
 }
+
+
+bool EnvMapFilter::SaveToCache(uint64_t sourceHash, const EnvCacheParameters& parameters)
+{
+	// without the shaders FilterEnvMap() leaves the targets as they were
+	if (!m_envMapSpecPrefilter || !m_brdfLutGen || !m_envMapDiffPrefilter)
+		return false;
+
+	RenderTarget* targets[kEnvCacheProductsNum] = {&m_prefilteredSpecEnvMap, &m_prefilteredDiffEnvMap, &m_brdfLut};
+	D3D12_RESOURCE_STATES finalState = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+	bool result = true;
+	for (uint32_t i = 0; i < kEnvCacheProductsNum; i++)
+	{
+		EEnvCacheProduct product = (EEnvCacheProduct)i;
+		uint64_t key = GetEnvCacheKey(product, sourceHash, parameters);
+		if (IsEnvCached(product, key))
+			continue;
+
+		// the copy goes on the queue after the filter and waits for it, with every mip and face
+		ScratchImage image;
+		if (FAILED(CaptureTexture(m_device->GetCommandQueue().GetD3D12Queue(), targets[product]->texture, product != kEnvCacheBRDFLut, image, finalState,
+		                          finalState)))
+		{
+			LogStdErr("Failed to read back the %s product of EnvMapFilter\n", kEnvCacheProductNames[product]);
+			result = false;
+			continue;
+		}
+		result &= SaveEnvCacheProduct(product, key, image);
+	}
+	return result;
+}
+
+
+bool EnvMapFilter::LoadCached(uint64_t sourceHash, const EnvCacheParameters& parameters)
+{
+	m_useCached = false;
+	for (uint32_t i = 0; i < kEnvCacheProductsNum; i++)
+	{
+		EEnvCacheProduct product = (EEnvCacheProduct)i;
+		uint64_t key = GetEnvCacheKey(product, sourceHash, parameters);
+		if (m_cachedTextures[product] && m_cachedKeys[product] == key)
+			continue;
+
+		ReleaseCachedProduct(product);
+		if (!LoadCachedProduct(product, key))
+			return false;
+	}
+
+	m_useCached = true;
+	return true;
+}
+
+
+bool EnvMapFilter::LoadCachedProduct(EEnvCacheProduct product, uint64_t key)
+{
+	// a miss is not an error, the product is filtered instead
+	uint32_t mipLevels = product == kEnvCacheSpecular ? m_prefilteredSpecEnvMap.m_mipLevels : 1;
+	ScratchImage scratchImage;
+	if (!LoadEnvCacheProduct(product, key, mipLevels, scratchImage))
+		return false;
+
+	FilePathW filepath = ConvertPath(GetEnvCachePath(product, key));
+	const TexMetadata& metadata = scratchImage.GetMetadata();
+	bool cube = product != kEnvCacheBRDFLut;
+
+	D3D12_RESOURCE_DESC desc;
+	desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+	desc.Alignment = 0;
+	desc.Width = (UINT)metadata.width;
+	desc.Height = (UINT)metadata.height;
+	desc.DepthOrArraySize = (UINT16)metadata.arraySize;
+	desc.MipLevels = (UINT16)metadata.mipLevels;
+	desc.Format = metadata.format;
+	desc.SampleDesc = {1, 0};
+	desc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+	desc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+	D3D12_HEAP_PROPERTIES heapProp = {};
+	heapProp.Type = D3D12_HEAP_TYPE_DEFAULT;
+
+	ID3D12Resource* texture = nullptr;
+	HRESULT hr =
+	    m_device->GetDevice()->CreateCommittedResource(&heapProp, D3D12_HEAP_FLAG_NONE, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr, IID_PPV_ARGS(&texture));
+	if (FAILED(hr))
+		return false;
+	texture->SetName(filepath.c_str());
+
+	m_device->BeginTransfer();
+	for (uint32_t arrayIdx = 0; arrayIdx < desc.DepthOrArraySize; arrayIdx++)
+	{
+		for (uint32_t mip = 0; mip < desc.MipLevels; mip++)
+		{
+			const Image* image = scratchImage.GetImage(mip, arrayIdx, 0);
+			m_device->UploadTextureSubresource(texture, mip, arrayIdx, image->pixels, image->rowPitch);
+		}
+	}
+	m_device->EndTransfer();
+
+	D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc;
+	srvDesc.Format = desc.Format;
+	srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+	if (cube)
+	{
+		srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE;
+		srvDesc.TextureCube.MipLevels = desc.MipLevels;
+		srvDesc.TextureCube.MostDetailedMip = 0;
+		srvDesc.TextureCube.ResourceMinLODClamp = 0.0f;
+	}
+	else
+	{
+		srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+		srvDesc.Texture2D.MipLevels = desc.MipLevels;
+		srvDesc.Texture2D.MostDetailedMip = 0;
+		srvDesc.Texture2D.PlaneSlice = 0;
+		srvDesc.Texture2D.ResourceMinLODClamp = 0.0f;
+	}
+
+	m_cachedKeys[product] = key;
+	m_cachedTextures[product] = texture;
+	m_cachedSRVs[product] = m_device->CreateSRV(texture, &srvDesc);
+	return true;
+}
+
+
+void EnvMapFilter::ReleaseCachedProduct(EEnvCacheProduct product)
+{
+	if (!m_cachedTextures[product])
+		return;
+
+	m_device->DestroySRV(m_cachedSRVs[product]);
+	m_device->DestroyResource(m_cachedTextures[product]);
+	m_cachedTextures[product] = nullptr;
+	m_cachedKeys[product] = 0;
+}
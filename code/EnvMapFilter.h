@@ -1,4 +1,5 @@
 #pragma once
+#include "EnvCache.h"
 
 class EnvMapFilter
 {
@@ -9,6 +10,11 @@ public:
 	bool ReloadShaders();
 
 	void FilterEnvMap(ID3D12GraphicsCommandList* cmdList, SRVHandle envmap);
+	// Use the products of EnvCache instead of FilterEnvMap(), false and back to the filter when one of them is missing
+	bool LoadCached(uint64_t sourceHash, const EnvCacheParameters& parameters);
+	void UseFiltered();
+	// Save the products of the last FilterEnvMap() missing from EnvCache, after the frame that recorded it was submitted
+	bool SaveToCache(uint64_t sourceHash, const EnvCacheParameters& parameters);
 
 	SRVHandle GetPrefilteredSpecEnvMap();
 	SRVHandle GetBRDFLut();
@@ -29,22 +35,37 @@ private:
 
 	RenderTarget m_prefilteredDiffEnvMap;
 	UAVHandle m_prefilteredDiffEnvMapUAV;
+
+	// loaded products stay until their key changes, the LUT across environments
+	uint64_t m_cachedKeys[kEnvCacheProductsNum] = {};
+	ID3D12Resource* m_cachedTextures[kEnvCacheProductsNum] = {};
+	SRVHandle m_cachedSRVs[kEnvCacheProductsNum];
+	bool m_useCached = false;
+
+	bool LoadCachedProduct(EEnvCacheProduct product, uint64_t key);
+	void ReleaseCachedProduct(EEnvCacheProduct product);
 };
 
 
+inline void EnvMapFilter::UseFiltered()
+{
+	m_useCached = false;
+}
+
+
 inline SRVHandle EnvMapFilter::GetPrefilteredSpecEnvMap()
 {
-	return m_prefilteredSpecEnvMap.srv;
+	return m_useCached ? m_cachedSRVs[kEnvCacheSpecular] : m_prefilteredSpecEnvMap.srv;
 }
 
 
 inline SRVHandle EnvMapFilter::GetBRDFLut()
 {
-	return m_brdfLut.srv;
+	return m_useCached ? m_cachedSRVs[kEnvCacheBRDFLut] : m_brdfLut.srv;
 }
 
 
 inline SRVHandle EnvMapFilter::GetPrefilteredDiffEnvMap()
 {
-	return m_prefilteredDiffEnvMap.srv;
+	return m_useCached ? m_cachedSRVs[kEnvCacheDiffuse] : m_prefilteredDiffEnvMap.srv;
 }
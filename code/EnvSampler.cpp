@@ -0,0 +1,221 @@
+#include "Precompiled.h"
+#include "EnvSampler.h"
+#include "ColorSpace.h"
+#include "Parallel.h"
+
+
+// bump on any change of the table layout or of the pixel weights
+static const uint32_t kEnvSamplerVersion = 1;
+static const uint32_t kEnvSamplerMagic = 0x53564e45;  // "ENVS"
+
+static const float kOneMinusEpsilon = 0x1.fffffep-1f;
+
+
+struct EnvSamplerHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t width;
+	uint32_t height;
+};
+
+
+static uint64_t GetEnvSamplerSize(uint32_t width, uint32_t height)
+{
+	return sizeof(EnvSamplerHeader) + ((uint64_t)height + (uint64_t)width * height) * sizeof(EnvSampler::AliasEntry);
+}
+
+
+/**
+ * Vose's alias method over the weights, scratch holds count values. Entries
+ * end up with the same share of the unit interval, an entry below 1 is
+ * topped up by one above and the remainder of the latter goes back to the
+ * worklists. Weights summing to 0 give a uniform table. Returns the sum.
+ */
+static double BuildAliasTable(const double* weights, uint32_t count, EnvSampler::AliasEntry* entries, double* scratch, std::vector<uint32_t>& small,
+                              std::vector<uint32_t>& large)
+{
+	double sum = 0.0;
+	for (uint32_t i = 0; i < count; i++)
+		sum += weights[i];
+
+	small.clear();
+	large.clear();
+	for (uint32_t i = 0; i < count; i++)
+	{
+		double probability = sum > 0.0 ? weights[i] / sum : 1.0 / count;
+		entries[i].probability = (float)probability;
+		scratch[i] = probability * count;
+		(scratch[i] < 1.0 ? small : large).push_back(i);
+	}
+
+	while (!small.empty() && !large.empty())
+	{
+		uint32_t s = small.back();
+		uint32_t l = large.back();
+		small.pop_back();
+		entries[s].threshold = (float)scratch[s];
+		entries[s].alias = l;
+		scratch[l] += scratch[s] - 1.0;
+		if (scratch[l] < 1.0)
+		{
+			large.pop_back();
+			small.push_back(l);
+		}
+	}
+
+	// what is left is 1 up to rounding
+	for (uint32_t i : small)
+		entries[i] = {1.0f, i, entries[i].probability};
+	for (uint32_t i : large)
+		entries[i] = {1.0f, i, entries[i].probability};
+	return sum;
+}
+
+
+// Pick an entry from u in [0, 1) and rescale u to [0, 1) within the pick
+static uint32_t SampleAliasTable(const EnvSampler::AliasEntry* entries, uint32_t count, float& u)
+{
+	float scaled = u * count;
+	uint32_t i = std::min((uint32_t)scaled, count - 1);
+	float fraction = scaled - i;
+	const EnvSampler::AliasEntry& entry = entries[i];
+	if (fraction < entry.threshold)
+	{
+		u = std::min(fraction / entry.threshold, kOneMinusEpsilon);
+		return i;
+	}
+	u = std::min((fraction - entry.threshold) / (1.0f - entry.threshold), kOneMinusEpsilon);
+	return entry.alias;
+}
+
+
+bool EnvSampler::Build(const EquirectImage& image, uint32_t threadsNum)
+{
+	Close();
+	if (!image.pixels || image.width == 0 || image.height == 0)
+		return false;
+
+	uint64_t size = GetEnvSamplerSize(image.width, image.height);
+	if (size > UINT32_MAX)
+		return false;
+
+	m_memory.resize((size_t)size);
+	EnvSamplerHeader* header = (EnvSamplerHeader*)m_memory.data();
+	*header = {kEnvSamplerMagic, kEnvSamplerVersion, image.width, image.height};
+	AliasEntry* rows = (AliasEntry*)(header + 1);
+	AliasEntry* columns = rows + image.height;
+
+	// HDRs are linear Rec.709
+	const float(&luminance)[3] = GetColorSpaceMatrix(kColorSpaceRec709, kColorSpaceXYZ).m[1];
+	std::vector<double> rowWeights(image.height);
+	ParallelFor(
+	    image.height,
+	    [&](uint32_t y) {
+		    // every pixel of a row covers the same solid angle, proportional to the sine at its center
+		    double sinTheta = sin((y + 0.5) * XM_PI / image.height);
+		    std::vector<double> weights(image.width);
+		    std::vector<double> scratch(image.width);
+		    std::vector<uint32_t> small, large;
+		    const XMFLOAT4* pixels = image.pixels + (size_t)y * image.width;
+		    for (uint32_t x = 0; x < image.width; x++)
+			    weights[x] = std::max(luminance[0] * pixels[x].x + luminance[1] * pixels[x].y + luminance[2] * pixels[x].z, 0.0f) * sinTheta;
+		    rowWeights[y] = BuildAliasTable(weights.data(), image.width, columns + (size_t)y * image.width, scratch.data(), small, large);
+	    },
+	    threadsNum);
+
+	std::vector<double> scratch(image.height);
+	std::vector<uint32_t> small, large;
+	BuildAliasTable(rowWeights.data(), image.height, rows, scratch.data(), small, large);
+
+	return Attach(m_memory.data(), (uint32_t)m_memory.size());
+}
+
+
+bool EnvSampler::Save(const char* filename) const
+{
+	if (!IsLoaded())
+		return false;
+
+	const uint8_t* data = m_memory.empty() ? m_file.GetData() : m_memory.data();
+	uint32_t size = (uint32_t)GetEnvSamplerSize(m_width, m_height);
+	File file(filename, File::kOpenWrite);
+	return file.IsOpened() && file.Write(data, size) == size;
+}
+
+
+bool EnvSampler::Load(const char* filename)
+{
+	Close();
+	if (m_file.Open(filename) && Attach(m_file.GetData(), m_file.GetSize()))
+		return true;
+
+	LogStdErr("Failed to load environment sampling tables '%s'\n", filename);
+	Close();
+	return false;
+}
+
+
+void EnvSampler::Close()
+{
+	m_file.Close();
+	m_memory.clear();
+	m_width = 0;
+	m_height = 0;
+	m_rows = nullptr;
+	m_columns = nullptr;
+}
+
+
+bool EnvSampler::Attach(const uint8_t* data, uint32_t size)
+{
+	if (size < sizeof(EnvSamplerHeader))
+		return false;
+
+	const EnvSamplerHeader* header = (const EnvSamplerHeader*)data;
+	if (header->magic != kEnvSamplerMagic || header->version != kEnvSamplerVersion || header->width == 0 || header->height == 0 ||
+	    size != GetEnvSamplerSize(header->width, header->height))
+		return false;
+
+	m_width = header->width;
+	m_height = header->height;
+	m_rows = (const AliasEntry*)(header + 1);
+	m_columns = m_rows + m_height;
+	return true;
+}
+
+
+EnvSample EnvSampler::Sample(float u0, float u1) const
+{
+	Assert(IsLoaded());
+	uint32_t y = SampleAliasTable(m_rows, m_height, u0);
+	const AliasEntry* row = m_columns + (size_t)y * m_width;
+	uint32_t x = SampleAliasTable(row, m_width, u1);
+
+	// uniform within the pixel in equirect coordinates, the inverse of Cubemap::GetEquirectCoords()
+	float theta = (y + u0) * (XM_PI / m_height);
+	float phi = (x + u1) * (2.0f * XM_PI / m_width);
+	float sinTheta = sinf(theta);
+
+	EnvSample sample;
+	sample.direction = {sinTheta * sinf(phi), cosf(theta), sinTheta * cosf(phi)};
+	// dw = 2 * pi^2 * sin(theta) * du * dv
+	float pdf = m_rows[y].probability * row[x].probability * m_width * m_height / (2.0f * XM_PI * XM_PI);
+	sample.pdf = sinTheta > 0.0f ? pdf / sinTheta : 0.0f;
+	return sample;
+}
+
+
+float EnvSampler::Pdf(const XMFLOAT3& direction) const
+{
+	Assert(IsLoaded());
+	XMFLOAT2 uv = Cubemap::GetEquirectCoords(direction);
+	uint32_t x = std::min((uint32_t)(uv.x * m_width), m_width - 1);
+	uint32_t y = std::min((uint32_t)(uv.y * m_height), m_height - 1);
+	float sinTheta = sinf(uv.y * XM_PI);
+	if (sinTheta <= 0.0f)
+		return 0.0f;
+
+	float probability = m_rows[y].probability * m_columns[(size_t)y * m_width + x].probability;
+	return probability * m_width * m_height / (2.0f * XM_PI * XM_PI * sinTheta);
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include "Cubemap.h"
+
+
+struct EnvSample
+{
+	XMFLOAT3 direction;
+	// over the solid angle
+	float pdf;
+};
+
+
+/**
+ * \brief Importance sampling of an equirect environment, so a small bright
+ * sun is found by a few samples instead of thousands of BRDF samples.
+ *
+ * Pixels are weighted by their luminance times sin(theta), the solid angle
+ * they cover. A Vose alias table over the rows picks a row, then the alias
+ * table of that row picks a pixel, both in constant time from one uniform
+ * number each. The leftover of each number places the direction inside the
+ * pixel. Entries keep their probability as well, so the pdf of any
+ * direction is a lookup too. The directions are those of env_emitter.hlsl.
+ */
+class EnvSampler
+{
+public:
+	struct AliasEntry
+	{
+		// the entry keeps its own index below this threshold and takes the alias above
+		float threshold;
+		uint32_t alias;
+		// normalized probability of the entry itself
+		float probability;
+	};
+
+	EnvSampler() = default;
+	EnvSampler(const EnvSampler&) = delete;
+	EnvSampler& operator=(const EnvSampler&) = delete;
+
+	// Build the tables in memory, on all hardware threads when threadsNum is 0
+	bool Build(const EquirectImage& image, uint32_t threadsNum = 0);
+	bool Save(const char* filename) const;
+	bool Load(const char* filename);
+	void Close();
+
+	bool IsLoaded() const;
+	uint32_t GetWidth() const;
+	uint32_t GetHeight() const;
+
+	// Direction for uniform numbers u0 and u1 in [0, 1)
+	EnvSample Sample(float u0, float u1) const;
+	float Pdf(const XMFLOAT3& direction) const;
+
+private:
+	MappedFile m_file;
+	std::vector<uint8_t> m_memory;
+	uint32_t m_width = 0;
+	uint32_t m_height = 0;
+	const AliasEntry* m_rows = nullptr;
+	// m_width entries per row
+	const AliasEntry* m_columns = nullptr;
+
+	bool Attach(const uint8_t* data, uint32_t size);
+};
+
+
+inline bool EnvSampler::IsLoaded() const
+{
+	return m_rows != nullptr;
+}
+
+
+inline uint32_t EnvSampler::GetWidth() const
+{
+	return m_width;
+}
+
+
+inline uint32_t EnvSampler::GetHeight() const
+{
+	return m_height;
+}
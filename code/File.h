@@ -39,4 +39,60 @@ inline bool File::IsOpened() const
 inline uint32_t File::GetSize() const
 {
 	return m_size;
+}
+
+
+// Read-only view of a whole file mapped into memory
+class MappedFile
+{
+public:
+	MappedFile() = default;
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	~MappedFile();
+
+	bool Open(const char* filename);
+	void Close();
+
+	bool IsOpened() const;
+	const uint8_t* GetData() const;
+	uint32_t GetSize() const;
+
+private:
+	HANDLE m_file = INVALID_HANDLE_VALUE;
+	HANDLE m_mapping = nullptr;
+	const uint8_t* m_data = nullptr;
+	uint32_t m_size = 0;
+};
+
+
+inline bool MappedFile::IsOpened() const
+{
+	return m_data != nullptr;
+}
+
+
+inline const uint8_t* MappedFile::GetData() const
+{
+	return m_data;
+}
+
+
+inline uint32_t MappedFile::GetSize() const
+{
+	return m_size;
+}
+
+
+static const uint64_t kFNVOffsetBasis = 14695981039346656037ull;
+static const uint64_t kFNVPrime = 1099511628211ull;
+
+
+// FNV-1a of a block of bytes, blocks are chained by passing the hash of the previous one
+inline uint64_t HashBytes(const void* data, size_t size, uint64_t hash = kFNVOffsetBasis)
+{
+	const uint8_t* bytes = (const uint8_t*)data;
+	for (size_t i = 0; i < size; i++)
+		hash = (hash ^ bytes[i]) * kFNVPrime;
+	return hash;
 }
\ No newline at end of file
@@ -51,6 +51,41 @@ uint32_t LinearToPackedSRGB(const XMVECTOR& v)
 }
 
 
+FilePathW GetDerivedEnvMapPath(const FilePathW& environment, const wchar_t* extension)
+{
+	// fails when it already exists, a missing directory shows up as a failed save
+	CreateDirectoryW(L"data\\EnvMaps", nullptr);
+	FilePathW path = L"data\\EnvMaps";
+	path /= environment.GetStem();
+	path += extension;
+	return path;
+}
+
+
+void EnumerateFiles(const char* searchDir, std::vector<FilePath>& list, bool dir)
+{
+	WIN32_FIND_DATAA ffd;
+	HANDLE hFind = INVALID_HANDLE_VALUE;
+
+	hFind = FindFirstFileA(searchDir, &ffd);
+	if (INVALID_HANDLE_VALUE == hFind)
+		return;
+
+	do
+	{
+		if ((ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0 && !dir)
+			continue;
+		if ((ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0 && dir)
+			continue;
+		if (ffd.cFileName[0] == '.' || strcmp(ffd.cFileName, "..") == 0)
+			continue;
+		list.push_back(std::move(ffd.cFileName));
+	} while (FindNextFileA(hFind, &ffd) != 0);
+
+	FindClose(hFind);
+}
+
+
 struct WICInitializer
 {
 	WICInitializer()
@@ -85,4 +120,44 @@ bool LoadTexture(const FilePathW& filepath, TexMetadata* metadata, ScratchImage&
 		return LoadFromTGAMemory(data.get(), file.GetSize(), metadata, image) == S_OK;
 	else
 		return LoadFromWICMemory(data.get(), file.GetSize(), WIC_FLAGS_NONE, metadata, image) == S_OK;
+}
+
+
+bool LoadEquirect(const FilePathW& filepath, ScratchImage& image)
+{
+	TexMetadata data;
+	if (!LoadTexture(filepath, &data, image))
+	{
+		LogStdErr("Failed to load texture\n");
+		return false;
+	}
+
+	// a cube, like the ones the cubemap command writes, is not an equirect
+	if (data.IsCubemap() || data.arraySize > 1)
+	{
+		LogStdErr("'%S' is not an equirect image\n", filepath.c_str());
+		return false;
+	}
+
+	if (IsCompressed(data.format))
+	{
+		ScratchImage decompressedImage;
+		if (FAILED(Decompress(*image.GetImage(0, 0, 0), DXGI_FORMAT_R32G32B32A32_FLOAT, decompressedImage)))
+		{
+			LogStdErr("Failed to decompress texture\n");
+			return false;
+		}
+		image = std::move(decompressedImage);
+	}
+	else if (data.format != DXGI_FORMAT_R32G32B32A32_FLOAT)
+	{
+		ScratchImage convertedImage;
+		if (FAILED(Convert(*image.GetImage(0, 0, 0), DXGI_FORMAT_R32G32B32A32_FLOAT, TEX_FILTER_DEFAULT, 0.0f, convertedImage)))
+		{
+			LogStdErr("Failed to convert texture\n");
+			return false;
+		}
+		image = std::move(convertedImage);
+	}
+	return true;
 }
\ No newline at end of file
@@ -14,3 +14,8 @@ DirectX::XMVECTOR PackedSRGBToSRGB(uint32_t color);
 DirectX::XMVECTOR PackedSRGBToLinear(uint32_t color);
 uint32_t LinearToPackedSRGB(const DirectX::XMVECTOR& v);
 bool LoadTexture(const FilePathW& filepath, DirectX::TexMetadata* metadata, DirectX::ScratchImage& image);
+// An environment as RGBA floats, the layout of EquirectImage
+bool LoadEquirect(const FilePathW& filepath, DirectX::ScratchImage& image);
+// Output of a command run on an environment of data\HDRs, in data\EnvMaps so that it is not listed as an environment itself
+FilePathW GetDerivedEnvMapPath(const FilePathW& environment, const wchar_t* extension);
+void EnumerateFiles(const char* searchDir, std::vector<FilePath>& list, bool dir = false);
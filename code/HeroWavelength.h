@@ -0,0 +1,131 @@
+#pragma once
+#include "SpectralPowerDistribution.h"
+
+
+// Gaussian with different widths left and right of its peak
+inline float CIEFitLobe(float lambda, float mu, float sigmaLeft, float sigmaRight)
+{
+	float t = (lambda - mu) / (lambda < mu ? sigmaLeft : sigmaRight);
+	return expf(-0.5f * t * t);
+}
+
+
+// Multi-lobe fits of the CIE 1931 2 degree color matching functions, Wyman et al. 2013
+inline float CIE_X_Fit(float lambda)
+{
+	return 1.056f * CIEFitLobe(lambda, 599.8f, 37.9f, 31.0f) + 0.362f * CIEFitLobe(lambda, 442.0f, 16.0f, 26.7f) -
+	       0.065f * CIEFitLobe(lambda, 501.1f, 20.4f, 26.2f);
+}
+
+
+inline float CIE_Y_Fit(float lambda)
+{
+	return 0.821f * CIEFitLobe(lambda, 568.8f, 46.9f, 40.5f) + 0.286f * CIEFitLobe(lambda, 530.9f, 16.3f, 31.1f);
+}
+
+
+inline float CIE_Z_Fit(float lambda)
+{
+	return 1.217f * CIEFitLobe(lambda, 437.0f, 11.8f, 36.0f) + 0.681f * CIEFitLobe(lambda, 459.0f, 26.0f, 13.8f);
+}
+
+
+// Integral of CIE_Y_Fit(), each lobe contributes sqrt(pi / 2) * weight * (sigmaLeft + sigmaRight)
+static const float kCIEYFitIntegral = 1.2533141f * (0.821f * (46.9f + 40.5f) + 0.286f * (16.3f + 31.1f));
+
+
+/**
+ * \brief Wavelengths of one Monte Carlo sample, one per lane of the packet P.
+ *
+ * The first lane is the hero wavelength, the others are its rotations by
+ * equal steps of the sampling CDF (Wilkie et al. 2014), so the lanes of one
+ * sample are stratified over the visible range. Wavelengths are importance
+ * sampled proportionally to the visible response (Radziszewski et al. 2009).
+ * Estimates of different samples are averaged to converge to the full
+ * spectrum result, see FresnelConductorRGB().
+ */
+template <typename P>
+struct SampledWavelengths
+{
+	static const uint32_t kCount = SimdTraits<P>::kWidth;
+
+	float lambda[kCount];
+	float pdf[kCount];
+	// X, Y and Z of a unit value in each lane, the color matching function fits over pdf, lane count and Y integral
+	float cieWeights[3][kCount];
+
+	// u in [0, 1) picks the hero wavelength
+	static SampledWavelengths Sample(float u);
+
+	P Lambda() const;
+
+	// Value of every lane of a SpectralPowerDistribution or a SpectrumT, both interpolate with Eval()
+	template <typename S>
+	P Eval(const S& spectrum) const;
+
+	void ToXYZ(P values, float& x, float& y, float& z) const;
+	void ToLinearRGB(P values, float& r, float& g, float& b) const;
+};
+
+
+template <typename P>
+inline SampledWavelengths<P> SampledWavelengths<P>::Sample(float u)
+{
+	SampledWavelengths wavelengths;
+	for (uint32_t i = 0; i < kCount; i++)
+	{
+		float ui = u + (float)i / kCount;
+		ui = ui >= 1.0f ? ui - 1.0f : ui;
+
+		// inverse CDF and pdf of 1 / cosh^2(0.0072 * (lambda - 538)) over [360, 830]
+		float lambda = 538.0f - 138.888889f * atanhf(0.85691062f - 1.82750197f * ui);
+		lambda = std::min(std::max(lambda, kSpectrumMinWavelength), kSpectrumMaxWavelength);
+		float coshValue = coshf(0.0072f * (lambda - 538.0f));
+		float pdf = 0.0039398042f / (coshValue * coshValue);
+
+		wavelengths.lambda[i] = lambda;
+		wavelengths.pdf[i] = pdf;
+		float weight = 1.0f / (pdf * kCount * kCIEYFitIntegral);
+		wavelengths.cieWeights[0][i] = CIE_X_Fit(lambda) * weight;
+		wavelengths.cieWeights[1][i] = CIE_Y_Fit(lambda) * weight;
+		wavelengths.cieWeights[2][i] = CIE_Z_Fit(lambda) * weight;
+	}
+	return wavelengths;
+}
+
+
+template <typename P>
+inline P SampledWavelengths<P>::Lambda() const
+{
+	return SimdTraits<P>::Load(lambda);
+}
+
+
+template <typename P>
+template <typename S>
+inline P SampledWavelengths<P>::Eval(const S& spectrum) const
+{
+	// scattered lookups, filled lane by lane
+	float values[kCount];
+	for (uint32_t i = 0; i < kCount; i++)
+		values[i] = spectrum.Eval(lambda[i]);
+	return SimdTraits<P>::Load(values);
+}
+
+
+template <typename P>
+inline void SampledWavelengths<P>::ToXYZ(P values, float& x, float& y, float& z) const
+{
+	x = ReduceAdd(values * SimdTraits<P>::Load(cieWeights[0]));
+	y = ReduceAdd(values * SimdTraits<P>::Load(cieWeights[1]));
+	z = ReduceAdd(values * SimdTraits<P>::Load(cieWeights[2]));
+}
+
+
+template <typename P>
+inline void SampledWavelengths<P>::ToLinearRGB(P values, float& r, float& g, float& b) const
+{
+	float x, y, z;
+	ToXYZ(values, x, y, z);
+	XYZToLinearRGB(x, y, z, r, g, b);
+}
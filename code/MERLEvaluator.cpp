@@ -0,0 +1,208 @@
+#include "Precompiled.h"
+#include "MERLEvaluator.h"
+#include "Simd.h"
+
+
+// below it theta_half and theta_diff are considered 0, as in the shader
+static const float kAngleEpsilon = 1e-3f;
+
+
+static uint32_t PhiDiffIndex(float phiDiff)
+{
+	// reciprocity, the BRDF is unchanged under phi_diff -> phi_diff + pi
+	if (phiDiff < 0.0f)
+		phiDiff += XM_PI;
+
+	int32_t index = (int32_t)(phiDiff * (1.0f / XM_PI * MERLMaterial::kPhiDiffRes));
+	return (uint32_t)std::min(std::max(index, 0), (int32_t)MERLMaterial::kPhiDiffRes - 1);
+}
+
+
+// non linear mapping, the resolution is higher around the specular peak
+static uint32_t ThetaHalfIndex(float thetaHalf)
+{
+	if (thetaHalf <= 0.0f)
+		return 0;
+
+	int32_t index = (int32_t)(sqrtf(thetaHalf * (2.0f / XM_PI)) * MERLMaterial::kThetaHalfRes);
+	return (uint32_t)std::min(std::max(index, 0), (int32_t)MERLMaterial::kThetaHalfRes - 1);
+}
+
+
+static uint32_t ThetaDiffIndex(float thetaDiff)
+{
+	int32_t index = (int32_t)(thetaDiff * (2.0f / XM_PI * MERLMaterial::kThetaDiffRes));
+	return (uint32_t)std::min(std::max(index, 0), (int32_t)MERLMaterial::kThetaDiffRes - 1);
+}
+
+
+static float Dot(const XMVECTOR& a, const XMVECTOR& b)
+{
+	return XMVectorGetX(XMVector3Dot(a, b));
+}
+
+
+uint32_t MERLEvaluator::GetIndexReference(const XMFLOAT3& toLight, const XMFLOAT3& toViewer)
+{
+	const XMVECTOR normal = XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f);
+	const XMVECTOR tangent = XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f);
+	const XMVECTOR bitangent = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+	XMVECTOR l = XMLoadFloat3(&toLight);
+	XMVECTOR v = XMLoadFloat3(&toViewer);
+
+	XMVECTOR h = XMVector3Normalize(XMVectorAdd(l, v));
+	float thetaHalf = acosf(std::min(std::max(Dot(normal, h), 0.0f), 1.0f));
+	float thetaDiff = acosf(std::min(std::max(Dot(h, l), 0.0f), 1.0f));
+	float phiDiff = 0.0f;
+
+	if (thetaDiff < kAngleEpsilon)
+	{
+		// phi_diff indeterminate, use phi_half instead
+		phiDiff = atan2f(std::min(std::max(-Dot(l, bitangent), -1.0f), 1.0f), std::min(std::max(Dot(l, tangent), -1.0f), 1.0f));
+	}
+	else if (thetaHalf > kAngleEpsilon)
+	{
+		// Gram-Schmidt orthonormalization to find the difference basis vectors
+		XMVECTOR u = XMVectorNegate(XMVector3Normalize(XMVectorSubtract(normal, XMVectorScale(h, Dot(normal, h)))));
+		XMVECTOR w = XMVector3Cross(h, u);
+		phiDiff = atan2f(std::min(std::max(Dot(l, w), -1.0f), 1.0f), std::min(std::max(Dot(l, u), -1.0f), 1.0f));
+	}
+	else
+	{
+		thetaHalf = 0.0f;
+	}
+
+	// phi_half is ignored, isotropic BRDFs are assumed
+	return MERLMaterial::GetIndex(ThetaHalfIndex(thetaHalf), ThetaDiffIndex(thetaDiff), PhiDiffIndex(phiDiff));
+}
+
+
+XMFLOAT3 MERLEvaluator::EvalReference(const XMFLOAT3& toLight, const XMFLOAT3& toViewer) const
+{
+	Assert(IsInitialized());
+	const XMFLOAT4A& entry = m_table[GetIndexReference(toLight, toViewer)];
+	float cosThetaL = std::min(std::max(toLight.z, 0.0f), 1.0f);
+	return {entry.x * cosThetaL, entry.y * cosThetaL, entry.z * cosThetaL};
+}
+
+
+// Arc cosine over [-1, 1], Abramowitz and Stegun 4.4.46 with an error below 2e-8
+template <typename P>
+static P Acos(P x)
+{
+	const P zero = SimdTraits<P>::Set(0.0f);
+	P t = Max(x, zero - x);
+	P poly = SimdTraits<P>::Set(-0.0012624911f);
+	poly = MulAdd(poly, t, SimdTraits<P>::Set(0.0066700901f));
+	poly = MulAdd(poly, t, SimdTraits<P>::Set(-0.0170881256f));
+	poly = MulAdd(poly, t, SimdTraits<P>::Set(0.0308918810f));
+	poly = MulAdd(poly, t, SimdTraits<P>::Set(-0.0501743046f));
+	poly = MulAdd(poly, t, SimdTraits<P>::Set(0.0889789874f));
+	poly = MulAdd(poly, t, SimdTraits<P>::Set(-0.2145988016f));
+	poly = MulAdd(poly, t, SimdTraits<P>::Set(1.5707963050f));
+	P result = Sqrt(Max(SimdTraits<P>::Set(1.0f) - t, zero)) * poly;
+	return Select(LessThan(x, zero), SimdTraits<P>::Set(XM_PI) - result, result);
+}
+
+
+// Index of a table dimension, NaNs of degenerate directions end up at 0
+template <typename P>
+static P ToIndex(P x, uint32_t resolution)
+{
+	return Min(Max(Truncate(x), SimdTraits<P>::Set(0.0f)), SimdTraits<P>::Set((float)(resolution - 1)));
+}
+
+
+template <typename P>
+uint32_t MERLEvaluator::EvalPackets(const MERLDirections& toLight, const MERLDirections& toViewer, uint32_t first, uint32_t count, float* r, float* g,
+                                    float* b) const
+{
+	using T = SimdTraits<P>;
+	const P zero = T::Set(0.0f);
+	const P one = T::Set(1.0f);
+	const P epsilon = T::Set(kAngleEpsilon);
+	// below it the light direction has no component in the difference plane
+	const P tiny = T::Set(1e-20f);
+
+	uint32_t i = first;
+	for (; i + T::kWidth <= count; i += T::kWidth)
+	{
+		P lx = T::Load(toLight.x + i);
+		P ly = T::Load(toLight.y + i);
+		P lz = T::Load(toLight.z + i);
+		P hx = lx + T::Load(toViewer.x + i);
+		P hy = ly + T::Load(toViewer.y + i);
+		P hz = lz + T::Load(toViewer.z + i);
+		P invLength = one / Sqrt(MulAdd(hx, hx, MulAdd(hy, hy, hz * hz)));
+		hx = hx * invLength;
+		hy = hy * invLength;
+		hz = hz * invLength;
+
+		P cosThetaHalf = Min(Max(hz, zero), one);
+		P thetaHalf = Acos(cosThetaHalf);
+		P thetaDiff = Acos(Min(Max(MulAdd(hx, lx, MulAdd(hy, ly, hz * lz)), zero), one));
+
+		// light direction in the difference frame, u = -normalize(n - cos(theta_half) h) and v = h x u
+		P ux = cosThetaHalf * hx;
+		P uy = cosThetaHalf * hy;
+		P uz = MulAdd(cosThetaHalf, hz, zero - one);
+		P invULength = one / Sqrt(Max(MulAdd(ux, ux, MulAdd(uy, uy, uz * uz)), tiny));
+		ux = ux * invULength;
+		uy = uy * invULength;
+		uz = uz * invULength;
+		P phiX = MulAdd(lx, ux, MulAdd(ly, uy, lz * uz));
+		P phiY = MulAdd(lx, hy * uz - hz * uy, MulAdd(ly, hz * ux - hx * uz, lz * (hx * uy - hy * ux)));
+
+		// without a half angle phi_diff is 0, and when theta_diff vanishes phi_half stands in for it
+		P general = LessThan(epsilon, thetaHalf);
+		P diffVanishes = LessThan(thetaDiff, epsilon);
+		thetaHalf = Select(diffVanishes, thetaHalf, Select(general, thetaHalf, zero));
+		phiX = Select(diffVanishes, lx, Select(general, phiX, one));
+		phiY = Select(diffVanishes, zero - ly, Select(general, phiY, zero));
+
+		// reciprocity folds phi_diff into [0, pi], where it is the arc cosine of the folded x
+		P phiLength2 = MulAdd(phiX, phiX, phiY * phiY);
+		P cosPhi = phiX / Sqrt(Max(phiLength2, tiny));
+		cosPhi = Select(LessThan(phiY, zero), zero - cosPhi, cosPhi);
+		cosPhi = Select(LessThan(phiLength2, tiny), one, Min(Max(cosPhi, zero - one), one));
+		P phiDiff = Acos(cosPhi);
+
+		// the same operations as the shader, so the truncations agree
+		P phiIndex = ToIndex(phiDiff * T::Set(1.0f / XM_PI * MERLMaterial::kPhiDiffRes), MERLMaterial::kPhiDiffRes);
+		P thetaDiffIndex = ToIndex(thetaDiff * T::Set(2.0f / XM_PI * MERLMaterial::kThetaDiffRes), MERLMaterial::kThetaDiffRes);
+		P thetaHalfIndex = ToIndex(Sqrt(thetaHalf * T::Set(2.0f / XM_PI)) * T::Set((float)MERLMaterial::kThetaHalfRes), MERLMaterial::kThetaHalfRes);
+		P index = MulAdd(MulAdd(thetaHalfIndex, T::Set((float)MERLMaterial::kThetaDiffRes), thetaDiffIndex), T::Set((float)MERLMaterial::kPhiDiffRes), phiIndex);
+
+		// the table is gathered lane by lane
+		float indices[T::kWidth];
+		float cosThetaL[T::kWidth];
+		T::Store(indices, index);
+		T::Store(cosThetaL, Min(Max(lz, zero), one));
+		for (uint32_t l = 0; l < T::kWidth; l++)
+		{
+			const XMFLOAT4A& entry = m_table[(uint32_t)indices[l]];
+			r[i + l] = entry.x * cosThetaL[l];
+			g[i + l] = entry.y * cosThetaL[l];
+			b[i + l] = entry.z * cosThetaL[l];
+		}
+	}
+	return i;
+}
+
+
+void MERLEvaluator::Release()
+{
+	m_table.clear();
+	m_table.shrink_to_fit();
+}
+
+
+void MERLEvaluator::Eval(const MERLDirections& toLight, const MERLDirections& toViewer, uint32_t count, float* r, float* g, float* b) const
+{
+	Assert(IsInitialized());
+	DispatchSimd([&](auto packet) {
+		using P = decltype(packet);
+		uint32_t i = EvalPackets<P>(toLight, toViewer, 0, count, r, g, b);
+		EvalPackets<float>(toLight, toViewer, i, count, r, g, b);
+	});
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include "MERLMaterial.h"
+#include "Parallel.h"
+
+
+// SoA planes of count directions
+struct MERLDirections
+{
+	const float* x;
+	const float* y;
+	const float* z;
+};
+
+
+/**
+ * \brief CPU port of EvaluteMerlBRDF() of data\shaders\merl.h, evaluating
+ * a packet of directions at a time.
+ *
+ * Directions are normalized and in the shading frame, x along the tangent,
+ * y along the bitangent and z along the normal. The angles are found with
+ * polynomial arc cosines and no other trigonometry, phi_diff is the arc
+ * cosine of the light direction in the difference frame once it is folded
+ * into the upper half plane. The table interleaves the scaled channels with
+ * a padding float, so a lookup reads a single 16 byte aligned entry instead
+ * of three entries 5.8 MB apart.
+ */
+class MERLEvaluator
+{
+public:
+	// M is a MERLMaterial or a CompactMERLMaterial, on all hardware threads when threadsNum is 0
+	template <typename M>
+	void Init(const M& material, uint32_t threadsNum = 0);
+	void Release();
+
+	bool IsInitialized() const;
+
+	// BRDF times the cosine of the light direction, like the shader
+	void Eval(const MERLDirections& toLight, const MERLDirections& toViewer, uint32_t count, float* r, float* g, float* b) const;
+
+	// Line by line port of the shader with the standard trigonometry, the reference of Eval()
+	static uint32_t GetIndexReference(const XMFLOAT3& toLight, const XMFLOAT3& toViewer);
+	XMFLOAT3 EvalReference(const XMFLOAT3& toLight, const XMFLOAT3& toViewer) const;
+
+private:
+	std::vector<XMFLOAT4A> m_table;
+
+	// Evaluate whole packets from first on, returns where they stopped
+	template <typename P>
+	uint32_t EvalPackets(const MERLDirections& toLight, const MERLDirections& toViewer, uint32_t first, uint32_t count, float* r, float* g, float* b) const;
+};
+
+
+inline bool MERLEvaluator::IsInitialized() const
+{
+	return !m_table.empty();
+}
+
+
+template <typename M>
+inline void MERLEvaluator::Init(const M& material, uint32_t threadsNum)
+{
+	m_table.resize(MERLMaterial::kSamplesNum);
+	const uint32_t kSamplesPerTask = 65536;
+	ParallelFor(
+	    (MERLMaterial::kSamplesNum + kSamplesPerTask - 1) / kSamplesPerTask,
+	    [&](uint32_t task) {
+		    uint32_t end = std::min((task + 1) * kSamplesPerTask, MERLMaterial::kSamplesNum);
+		    for (uint32_t i = task * kSamplesPerTask; i < end; i++)
+			    m_table[i] = {material.GetValue(0, i), material.GetValue(1, i), material.GetValue(2, i), 0.0f};
+	    },
+	    threadsNum);
+}
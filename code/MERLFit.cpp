@@ -0,0 +1,444 @@
+#include "Precompiled.h"
+#include "MERLFit.h"
+#include "ColorSpace.h"
+#include "Parallel.h"
+
+
+// bump on any change of the entry layout or of the fitted model
+static const uint32_t kFitVersion = 1;
+static const uint32_t kFitMagic = 0x474c524d;  // "MRLG"
+
+// roughness, then F0 and albedo per channel
+static const uint32_t kParametersNum = 7;
+// every theta_h sample is fitted, the smoother difference angles are decimated
+static const uint32_t kThetaDiffStride = 2;
+static const uint32_t kPhiDiffStride = 4;
+// cosine of the largest fitted light and view angle, 80 degrees
+static const float kMinFitCosine = 0.173648f;
+static const float kStartRoughnesses[] = {0.05f, 0.2f, 0.6f};
+static const float kMinRoughness = 1e-3f;
+static const uint32_t kMaxIterations = 100;
+
+
+struct FitHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t entriesNum;
+	uint32_t reserved;
+};
+
+
+// Angles of a fitted direction pair and the measured BRDF times the cosine, in log(1 + x) space
+struct FitSample
+{
+	float NoL;
+	float NoV;
+	float NoH;
+	float VoH;
+	float target[MERLMaterial::kChannelsNum];
+};
+
+
+static float D_GGX(float NoH, float roughness)
+{
+	float a2 = roughness * roughness;
+	float d = (NoH * a2 - NoH) * NoH + 1.0f;
+	return a2 / (XM_PI * d * d);
+}
+
+
+// Vis = G / (4 * NoL * NoV), the approximated joint Smith of the shader
+static float Vis_SmithJointGGX(float NoL, float NoV, float roughness)
+{
+	float lambdaV = NoL * (NoV * (1.0f - roughness) + roughness);
+	float lambdaL = NoV * (NoL * (1.0f - roughness) + roughness);
+	return 0.5f / (lambdaV + lambdaL);
+}
+
+
+static float Pow5(float x)
+{
+	float x2 = x * x;
+	return x2 * x2 * x;
+}
+
+
+XMFLOAT3 EvalGGX(const GGXParameters& parameters, const XMFLOAT3& toLight, const XMFLOAT3& toViewer)
+{
+	float NoL = std::min(std::max(toLight.z, 0.0f), 1.0f);
+	float hx = toLight.x + toViewer.x;
+	float hy = toLight.y + toViewer.y;
+	float hz = toLight.z + toViewer.z;
+	float length = sqrtf(hx * hx + hy * hy + hz * hz);
+	if (NoL <= 0.0f || length <= 0.0f)
+		return {0.0f, 0.0f, 0.0f};
+
+	float roughness = std::max(parameters.roughness, 1e-4f);
+	float NoV = fabsf(toViewer.z) + 1e-5f;
+	float NoH = std::min(std::max(hz / length, 0.0f), 1.0f);
+	float VoH = std::min(std::max((toViewer.x * hx + toViewer.y * hy + toViewer.z * hz) / length, 0.0f), 1.0f);
+	float specular = D_GGX(NoH, roughness) * Vis_SmithJointGGX(NoL, NoV, roughness);
+	float Fc = Pow5(1.0f - VoH);
+
+	auto channel = [&](float F0, float albedo) { return (albedo / XM_PI + specular * ((1.0f - Fc) * F0 + Fc)) * NoL; };
+	return {channel(parameters.F0.x, parameters.albedo.x), channel(parameters.F0.y, parameters.albedo.y), channel(parameters.F0.z, parameters.albedo.z)};
+}
+
+
+void GetMERLSampleDirections(uint32_t index, XMFLOAT3& toLight, XMFLOAT3& toViewer)
+{
+	uint32_t phiDiffIndex = index % MERLMaterial::kPhiDiffRes;
+	uint32_t thetaDiffIndex = index / MERLMaterial::kPhiDiffRes % MERLMaterial::kThetaDiffRes;
+	uint32_t thetaHalfIndex = index / (MERLMaterial::kPhiDiffRes * MERLMaterial::kThetaDiffRes);
+
+	// inverse of the non linear theta_h mapping
+	float t = (thetaHalfIndex + 0.5f) / MERLMaterial::kThetaHalfRes;
+	float thetaHalf = t * t * (0.5f * XM_PI);
+	float thetaDiff = (thetaDiffIndex + 0.5f) / MERLMaterial::kThetaDiffRes * (0.5f * XM_PI);
+	float phiDiff = (phiDiffIndex + 0.5f) / MERLMaterial::kPhiDiffRes * XM_PI;
+
+	// the difference vector is around the half vector, which is tilted by theta_h about the bitangent
+	float dx = sinf(thetaDiff) * cosf(phiDiff);
+	float dy = sinf(thetaDiff) * sinf(phiDiff);
+	float dz = cosf(thetaDiff);
+	float cosThetaHalf = cosf(thetaHalf);
+	float sinThetaHalf = sinf(thetaHalf);
+	toLight = {dx * cosThetaHalf + dz * sinThetaHalf, dy, dz * cosThetaHalf - dx * sinThetaHalf};
+	toViewer = {dz * sinThetaHalf - dx * cosThetaHalf, -dy, dz * cosThetaHalf + dx * sinThetaHalf};
+}
+
+
+static std::vector<FitSample> CollectSamples(const MERLMaterial& material)
+{
+	std::vector<FitSample> samples;
+	for (uint32_t thetaHalf = 0; thetaHalf < MERLMaterial::kThetaHalfRes; thetaHalf++)
+	{
+		for (uint32_t thetaDiff = 0; thetaDiff < MERLMaterial::kThetaDiffRes; thetaDiff += kThetaDiffStride)
+		{
+			for (uint32_t phiDiff = 0; phiDiff < MERLMaterial::kPhiDiffRes; phiDiff += kPhiDiffStride)
+			{
+				uint32_t index = MERLMaterial::GetIndex(thetaHalf, thetaDiff, phiDiff);
+				bool missing = false;
+				for (uint32_t c = 0; c < MERLMaterial::kChannelsNum; c++)
+					missing |= material.GetChannel(c)[index] < 0.0;
+
+				XMFLOAT3 toLight, toViewer;
+				GetMERLSampleDirections(index, toLight, toViewer);
+				if (missing || toLight.z < kMinFitCosine || toViewer.z < kMinFitCosine)
+					continue;
+
+				FitSample sample;
+				float hx = toLight.x + toViewer.x;
+				float hy = toLight.y + toViewer.y;
+				float hz = toLight.z + toViewer.z;
+				float length = sqrtf(hx * hx + hy * hy + hz * hz);
+				sample.NoL = toLight.z;
+				sample.NoV = toViewer.z + 1e-5f;
+				sample.NoH = hz / length;
+				sample.VoH = (toViewer.x * hx + toViewer.y * hy + toViewer.z * hz) / length;
+				for (uint32_t c = 0; c < MERLMaterial::kChannelsNum; c++)
+					sample.target[c] = log1pf(material.GetValue(c, index) * sample.NoL);
+				samples.push_back(sample);
+			}
+		}
+	}
+	return samples;
+}
+
+
+// Sum of the squared residuals, and the normal equations J^T J and J^T r when jtj is given
+static double Evaluate(const std::vector<FitSample>& samples, const double* parameters, double* jtj, double* jtr)
+{
+	if (jtj)
+	{
+		memset(jtj, 0, kParametersNum * kParametersNum * sizeof(double));
+		memset(jtr, 0, kParametersNum * sizeof(double));
+	}
+
+	const float roughness = (float)parameters[0];
+	const float a2 = roughness * roughness;
+	double cost = 0.0;
+	for (const FitSample& sample : samples)
+	{
+		float d = (sample.NoH * a2 - sample.NoH) * sample.NoH + 1.0f;
+		float D = a2 / (XM_PI * d * d);
+		float lambdaSum = sample.NoL * (sample.NoV * (1.0f - roughness) + roughness) + sample.NoV * (sample.NoL * (1.0f - roughness) + roughness);
+		float vis = 0.5f / lambdaSum;
+		float specular = D * vis;
+		float Fc = Pow5(1.0f - sample.VoH);
+
+		// derivatives of D and Vis with respect to the roughness
+		float dD = 2.0f * roughness / XM_PI * (d - 2.0f * a2 * sample.NoH * sample.NoH) / (d * d * d);
+		float dVis = -0.5f * (sample.NoL * (1.0f - sample.NoV) + sample.NoV * (1.0f - sample.NoL)) / (lambdaSum * lambdaSum);
+		float dSpecular = dD * vis + D * dVis;
+
+		for (uint32_t c = 0; c < MERLMaterial::kChannelsNum; c++)
+		{
+			float fresnel = (1.0f - Fc) * (float)parameters[1 + c] + Fc;
+			float model = (float)parameters[4 + c] / XM_PI + specular * fresnel;
+			double residual = log1pf(model * sample.NoL) - sample.target[c];
+			cost += residual * residual;
+			if (!jtj)
+				continue;
+
+			// each channel only depends on the roughness and its own F0 and albedo
+			float g = sample.NoL / (1.0f + model * sample.NoL);
+			const uint32_t indices[3] = {0, 1 + c, 4 + c};
+			const double row[3] = {g * dSpecular * fresnel, g * specular * (1.0f - Fc), g / XM_PI};
+			for (uint32_t i = 0; i < 3; i++)
+			{
+				jtr[indices[i]] += row[i] * residual;
+				for (uint32_t j = 0; j < 3; j++)
+					jtj[indices[i] * kParametersNum + indices[j]] += row[i] * row[j];
+			}
+		}
+	}
+	return cost;
+}
+
+
+// Solve a x = b in place with Gaussian elimination and partial pivoting, false when a is singular
+static bool Solve(double* a, double* b)
+{
+	const uint32_t n = kParametersNum;
+	for (uint32_t k = 0; k < n; k++)
+	{
+		uint32_t pivot = k;
+		for (uint32_t i = k + 1; i < n; i++)
+			if (fabs(a[i * n + k]) > fabs(a[pivot * n + k]))
+				pivot = i;
+		if (fabs(a[pivot * n + k]) < 1e-300)
+			return false;
+
+		if (pivot != k)
+		{
+			for (uint32_t j = 0; j < n; j++)
+				std::swap(a[k * n + j], a[pivot * n + j]);
+			std::swap(b[k], b[pivot]);
+		}
+		for (uint32_t i = k + 1; i < n; i++)
+		{
+			double factor = a[i * n + k] / a[k * n + k];
+			for (uint32_t j = k; j < n; j++)
+				a[i * n + j] -= factor * a[k * n + j];
+			b[i] -= factor * b[k];
+		}
+	}
+
+	for (uint32_t k = n; k-- > 0;)
+	{
+		for (uint32_t j = k + 1; j < n; j++)
+			b[k] -= a[k * n + j] * b[j];
+		b[k] /= a[k * n + k];
+	}
+	return true;
+}
+
+
+// Keep the parameters physical, steps are projected back onto the bounds
+static void ClampParameters(double* parameters)
+{
+	parameters[0] = std::min(std::max(parameters[0], (double)kMinRoughness), 1.0);
+	for (uint32_t i = 1; i < kParametersNum; i++)
+		parameters[i] = std::min(std::max(parameters[i], 0.0), 1.0);
+}
+
+
+// Levenberg-Marquardt from the given parameters, returns the iterations taken
+static uint32_t Minimize(const std::vector<FitSample>& samples, double* parameters, double& cost)
+{
+	double jtj[kParametersNum * kParametersNum];
+	double jtr[kParametersNum];
+	double lambda = 1e-3;
+	cost = Evaluate(samples, parameters, jtj, jtr);
+
+	uint32_t iteration = 0;
+	while (iteration < kMaxIterations && lambda < 1e10)
+	{
+		iteration++;
+		double a[kParametersNum * kParametersNum];
+		double step[kParametersNum];
+		memcpy(a, jtj, sizeof(a));
+		for (uint32_t i = 0; i < kParametersNum; i++)
+		{
+			a[i * kParametersNum + i] += lambda * jtj[i * kParametersNum + i] + 1e-12;
+			step[i] = -jtr[i];
+		}
+		if (!Solve(a, step))
+		{
+			lambda *= 10.0;
+			continue;
+		}
+
+		double candidate[kParametersNum];
+		for (uint32_t i = 0; i < kParametersNum; i++)
+			candidate[i] = parameters[i] + step[i];
+		ClampParameters(candidate);
+
+		double candidateCost = Evaluate(samples, candidate, nullptr, nullptr);
+		if (candidateCost >= cost)
+		{
+			lambda *= 10.0;
+			continue;
+		}
+
+		bool converged = cost - candidateCost < 1e-9 * cost;
+		memcpy(parameters, candidate, sizeof(candidate));
+		cost = Evaluate(samples, parameters, jtj, jtr);
+		lambda = std::max(lambda * 0.1, 1e-12);
+		if (converged)
+			break;
+	}
+	return iteration;
+}
+
+
+bool FitGGX(const MERLMaterial& material, GGXParameters& parameters, GGXFitError& error)
+{
+	if (!material.IsLoaded())
+		return false;
+
+	std::vector<FitSample> samples = CollectSamples(material);
+	if (samples.empty())
+		return false;
+
+	double best[kParametersNum];
+	double bestCost = DBL_MAX;
+	error.iterations = 0;
+	for (float roughness : kStartRoughnesses)
+	{
+		double candidate[kParametersNum] = {roughness, 0.04, 0.04, 0.04, 0.1, 0.1, 0.1};
+		double cost;
+		error.iterations += Minimize(samples, candidate, cost);
+		if (cost < bestCost)
+		{
+			bestCost = cost;
+			memcpy(best, candidate, sizeof(best));
+		}
+	}
+
+	parameters.roughness = (float)best[0];
+	parameters.F0 = {(float)best[1], (float)best[2], (float)best[3]};
+	parameters.albedo = {(float)best[4], (float)best[5], (float)best[6]};
+	error.rms = (float)sqrt(bestCost / (samples.size() * MERLMaterial::kChannelsNum));
+
+	// luminance of linear Rec.709, the color space of the MERL measurements
+	const float(&luminance)[3] = GetColorSpaceMatrix(kColorSpaceRec709, kColorSpaceXYZ).m[1];
+	double measuredEnergy = 0.0;
+	double fittedEnergy = 0.0;
+	for (const FitSample& sample : samples)
+	{
+		float specular = D_GGX(sample.NoH, parameters.roughness) * Vis_SmithJointGGX(sample.NoL, sample.NoV, parameters.roughness);
+		float Fc = Pow5(1.0f - sample.VoH);
+		for (uint32_t c = 0; c < MERLMaterial::kChannelsNum; c++)
+		{
+			measuredEnergy += luminance[c] * expm1f(sample.target[c]);
+			fittedEnergy += luminance[c] * ((float)best[4 + c] / XM_PI + specular * ((1.0f - Fc) * (float)best[1 + c] + Fc)) * sample.NoL;
+		}
+	}
+	error.energy = measuredEnergy > 0.0 ? (float)(fittedEnergy / measuredEnergy - 1.0) : 0.0f;
+	return true;
+}
+
+
+bool GGXFitTable::Load(const char* filename)
+{
+	m_entries.clear();
+	File file(filename, File::kOpenRead);
+	FitHeader header;
+	if (file.IsOpened() && file.Read(&header, sizeof(header)) == sizeof(header) && header.magic == kFitMagic && header.version == kFitVersion &&
+	    file.GetSize() == sizeof(header) + header.entriesNum * sizeof(Entry))
+	{
+		m_entries.resize(header.entriesNum);
+		uint32_t entriesSize = header.entriesNum * sizeof(Entry);
+		if (file.Read(m_entries.data(), entriesSize) == entriesSize)
+			return true;
+	}
+
+	LogStdErr("Failed to load GGX fits '%s'\n", filename);
+	m_entries.clear();
+	return false;
+}
+
+
+bool GGXFitTable::Save(const char* filename) const
+{
+	File file(filename, File::kOpenWrite);
+	FitHeader header = {kFitMagic, kFitVersion, (uint32_t)m_entries.size(), 0};
+	uint32_t entriesSize = (uint32_t)(m_entries.size() * sizeof(Entry));
+	return file.IsOpened() && file.Write(&header, sizeof(header)) == sizeof(header) && file.Write(m_entries.data(), entriesSize) == entriesSize;
+}
+
+
+const GGXFitTable::Entry* GGXFitTable::Find(const char* name) const
+{
+	for (const Entry& entry : m_entries)
+		if (strcmp(entry.name, name) == 0)
+			return &entry;
+	return nullptr;
+}
+
+
+bool GGXFitTable::FitDirectory()
+{
+	std::vector<FilePath> files;
+	EnumerateFiles("data\\MERL\\*.binary", files);
+	if (files.empty())
+	{
+		LogStdErr("No MERL BRDF in 'data\\MERL'\n");
+		return false;
+	}
+
+	// materials are independent, each thread fits whole files and the report is written in order afterwards
+	GGXFitTable table;
+	table.m_entries.resize(files.size());
+	std::vector<uint8_t> succeeded(files.size(), 0);
+	ParallelFor((uint32_t)files.size(), [&](uint32_t i) {
+		FilePath input = "data\\MERL";
+		input /= files[i];
+
+		Entry& entry = table.m_entries[i];
+		memset(entry.name, 0, kNameLength);
+		strncpy(entry.name, files[i].c_str(), kNameLength - 1);
+		MERLMaterial material;
+		succeeded[i] = material.Load(input.c_str()) && FitGGX(material, entry.parameters, entry.error);
+	});
+
+	std::string report = "# GGX fits of data\\MERL, written by \"brdf_playground.exe merlfit\"\n"
+	                     "# name roughness F0.r F0.g F0.b albedo.r albedo.g albedo.b rms energy iterations\n";
+	bool allSucceeded = true;
+	double rmsSum = 0.0;
+	for (size_t i = 0; i < files.size(); i++)
+	{
+		if (!succeeded[i])
+		{
+			LogStdErr("  %s: failed\n", files[i].c_str());
+			allSucceeded = false;
+			continue;
+		}
+
+		const Entry& entry = table.m_entries[i];
+		const GGXParameters& p = entry.parameters;
+		char line[256];
+		snprintf(line, sizeof(line), "%-32s %.4f %.4f %.4f %.4f %.4f %.4f %.4f %.5f %+.4f %u\n", entry.name, p.roughness, p.F0.x, p.F0.y, p.F0.z, p.albedo.x,
+		         p.albedo.y, p.albedo.z, entry.error.rms, entry.error.energy, entry.error.iterations);
+		report += line;
+		LogStdOut("  %s", line);
+		rmsSum += entry.error.rms;
+	}
+
+	// failed materials are left out of the file
+	std::vector<Entry> entries;
+	for (size_t i = 0; i < files.size(); i++)
+		if (succeeded[i])
+			entries.push_back(table.m_entries[i]);
+	table.m_entries = std::move(entries);
+
+	File reportFile("data\\MERL\\ggx_fits.txt", File::kOpenWrite);
+	bool saved = table.Save("data\\MERL\\ggx_fits.bin") && reportFile.IsOpened() &&
+	             reportFile.Write(report.data(), (uint32_t)report.size()) == (uint32_t)report.size();
+	LogStdOut("Fitted %u MERL BRDFs, mean rms %.5f, %u bytes of parameters\n", (uint32_t)table.m_entries.size(),
+	          table.m_entries.empty() ? 0.0 : rmsSum / table.m_entries.size(), (uint32_t)(sizeof(FitHeader) + table.m_entries.size() * sizeof(Entry)));
+	return allSucceeded && saved;
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include "MERLMaterial.h"
+
+
+// Inputs of the renderer's simple material, D_GGX() * Vis_SmithJointGGX() * F_Schlick() plus Lambert in lighting.h
+struct GGXParameters
+{
+	// squared perceptual roughness, as MaterialData::roughness
+	float roughness = 0.5f;
+	XMFLOAT3 F0 = {0.04f, 0.04f, 0.04f};
+	XMFLOAT3 albedo = {0.0f, 0.0f, 0.0f};
+};
+
+
+struct GGXFitError
+{
+	// RMS of the residuals of the fit, in log(1 + BRDF * cos) space
+	float rms = 0.0f;
+	// signed relative error of the luminance reflected over all fitted direction pairs
+	float energy = 0.0f;
+	uint32_t iterations = 0;
+};
+
+
+// BRDF times the cosine of the light direction, like CalcDirectLight(). Directions are normalized and in the shading frame of MERLEvaluator
+XMFLOAT3 EvalGGX(const GGXParameters& parameters, const XMFLOAT3& toLight, const XMFLOAT3& toViewer);
+
+// Light and view directions at the center of a MERL sample, with phi_half = 0
+void GetMERLSampleDirections(uint32_t index, XMFLOAT3& toLight, XMFLOAT3& toViewer);
+
+/**
+ * \brief Fit the GGX parameters to a measured BRDF with Levenberg-Marquardt.
+ *
+ * Residuals are taken in log(1 + BRDF * cos) space, so the specular peak
+ * does not outweigh the rest of the lobe and the diffuse part by orders of
+ * magnitude. Missing measurements and directions above 80 degrees, where
+ * the MERL data is unreliable, are skipped. A few starting roughnesses are
+ * tried, the best fit is kept.
+ */
+bool FitGGX(const MERLMaterial& material, GGXParameters& parameters, GGXFitError& error);
+
+
+/**
+ * \brief GGX stand-ins of a whole MERL database, a fixed size entry per
+ * material in a single file.
+ */
+class GGXFitTable
+{
+public:
+	static const uint32_t kNameLength = 64;
+
+	struct Entry
+	{
+		char name[kNameLength];
+		GGXParameters parameters;
+		GGXFitError error;
+	};
+
+	bool Load(const char* filename);
+	bool Save(const char* filename) const;
+
+	const std::vector<Entry>& GetEntries() const;
+	// nullptr when the material was not fitted
+	const Entry* Find(const char* name) const;
+
+	// Fit every .binary file of data\MERL, one file per thread, and write data\MERL\ggx_fits.bin and the data\MERL\ggx_fits.txt error report
+	static bool FitDirectory();
+
+private:
+	std::vector<Entry> m_entries;
+};
+
+
+inline const std::vector<GGXFitTable::Entry>& GGXFitTable::GetEntries() const
+{
+	return m_entries;
+}
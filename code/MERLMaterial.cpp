@@ -1,78 +1,376 @@
 #include "Precompiled.h"
+#include "MERLMaterial.h"
+#include "Parallel.h"
+#include <DirectXPackedVector.h>
 
-#define BRDF_SAMPLING_RES_THETA_H 90
-#define BRDF_SAMPLING_RES_THETA_D 90
-#define BRDF_SAMPLING_RES_PHI_D 360
 
-#if 0
-HRESULT MERLMaterial::Load(ID3D11Device* pd3dDevice, const char* materialName)
+const double MERLMaterial::kChannelScales[MERLMaterial::kChannelsNum] = {1.0 / 1500.0, 1.15 / 1500.0, 1.66 / 1500.0};
+
+// Whole table conversions are split in tasks of this many samples
+static const uint32_t kSamplesPerTask = 65536;
+
+// bump on any change of the compact layout or of an encoding
+static const uint32_t kCompactVersion = 1;
+static const uint32_t kCompactMagic = 0x434c524d;  // "MRLC"
+// the log encoding starts here, smaller values are below the noise of the measurements and decode to 0
+static const float kLogOffset = 1e-4f;
+
+
+struct CompactHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t encoding;
+	uint32_t reserved;
+	// log of the largest value of each channel, the top of the log encoding
+	float logMax[MERLMaterial::kChannelsNum];
+	uint32_t reserved2;
+};
+
+
+bool MERLMaterial::Load(const char* filename)
+{
+	Close();
+	if (!m_file.Open(filename))
+	{
+		LogStdErr("Failed to open MERL BRDF '%s'\n", filename);
+		return false;
+	}
+
+	const uint32_t kHeaderSize = 3 * sizeof(int32_t);
+	const int32_t* dims = (const int32_t*)m_file.GetData();
+	if (m_file.GetSize() != kHeaderSize + kChannelsNum * kSamplesNum * sizeof(double) || dims[0] != kThetaHalfRes || dims[1] != kThetaDiffRes ||
+	    dims[2] != kPhiDiffRes)
+	{
+		LogStdErr("'%s' is not a %ux%ux%u MERL BRDF\n", filename, kThetaHalfRes, kThetaDiffRes, kPhiDiffRes);
+		Close();
+		return false;
+	}
+
+	m_samples = (const double*)(m_file.GetData() + kHeaderSize);
+	return true;
+}
+
+
+void MERLMaterial::Close()
+{
+	m_file.Close();
+	m_samples = nullptr;
+}
+
+
+float MERLMaterial::GetValue(uint32_t channel, uint32_t index) const
+{
+	Assert(IsLoaded() && channel < kChannelsNum && index < kSamplesNum);
+	return (float)std::max(GetChannel(channel)[index] * kChannelScales[channel], 0.0);
+}
+
+
+void MERLMaterial::ConvertToFloat(uint32_t channel, uint32_t first, uint32_t count, float* values) const
 {
-	SAFE_RELEASE(m_brdfSRV);
-	SAFE_RELEASE(m_brdf);
+	Assert(IsLoaded() && channel < kChannelsNum && first + count <= kSamplesNum);
+	const double* samples = GetChannel(channel) + first;
+	const double scale = kChannelScales[channel];
+	for (uint32_t i = 0; i < count; i++)
+		values[i] = (float)std::max(samples[i] * scale, 0.0);
+}
 
-	wchar_t relPath[MAX_PATH];
-	wsprintf(relPath, L"%S", materialName);
-	wchar_t fullPath[MAX_PATH];
-	if (FAILED(DXUTFindDXSDKMediaFileCch(fullPath, MAX_PATH, relPath)))
+
+void MERLMaterial::ConvertToHalf(uint32_t channel, uint32_t first, uint32_t count, uint16_t* values) const
+{
+	// through a float block that stays in L1
+	const uint32_t kBlockSize = 1024;
+	float block[kBlockSize];
+	for (uint32_t i = 0; i < count; i += kBlockSize)
 	{
-		ErrorMessageBox("Failed to find MERL BRDF");
-		return E_FAIL;
+		uint32_t blockSize = std::min(kBlockSize, count - i);
+		ConvertToFloat(channel, first + i, blockSize, block);
+		PackedVector::XMConvertFloatToHalfStream(values + i, sizeof(uint16_t), block, sizeof(float), blockSize);
 	}
+}
+
+
+// Call func(channel, first, count) for every task of a whole table conversion, channelsNum is 1 for tasks covering all channels
+template <typename FUNC>
+static void ForEachTask(uint32_t threadsNum, const FUNC& func, uint32_t channelsNum = MERLMaterial::kChannelsNum)
+{
+	const uint32_t tasksPerChannel = (MERLMaterial::kSamplesNum + kSamplesPerTask - 1) / kSamplesPerTask;
+	ParallelFor(
+	    channelsNum * tasksPerChannel,
+	    [&](uint32_t task) {
+		    uint32_t channel = task / tasksPerChannel;
+		    uint32_t first = task % tasksPerChannel * kSamplesPerTask;
+		    func(channel, first, std::min(kSamplesPerTask, MERLMaterial::kSamplesNum - first));
+	    },
+	    threadsNum);
+}
+
+
+void MERLMaterial::ConvertToFloat(float* values, uint32_t threadsNum) const
+{
+	ForEachTask(threadsNum, [&](uint32_t channel, uint32_t first, uint32_t count) {
+		ConvertToFloat(channel, first, count, values + channel * kSamplesNum + first);
+	});
+}
 
-	FILE* f = nullptr;
-	_wfopen_s(&f, fullPath, L"rb");
-	if (!f)
+
+void MERLMaterial::ConvertToHalf(uint16_t* values, uint32_t threadsNum) const
+{
+	ForEachTask(threadsNum, [&](uint32_t channel, uint32_t first, uint32_t count) {
+		ConvertToHalf(channel, first, count, values + channel * kSamplesNum + first);
+	});
+}
+
+
+static uint32_t GetCompactSize(EMERLEncoding encoding)
+{
+	uint32_t sampleSize = encoding == kMERLEncodingHalf ? MERLMaterial::kChannelsNum * sizeof(uint16_t) : sizeof(uint32_t);
+	return sizeof(CompactHeader) + MERLMaterial::kSamplesNum * sampleSize;
+}
+
+
+bool CompactMERLMaterial::Encode(const MERLMaterial& material, EMERLEncoding encoding, uint32_t threadsNum)
+{
+	Close();
+	if (!material.IsLoaded() || encoding >= kMERLEncodingsNum)
 		return false;
 
-	int dims[3];
-	fread(dims, sizeof(int), 3, f);
-	int n = dims[0] * dims[1] * dims[2];
-	if (n != BRDF_SAMPLING_RES_THETA_H * BRDF_SAMPLING_RES_THETA_D * BRDF_SAMPLING_RES_PHI_D / 2)
+	m_memory.resize(GetCompactSize(encoding));
+	CompactHeader* header = (CompactHeader*)m_memory.data();
+	*header = {kCompactMagic, kCompactVersion, (uint32_t)encoding};
+	uint8_t* samples = m_memory.data() + sizeof(CompactHeader);
+
+	if (encoding == kMERLEncodingHalf)
+	{
+		material.ConvertToHalf((uint16_t*)samples, threadsNum);
+		return Attach(m_memory.data(), (uint32_t)m_memory.size());
+	}
+
+	// the top of each channel first, then every sample is quantized against it
+	const uint32_t kBlockSize = 1024;
+	std::vector<float> taskMax(MERLMaterial::kChannelsNum * ((MERLMaterial::kSamplesNum + kSamplesPerTask - 1) / kSamplesPerTask), 0.0f);
+	ForEachTask(threadsNum, [&](uint32_t channel, uint32_t first, uint32_t count) {
+		float block[kBlockSize];
+		float maxValue = 0.0f;
+		for (uint32_t i = 0; i < count; i += kBlockSize)
+		{
+			uint32_t blockSize = std::min(kBlockSize, count - i);
+			material.ConvertToFloat(channel, first + i, blockSize, block);
+			for (uint32_t j = 0; j < blockSize; j++)
+				maxValue = std::max(maxValue, block[j]);
+		}
+		taskMax[channel * (taskMax.size() / MERLMaterial::kChannelsNum) + first / kSamplesPerTask] = maxValue;
+	});
+
+	float invSteps[MERLMaterial::kChannelsNum];
+	const float logMin = logf(kLogOffset);
+	for (uint32_t c = 0; c < MERLMaterial::kChannelsNum; c++)
 	{
-		fprintf(stderr, "Dimensions don't match\n");
-		fclose(f);
+		auto begin = taskMax.begin() + c * (taskMax.size() / MERLMaterial::kChannelsNum);
+		float maxValue = *std::max_element(begin, begin + taskMax.size() / MERLMaterial::kChannelsNum);
+		header->logMax[c] = logf(maxValue + kLogOffset);
+		invSteps[c] = header->logMax[c] > logMin ? (kLogCodesNum - 1) / (header->logMax[c] - logMin) : 0.0f;
+	}
+
+	uint32_t* packed = (uint32_t*)samples;
+	ForEachTask(
+	    threadsNum,
+	    [&](uint32_t, uint32_t first, uint32_t count) {
+		    float block[MERLMaterial::kChannelsNum][kBlockSize];
+		    for (uint32_t i = 0; i < count; i += kBlockSize)
+		    {
+			    uint32_t blockSize = std::min(kBlockSize, count - i);
+			    for (uint32_t c = 0; c < MERLMaterial::kChannelsNum; c++)
+				    material.ConvertToFloat(c, first + i, blockSize, block[c]);
+
+			    for (uint32_t j = 0; j < blockSize; j++)
+			    {
+				    uint32_t sample = 0;
+				    for (uint32_t c = 0; c < MERLMaterial::kChannelsNum; c++)
+				    {
+					    float code = (logf(block[c][j] + kLogOffset) - logMin) * invSteps[c];
+					    sample |= std::min((uint32_t)(code + 0.5f), kLogCodesNum - 1) << (10 * c);
+				    }
+				    packed[first + i + j] = sample;
+			    }
+		    }
+	    },
+	    1);
+
+	return Attach(m_memory.data(), (uint32_t)m_memory.size());
+}
+
+
+bool CompactMERLMaterial::Save(const char* filename) const
+{
+	if (!IsLoaded())
+		return false;
+
+	const uint8_t* data = m_memory.empty() ? m_file.GetData() : m_memory.data();
+	File file(filename, File::kOpenWrite);
+	return file.IsOpened() && file.Write(data, m_size) == m_size;
+}
+
+
+bool CompactMERLMaterial::Load(const char* filename)
+{
+	Close();
+	if (m_file.Open(filename) && Attach(m_file.GetData(), m_file.GetSize()))
+		return true;
+
+	LogStdErr("Failed to load compact MERL BRDF '%s'\n", filename);
+	Close();
+	return false;
+}
+
+
+void CompactMERLMaterial::Close()
+{
+	m_file.Close();
+	m_memory.clear();
+	m_size = 0;
+	m_halfs = nullptr;
+	m_packed = nullptr;
+}
+
+
+bool CompactMERLMaterial::Attach(const uint8_t* data, uint32_t size)
+{
+	if (size < sizeof(CompactHeader))
+		return false;
+
+	const CompactHeader* header = (const CompactHeader*)data;
+	if (header->magic != kCompactMagic || header->version != kCompactVersion || header->encoding >= kMERLEncodingsNum ||
+	    size != GetCompactSize((EMERLEncoding)header->encoding))
 		return false;
+
+	m_size = size;
+	m_encoding = (EMERLEncoding)header->encoding;
+	if (m_encoding == kMERLEncodingHalf)
+	{
+		m_halfs = (const uint16_t*)(data + sizeof(CompactHeader));
+		return true;
 	}
 
-	double* brdfDouble = (double*)malloc(sizeof(double) * 3 * n);
-	fread(brdfDouble, sizeof(double), 3 * n, f);
-	fclose(f);
+	// decoding is a lookup, code 0 is exactly 0
+	const float logMin = logf(kLogOffset);
+	for (uint32_t c = 0; c < MERLMaterial::kChannelsNum; c++)
+	{
+		float step = (header->logMax[c] - logMin) / (kLogCodesNum - 1);
+		m_logTable[c][0] = 0.0f;
+		for (uint32_t code = 1; code < kLogCodesNum; code++)
+			m_logTable[c][code] = std::max(expf(logMin + code * step) - kLogOffset, 0.0f);
+	}
+	m_packed = (const uint32_t*)(data + sizeof(CompactHeader));
+	return true;
+}
 
-	float* brdfFloat = (float*)malloc(sizeof(float) * 3 * n);
-	for (int i = 0; i < 3 * n; i++)
-		brdfFloat[i] = (float)brdfDouble[i];
 
-	D3D11_BUFFER_DESC bufDesc;
-	ZeroMemory(&bufDesc, sizeof(bufDesc));
-	bufDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-	bufDesc.ByteWidth = sizeof(float) * 3 * n;
-	bufDesc.Usage = D3D11_USAGE_DEFAULT;
-	D3D11_SUBRESOURCE_DATA data;
-	data.pSysMem = brdfFloat;
-	data.SysMemPitch = bufDesc.ByteWidth;
-	data.SysMemSlicePitch = 0;
+float CompactMERLMaterial::GetValue(uint32_t channel, uint32_t index) const
+{
+	Assert(IsLoaded() && channel < MERLMaterial::kChannelsNum && index < MERLMaterial::kSamplesNum);
+	if (m_encoding == kMERLEncodingHalf)
+		return PackedVector::XMConvertHalfToFloat(m_halfs[channel * MERLMaterial::kSamplesNum + index]);
+	return m_logTable[channel][(m_packed[index] >> (10 * channel)) & (kLogCodesNum - 1)];
+}
+
+
+void CompactMERLMaterial::Decode(float* values, uint32_t threadsNum) const
+{
+	Assert(IsLoaded());
+	ForEachTask(threadsNum, [&](uint32_t channel, uint32_t first, uint32_t count) {
+		float* out = values + channel * MERLMaterial::kSamplesNum + first;
+		if (m_encoding == kMERLEncodingHalf)
+		{
+			PackedVector::XMConvertHalfToFloatStream(out, sizeof(float), m_halfs + channel * MERLMaterial::kSamplesNum + first, sizeof(uint16_t), count);
+			return;
+		}
 
-	HRESULT hr;
-	V_RETURN(pd3dDevice->CreateBuffer(&bufDesc, &data, &m_brdf));
+		const float* table = m_logTable[channel];
+		for (uint32_t i = 0; i < count; i++)
+			out[i] = table[(m_packed[first + i] >> (10 * channel)) & (kLogCodesNum - 1)];
+	});
+}
 
-	D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
-	ZeroMemory(&srvDesc, sizeof(srvDesc));
-	srvDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
-	srvDesc.Format = DXGI_FORMAT_R32_FLOAT;
-	srvDesc.Buffer.FirstElement = 0;
-	srvDesc.Buffer.NumElements = 3 * n;
-	V_RETURN(pd3dDevice->CreateShaderResourceView(m_brdf, &srvDesc, &m_brdfSRV));
 
-	free(brdfDouble);
-	free(brdfFloat);
+MERLEncodingError CompactMERLMaterial::ComputeError(const MERLMaterial& material) const
+{
+	MERLEncodingError error;
+	uint32_t relativeNum = 0;
+	double relativeSum = 0.0;
+	for (uint32_t c = 0; c < MERLMaterial::kChannelsNum; c++)
+	{
+		for (uint32_t i = 0; i < MERLMaterial::kSamplesNum; i++)
+		{
+			float reference = material.GetValue(c, i);
+			float difference = fabsf(GetValue(c, i) - reference);
+			if (reference < kMERLRelativeErrorThreshold)
+			{
+				error.maxAbsolute = std::max(error.maxAbsolute, difference);
+				continue;
+			}
 
-	return S_OK;
+			float relative = difference / reference;
+			error.maxRelative = std::max(error.maxRelative, relative);
+			relativeSum += relative;
+			relativeNum++;
+		}
+	}
+	error.meanRelative = relativeNum ? (float)(relativeSum / relativeNum) : 0.0f;
+	return error;
 }
 
 
-void MERLMaterial::Release()
+bool CompactMERLMaterial::BuildDirectory(EMERLEncoding encoding)
 {
-	SAFE_RELEASE(m_brdfSRV);
-	SAFE_RELEASE(m_brdf);
+	std::vector<FilePath> files;
+	EnumerateFiles("data\\MERL\\*.binary", files);
+	if (files.empty())
+	{
+		LogStdErr("No MERL BRDF in 'data\\MERL'\n");
+		return false;
+	}
+
+	// materials are independent, each thread encodes whole files and the report is logged in order afterwards
+	struct Result
+	{
+		bool succeeded = false;
+		uint32_t size = 0;
+		MERLEncodingError error;
+	};
+	std::vector<Result> results(files.size());
+	ParallelFor((uint32_t)files.size(), [&](uint32_t i) {
+		FilePath input = "data\\MERL";
+		input /= files[i];
+		FilePath output = input;
+		output.SetExtension(".merlc");
+
+		MERLMaterial material;
+		CompactMERLMaterial compact;
+		if (!material.Load(input.c_str()) || !compact.Encode(material, encoding, 1) || !compact.Save(output.c_str()))
+			return;
+
+		results[i].succeeded = true;
+		results[i].size = compact.GetSize();
+		results[i].error = compact.ComputeError(material);
+	});
+
+	bool succeeded = true;
+	uint64_t totalSize = 0;
+	for (size_t i = 0; i < files.size(); i++)
+	{
+		const Result& result = results[i];
+		if (!result.succeeded)
+		{
+			LogStdErr("  %s: failed\n", files[i].c_str());
+			succeeded = false;
+			continue;
+		}
+
+		totalSize += result.size;
+		LogStdOut("  %s: %.2f MB, relative error max %.5f mean %.6f, absolute error below %g max %g\n", files[i].c_str(), result.size / (1024.0 * 1024.0),
+		          result.error.maxRelative, result.error.meanRelative, kMERLRelativeErrorThreshold, result.error.maxAbsolute);
+	}
+	LogStdOut("Encoded %u MERL BRDFs as %s, %.1f MB in total\n", (uint32_t)files.size(), kMERLEncodingNames[encoding], totalSize / (1024.0 * 1024.0));
+	return succeeded;
 }
-#endif
\ No newline at end of file
@@ -1,13 +1,166 @@
 #pragma once
 
 
-#if 0
-struct MERLMaterial
+/**
+ * \brief Measured isotropic BRDF of the MERL database, Matusik et al. 2003.
+ *
+ * The .binary file is mapped, Load() only validates the 90x90x180 header,
+ * so samples are paged in when they are first touched. The three channels
+ * are stored one after the other as doubles, indexed by the half angle
+ * theta, the difference angle theta and the difference angle phi. They are
+ * exposed as is, or converted to float or half on demand, either a range
+ * at a time or the whole table across threads.
+ *
+ * The conversions apply kChannelScales, their values are the BRDF that the
+ * CPU consumers expect: MERLEvaluator, the GGX fit, the sampling tables and
+ * CompactMERLMaterial. merl.h applies the same scales on the GPU, a buffer
+ * for it is filled from GetChannel() and never from the conversions.
+ */
+class MERLMaterial
 {
-	HRESULT Load(ID3D11Device* pd3dDevice, const char* materialName);
-	void Release();
+public:
+	static const uint32_t kThetaHalfRes = 90;
+	static const uint32_t kThetaDiffRes = 90;
+	// reciprocity halves the phi difference range
+	static const uint32_t kPhiDiffRes = 180;
+	static const uint32_t kSamplesNum = kThetaHalfRes * kThetaDiffRes * kPhiDiffRes;
+	static const uint32_t kChannelsNum = 3;
+	// Scales of the stored red, green and blue values, from the reference reader of the database
+	static const double kChannelScales[kChannelsNum];
 
-	ID3D11Buffer* m_brdf = nullptr;
-	ID3D11ShaderResourceView* m_brdfSRV = nullptr;
+	MERLMaterial() = default;
+	MERLMaterial(const MERLMaterial&) = delete;
+	MERLMaterial& operator=(const MERLMaterial&) = delete;
+
+	bool Load(const char* filename);
+	void Close();
+
+	bool IsLoaded() const;
+
+	static uint32_t GetIndex(uint32_t thetaHalf, uint32_t thetaDiff, uint32_t phiDiff);
+
+	// Samples of a channel as stored in the file, unscaled and negative where the measurement is missing
+	const double* GetChannel(uint32_t channel) const;
+	// BRDF value of a sample, scaled and clamped to 0
+	float GetValue(uint32_t channel, uint32_t index) const;
+
+	// Convert count samples of a channel starting at first, the same way as GetValue(). Only the pages of the range are touched
+	void ConvertToFloat(uint32_t channel, uint32_t first, uint32_t count, float* values) const;
+	void ConvertToHalf(uint32_t channel, uint32_t first, uint32_t count, uint16_t* values) const;
+
+	// Convert all channels, one after the other like the file, on all hardware threads when threadsNum is 0
+	void ConvertToFloat(float* values, uint32_t threadsNum = 0) const;
+	void ConvertToHalf(uint16_t* values, uint32_t threadsNum = 0) const;
+
+private:
+	MappedFile m_file;
+	const double* m_samples = nullptr;
+};
+
+
+inline bool MERLMaterial::IsLoaded() const
+{
+	return m_samples != nullptr;
+}
+
+
+inline uint32_t MERLMaterial::GetIndex(uint32_t thetaHalf, uint32_t thetaDiff, uint32_t phiDiff)
+{
+	return (thetaHalf * kThetaDiffRes + thetaDiff) * kPhiDiffRes + phiDiff;
+}
+
+
+inline const double* MERLMaterial::GetChannel(uint32_t channel) const
+{
+	return m_samples + channel * kSamplesNum;
+}
+
+
+enum EMERLEncoding
+{
+	// scaled values as fp16, planar like the .binary file
+	kMERLEncodingHalf = 0,
+	// natural log of the scaled values quantized to 10 bits per channel, one packed uint32 per sample
+	kMERLEncodingLog10Bit,
+	kMERLEncodingsNum
+};
+
+static const char* const kMERLEncodingNames[kMERLEncodingsNum] = {"half", "log10bit"};
+
+
+// Round trip error of an encoding, relative above kMERLRelativeErrorThreshold and absolute below it
+struct MERLEncodingError
+{
+	float maxRelative = 0.0f;
+	float meanRelative = 0.0f;
+	float maxAbsolute = 0.0f;
 };
-#endif
\ No newline at end of file
+
+static const float kMERLRelativeErrorThreshold = 1e-3f;
+
+
+/**
+ * \brief MERL BRDF in a compact format meant to keep many materials in
+ * memory, the same bytes on disk and in memory.
+ *
+ * The channel scales of the database are folded in, so values decode
+ * straight to the BRDF. fp16 keeps about 3 significant digits over the
+ * whole range in half the size of floats. The log encoding spends 10 bits
+ * per channel on the natural log of the value up to the channel maximum, a
+ * third of the size of floats for below 1% of error, and decodes through a
+ * 1024 entry table.
+ */
+class CompactMERLMaterial
+{
+public:
+	static const uint32_t kLogCodesNum = 1024;
+
+	// Encode a loaded material in memory, on all hardware threads when threadsNum is 0
+	bool Encode(const MERLMaterial& material, EMERLEncoding encoding, uint32_t threadsNum = 0);
+	bool Save(const char* filename) const;
+	bool Load(const char* filename);
+	void Close();
+
+	bool IsLoaded() const;
+	EMERLEncoding GetEncoding() const;
+	// Bytes taken by the samples and the header
+	uint32_t GetSize() const;
+
+	float GetValue(uint32_t channel, uint32_t index) const;
+	// Decode all channels one after the other, like MERLMaterial::ConvertToFloat()
+	void Decode(float* values, uint32_t threadsNum = 0) const;
+
+	MERLEncodingError ComputeError(const MERLMaterial& material) const;
+
+	// Encode every .binary file of data\MERL next to it with the .merlc extension, one file per thread, and log the round trip errors
+	static bool BuildDirectory(EMERLEncoding encoding);
+
+private:
+	MappedFile m_file;
+	std::vector<uint8_t> m_memory;
+	uint32_t m_size = 0;
+	EMERLEncoding m_encoding = kMERLEncodingHalf;
+	const uint16_t* m_halfs = nullptr;
+	const uint32_t* m_packed = nullptr;
+	float m_logTable[MERLMaterial::kChannelsNum][kLogCodesNum];
+
+	bool Attach(const uint8_t* data, uint32_t size);
+};
+
+
+inline bool CompactMERLMaterial::IsLoaded() const
+{
+	return m_halfs != nullptr || m_packed != nullptr;
+}
+
+
+inline EMERLEncoding CompactMERLMaterial::GetEncoding() const
+{
+	return m_encoding;
+}
+
+
+inline uint32_t CompactMERLMaterial::GetSize() const
+{
+	return m_size;
+}
@@ -0,0 +1,352 @@
+#include "Precompiled.h"
+#include "MERLSampler.h"
+#include "ColorSpace.h"
+#include <algorithm>
+
+
+// bump on any change of the table layout or of the cell weights
+static const uint32_t kSamplerVersion = 1;
+static const uint32_t kSamplerMagic = 0x534c524d;  // "MRLS"
+
+// share of the samples drawn from the cosine, the pdf then never drops below this fraction of the cosine pdf
+static const float kCosineFraction = 0.1f;
+// cells are weighted by the average of this many samples per axis
+static const uint32_t kCellSamplesPerAxis = 2;
+static const float kOneMinusEpsilon = 0x1.fffffep-1f;
+
+
+struct SamplerHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t viewBinsNum;
+	uint32_t thetaHalfBinsNum;
+	uint32_t phiHalfBinsNum;
+	uint32_t reserved;
+};
+
+
+static uint32_t GetSamplerSize()
+{
+	uint32_t marginalsNum = MERLSampler::kViewBinsNum * (MERLSampler::kThetaHalfBinsNum + 1);
+	uint32_t conditionalsNum = MERLSampler::kViewBinsNum * MERLSampler::kThetaHalfBinsNum * (MERLSampler::kPhiHalfBinsNum + 1);
+	return sizeof(SamplerHeader) + (marginalsNum + conditionalsNum) * sizeof(float);
+}
+
+
+// Lower edge of a theta_h bin, the same non linear mapping as the MERL table
+static float ThetaHalfEdge(uint32_t bin)
+{
+	float t = (float)bin / MERLSampler::kThetaHalfBinsNum;
+	return t * t * (0.5f * XM_PI);
+}
+
+
+static uint32_t ThetaHalfBin(float thetaHalf)
+{
+	if (thetaHalf <= 0.0f)
+		return 0;
+	return std::min((uint32_t)(sqrtf(thetaHalf * (2.0f / XM_PI)) * MERLSampler::kThetaHalfBinsNum), MERLSampler::kThetaHalfBinsNum - 1);
+}
+
+
+// Rotation about the normal bringing the view direction into the xz plane, and its elevation bin
+struct ViewFrame
+{
+	float cosPhi;
+	float sinPhi;
+	XMFLOAT3 toViewer;
+	uint32_t bin;
+};
+
+
+static ViewFrame GetViewFrame(const XMFLOAT3& toViewer)
+{
+	ViewFrame frame;
+	float sinTheta = sqrtf(toViewer.x * toViewer.x + toViewer.y * toViewer.y);
+	frame.cosPhi = sinTheta > 0.0f ? toViewer.x / sinTheta : 1.0f;
+	frame.sinPhi = sinTheta > 0.0f ? toViewer.y / sinTheta : 0.0f;
+	frame.toViewer = {sinTheta, 0.0f, toViewer.z};
+	float theta = atan2f(sinTheta, toViewer.z);
+	frame.bin = std::min((uint32_t)std::max(theta * (2.0f / XM_PI * MERLSampler::kViewBinsNum), 0.0f), MERLSampler::kViewBinsNum - 1);
+	return frame;
+}
+
+
+// Normalize weights into a CDF of binsNum + 1 entries, uniform when they are all 0. Returns their sum
+static double BuildCDF(const double* weights, uint32_t binsNum, float* cdf)
+{
+	double sum = 0.0;
+	for (uint32_t i = 0; i < binsNum; i++)
+		sum += weights[i];
+
+	double partial = 0.0;
+	cdf[0] = 0.0f;
+	for (uint32_t i = 1; i < binsNum; i++)
+	{
+		partial += weights[i - 1];
+		cdf[i] = sum > 0.0 ? (float)(partial / sum) : (float)i / binsNum;
+	}
+	cdf[binsNum] = 1.0f;
+	return sum;
+}
+
+
+// Bin of u in a CDF, u is remapped to [0, 1) inside the bin
+static uint32_t SampleCDF(const float* cdf, uint32_t binsNum, float& u)
+{
+	uint32_t bin = std::min((uint32_t)(std::upper_bound(cdf + 1, cdf + binsNum + 1, u) - (cdf + 1)), binsNum - 1);
+	float width = cdf[bin + 1] - cdf[bin];
+	u = width > 0.0f ? std::min((u - cdf[bin]) / width, kOneMinusEpsilon) : 0.0f;
+	return bin;
+}
+
+
+bool MERLSampler::Build(const MERLEvaluator& evaluator, uint32_t threadsNum)
+{
+	Close();
+	if (!evaluator.IsInitialized())
+		return false;
+
+	m_memory.resize(GetSamplerSize());
+	SamplerHeader* header = (SamplerHeader*)m_memory.data();
+	*header = {kSamplerMagic, kSamplerVersion, kViewBinsNum, kThetaHalfBinsNum, kPhiHalfBinsNum, 0};
+	float* marginals = (float*)(header + 1);
+	float* conditionals = marginals + kViewBinsNum * (kThetaHalfBinsNum + 1);
+
+	// luminance of linear Rec.709, the color space of the MERL measurements
+	const float(&luminance)[3] = GetColorSpaceMatrix(kColorSpaceRec709, kColorSpaceXYZ).m[1];
+	const uint32_t kCellSamplesNum = kCellSamplesPerAxis * kCellSamplesPerAxis;
+	const uint32_t kSamplesNum = kThetaHalfBinsNum * kPhiHalfBinsNum * kCellSamplesNum;
+	const float kPhiStep = 2.0f * XM_PI / kPhiHalfBinsNum;
+
+	ParallelFor(
+	    kViewBinsNum,
+	    [&](uint32_t viewBin) {
+		    // the center of the bin stands for all its elevations, the azimuth is 0
+		    float thetaView = (viewBin + 0.5f) * (0.5f * XM_PI / kViewBinsNum);
+		    XMFLOAT3 toViewer = {sinf(thetaView), 0.0f, cosf(thetaView)};
+
+		    // light directions of the cell samples, reflected about their half vector, and the Jacobians from (theta_h, phi_h) to them
+		    std::vector<float> planes[6];
+		    for (std::vector<float>& plane : planes)
+			    plane.resize(kSamplesNum);
+		    std::vector<float> jacobians(kSamplesNum);
+		    uint32_t i = 0;
+		    for (uint32_t t = 0; t < kThetaHalfBinsNum; t++)
+		    {
+			    for (uint32_t p = 0; p < kPhiHalfBinsNum; p++)
+			    {
+				    for (uint32_t s = 0; s < kCellSamplesNum; s++, i++)
+				    {
+					    float thetaHalf = Lerp((s / kCellSamplesPerAxis + 0.5f) / kCellSamplesPerAxis, ThetaHalfEdge(t), ThetaHalfEdge(t + 1));
+					    float phiHalf = (p + (s % kCellSamplesPerAxis + 0.5f) / kCellSamplesPerAxis) * kPhiStep;
+					    float sinThetaHalf = sinf(thetaHalf);
+					    XMFLOAT3 half = {sinThetaHalf * cosf(phiHalf), sinThetaHalf * sinf(phiHalf), cosf(thetaHalf)};
+					    float VoH = toViewer.x * half.x + toViewer.z * half.z;
+					    planes[0][i] = 2.0f * VoH * half.x - toViewer.x;
+					    planes[1][i] = 2.0f * VoH * half.y;
+					    planes[2][i] = 2.0f * VoH * half.z - toViewer.z;
+					    planes[3][i] = toViewer.x;
+					    planes[4][i] = toViewer.y;
+					    planes[5][i] = toViewer.z;
+					    jacobians[i] = sinThetaHalf * 4.0f * std::max(VoH, 0.0f);
+				    }
+			    }
+		    }
+
+		    std::vector<float> rgb[3];
+		    for (std::vector<float>& channel : rgb)
+			    channel.resize(kSamplesNum);
+		    MERLDirections toLight = {planes[0].data(), planes[1].data(), planes[2].data()};
+		    MERLDirections toViewers = {planes[3].data(), planes[4].data(), planes[5].data()};
+		    evaluator.Eval(toLight, toViewers, kSamplesNum, rgb[0].data(), rgb[1].data(), rgb[2].data());
+
+		    // azimuth bins share their width, so only the theta_h bins scale the rows of the marginal
+		    double cellWeights[kPhiHalfBinsNum];
+		    double rowWeights[kThetaHalfBinsNum];
+		    i = 0;
+		    for (uint32_t t = 0; t < kThetaHalfBinsNum; t++)
+		    {
+			    for (uint32_t p = 0; p < kPhiHalfBinsNum; p++)
+			    {
+				    double weight = 0.0;
+				    for (uint32_t s = 0; s < kCellSamplesNum; s++, i++)
+					    weight += (luminance[0] * rgb[0][i] + luminance[1] * rgb[1][i] + luminance[2] * rgb[2][i]) * jacobians[i];
+				    cellWeights[p] = std::max(weight, 0.0);
+			    }
+			    float* conditional = conditionals + (viewBin * kThetaHalfBinsNum + t) * (kPhiHalfBinsNum + 1);
+			    rowWeights[t] = BuildCDF(cellWeights, kPhiHalfBinsNum, conditional) * (ThetaHalfEdge(t + 1) - ThetaHalfEdge(t));
+		    }
+		    BuildCDF(rowWeights, kThetaHalfBinsNum, marginals + viewBin * (kThetaHalfBinsNum + 1));
+	    },
+	    threadsNum);
+
+	return Attach(m_memory.data(), (uint32_t)m_memory.size());
+}
+
+
+bool MERLSampler::Save(const char* filename) const
+{
+	if (!IsLoaded())
+		return false;
+
+	const uint8_t* data = m_memory.empty() ? m_file.GetData() : m_memory.data();
+	uint32_t size = GetSamplerSize();
+	File file(filename, File::kOpenWrite);
+	return file.IsOpened() && file.Write(data, size) == size;
+}
+
+
+bool MERLSampler::Load(const char* filename)
+{
+	Close();
+	if (m_file.Open(filename) && Attach(m_file.GetData(), m_file.GetSize()))
+		return true;
+
+	LogStdErr("Failed to load MERL sampling tables '%s'\n", filename);
+	Close();
+	return false;
+}
+
+
+void MERLSampler::Close()
+{
+	m_file.Close();
+	m_memory.clear();
+	m_marginal = nullptr;
+	m_conditional = nullptr;
+}
+
+
+bool MERLSampler::Attach(const uint8_t* data, uint32_t size)
+{
+	if (size != GetSamplerSize())
+		return false;
+
+	const SamplerHeader* header = (const SamplerHeader*)data;
+	if (header->magic != kSamplerMagic || header->version != kSamplerVersion || header->viewBinsNum != kViewBinsNum ||
+	    header->thetaHalfBinsNum != kThetaHalfBinsNum || header->phiHalfBinsNum != kPhiHalfBinsNum)
+		return false;
+
+	m_marginal = (const float*)(header + 1);
+	m_conditional = m_marginal + kViewBinsNum * (kThetaHalfBinsNum + 1);
+	return true;
+}
+
+
+MERLSample MERLSampler::Sample(const XMFLOAT3& toViewer, float u0, float u1) const
+{
+	Assert(IsLoaded());
+	ViewFrame frame = GetViewFrame(toViewer);
+
+	XMFLOAT3 toLight;
+	if (u0 < kCosineFraction)
+	{
+		// cosine distributed, the frame does not matter
+		float r = sqrtf(u1);
+		float phi = 2.0f * XM_PI * (u0 / kCosineFraction);
+		toLight = {r * cosf(phi), r * sinf(phi), sqrtf(std::max(1.0f - u1, 0.0f))};
+	}
+	else
+	{
+		u0 = std::min((u0 - kCosineFraction) / (1.0f - kCosineFraction), kOneMinusEpsilon);
+		uint32_t thetaHalfBin = SampleCDF(GetMarginal(frame.bin), kThetaHalfBinsNum, u0);
+		uint32_t phiHalfBin = SampleCDF(GetConditional(frame.bin, thetaHalfBin), kPhiHalfBinsNum, u1);
+		float thetaHalf = Lerp(u0, ThetaHalfEdge(thetaHalfBin), ThetaHalfEdge(thetaHalfBin + 1));
+		float phiHalf = (phiHalfBin + u1) * (2.0f * XM_PI / kPhiHalfBinsNum);
+
+		// reflect the view direction about the half vector in the view frame, then rotate back
+		const XMFLOAT3& v = frame.toViewer;
+		float sinThetaHalf = sinf(thetaHalf);
+		XMFLOAT3 half = {sinThetaHalf * cosf(phiHalf), sinThetaHalf * sinf(phiHalf), cosf(thetaHalf)};
+		float VoH = v.x * half.x + v.z * half.z;
+		float x = 2.0f * VoH * half.x - v.x;
+		float y = 2.0f * VoH * half.y;
+		toLight = {frame.cosPhi * x - frame.sinPhi * y, frame.sinPhi * x + frame.cosPhi * y, 2.0f * VoH * half.z - v.z};
+	}
+
+	return {toLight, Pdf(toLight, toViewer)};
+}
+
+
+float MERLSampler::Pdf(const XMFLOAT3& toLight, const XMFLOAT3& toViewer) const
+{
+	Assert(IsLoaded());
+	if (toLight.z <= 0.0f)
+		return 0.0f;
+
+	float cosinePdf = kCosineFraction * toLight.z / XM_PI;
+
+	// half vector in the view frame
+	ViewFrame frame = GetViewFrame(toViewer);
+	float x = frame.cosPhi * toLight.x + frame.sinPhi * toLight.y + frame.toViewer.x;
+	float y = frame.cosPhi * toLight.y - frame.sinPhi * toLight.x;
+	float z = toLight.z + frame.toViewer.z;
+	float length = sqrtf(x * x + y * y + z * z);
+	if (length <= 0.0f)
+		return cosinePdf;
+
+	XMFLOAT3 half = {x / length, y / length, z / length};
+	float VoH = frame.toViewer.x * half.x + frame.toViewer.z * half.z;
+	float sinThetaHalf = sqrtf(half.x * half.x + half.y * half.y);
+	if (VoH <= 0.0f || sinThetaHalf <= 0.0f)
+		return cosinePdf;
+
+	float thetaHalf = atan2f(sinThetaHalf, half.z);
+	float phiHalf = atan2f(half.y, half.x);
+	if (phiHalf < 0.0f)
+		phiHalf += 2.0f * XM_PI;
+	uint32_t thetaHalfBin = ThetaHalfBin(thetaHalf);
+	uint32_t phiHalfBin = std::min((uint32_t)(phiHalf * (kPhiHalfBinsNum / (2.0f * XM_PI))), kPhiHalfBinsNum - 1);
+
+	// the cell is uniform over (theta_h, phi_h), divided by the Jacobian to the light direction
+	const float* marginal = GetMarginal(frame.bin);
+	const float* conditional = GetConditional(frame.bin, thetaHalfBin);
+	float cellProbability = (marginal[thetaHalfBin + 1] - marginal[thetaHalfBin]) * (conditional[phiHalfBin + 1] - conditional[phiHalfBin]);
+	float cellArea = (ThetaHalfEdge(thetaHalfBin + 1) - ThetaHalfEdge(thetaHalfBin)) * (2.0f * XM_PI / kPhiHalfBinsNum);
+	float tablePdf = cellProbability / (cellArea * sinThetaHalf * 4.0f * VoH);
+	return cosinePdf + (1.0f - kCosineFraction) * tablePdf;
+}
+
+
+bool MERLSampler::BuildDirectory()
+{
+	std::vector<FilePath> files;
+	EnumerateFiles("data\\MERL\\*.binary", files);
+	if (files.empty())
+	{
+		LogStdErr("No MERL BRDF in 'data\\MERL'\n");
+		return false;
+	}
+
+	// materials are independent, each thread builds whole files
+	std::vector<uint8_t> succeeded(files.size(), 0);
+	ParallelFor((uint32_t)files.size(), [&](uint32_t i) {
+		FilePath input = "data\\MERL";
+		input /= files[i];
+		FilePath output = input;
+		output.SetExtension(".merls");
+
+		MERLMaterial material;
+		MERLEvaluator evaluator;
+		MERLSampler sampler;
+		if (!material.Load(input.c_str()))
+			return;
+		evaluator.Init(material, 1);
+		material.Close();
+		succeeded[i] = sampler.Build(evaluator, 1) && sampler.Save(output.c_str());
+	});
+
+	bool allSucceeded = true;
+	for (size_t i = 0; i < files.size(); i++)
+	{
+		if (!succeeded[i])
+		{
+			LogStdErr("  %s: failed\n", files[i].c_str());
+			allSucceeded = false;
+		}
+	}
+	LogStdOut("Built the sampling tables of %u MERL BRDFs, %.2f MB each\n", (uint32_t)files.size(), GetSamplerSize() / (1024.0 * 1024.0));
+	return allSucceeded;
+}
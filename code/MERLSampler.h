@@ -0,0 +1,81 @@
+#pragma once
+#include "MERLEvaluator.h"
+
+
+struct MERLSample
+{
+	XMFLOAT3 toLight;
+	// over the solid angle, 0 when the direction is below the horizon and carries no energy
+	float pdf;
+};
+
+
+/**
+ * \brief Importance sampling tables of a measured isotropic BRDF, so light
+ * directions follow the measured lobe instead of the cosine.
+ *
+ * For a view elevation the free dimensions are the half vector angles,
+ * theta_h and its azimuth relative to the view, phi_d follows from them. Each
+ * of the kViewBinsNum elevation bins holds a marginal CDF over theta_h, on
+ * the non linear bins of the MERL table, and a conditional CDF over the
+ * azimuth for every theta_h bin. Cells are weighted by the luminance of the
+ * BRDF times the cosine and the Jacobian to the light direction. A fraction
+ * of the samples stays cosine distributed, so the pdf covers every direction
+ * the table bins missed and the estimator remains unbiased.
+ */
+class MERLSampler
+{
+public:
+	static const uint32_t kViewBinsNum = 32;
+	static const uint32_t kThetaHalfBinsNum = MERLMaterial::kThetaHalfRes;
+	static const uint32_t kPhiHalfBinsNum = 180;
+
+	MERLSampler() = default;
+	MERLSampler(const MERLSampler&) = delete;
+	MERLSampler& operator=(const MERLSampler&) = delete;
+
+	// Build the tables in memory from an initialized evaluator, on all hardware threads when threadsNum is 0
+	bool Build(const MERLEvaluator& evaluator, uint32_t threadsNum = 0);
+	bool Save(const char* filename) const;
+	bool Load(const char* filename);
+	void Close();
+
+	bool IsLoaded() const;
+
+	// Directions are normalized and in the shading frame of MERLEvaluator, u0 and u1 uniform in [0, 1)
+	MERLSample Sample(const XMFLOAT3& toViewer, float u0, float u1) const;
+	float Pdf(const XMFLOAT3& toLight, const XMFLOAT3& toViewer) const;
+
+	// Build the tables of every .binary file of data\MERL next to it with the .merls extension, one file per thread
+	static bool BuildDirectory();
+
+private:
+	MappedFile m_file;
+	std::vector<uint8_t> m_memory;
+	// kThetaHalfBinsNum + 1 entries per view bin
+	const float* m_marginal = nullptr;
+	// kPhiHalfBinsNum + 1 entries per theta_h bin of every view bin
+	const float* m_conditional = nullptr;
+
+	bool Attach(const uint8_t* data, uint32_t size);
+	const float* GetMarginal(uint32_t viewBin) const;
+	const float* GetConditional(uint32_t viewBin, uint32_t thetaHalfBin) const;
+};
+
+
+inline bool MERLSampler::IsLoaded() const
+{
+	return m_marginal != nullptr;
+}
+
+
+inline const float* MERLSampler::GetMarginal(uint32_t viewBin) const
+{
+	return m_marginal + viewBin * (kThetaHalfBinsNum + 1);
+}
+
+
+inline const float* MERLSampler::GetConditional(uint32_t viewBin, uint32_t thetaHalfBin) const
+{
+	return m_conditional + (viewBin * kThetaHalfBinsNum + thetaHalfBin) * (kPhiHalfBinsNum + 1);
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <atomic>
+#include <thread>
+
+
+/**
+ * \brief Call func(i) for every i in [0, count) on up to threadsNum threads,
+ * the calling thread included. 0 uses every hardware thread. Indices are
+ * handed out one at a time, so items of uneven cost balance out.
+ */
+template <typename FUNC>
+inline void ParallelFor(uint32_t count, const FUNC& func, uint32_t threadsNum = 0)
+{
+	if (threadsNum == 0)
+		threadsNum = std::max(std::thread::hardware_concurrency(), 1u);
+	threadsNum = std::min(threadsNum, count);
+
+	std::atomic<uint32_t> next = 0;
+	auto worker = [&]() {
+		for (uint32_t i = next++; i < count; i = next++)
+			func(i);
+	};
+
+	std::vector<std::thread> threads;
+	for (uint32_t t = 1; t < threadsNum; t++)
+		threads.emplace_back(worker);
+	worker();
+	for (std::thread& thread : threads)
+		thread.join();
+}
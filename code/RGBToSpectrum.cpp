@@ -0,0 +1,353 @@
+#include "Precompiled.h"
+#include "RGBToSpectrum.h"
+#include "Parallel.h"
+
+
+static const char* kTablePath = "data\\RGBToSpectrum.bin";
+
+// bump on any change of the layout or of the fit
+static const uint32_t kTableVersion = 1;
+static const uint32_t kTableMagic = 0x53424752;  // "RGBS"
+static const uint32_t kMaxIterations = 15;
+// coefficients of the normalized wavelength beyond this only sharpen the sigmoid into a step
+static const double kMaxCoefficient = 200.0;
+
+
+struct TableHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t resolution;
+	uint32_t reserved;
+};
+
+
+static RGBToSpectrumTable s_rgbToSpectrumTable;
+
+
+// D65 lit color matching functions the spectra are fitted against, over the normalized wavelength
+struct FitData
+{
+	double lambda[kSpectrumSamples];
+	double xyzWeights[kSpectrumSamples][3];
+	double xyzWhite[3];
+};
+
+
+static void InitFitData(FitData& data)
+{
+	const Spectrum& d65 = GetD65Normalized<Spectrum>();
+	const Spectrum* cie[3] = {&GetCIE_X<Spectrum>(), &GetCIE_Y<Spectrum>(), &GetCIE_Z<Spectrum>()};
+	double normalization = GetCIENormalization<Spectrum>();
+
+	data.xyzWhite[0] = data.xyzWhite[1] = data.xyzWhite[2] = 0.0;
+	for (uint32_t i = 0; i < kSpectrumSamples; i++)
+	{
+		data.lambda[i] = (i + 0.5) / kSpectrumSamples;
+		for (uint32_t c = 0; c < 3; c++)
+		{
+			data.xyzWeights[i][c] = (double)(*cie[c])[i] * d65[i] * normalization;
+			data.xyzWhite[c] += data.xyzWeights[i][c];
+		}
+	}
+}
+
+
+static double Sigmoid(double x)
+{
+	return 0.5 + x / (2.0 * sqrt(1.0 + x * x));
+}
+
+
+// The fit minimizes the difference in CIELAB, i.e. roughly in perceived color
+static void XYZToLab(const FitData& data, const double xyz[3], double lab[3])
+{
+	auto f = [](double t) {
+		const double delta = 6.0 / 29.0;
+		return t > delta * delta * delta ? cbrt(t) : t / (3.0 * delta * delta) + 4.0 / 29.0;
+	};
+
+	double fx = f(xyz[0] / data.xyzWhite[0]);
+	double fy = f(xyz[1] / data.xyzWhite[1]);
+	double fz = f(xyz[2] / data.xyzWhite[2]);
+	lab[0] = 116.0 * fy - 16.0;
+	lab[1] = 500.0 * (fx - fy);
+	lab[2] = 200.0 * (fy - fz);
+}
+
+
+static void EvalResidual(const FitData& data, const double coefficients[3], const double targetLab[3], double residual[3])
+{
+	double xyz[3] = {};
+	for (uint32_t i = 0; i < kSpectrumSamples; i++)
+	{
+		double lambda = data.lambda[i];
+		double s = Sigmoid((coefficients[0] * lambda + coefficients[1]) * lambda + coefficients[2]);
+		for (uint32_t c = 0; c < 3; c++)
+			xyz[c] += s * data.xyzWeights[i][c];
+	}
+
+	double lab[3];
+	XYZToLab(data, xyz, lab);
+	for (uint32_t c = 0; c < 3; c++)
+		residual[c] = targetLab[c] - lab[c];
+}
+
+
+// Gauss-Newton iterations from the given coefficients, with a central difference Jacobian
+static void FitCoefficients(const FitData& data, const float rgb[3], double coefficients[3])
+{
+	float xyz[3];
+	LinearRGBToXYZ(rgb[0], rgb[1], rgb[2], xyz[0], xyz[1], xyz[2]);
+	double targetXYZ[3] = {xyz[0], xyz[1], xyz[2]};
+	double targetLab[3];
+	XYZToLab(data, targetXYZ, targetLab);
+
+	for (uint32_t iteration = 0; iteration < kMaxIterations; iteration++)
+	{
+		double residual[3];
+		EvalResidual(data, coefficients, targetLab, residual);
+		if (residual[0] * residual[0] + residual[1] * residual[1] + residual[2] * residual[2] < 1e-12)
+			break;
+
+		const double eps = 1e-5;
+		double jacobian[3][3];
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			double c[3] = {coefficients[0], coefficients[1], coefficients[2]};
+			double r0[3], r1[3];
+			c[i] = coefficients[i] - eps;
+			EvalResidual(data, c, targetLab, r0);
+			c[i] = coefficients[i] + eps;
+			EvalResidual(data, c, targetLab, r1);
+			for (uint32_t j = 0; j < 3; j++)
+				jacobian[j][i] = (r1[j] - r0[j]) / (2.0 * eps);
+		}
+
+		// solve jacobian * step = residual by Cramer's rule
+		auto det3 = [](const double m[3][3]) {
+			return m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+			       m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+		};
+		double det = det3(jacobian);
+		if (fabs(det) < 1e-15)
+			break;
+
+		double step[3];
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			double m[3][3];
+			memcpy(m, jacobian, sizeof(m));
+			for (uint32_t j = 0; j < 3; j++)
+				m[j][i] = residual[j];
+			step[i] = det3(m) / det;
+		}
+
+		double maxCoefficient = 0.0;
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			coefficients[i] -= step[i];
+			maxCoefficient = std::max(maxCoefficient, fabs(coefficients[i]));
+		}
+		if (maxCoefficient > kMaxCoefficient)
+		{
+			for (uint32_t i = 0; i < 3; i++)
+				coefficients[i] *= kMaxCoefficient / maxCoefficient;
+		}
+	}
+}
+
+
+// Brightness nodes, denser towards black and white where the coefficients change fastest
+static float ScaleNode(uint32_t k, uint32_t resolution)
+{
+	auto smoothStep = [](float x) { return x * x * (3.0f - 2.0f * x); };
+	return smoothStep(smoothStep((float)k / (resolution - 1)));
+}
+
+
+static size_t GetTableSize(uint32_t resolution)
+{
+	return sizeof(TableHeader) + resolution * sizeof(float) + (size_t)3 * resolution * resolution * resolution * 3 * sizeof(float);
+}
+
+
+bool RGBToSpectrumTable::Bake(uint32_t resolution, uint32_t threadsNum)
+{
+	Close();
+	if (resolution < 2)
+		return false;
+
+	std::unique_ptr<FitData> data = std::make_unique<FitData>();
+	InitFitData(*data);
+
+	m_memory.resize(GetTableSize(resolution));
+	TableHeader* header = (TableHeader*)m_memory.data();
+	header->magic = kTableMagic;
+	header->version = kTableVersion;
+	header->resolution = resolution;
+	header->reserved = 0;
+	float* scales = (float*)(m_memory.data() + sizeof(TableHeader));
+	float* coefficients = scales + resolution;
+	for (uint32_t k = 0; k < resolution; k++)
+		scales[k] = ScaleNode(k, resolution);
+
+	// Every brightness row starts from a mid gray fit and walks towards black and white,
+	// each fit starting from the previous one. Rows are independent and fitted in parallel
+	const uint32_t rowsNum = 3 * resolution * resolution;
+	ParallelFor(
+	    rowsNum,
+	    [&](uint32_t row) {
+		    uint32_t maxComponent = row / (resolution * resolution);
+		    uint32_t y = row / resolution % resolution;
+		    uint32_t x = row % resolution;
+
+		    auto fit = [&](uint32_t k, double c[3]) {
+			    float z = scales[k];
+			    float rgb[3];
+			    rgb[maxComponent] = z;
+			    rgb[(maxComponent + 1) % 3] = (float)x / (resolution - 1) * z;
+			    rgb[(maxComponent + 2) % 3] = (float)y / (resolution - 1) * z;
+			    FitCoefficients(*data, rgb, c);
+
+			    // from the normalized wavelength to nm
+			    const double offset = kSpectrumMinWavelength;
+			    const double scale = 1.0 / kSpectrumRange;
+			    float* out = coefficients + ((((size_t)maxComponent * resolution + k) * resolution + y) * resolution + x) * 3;
+			    out[0] = (float)(c[0] * scale * scale);
+			    out[1] = (float)(c[1] * scale - 2.0 * c[0] * offset * scale * scale);
+			    out[2] = (float)(c[2] - c[1] * offset * scale + c[0] * offset * offset * scale * scale);
+		    };
+
+		    const uint32_t start = resolution / 5;
+		    double c[3] = {};
+		    for (uint32_t k = start; k < resolution; k++)
+			    fit(k, c);
+		    c[0] = c[1] = c[2] = 0.0;
+		    for (uint32_t k = start + 1; k-- > 0;)
+			    fit(k, c);
+	    },
+	    threadsNum);
+
+	return Attach(m_memory.data(), (uint32_t)m_memory.size());
+}
+
+
+bool RGBToSpectrumTable::Build(uint32_t resolution)
+{
+	RGBToSpectrumTable table;
+	if (!table.Bake(resolution))
+		return false;
+
+	// the table can't be rewritten while it is mapped
+	bool reopen = s_rgbToSpectrumTable.IsOpened();
+	s_rgbToSpectrumTable.Close();
+	File file(kTablePath, File::kOpenWrite);
+	bool written = file.IsOpened() && file.Write(table.m_memory.data(), (uint32_t)table.m_memory.size()) == (uint32_t)table.m_memory.size();
+	if (written)
+		LogStdOut("Fitted %u^3 RGB to spectrum coefficients into '%s'\n", resolution, kTablePath);
+	if (reopen)
+		s_rgbToSpectrumTable.Open();
+	return written;
+}
+
+
+bool RGBToSpectrumTable::Open()
+{
+	Close();
+	if (m_file.Open(kTablePath) && Attach(m_file.GetData(), m_file.GetSize()))
+		return true;
+
+	Close();
+	return false;
+}
+
+
+void RGBToSpectrumTable::Close()
+{
+	m_file.Close();
+	m_memory.clear();
+	m_scales = nullptr;
+	m_coefficients = nullptr;
+	m_resolution = 0;
+}
+
+
+bool RGBToSpectrumTable::Attach(const uint8_t* data, uint32_t size)
+{
+	if (size < sizeof(TableHeader))
+		return false;
+
+	const TableHeader* header = (const TableHeader*)data;
+	if (header->magic != kTableMagic || header->version != kTableVersion || header->resolution < 2 || size != GetTableSize(header->resolution))
+		return false;
+
+	m_resolution = header->resolution;
+	m_scales = (const float*)(data + sizeof(TableHeader));
+	m_coefficients = m_scales + m_resolution;
+	return true;
+}
+
+
+SigmoidPolynomial RGBToSpectrumTable::Lookup(float r, float g, float b) const
+{
+	Assert(IsOpened());
+	float rgb[3] = {std::min(std::max(r, 0.0f), 1.0f), std::min(std::max(g, 0.0f), 1.0f), std::min(std::max(b, 0.0f), 1.0f)};
+
+	// grays are flat, the sigmoid of a constant hitting the value exactly
+	SigmoidPolynomial result;
+	if (rgb[0] == rgb[1] && rgb[1] == rgb[2])
+	{
+		float v = rgb[0];
+		result.c2 = v <= 0.0f ? -1e6f : v >= 1.0f ? 1e6f : (v - 0.5f) / sqrtf(v * (1.0f - v));
+		return result;
+	}
+
+	uint32_t maxComponent = rgb[0] > rgb[1] ? (rgb[0] > rgb[2] ? 0 : 2) : (rgb[1] > rgb[2] ? 1 : 2);
+	float z = rgb[maxComponent];
+	float x = rgb[(maxComponent + 1) % 3] * (m_resolution - 1) / z;
+	float y = rgb[(maxComponent + 2) % 3] * (m_resolution - 1) / z;
+
+	uint32_t xi = std::min((uint32_t)x, m_resolution - 2);
+	uint32_t yi = std::min((uint32_t)y, m_resolution - 2);
+	uint32_t zi = (uint32_t)(std::upper_bound(m_scales, m_scales + m_resolution, z) - m_scales);
+	zi = std::min(std::max(zi, 1u), m_resolution - 1) - 1;
+	float dx = x - xi;
+	float dy = y - yi;
+	float dz = (z - m_scales[zi]) / (m_scales[zi + 1] - m_scales[zi]);
+
+	const uint32_t res = m_resolution;
+	const float* base = m_coefficients + ((((size_t)maxComponent * res + zi) * res + yi) * res + xi) * 3;
+	const size_t strideX = 3, strideY = res * 3, strideZ = (size_t)res * res * 3;
+	float c[3];
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		const float* p = base + i;
+		float c00 = Lerp(dx, p[0], p[strideX]);
+		float c01 = Lerp(dx, p[strideY], p[strideY + strideX]);
+		float c10 = Lerp(dx, p[strideZ], p[strideZ + strideX]);
+		float c11 = Lerp(dx, p[strideZ + strideY], p[strideZ + strideY + strideX]);
+		c[i] = Lerp(dz, Lerp(dy, c00, c01), Lerp(dy, c10, c11));
+	}
+	result.c0 = c[0];
+	result.c1 = c[1];
+	result.c2 = c[2];
+	return result;
+}
+
+
+bool InitRGBToSpectrumTable()
+{
+	if (s_rgbToSpectrumTable.Open())
+		return true;
+
+	LogStdOut("No RGB to spectrum table in '%s', RGB colors are uplifted with the Smits bases. Run \"brdf_playground.exe rgb2spec\" to fit it\n",
+	          kTablePath);
+	return false;
+}
+
+
+const RGBToSpectrumTable& GetRGBToSpectrumTable()
+{
+	return s_rgbToSpectrumTable;
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include "SpectralPowerDistribution.h"
+
+
+/**
+ * \brief Smooth spectrum of Jakob and Hanika 2019, a sigmoid of a quadratic
+ * polynomial in the wavelength. It stays within [0, 1] and can be evaluated
+ * at any wavelength without building a whole spectrum.
+ */
+struct SigmoidPolynomial
+{
+	// coefficients of c0 * lambda^2 + c1 * lambda + c2 with lambda in nm
+	float c0 = 0.0f;
+	float c1 = 0.0f;
+	float c2 = 0.0f;
+
+	float Eval(float lambda) const;
+
+	template <typename S>
+	S ToSpectrum() const;
+};
+
+
+inline float SigmoidPolynomial::Eval(float lambda) const
+{
+	float x = (c0 * lambda + c1) * lambda + c2;
+	return 0.5f + x / (2.0f * sqrtf(1.0f + x * x));
+}
+
+
+template <typename S>
+inline S SigmoidPolynomial::ToSpectrum() const
+{
+	static const float kLaneOffsets[8] = {0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f};
+	const float binWidth = (S::kMaxWavelength - S::kMinWavelength) / S::kSamples;
+
+	// sampled at the bin centers
+	S spectrum;
+	float* values = &spectrum[0];
+	DispatchSimd([&](auto packet) {
+		using P = decltype(packet);
+		const P offsets = SimdTraits<P>::Load(kLaneOffsets);
+		const P half = SimdTraits<P>::Set(0.5f);
+		const P one = SimdTraits<P>::Set(1.0f);
+		uint32_t i = 0;
+		for (; i + SimdTraits<P>::kWidth <= S::kSamples; i += SimdTraits<P>::kWidth)
+		{
+			P lambda = MulAdd(SimdTraits<P>::Set((float)i) + offsets, SimdTraits<P>::Set(binWidth), SimdTraits<P>::Set(S::kMinWavelength));
+			P x = MulAdd(MulAdd(SimdTraits<P>::Set(c0), lambda, SimdTraits<P>::Set(c1)), lambda, SimdTraits<P>::Set(c2));
+			SimdTraits<P>::Store(values + i, MulAdd(half, x / Sqrt(MulAdd(x, x, one)), half));
+		}
+		for (; i < S::kSamples; i++)
+			values[i] = Eval(S::kMinWavelength + (i + 0.5f) * binWidth);
+	});
+	return spectrum;
+}
+
+
+/**
+ * \brief Sigmoid coefficients of linear RGB reflectances lit by D65, fitted
+ * offline on a res^3 grid for each of the three largest components and
+ * stored in data\RGBToSpectrum.bin. A lookup is a trilinear interpolation of
+ * the coefficients, so uplifting a color costs the same whatever the spectrum
+ * resolution it ends up in.
+ */
+class RGBToSpectrumTable
+{
+public:
+	static const uint32_t kDefaultResolution = 64;
+
+	// Map the table file, without it FromLinearRGB() falls back to the Smits bases
+	bool Open();
+	void Close();
+
+	// Fit the coefficients of every grid point on all hardware threads and write the table file
+	static bool Build(uint32_t resolution = kDefaultResolution);
+	// Fit into memory only, on all hardware threads when threadsNum is 0
+	bool Bake(uint32_t resolution, uint32_t threadsNum = 0);
+
+	bool IsOpened() const;
+	uint32_t GetResolution() const;
+
+	// r, g and b are clamped to [0, 1]
+	SigmoidPolynomial Lookup(float r, float g, float b) const;
+
+private:
+	MappedFile m_file;
+	std::vector<uint8_t> m_memory;
+	const float* m_scales = nullptr;
+	const float* m_coefficients = nullptr;
+	uint32_t m_resolution = 0;
+
+	bool Attach(const uint8_t* data, uint32_t size);
+};
+
+
+inline bool RGBToSpectrumTable::IsOpened() const
+{
+	return m_coefficients != nullptr;
+}
+
+
+inline uint32_t RGBToSpectrumTable::GetResolution() const
+{
+	return m_resolution;
+}
+
+
+bool InitRGBToSpectrumTable();
+const RGBToSpectrumTable& GetRGBToSpectrumTable();
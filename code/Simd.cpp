@@ -0,0 +1,75 @@
+#include "Precompiled.h"
+#include "Simd.h"
+#include <intrin.h>
+
+
+static ESimdLevel DetectSimdLevel()
+{
+#if SIMD_X64
+	int info[4];
+	__cpuid(info, 0);
+	int maxLeaf = info[0];
+
+	__cpuid(info, 1);
+	bool fma = (info[2] & (1 << 12)) != 0;
+	bool osxsave = (info[2] & (1 << 27)) != 0;
+	bool avx = (info[2] & (1 << 28)) != 0;
+	// The OS has to preserve the XMM and YMM registers on context switches
+	bool ymmState = osxsave && (_xgetbv(0) & 0x6) == 0x6;
+
+	bool avx2 = false;
+	if (maxLeaf >= 7)
+	{
+		__cpuidex(info, 7, 0);
+		avx2 = (info[1] & (1 << 5)) != 0;
+	}
+
+	return fma && avx && ymmState && avx2 ? kSimd256 : kSimd128;
+#elif SIMD_NEON
+	return kSimd128;
+#else
+	return kSimdScalar;
+#endif
+}
+
+
+static const ESimdLevel kSupportedSimdLevel = DetectSimdLevel();
+static ESimdLevel s_simdLevel = kSupportedSimdLevel;
+
+
+ESimdLevel GetSupportedSimdLevel()
+{
+	return kSupportedSimdLevel;
+}
+
+
+ESimdLevel GetSimdLevel()
+{
+	return s_simdLevel;
+}
+
+
+void SetSimdLevel(ESimdLevel level)
+{
+	s_simdLevel = std::min(level, kSupportedSimdLevel);
+}
+
+
+const char* GetSimdLevelName(ESimdLevel level)
+{
+	switch (level)
+	{
+		case kSimdScalar:
+			return "scalar";
+		case kSimd128:
+#if SIMD_NEON
+			return "NEON";
+#else
+			return "SSE2";
+#endif
+		case kSimd256:
+			return "AVX2+FMA";
+		default:
+			return "unknown";
+	}
+}
@@ -0,0 +1,459 @@
+#pragma once
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define SIMD_X64 1
+#include <immintrin.h>
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+
+enum ESimdLevel
+{
+	kSimdScalar = 0,
+	kSimd128,  // SSE2 on x64, NEON on ARM64
+	kSimd256,  // AVX2 + FMA
+	kSimdLevelsNum
+};
+
+
+// Widest instruction set the CPU and the OS support
+ESimdLevel GetSupportedSimdLevel();
+
+// Instruction set the kernels dispatch to, defaults to the supported one
+ESimdLevel GetSimdLevel();
+
+// Force a narrower instruction set, e.g. to compare against the scalar path. The level is clamped to the supported one.
+void SetSimdLevel(ESimdLevel level);
+
+const char* GetSimdLevelName(ESimdLevel level);
+
+
+/**
+ * \brief Packet types used by the vectorized kernels.
+ *
+ * A kernel is written once as a template over the packet type P and
+ * instantiated for float (the scalar fallback), Float4 and Float8.
+ * SimdTraits<P> provides loads, stores and the lane count, the free
+ * functions below the arithmetic. Loads and stores are unaligned.
+ */
+template <typename P>
+struct SimdTraits;
+
+
+template <>
+struct SimdTraits<float>
+{
+	static const uint32_t kWidth = 1;
+
+	static float Load(const float* p)
+	{
+		return *p;
+	}
+
+	static float Set(float v)
+	{
+		return v;
+	}
+
+	static void Store(float* p, float v)
+	{
+		*p = v;
+	}
+};
+
+
+inline float Max(float a, float b)
+{
+	return a > b ? a : b;
+}
+
+
+inline float Min(float a, float b)
+{
+	return a < b ? a : b;
+}
+
+
+inline float Sqrt(float a)
+{
+	return std::sqrt(a);
+}
+
+
+inline float MulAdd(float a, float b, float c)
+{
+	return a * b + c;
+}
+
+
+inline float ReduceAdd(float a)
+{
+	return a;
+}
+
+
+// Comparisons give a mask per lane for Select(), a bool for the scalar version
+inline bool LessThan(float a, float b)
+{
+	return a < b;
+}
+
+
+// a where the mask is set, b elsewhere
+inline float Select(bool mask, float a, float b)
+{
+	return mask ? a : b;
+}
+
+
+// Rounds toward zero, the results have to fit in an int32
+inline float Truncate(float a)
+{
+	return (float)(int32_t)a;
+}
+
+
+#if SIMD_X64 || SIMD_NEON
+
+struct Float4
+{
+#if SIMD_X64
+	__m128 v;
+#else
+	float32x4_t v;
+#endif
+};
+
+
+template <>
+struct SimdTraits<Float4>
+{
+	static const uint32_t kWidth = 4;
+
+#if SIMD_X64
+	static Float4 Load(const float* p)
+	{
+		return {_mm_loadu_ps(p)};
+	}
+
+	static Float4 Set(float v)
+	{
+		return {_mm_set1_ps(v)};
+	}
+
+	static void Store(float* p, Float4 v)
+	{
+		_mm_storeu_ps(p, v.v);
+	}
+#else
+	static Float4 Load(const float* p)
+	{
+		return {vld1q_f32(p)};
+	}
+
+	static Float4 Set(float v)
+	{
+		return {vdupq_n_f32(v)};
+	}
+
+	static void Store(float* p, Float4 v)
+	{
+		vst1q_f32(p, v.v);
+	}
+#endif
+};
+
+
+#if SIMD_X64
+
+inline Float4 operator+(Float4 a, Float4 b)
+{
+	return {_mm_add_ps(a.v, b.v)};
+}
+
+
+inline Float4 operator-(Float4 a, Float4 b)
+{
+	return {_mm_sub_ps(a.v, b.v)};
+}
+
+
+inline Float4 operator*(Float4 a, Float4 b)
+{
+	return {_mm_mul_ps(a.v, b.v)};
+}
+
+
+inline Float4 operator/(Float4 a, Float4 b)
+{
+	return {_mm_div_ps(a.v, b.v)};
+}
+
+
+// Same as the scalar version: returns b when either operand is NaN
+inline Float4 Max(Float4 a, Float4 b)
+{
+	return {_mm_max_ps(a.v, b.v)};
+}
+
+
+inline Float4 Min(Float4 a, Float4 b)
+{
+	return {_mm_min_ps(a.v, b.v)};
+}
+
+
+inline Float4 Sqrt(Float4 a)
+{
+	return {_mm_sqrt_ps(a.v)};
+}
+
+
+// FMA is not part of the 128-bit baseline, so this rounds twice like the scalar version
+inline Float4 MulAdd(Float4 a, Float4 b, Float4 c)
+{
+	return {_mm_add_ps(_mm_mul_ps(a.v, b.v), c.v)};
+}
+
+
+inline float ReduceAdd(Float4 a)
+{
+	__m128 shuf = _mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(2, 3, 0, 1));
+	__m128 sums = _mm_add_ps(a.v, shuf);
+	shuf = _mm_movehl_ps(shuf, sums);
+	sums = _mm_add_ss(sums, shuf);
+	return _mm_cvtss_f32(sums);
+}
+
+
+inline Float4 LessThan(Float4 a, Float4 b)
+{
+	return {_mm_cmplt_ps(a.v, b.v)};
+}
+
+
+// blendv is SSE4.1, the baseline selects with bitwise operations
+inline Float4 Select(Float4 mask, Float4 a, Float4 b)
+{
+	return {_mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v))};
+}
+
+
+inline Float4 Truncate(Float4 a)
+{
+	return {_mm_cvtepi32_ps(_mm_cvttps_epi32(a.v))};
+}
+
+#else
+
+inline Float4 operator+(Float4 a, Float4 b)
+{
+	return {vaddq_f32(a.v, b.v)};
+}
+
+
+inline Float4 operator-(Float4 a, Float4 b)
+{
+	return {vsubq_f32(a.v, b.v)};
+}
+
+
+inline Float4 operator*(Float4 a, Float4 b)
+{
+	return {vmulq_f32(a.v, b.v)};
+}
+
+
+inline Float4 operator/(Float4 a, Float4 b)
+{
+	return {vdivq_f32(a.v, b.v)};
+}
+
+
+// vmaxq_f32 propagates NaN, select explicitly to match the scalar version
+inline Float4 Max(Float4 a, Float4 b)
+{
+	return {vbslq_f32(vcgtq_f32(a.v, b.v), a.v, b.v)};
+}
+
+
+inline Float4 Min(Float4 a, Float4 b)
+{
+	return {vbslq_f32(vcltq_f32(a.v, b.v), a.v, b.v)};
+}
+
+
+inline Float4 Sqrt(Float4 a)
+{
+	return {vsqrtq_f32(a.v)};
+}
+
+
+inline Float4 MulAdd(Float4 a, Float4 b, Float4 c)
+{
+	return {vfmaq_f32(c.v, a.v, b.v)};
+}
+
+
+inline float ReduceAdd(Float4 a)
+{
+	return vaddvq_f32(a.v);
+}
+
+
+inline Float4 LessThan(Float4 a, Float4 b)
+{
+	return {vreinterpretq_f32_u32(vcltq_f32(a.v, b.v))};
+}
+
+
+inline Float4 Select(Float4 mask, Float4 a, Float4 b)
+{
+	return {vbslq_f32(vreinterpretq_u32_f32(mask.v), a.v, b.v)};
+}
+
+
+inline Float4 Truncate(Float4 a)
+{
+	return {vcvtq_f32_s32(vcvtq_s32_f32(a.v))};
+}
+
+#endif
+
+#endif
+
+
+#if SIMD_X64
+
+struct Float8
+{
+	__m256 v;
+};
+
+
+template <>
+struct SimdTraits<Float8>
+{
+	static const uint32_t kWidth = 8;
+
+	static Float8 Load(const float* p)
+	{
+		return {_mm256_loadu_ps(p)};
+	}
+
+	static Float8 Set(float v)
+	{
+		return {_mm256_set1_ps(v)};
+	}
+
+	static void Store(float* p, Float8 v)
+	{
+		_mm256_storeu_ps(p, v.v);
+	}
+};
+
+
+inline Float8 operator+(Float8 a, Float8 b)
+{
+	return {_mm256_add_ps(a.v, b.v)};
+}
+
+
+inline Float8 operator-(Float8 a, Float8 b)
+{
+	return {_mm256_sub_ps(a.v, b.v)};
+}
+
+
+inline Float8 operator*(Float8 a, Float8 b)
+{
+	return {_mm256_mul_ps(a.v, b.v)};
+}
+
+
+inline Float8 operator/(Float8 a, Float8 b)
+{
+	return {_mm256_div_ps(a.v, b.v)};
+}
+
+
+inline Float8 Max(Float8 a, Float8 b)
+{
+	return {_mm256_max_ps(a.v, b.v)};
+}
+
+
+inline Float8 Min(Float8 a, Float8 b)
+{
+	return {_mm256_min_ps(a.v, b.v)};
+}
+
+
+inline Float8 Sqrt(Float8 a)
+{
+	return {_mm256_sqrt_ps(a.v)};
+}
+
+
+inline Float8 MulAdd(Float8 a, Float8 b, Float8 c)
+{
+	return {_mm256_fmadd_ps(a.v, b.v, c.v)};
+}
+
+
+inline float ReduceAdd(Float8 a)
+{
+	Float4 lo = {_mm256_castps256_ps128(a.v)};
+	Float4 hi = {_mm256_extractf128_ps(a.v, 1)};
+	return ReduceAdd(lo + hi);
+}
+
+
+inline Float8 LessThan(Float8 a, Float8 b)
+{
+	return {_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)};
+}
+
+
+inline Float8 Select(Float8 mask, Float8 a, Float8 b)
+{
+	return {_mm256_blendv_ps(b.v, a.v, mask.v)};
+}
+
+
+inline Float8 Truncate(Float8 a)
+{
+	return {_mm256_cvtepi32_ps(_mm256_cvttps_epi32(a.v))};
+}
+
+#endif
+
+
+/**
+ * \brief Call a generic lambda with a default constructed packet of the
+ * active SIMD level, e.g.
+ *
+ *     DispatchSimd([&](auto packet) { using P = decltype(packet); ... });
+ */
+template <typename LAMBDA>
+inline void DispatchSimd(const LAMBDA& lambda)
+{
+	switch (GetSimdLevel())
+	{
+#if SIMD_X64
+		case kSimd256:
+			lambda(Float8());
+			return;
+#endif
+#if SIMD_X64 || SIMD_NEON
+		case kSimd128:
+			lambda(Float4());
+			return;
+#endif
+		default:
+			lambda(0.0f);
+			return;
+	}
+}
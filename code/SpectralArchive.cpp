@@ -0,0 +1,363 @@
+#include "Precompiled.h"
+#include "SpectralArchive.h"
+
+
+static const char* kSPDsDir = "data\\SPDs";
+static const char* kSPDsSearchPath = "data\\SPDs\\*.spd";
+static const char* kArchivePath = "data\\SPDs.pack";
+
+// bump on any change of the layout or of the way spectra are resampled
+static const uint32_t kArchiveVersion = 1;
+static const uint32_t kArchiveMagic = 0x41445053;  // "SPDA"
+static const uint32_t kArchiveAlignment = 16;
+static const uint32_t kNameLength = 64;
+
+
+struct ArchiveHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t samplesNum;
+	float minWavelength;
+	float maxWavelength;
+	uint32_t sourcesNum;
+	uint32_t sourcesOffset;
+	uint32_t materialsNum;
+	uint32_t materialsOffset;
+};
+
+
+// A source .spd file, the archive is out of date as soon as the list of sources differs
+struct ArchiveSource
+{
+	char name[kNameLength];
+	uint64_t size;
+	uint64_t writeTime;
+};
+
+
+struct ArchiveEntries
+{
+	uint32_t size;
+	uint32_t wavelengthsOffset;
+	uint32_t valuesOffset;
+};
+
+
+// Materials are sorted by name
+struct ArchiveMaterial
+{
+	char name[kNameLength];
+	ArchiveEntries etaEntries;
+	ArchiveEntries kEntries;
+	uint32_t etaOffset;
+	uint32_t kOffset;
+};
+
+
+static_assert(std::is_trivially_copyable_v<Spectrum> && sizeof(Spectrum) == kSpectrumSamples * sizeof(float), "Spectrum is read in place from the archive");
+
+
+static SpectralArchive s_spectralArchive;
+
+
+static bool GatherSources(std::vector<ArchiveSource>& sources)
+{
+	std::vector<FilePath> files;
+	EnumerateFiles(kSPDsSearchPath, files);
+	std::sort(files.begin(), files.end());
+
+	sources.clear();
+	for (const FilePath& file : files)
+	{
+		if (file.length() >= kNameLength)
+		{
+			LogStdErr("SPD file name '%s' is too long, skipping it\n", file.c_str());
+			continue;
+		}
+
+		FilePath path = kSPDsDir;
+		path /= file.c_str();
+		WIN32_FILE_ATTRIBUTE_DATA attributes;
+		if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &attributes))
+			return false;
+
+		ArchiveSource source = {};
+		strcpy(source.name, file.c_str());
+		source.size = ((uint64_t)attributes.nFileSizeHigh << 32) | attributes.nFileSizeLow;
+		source.writeTime = ((uint64_t)attributes.ftLastWriteTime.dwHighDateTime << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+		sources.push_back(source);
+	}
+
+	return true;
+}
+
+
+static uint32_t AppendToArchive(std::vector<uint8_t>& archive, const void* data, size_t size)
+{
+	archive.resize((archive.size() + kArchiveAlignment - 1) / kArchiveAlignment * kArchiveAlignment);
+	uint32_t offset = (uint32_t)archive.size();
+	archive.insert(archive.end(), (const uint8_t*)data, (const uint8_t*)data + size);
+	return offset;
+}
+
+
+static ArchiveEntries AppendEntries(std::vector<uint8_t>& archive, const SpectralPowerDistribution& spd)
+{
+	ArchiveEntries entries;
+	entries.size = (uint32_t)spd.Size();
+	entries.wavelengthsOffset = AppendToArchive(archive, spd.Wavelength(), spd.Size() * sizeof(float));
+	entries.valuesOffset = AppendToArchive(archive, spd.Values(), spd.Size() * sizeof(float));
+	return entries;
+}
+
+
+static bool BuildArchive(const std::vector<ArchiveSource>& sources, std::vector<uint8_t>& archive)
+{
+	const char* kEtaExtension = ".eta.spd";
+	const char* kKExtension = ".k.spd";
+
+	struct Pair
+	{
+		std::string name;
+		SpectralPowerDistribution eta;
+		SpectralPowerDistribution k;
+	};
+
+	std::vector<Pair> pairs;
+	for (const ArchiveSource& source : sources)
+	{
+		size_t length = strlen(source.name);
+		size_t extensionLength = strlen(kEtaExtension);
+		if (length <= extensionLength || strcmp(source.name + length - extensionLength, kEtaExtension) != 0)
+			continue;
+
+		Pair pair;
+		pair.name.assign(source.name, length - extensionLength);
+		std::string kName = pair.name + kKExtension;
+		auto isK = [&kName](const ArchiveSource& s) { return kName == s.name; };
+		if (std::find_if(sources.begin(), sources.end(), isK) == sources.end())
+			continue;
+
+		if (!pair.eta.InitFromFile(source.name) || !pair.k.InitFromFile(kName.c_str()) || pair.eta.Size() == 0 || pair.k.Size() == 0)
+		{
+			LogStdErr("Failed to load IOR '%s'\n", pair.name.c_str());
+			continue;
+		}
+		pairs.push_back(std::move(pair));
+	}
+	std::sort(pairs.begin(), pairs.end(), [](const Pair& a, const Pair& b) { return strcmp(a.name.c_str(), b.name.c_str()) < 0; });
+
+	archive.clear();
+	ArchiveHeader header = {};
+	AppendToArchive(archive, &header, sizeof(header));
+	header.magic = kArchiveMagic;
+	header.version = kArchiveVersion;
+	header.samplesNum = kSpectrumSamples;
+	header.minWavelength = kSpectrumMinWavelength;
+	header.maxWavelength = kSpectrumMaxWavelength;
+	header.sourcesNum = (uint32_t)sources.size();
+	header.sourcesOffset = AppendToArchive(archive, sources.data(), sources.size() * sizeof(ArchiveSource));
+
+	std::vector<ArchiveMaterial> materials(pairs.size());
+	header.materialsNum = (uint32_t)materials.size();
+	header.materialsOffset = AppendToArchive(archive, materials.data(), materials.size() * sizeof(ArchiveMaterial));
+
+	std::vector<Spectrum> spectra(2);
+	for (size_t i = 0; i < pairs.size(); i++)
+	{
+		const Pair& pair = pairs[i];
+		ArchiveMaterial& material = materials[i];
+		strcpy(material.name, pair.name.c_str());
+		material.etaEntries = AppendEntries(archive, pair.eta);
+		material.kEntries = AppendEntries(archive, pair.k);
+
+		spectra[0] = Spectrum(pair.eta);
+		spectra[1] = Spectrum(pair.k);
+		material.etaOffset = AppendToArchive(archive, &spectra[0], sizeof(Spectrum));
+		material.kOffset = AppendToArchive(archive, &spectra[1], sizeof(Spectrum));
+	}
+
+	memcpy(archive.data(), &header, sizeof(header));
+	memcpy(archive.data() + header.materialsOffset, materials.data(), materials.size() * sizeof(ArchiveMaterial));
+	return !materials.empty();
+}
+
+
+static bool WriteArchive(const std::vector<uint8_t>& archive)
+{
+	File file(kArchivePath, File::kOpenWrite);
+	if (!file.IsOpened())
+		return false;
+
+	return file.Write(archive.data(), (uint32_t)archive.size()) == (uint32_t)archive.size();
+}
+
+
+bool SpectralArchive::Open()
+{
+	Close();
+
+	std::vector<ArchiveSource> sources;
+	if (!GatherSources(sources) || sources.empty())
+		return false;
+
+	if (m_file.Open(kArchivePath) && Attach(m_file.GetData(), m_file.GetSize()))
+	{
+		const ArchiveHeader* header = (const ArchiveHeader*)m_data;
+		if (header->sourcesNum == sources.size() && memcmp(m_data + header->sourcesOffset, sources.data(), sources.size() * sizeof(ArchiveSource)) == 0)
+			return true;
+	}
+	Close();
+
+	std::vector<uint8_t> archive;
+	if (!BuildArchive(sources, archive))
+		return false;
+
+	if (WriteArchive(archive) && m_file.Open(kArchivePath) && Attach(m_file.GetData(), m_file.GetSize()))
+	{
+		LogStdOut("Packed %u IORs into '%s'\n", GetMaterialsNum(), kArchivePath);
+		return true;
+	}
+
+	// the data directory isn't writable, keep the archive in memory for this run
+	Close();
+	m_memory = std::move(archive);
+	return Attach(m_memory.data(), (uint32_t)m_memory.size());
+}
+
+
+void SpectralArchive::Close()
+{
+	m_file.Close();
+	m_memory.clear();
+	m_data = nullptr;
+	m_size = 0;
+}
+
+
+bool SpectralArchive::Build()
+{
+	std::vector<ArchiveSource> sources;
+	std::vector<uint8_t> archive;
+	if (!GatherSources(sources) || !BuildArchive(sources, archive))
+		return false;
+
+	// the archive can't be rewritten while it is mapped
+	bool reopen = s_spectralArchive.IsOpened();
+	s_spectralArchive.Close();
+	bool written = WriteArchive(archive);
+	if (reopen)
+		s_spectralArchive.Open();
+	return written;
+}
+
+
+bool SpectralArchive::Attach(const uint8_t* data, uint32_t size)
+{
+	if (size < sizeof(ArchiveHeader))
+		return false;
+
+	const ArchiveHeader* header = (const ArchiveHeader*)data;
+	if (header->magic != kArchiveMagic || header->version != kArchiveVersion || header->samplesNum != kSpectrumSamples ||
+	    header->minWavelength != kSpectrumMinWavelength || header->maxWavelength != kSpectrumMaxWavelength)
+		return false;
+
+	// a truncated or damaged file must not send lookups out of the mapping
+	auto inBounds = [size](uint64_t offset, uint64_t bytes) { return offset % sizeof(float) == 0 && offset + bytes <= size; };
+	if (!inBounds(header->sourcesOffset, (uint64_t)header->sourcesNum * sizeof(ArchiveSource)) ||
+	    !inBounds(header->materialsOffset, (uint64_t)header->materialsNum * sizeof(ArchiveMaterial)))
+		return false;
+
+	const ArchiveMaterial* materials = (const ArchiveMaterial*)(data + header->materialsOffset);
+	for (uint32_t i = 0; i < header->materialsNum; i++)
+	{
+		const ArchiveMaterial& material = materials[i];
+		if (memchr(material.name, 0, kNameLength) == nullptr)
+			return false;
+		for (const ArchiveEntries& entries : {material.etaEntries, material.kEntries})
+		{
+			if (!inBounds(entries.wavelengthsOffset, (uint64_t)entries.size * sizeof(float)) ||
+			    !inBounds(entries.valuesOffset, (uint64_t)entries.size * sizeof(float)) || entries.size == 0)
+				return false;
+		}
+		if (!inBounds(material.etaOffset, sizeof(Spectrum)) || !inBounds(material.kOffset, sizeof(Spectrum)))
+			return false;
+	}
+
+	m_data = data;
+	m_size = size;
+	return true;
+}
+
+
+uint32_t SpectralArchive::GetMaterialsNum() const
+{
+	return m_data ? ((const ArchiveHeader*)m_data)->materialsNum : 0;
+}
+
+
+uint64_t SpectralArchive::GetHash() const
+{
+	if (!m_data)
+		return 0;
+
+	// FNV-1a over the header and the source list, the rest is derived from them
+	const ArchiveHeader* header = (const ArchiveHeader*)m_data;
+	uint64_t hash = HashBytes(m_data, sizeof(ArchiveHeader));
+	return HashBytes(m_data + header->sourcesOffset, header->sourcesNum * sizeof(ArchiveSource), hash);
+}
+
+
+SpectralArchive::Material SpectralArchive::GetMaterial(uint32_t index) const
+{
+	Assert(index < GetMaterialsNum());
+	const ArchiveHeader* header = (const ArchiveHeader*)m_data;
+	const ArchiveMaterial& archived = ((const ArchiveMaterial*)(m_data + header->materialsOffset))[index];
+
+	auto entries = [this](const ArchiveEntries& archived) {
+		Entries entries;
+		entries.wavelengths = (const float*)(m_data + archived.wavelengthsOffset);
+		entries.values = (const float*)(m_data + archived.valuesOffset);
+		entries.size = archived.size;
+		return entries;
+	};
+
+	Material material;
+	material.name = archived.name;
+	material.eta = (const Spectrum*)(m_data + archived.etaOffset);
+	material.k = (const Spectrum*)(m_data + archived.kOffset);
+	material.etaEntries = entries(archived.etaEntries);
+	material.kEntries = entries(archived.kEntries);
+	return material;
+}
+
+
+bool SpectralArchive::Find(const char* name, Material& material) const
+{
+	if (!m_data)
+		return false;
+
+	const ArchiveHeader* header = (const ArchiveHeader*)m_data;
+	const ArchiveMaterial* begin = (const ArchiveMaterial*)(m_data + header->materialsOffset);
+	const ArchiveMaterial* end = begin + header->materialsNum;
+	const ArchiveMaterial* it =
+	    std::lower_bound(begin, end, name, [](const ArchiveMaterial& material, const char* name) { return strcmp(material.name, name) < 0; });
+	if (it == end || strcmp(it->name, name) != 0)
+		return false;
+
+	material = GetMaterial((uint32_t)(it - begin));
+	return true;
+}
+
+
+bool InitSpectralArchive()
+{
+	return s_spectralArchive.Open();
+}
+
+
+const SpectralArchive& GetSpectralArchive()
+{
+	return s_spectralArchive;
+}
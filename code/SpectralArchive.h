@@ -0,0 +1,95 @@
+#pragma once
+#include "SpectralPowerDistribution.h"
+
+
+/**
+ * \brief Conductor IOR data of data\SPDs packed into one memory mapped file.
+ *
+ * Every eta/k pair is stored both as the parsed .spd entries and resampled to
+ * the Spectrum grid, so picking a material is a binary search over the name
+ * index returning pointers into the mapping. The archive records the size and
+ * write time of every source file and is rebuilt when any of them changes.
+ */
+class SpectralArchive
+{
+public:
+	// Entries of a .spd file as stored in the archive
+	struct Entries
+	{
+		const float* wavelengths = nullptr;
+		const float* values = nullptr;
+		uint32_t size = 0;
+	};
+
+	struct Material
+	{
+		const char* name = nullptr;
+		const Spectrum* eta = nullptr;
+		const Spectrum* k = nullptr;
+		Entries etaEntries;
+		Entries kEntries;
+
+		// The 1 nm spectra are copied from the archive, coarser ones are resampled from the entries
+		template <typename S>
+		S Eta() const;
+		template <typename S>
+		S K() const;
+	};
+
+	/**
+	 * \brief Map the archive, building it first when it is missing, was
+	 * written by another version or any source .spd file has changed.
+	 * If the archive can't be written, the built data is kept in memory.
+	 */
+	bool Open();
+	void Close();
+
+	// Pack all eta/k pairs of data\SPDs into the archive file, whether it is up to date or not
+	static bool Build();
+
+	bool IsOpened() const;
+	uint32_t GetMaterialsNum() const;
+
+	// Identifies the packed data, caches derived from the archive are stale once it changes
+	uint64_t GetHash() const;
+	Material GetMaterial(uint32_t index) const;
+	bool Find(const char* name, Material& material) const;
+
+private:
+	MappedFile m_file;
+	std::vector<uint8_t> m_memory;
+	const uint8_t* m_data = nullptr;
+	uint32_t m_size = 0;
+
+	bool Attach(const uint8_t* data, uint32_t size);
+};
+
+
+template <typename S>
+inline S SpectralArchive::Material::Eta() const
+{
+	if constexpr (std::is_same_v<S, Spectrum>)
+		return *eta;
+	else
+		return S(etaEntries.wavelengths, etaEntries.values, etaEntries.size);
+}
+
+
+template <typename S>
+inline S SpectralArchive::Material::K() const
+{
+	if constexpr (std::is_same_v<S, Spectrum>)
+		return *k;
+	else
+		return S(kEntries.wavelengths, kEntries.values, kEntries.size);
+}
+
+
+inline bool SpectralArchive::IsOpened() const
+{
+	return m_data != nullptr;
+}
+
+
+bool InitSpectralArchive();
+const SpectralArchive& GetSpectralArchive();
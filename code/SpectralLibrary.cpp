@@ -0,0 +1,18 @@
+#include "Precompiled.h"
+#include "SpectralLibrary.h"
+
+
+static SpectralLibrary s_spectralLibrary;
+
+
+void SpectralLibrary::Clear()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	std::apply([](auto&... caches) { (caches.clear(), ...); }, m_caches);
+}
+
+
+SpectralLibrary& GetSpectralLibrary()
+{
+	return s_spectralLibrary;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include "SpectralArchive.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+
+// eta and k of a conductor, either as the .spd entries or as a Spectrum of any resolution
+template <typename S>
+struct SpectralIOR
+{
+	std::shared_ptr<const S> eta;
+	std::shared_ptr<const S> k;
+};
+
+
+/**
+ * \brief Process wide registry of conductor IORs.
+ *
+ * Every IOR is read from the spectral archive once per representation and
+ * handed out as shared handles to immutable data, so callers can keep them
+ * around and across threads, even after Clear(). All methods are thread safe.
+ */
+class SpectralLibrary
+{
+public:
+	template <typename S = Spectrum>
+	bool Get(const char* name, SpectralIOR<S>& ior);
+
+	// Drop the cached IORs, e.g. after the archive has been rebuilt. Handles already given out stay valid.
+	void Clear();
+
+	uint64_t GetHits() const;
+	uint64_t GetMisses() const;
+
+private:
+	template <typename S>
+	using Cache = std::unordered_map<std::string, SpectralIOR<S>>;
+
+	std::mutex m_mutex;
+	std::tuple<Cache<SpectralPowerDistribution>, Cache<Spectrum16>, Cache<Spectrum32>, Cache<Spectrum64>, Cache<Spectrum>> m_caches;
+	std::atomic<uint64_t> m_hits = 0;
+	std::atomic<uint64_t> m_misses = 0;
+};
+
+
+template <typename S>
+inline bool SpectralLibrary::Get(const char* name, SpectralIOR<S>& ior)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Cache<S>& cache = std::get<Cache<S>>(m_caches);
+	auto it = cache.find(name);
+	if (it != cache.end())
+	{
+		m_hits++;
+		ior = it->second;
+		return true;
+	}
+
+	m_misses++;
+	SpectralArchive::Material material;
+	if (!GetSpectralArchive().Find(name, material))
+		return false;
+
+	if constexpr (std::is_same_v<S, SpectralPowerDistribution>)
+	{
+		const SpectralArchive::Entries& eta = material.etaEntries;
+		const SpectralArchive::Entries& k = material.kEntries;
+		ior.eta = std::make_shared<const S>(eta.wavelengths, eta.values, eta.size);
+		ior.k = std::make_shared<const S>(k.wavelengths, k.values, k.size);
+	}
+	else
+	{
+		ior.eta = std::make_shared<const S>(material.Eta<S>());
+		ior.k = std::make_shared<const S>(material.K<S>());
+	}
+	cache.emplace(name, ior);
+	return true;
+}
+
+
+inline uint64_t SpectralLibrary::GetHits() const
+{
+	return m_hits;
+}
+
+
+inline uint64_t SpectralLibrary::GetMisses() const
+{
+	return m_misses;
+}
+
+
+SpectralLibrary& GetSpectralLibrary();
@@ -1,9 +1,8 @@
 #include "Precompiled.h"
 #include "CIE.h"
 #include "SpectralPowerDistribution.h"
-#include <iostream>
-#include <sstream>
-#include <fstream>
+#include "RGBToSpectrum.h"
+#include <charconv>
 
 /// ==========================================================================
 //   Smits-style RGB to Spectrum conversion data generated by Karl vom Berge
@@ -127,23 +126,64 @@ const float RGBIllum2SpecBlue_entries[RGB2Spec_samples] = {
     8.8773879881746481e-02,  1.3873621740236541e-01,  1.5535067531939065e-01,  1.4878477178237029e-01,  1.6624255403475907e-01,  1.6997613960634927e-01,
     1.5769743995852967e-01,  1.9069090525482305e-01};
 
-static Spectrum kCIE_X;
-static Spectrum kCIE_Y;
-static Spectrum kCIE_Z;
-static float kCIE_Normalization;
-static Spectrum kD65;
-static Spectrum kD65Normalized;
-static Spectrum kRGBSpectrums[kRGBSpectrumsNum];
+template <typename S>
+struct SpectrumTables
+{
+	S cieX;
+	S cieY;
+	S cieZ;
+	float cieNormalization = 0.0f;
+	S d65;
+	S d65Normalized;
+	S rgbSpectrums[kRGBSpectrumsNum];
+};
+
+#include "SpectrumTables.inl"
+
+template <typename S>
+static constexpr const SpectrumTables<S>& GetSpectrumTables()
+{
+	if constexpr (std::is_same_v<S, Spectrum16>)
+		return kSpectrumTables16;
+	else if constexpr (std::is_same_v<S, Spectrum32>)
+		return kSpectrumTables32;
+	else if constexpr (std::is_same_v<S, Spectrum64>)
+		return kSpectrumTables64;
+	else
+	{
+		static_assert(std::is_same_v<S, Spectrum>, "SpectrumTables.inl has no tables for this resolution");
+		return kSpectrumTables471;
+	}
+}
 
 
-static std::string TrimString(const std::string& str)
+static bool IsSpace(char c)
 {
-	std::string::size_type start = str.find_first_not_of(" \t\r\n"), end = str.find_last_not_of(" \t\r\n");
-	return str.substr(start == std::string::npos ? 0 : start, end == std::string::npos ? str.length() - 1 : end - start + 1);
+	return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
 }
 
 
-static float AverageSpectrumSamples(const float* lambda, const float* vals, uint32_t n, float lambdaStart, float lambdaEnd)
+// Parses a float like operator>> did: leading whitespace is skipped and an explicit '+' is allowed,
+// but inf/nan and hex are rejected. Returns the end of the number or nullptr if there is none.
+static const char* ParseFloat(const char* begin, const char* end, float& value)
+{
+	while (begin < end && IsSpace(*begin))
+		begin++;
+	if (begin < end && *begin == '+')
+		begin++;
+
+	const char* digits = begin < end && *begin == '-' ? begin + 1 : begin;
+	if (digits == end || !((*digits >= '0' && *digits <= '9') || *digits == '.'))
+		return nullptr;
+
+	std::from_chars_result result = std::from_chars(begin, end, value);
+	return result.ec == std::errc() ? result.ptr : nullptr;
+}
+
+
+// segment is the index of an input segment at or before the one containing lambdaStart. It is advanced
+// to the first segment of the range, so consecutive ranges can be averaged in a single sweep.
+static float AverageSpectrumSamples(const float* lambda, const float* vals, uint32_t n, float lambdaStart, float lambdaEnd, uint32_t& segment)
 {
 	// here is two implementations: one from pbrt, one from mitsuba 0.6.0, they are different and looks like pbrt version is more accurate
 	// when ambdaStart < lambda[0] and/or lambdaEnd > lambda[n - 1]
@@ -164,9 +204,9 @@ static float AverageSpectrumSamples(const float* lambda, const float* vals, uint
 		sum += vals[n - 1] * (lambdaEnd - lambda[n - 1]);
 
 	// Advance to first relevant wavelength segment
-	uint32_t i = 0;
-	while (lambdaStart > lambda[i + 1])
-		++i;
+	while (lambdaStart > lambda[segment + 1])
+		++segment;
+	uint32_t i = segment;
 
 	// Loop over wavelength sample segments and add contributions
 	auto interp = [lambda, vals](float w, int i) {
@@ -220,6 +260,13 @@ static float AverageSpectrumSamples(const float* lambda, const float* vals, uint
 }
 
 
+static float AverageSpectrumSamples(const float* lambda, const float* vals, uint32_t n, float lambdaStart, float lambdaEnd)
+{
+	uint32_t segment = 0;
+	return AverageSpectrumSamples(lambda, vals, n, lambdaStart, lambdaEnd, segment);
+}
+
+
 SpectralPowerDistribution::SpectralPowerDistribution(const float* wavelength, const float* values, uint32_t entriesNum)
 {
 	m_wavelengths.resize(entriesNum);
@@ -236,31 +283,65 @@ bool SpectralPowerDistribution::InitFromFile(const char* filename)
 {
 	m_wavelengths.clear();
 	m_values.clear();
+	m_slopes.clear();
 
 	FilePath fullPath = "data\\SPDs";
 	fullPath /= filename;
 
-	std::ifstream fileStream(fullPath.c_str());
-	if (fileStream.bad() || fileStream.fail())
+	File file(fullPath.c_str(), File::kOpenRead);
+	if (!file.IsOpened())
+		return false;
+
+	// The whole file is read at once into a buffer which is reused by the following loads
+	static thread_local std::vector<char> buffer;
+	buffer.resize(file.GetSize());
+	if (file.Read(buffer.data(), file.GetSize()) != file.GetSize())
 		return false;
 
-	std::string line;
-	while (true)
+	InitFromMemory(buffer.data(), buffer.size());
+	return true;
+}
+
+
+void SpectralPowerDistribution::InitFromMemory(const char* data, size_t size)
+{
+	m_wavelengths.clear();
+	m_values.clear();
+	m_slopes.clear();
+
+	const char* end = data + size;
+	size_t linesNum = std::count(data, end, '\n') + 1;
+	m_wavelengths.reserve(linesNum);
+	m_values.reserve(linesNum);
+
+	for (const char* lineStart = data; lineStart < end;)
 	{
-		if (!std::getline(fileStream, line))
-			break;
-		line = TrimString(line);
-		if (line.length() == 0 || line[0] == '#')
+		const char* lineEnd = std::find(lineStart, end, '\n');
+		const char* next = lineEnd < end ? lineEnd + 1 : end;
+		// CRLF is read as LF, like a text mode stream does
+		if (lineEnd > lineStart && lineEnd[-1] == '\r')
+			lineEnd--;
+
+		// Lines of whitespace only are blank too
+		const char* first = lineStart;
+		while (first < lineEnd && (*first == ' ' || *first == '\t' || *first == '\r'))
+			first++;
+		if (first == lineEnd || *first == '#')
+		{
+			lineStart = next;
 			continue;
-		std::istringstream iss(line);
+		}
+
+		// Same as before a malformed line ends the data
 		float lambda, value;
-		if (!(iss >> lambda >> value))
+		const char* p = ParseFloat(first, lineEnd, lambda);
+		if (!p || !ParseFloat(p, lineEnd, value))
 			break;
+
 		m_wavelengths.push_back(lambda);
 		m_values.push_back(value);
+		lineStart = next;
 	}
-
-	return true;
 }
 
 
@@ -269,145 +350,255 @@ float SpectralPowerDistribution::Eval(float lambda) const
 	if (m_values.size() < 2 || lambda < m_wavelengths[0] || lambda > m_wavelengths.back())
 		return 0.0f;
 
-	// Find the associated table entries using binary search
-	auto result = std::equal_range(m_wavelengths.begin(), m_wavelengths.end(), lambda);
-
-	size_t idx1 = result.first - m_values.begin();
-	size_t idx2 = result.second - m_values.begin();
-	if (idx1 == idx2)
+	// Find the first entry not below lambda using binary search
+	size_t idx = std::lower_bound(m_wavelengths.begin(), m_wavelengths.end(), lambda) - m_wavelengths.begin();
+	if (m_wavelengths[idx] == lambda)
 	{
-		float va = m_values[idx1 - 1];
-		float la = m_wavelengths[idx1 - 1];
-		float vb = m_values[idx1];
-		float lb = m_wavelengths[idx1];
-		return Lerp((lambda - la) / (lb - la), vb, va);
+		// Hit a value exactly
+		return m_values[idx];
 	}
-	else if (idx2 == idx1 + 1)
+
+	float va = m_values[idx - 1];
+	float la = m_wavelengths[idx - 1];
+	float vb = m_values[idx];
+	float lb = m_wavelengths[idx];
+	return Lerp((lambda - la) / (lb - la), va, vb);
+}
+
+
+void SpectralPowerDistribution::EvalSorted(const float* lambdas, size_t n, float* out) const
+{
+	Assert(std::is_sorted(lambdas, lambdas + n));
+
+	size_t size = m_values.size();
+	if (size < 2)
 	{
-		// Hit a value exactly
-		return m_values[idx1];
+		std::fill(out, out + n, 0.0f);
+		return;
 	}
-	else
+
+	const float* wavelengths = m_wavelengths.data();
+	const float* values = m_values.data();
+	const float* slopes = m_slopes.size() + 1 == size ? m_slopes.data() : nullptr;
+
+	// idx follows the queries, it is the first entry not below lambda as in Eval()
+	size_t idx = 0;
+	for (size_t i = 0; i < n; i++)
 	{
-		Assert(false);
-		return 0.0f;
+		float lambda = lambdas[i];
+		if (lambda < wavelengths[0] || lambda > wavelengths[size - 1])
+		{
+			out[i] = 0.0f;
+			continue;
+		}
+
+		while (wavelengths[idx] < lambda)
+			idx++;
+
+		if (wavelengths[idx] == lambda)
+			out[i] = values[idx];
+		else if (slopes)
+			out[i] = values[idx - 1] + (lambda - wavelengths[idx - 1]) * slopes[idx - 1];
+		else
+			out[i] = Lerp((lambda - wavelengths[idx - 1]) / (wavelengths[idx] - wavelengths[idx - 1]), values[idx - 1], values[idx]);
 	}
 }
 
 
+float SpectralPowerDistribution::GetSlope(size_t segment) const
+{
+	// repeated wavelengths are never interpolated over, see EvalSorted()
+	float width = m_wavelengths[segment + 1] - m_wavelengths[segment];
+	return width > 0.0f ? (m_values[segment + 1] - m_values[segment]) / width : 0.0f;
+}
+
+
+void SpectralPowerDistribution::PrecomputeSlopes()
+{
+	m_slopes.resize(m_values.size() > 1 ? m_values.size() - 1 : 0);
+	for (size_t i = 0; i < m_slopes.size(); i++)
+		m_slopes[i] = GetSlope(i);
+}
+
+
+void SpectralPowerDistribution::SetValue(uint32_t i, float value)
+{
+	m_values[i] = value;
+	if (m_slopes.empty())
+		return;
+
+	// only the segments ending and starting at the entry change
+	for (size_t segment = i > 0 ? i - 1 : 0; segment <= i && segment < m_slopes.size(); segment++)
+		m_slopes[segment] = GetSlope(segment);
+}
+
+
 float SpectralPowerDistribution::Average(float lambdaStart, float lambdaEnd) const
 {
 	return AverageSpectrumSamples(m_wavelengths.data(), m_values.data(), (uint32_t)m_wavelengths.size(), lambdaStart, lambdaEnd);
 }
 
 
-Spectrum::Spectrum(const float* wavelength, const float* values, uint32_t entriesNum)
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+SpectrumT<N, MinNm, MaxNm>::SpectrumT(const float* wavelength, const float* values, uint32_t entriesNum)
 {
-	for (uint32_t i = 0; i < kSpectrumSamples; i++)
+	Resample(wavelength, &values, entriesNum, 1, this);
+}
+
+
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+void SpectrumT<N, MinNm, MaxNm>::Resample(const float* wavelength, const float* const* values, uint32_t entriesNum, uint32_t count, SpectrumT* results)
+{
+	// Bins and input samples are both sorted by wavelength, so the input segment a bin starts in
+	// is carried over from the previous bin instead of being searched from the beginning
+	uint32_t segment = 0;
+	for (uint32_t i = 0; i < N; i++)
 	{
 		// Compute average value of given SPD over $i$th sample's range
-		float lambda0 = Lerp(float(i) / kSpectrumSamples, kSpectrumMinWavelength, kSpectrumMaxWavelength);
-		float lambda1 = Lerp(float(i + 1) / kSpectrumSamples, kSpectrumMinWavelength, kSpectrumMaxWavelength);
-		m_values[i] = AverageSpectrumSamples(wavelength, values, entriesNum, lambda0, lambda1);
+		float lambda0 = Lerp(float(i) / N, kMinWavelength, kMaxWavelength);
+		float lambda1 = Lerp(float(i + 1) / N, kMinWavelength, kMaxWavelength);
+		for (uint32_t s = 0; s < count; s++)
+			results[s].m_values[i] = AverageSpectrumSamples(wavelength, values[s], entriesNum, lambda0, lambda1, segment);
 	}
 }
 
 
-Spectrum::Spectrum(const SpectralPowerDistribution& spd) : Spectrum(spd.Wavelength(), spd.Values(), (uint32_t)spd.Size())
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+SpectrumT<N, MinNm, MaxNm>::SpectrumT(const SpectralPowerDistribution& spd) : SpectrumT(spd.Wavelength(), spd.Values(), (uint32_t)spd.Size())
 {
 }
 
 
-Spectrum::Spectrum(float v) : Spectrum()
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+SpectrumT<N, MinNm, MaxNm>::SpectrumT(float v) : SpectrumT()
 {
-	for (uint32_t i = 0; i < kSpectrumSamples; i++)
+	for (uint32_t i = 0; i < N; i++)
 		m_values[i] = v;
 }
 
 
-float Spectrum::Eval(float lambda) const
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+float SpectrumT<N, MinNm, MaxNm>::Eval(float lambda) const
 {
-	uint32_t idx = (uint32_t)((lambda - kSpectrumMinWavelength) / kSpectrumRange * (kSpectrumSamples - 1));
+	uint32_t idx = (uint32_t)((lambda - kMinWavelength) / (kMaxWavelength - kMinWavelength) * (N - 1));
 	return m_values[idx];
 }
 
 
-void Spectrum::ToXYZ(float& x, float& y, float& z) const
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+void SpectrumT<N, MinNm, MaxNm>::ToXYZ(float& x, float& y, float& z) const
 {
-	x = y = z = 0.0f;
-	for (uint32_t i = 0; i < kSpectrumSamples; ++i)
-	{
-		x += kCIE_X[i] * m_values[i];
-		y += kCIE_Y[i] * m_values[i];
-		z += kCIE_Z[i] * m_values[i];
-	}
+	const SpectrumTables<SpectrumT>& tables = GetSpectrumTables<SpectrumT>();
+
+	// X, Y and Z are accumulated in one pass over the spectrum. The vector paths
+	// sum in a different order than the scalar one, so the results differ by rounding
+	DispatchSimd([&](auto packet) {
+		using P = decltype(packet);
+		P accX = SimdTraits<P>::Set(0.0f);
+		P accY = SimdTraits<P>::Set(0.0f);
+		P accZ = SimdTraits<P>::Set(0.0f);
+		uint32_t i = 0;
+		for (; i + SimdTraits<P>::kWidth <= N; i += SimdTraits<P>::kWidth)
+		{
+			P v = this->template Packet<P>(i);
+			accX = MulAdd(tables.cieX.template Packet<P>(i), v, accX);
+			accY = MulAdd(tables.cieY.template Packet<P>(i), v, accY);
+			accZ = MulAdd(tables.cieZ.template Packet<P>(i), v, accZ);
+		}
+		x = ReduceAdd(accX);
+		y = ReduceAdd(accY);
+		z = ReduceAdd(accZ);
+		for (; i < N; ++i)
+		{
+			x += tables.cieX[i] * m_values[i];
+			y += tables.cieY[i] * m_values[i];
+			z += tables.cieZ[i] * m_values[i];
+		}
+	});
 
-	x *= kCIE_Normalization;
-	y *= kCIE_Normalization;
-	z *= kCIE_Normalization;
+	x *= tables.cieNormalization;
+	y *= tables.cieNormalization;
+	z *= tables.cieNormalization;
 }
 
 
-void Spectrum::ToLinearRGB(float& r, float& g, float& b) const
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+void SpectrumT<N, MinNm, MaxNm>::ToLinearRGB(float& r, float& g, float& b) const
 {
 	float x, y, z;
 	ToXYZ(x, y, z);
-	/* Convert from XYZ tristimulus values to ITU-R Rec. BT.709 linear RGB */
-	r = 3.240479f * x + -1.537150f * y + -0.498535f * z;
-	g = -0.969256f * x + 1.875991f * y + 0.041556f * z;
-	b = 0.055648f * x + -0.204043f * y + 1.057311f * z;
+	XYZToLinearRGB(x, y, z, r, g, b);
 }
 
 
-void Spectrum::FromLinearRGB(float r, float g, float b, ESpectrumType type)
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+void SpectrumT<N, MinNm, MaxNm>::FromLinearRGB(float r, float g, float b, ESpectrumType type, EUplifting uplifting)
 {
+	const RGBToSpectrumTable& table = GetRGBToSpectrumTable();
+	if (uplifting == kSigmoidUplifting && table.IsOpened())
+	{
+		if (type == kReflectance)
+		{
+			*this = table.Lookup(r, g, b).ToSpectrum<SpectrumT>();
+			return;
+		}
+
+		// An illuminant is a scaled reflectance lit by D65, halving the largest
+		// component keeps the reflectance in the smooth middle of the table
+		float scale = 2.0f * std::max({r, g, b, 0.0f});
+		float invScale = scale > 0.0f ? 1.0f / scale : 0.0f;
+		*this = table.Lookup(r * invScale, g * invScale, b * invScale).ToSpectrum<SpectrumT>() * GetD65Normalized<SpectrumT>() * scale;
+		return;
+	}
+
 	memset(m_values, 0, sizeof(m_values));
-	Spectrum& result = *this;
+	const SpectrumT* rgbSpectrums = GetSpectrumTables<SpectrumT>().rgbSpectrums;
+	SpectrumT& result = *this;
 	if (type == kReflectance)
 	{
 		if (r <= g && r <= b)
 		{
 			// Compute reflectance spectrum with 'r' as minimum
-			result += kRGBSpectrums[kRGBRefl2SpecWhite] * r;
+			result += rgbSpectrums[kRGBRefl2SpecWhite] * r;
 			if (g <= b)
 			{
-				result += kRGBSpectrums[kRGBRefl2SpecCyan] * (g - r);
-				result += kRGBSpectrums[kRGBRefl2SpecBlue] * (b - g);
+				result += rgbSpectrums[kRGBRefl2SpecCyan] * (g - r);
+				result += rgbSpectrums[kRGBRefl2SpecBlue] * (b - g);
 			}
 			else
 			{
-				result += kRGBSpectrums[kRGBRefl2SpecCyan] * (b - r);
-				result += kRGBSpectrums[kRGBRefl2SpecGreen] * (g - b);
+				result += rgbSpectrums[kRGBRefl2SpecCyan] * (b - r);
+				result += rgbSpectrums[kRGBRefl2SpecGreen] * (g - b);
 			}
 		}
 		else if (g <= r && g <= b)
 		{
 			// Compute reflectance spectrum with 'g' as minimum
-			result += kRGBSpectrums[kRGBRefl2SpecWhite] * g;
+			result += rgbSpectrums[kRGBRefl2SpecWhite] * g;
 			if (r <= b)
 			{
-				result += (r - g) * kRGBSpectrums[kRGBRefl2SpecMagenta];
-				result += (b - r) * kRGBSpectrums[kRGBRefl2SpecBlue];
+				result += (r - g) * rgbSpectrums[kRGBRefl2SpecMagenta];
+				result += (b - r) * rgbSpectrums[kRGBRefl2SpecBlue];
 			}
 			else
 			{
-				result += (b - g) * kRGBSpectrums[kRGBRefl2SpecMagenta];
-				result += (r - b) * kRGBSpectrums[kRGBRefl2SpecRed];
+				result += (b - g) * rgbSpectrums[kRGBRefl2SpecMagenta];
+				result += (r - b) * rgbSpectrums[kRGBRefl2SpecRed];
 			}
 		}
 		else
 		{
 			// Compute reflectance spectrum with 'b' as minimum
-			result += b * kRGBSpectrums[kRGBRefl2SpecWhite];
+			result += b * rgbSpectrums[kRGBRefl2SpecWhite];
 			if (r <= g)
 			{
-				result += (r - b) * kRGBSpectrums[kRGBRefl2SpecYellow];
-				result += (g - r) * kRGBSpectrums[kRGBRefl2SpecGreen];
+				result += (r - b) * rgbSpectrums[kRGBRefl2SpecYellow];
+				result += (g - r) * rgbSpectrums[kRGBRefl2SpecGreen];
 			}
 			else
 			{
-				result += (g - b) * kRGBSpectrums[kRGBRefl2SpecYellow];
-				result += (r - g) * kRGBSpectrums[kRGBRefl2SpecRed];
+				result += (g - b) * rgbSpectrums[kRGBRefl2SpecYellow];
+				result += (r - g) * rgbSpectrums[kRGBRefl2SpecRed];
 			}
 		}
 		result *= .94f;
@@ -418,46 +609,46 @@ void Spectrum::FromLinearRGB(float r, float g, float b, ESpectrumType type)
 		if (r <= g && r <= b)
 		{
 			// Compute illuminant spectrum with 'r' as minimum
-			result += r * kRGBSpectrums[kRGBIllum2SpecWhite];
+			result += r * rgbSpectrums[kRGBIllum2SpecWhite];
 			if (g <= b)
 			{
-				result += (g - r) * kRGBSpectrums[kRGBIllum2SpecCyan];
-				result += (b - g) * kRGBSpectrums[kRGBIllum2SpecBlue];
+				result += (g - r) * rgbSpectrums[kRGBIllum2SpecCyan];
+				result += (b - g) * rgbSpectrums[kRGBIllum2SpecBlue];
 			}
 			else
 			{
-				result += (b - r) * kRGBSpectrums[kRGBIllum2SpecCyan];
-				result += (g - b) * kRGBSpectrums[kRGBIllum2SpecGreen];
+				result += (b - r) * rgbSpectrums[kRGBIllum2SpecCyan];
+				result += (g - b) * rgbSpectrums[kRGBIllum2SpecGreen];
 			}
 		}
 		else if (g <= r && g <= b)
 		{
 			// Compute illuminant spectrum with 'g' as minimum
-			result += g * kRGBSpectrums[kRGBIllum2SpecWhite];
+			result += g * rgbSpectrums[kRGBIllum2SpecWhite];
 			if (r <= b)
 			{
-				result += (r - g) * kRGBSpectrums[kRGBIllum2SpecMagenta];
-				result += (b - r) * kRGBSpectrums[kRGBIllum2SpecBlue];
+				result += (r - g) * rgbSpectrums[kRGBIllum2SpecMagenta];
+				result += (b - r) * rgbSpectrums[kRGBIllum2SpecBlue];
 			}
 			else
 			{
-				result += (b - g) * kRGBSpectrums[kRGBIllum2SpecMagenta];
-				result += (r - b) * kRGBSpectrums[kRGBIllum2SpecRed];
+				result += (b - g) * rgbSpectrums[kRGBIllum2SpecMagenta];
+				result += (r - b) * rgbSpectrums[kRGBIllum2SpecRed];
 			}
 		}
 		else
 		{
 			// Compute illuminant spectrum with 'b' as minimum
-			result += b * kRGBSpectrums[kRGBIllum2SpecWhite];
+			result += b * rgbSpectrums[kRGBIllum2SpecWhite];
 			if (r <= g)
 			{
-				result += (r - b) * kRGBSpectrums[kRGBIllum2SpecYellow];
-				result += (g - r) * kRGBSpectrums[kRGBIllum2SpecGreen];
+				result += (r - b) * rgbSpectrums[kRGBIllum2SpecYellow];
+				result += (g - r) * rgbSpectrums[kRGBIllum2SpecGreen];
 			}
 			else
 			{
-				result += (g - b) * kRGBSpectrums[kRGBIllum2SpecYellow];
-				result += (r - g) * kRGBSpectrums[kRGBIllum2SpecRed];
+				result += (g - b) * rgbSpectrums[kRGBIllum2SpecYellow];
+				result += (r - g) * rgbSpectrums[kRGBIllum2SpecRed];
 			}
 		}
 		result *= .86445f;
@@ -468,73 +659,188 @@ void Spectrum::FromLinearRGB(float r, float g, float b, ESpectrumType type)
 }
 
 
-void InitSpectrum()
+template <typename S>
+static void ComputeSpectrumTables(SpectrumTables<S>& tables)
 {
-	kCIE_X = Spectrum(CIE_wavelengths, CIE_X_entries, kCIESamplesNum);
-	kCIE_Y = Spectrum(CIE_wavelengths, CIE_Y_entries, kCIESamplesNum);
-	kCIE_Z = Spectrum(CIE_wavelengths, CIE_Z_entries, kCIESamplesNum);
+	// The CIE tables and the RGB tables share a wavelength grid each, resample them in batches
+	const float* cieEntries[] = {CIE_X_entries, CIE_Y_entries, CIE_Z_entries, CIE_D65_entries};
+	S cie[_countof(cieEntries)];
+	S::Resample(CIE_wavelengths, cieEntries, kCIESamplesNum, _countof(cieEntries), cie);
+	tables.cieX = cie[0];
+	tables.cieY = cie[1];
+	tables.cieZ = cie[2];
+	tables.d65 = cie[3];
+
+	// Y of D65 is summed in scalar order, so the tables don't depend on the SIMD level of the generating machine
+	float cieYSum = 0.0f;
+	float d65Y = 0.0f;
+	for (uint32_t i = 0; i < S::kSamples; ++i)
+	{
+		cieYSum += tables.cieY[i];
+		d65Y += tables.cieY[i] * tables.d65[i];
+	}
+	tables.cieNormalization = 1.0f / cieYSum;
+	tables.d65Normalized = tables.d65;
+	tables.d65Normalized *= 1.0f / (d65Y * tables.cieNormalization);
+
+	/* Pre-integrate the Smits-style RGB to Spectrum conversion data, in ERGBSpectrums order */
+	const float* rgbEntries[kRGBSpectrumsNum] = {
+	    RGBRefl2SpecWhite_entries, RGBRefl2SpecCyan_entries, RGBRefl2SpecMagenta_entries, RGBRefl2SpecYellow_entries, RGBRefl2SpecRed_entries,
+	    RGBRefl2SpecGreen_entries, RGBRefl2SpecBlue_entries, RGBIllum2SpecWhite_entries, RGBIllum2SpecCyan_entries, RGBIllum2SpecMagenta_entries,
+	    RGBIllum2SpecYellow_entries, RGBIllum2SpecRed_entries, RGBIllum2SpecGreen_entries, RGBIllum2SpecBlue_entries};
+	S::Resample(RGB2Spec_wavelengths, rgbEntries, RGB2Spec_samples, kRGBSpectrumsNum, tables.rgbSpectrums);
+}
 
-	kCIE_Normalization = 0.0f;
-	for (uint32_t i = 0; i < kCIE_Y.Size(); ++i)
-		kCIE_Normalization += kCIE_Y[i];
-	kCIE_Normalization = 1.0f / kCIE_Normalization;
 
-	kD65 = Spectrum(CIE_wavelengths, CIE_D65_entries, kCIESamplesNum);
-	kD65Normalized = kD65;
-	float x, y, z;
-	kD65Normalized.ToXYZ(x, y, z);
-	kD65Normalized *= 1.0f / y;
+template <typename S>
+static void AppendSpectrumTable(std::string& text, const S& spectrum)
+{
+	char buf[64];
+	sprintf(buf, "    SpectrumT<%u>({", S::kSamples);
+	text.append(buf);
+	for (uint32_t i = 0; i < S::kSamples; i++)
+	{
+		// hex floats round trip exactly
+		sprintf(buf, "%s%af", i == 0 ? "" : i % 6 == 0 ? ",\n       " : ", ", spectrum[i]);
+		text.append(buf);
+	}
+	text.append("}),\n");
+}
 
-	/* Pre-integrate the Smits-style RGB to Spectrum conversion data */
-	kRGBSpectrums[kRGBRefl2SpecWhite] = Spectrum(RGB2Spec_wavelengths, RGBRefl2SpecWhite_entries, RGB2Spec_samples);
-	kRGBSpectrums[kRGBRefl2SpecCyan] = Spectrum(RGB2Spec_wavelengths, RGBRefl2SpecCyan_entries, RGB2Spec_samples);
-	kRGBSpectrums[kRGBRefl2SpecMagenta] = Spectrum(RGB2Spec_wavelengths, RGBRefl2SpecMagenta_entries, RGB2Spec_samples);
-	kRGBSpectrums[kRGBRefl2SpecYellow] = Spectrum(RGB2Spec_wavelengths, RGBRefl2SpecYellow_entries, RGB2Spec_samples);
-	kRGBSpectrums[kRGBRefl2SpecRed] = Spectrum(RGB2Spec_wavelengths, RGBRefl2SpecRed_entries, RGB2Spec_samples);
-	kRGBSpectrums[kRGBRefl2SpecGreen] = Spectrum(RGB2Spec_wavelengths, RGBRefl2SpecGreen_entries, RGB2Spec_samples);
-	kRGBSpectrums[kRGBRefl2SpecBlue] = Spectrum(RGB2Spec_wavelengths, RGBRefl2SpecBlue_entries, RGB2Spec_samples);
 
-	kRGBSpectrums[kRGBIllum2SpecWhite] = Spectrum(RGB2Spec_wavelengths, RGBIllum2SpecWhite_entries, RGB2Spec_samples);
-	kRGBSpectrums[kRGBIllum2SpecCyan] = Spectrum(RGB2Spec_wavelengths, RGBIllum2SpecCyan_entries, RGB2Spec_samples);
-	kRGBSpectrums[kRGBIllum2SpecMagenta] = Spectrum(RGB2Spec_wavelengths, RGBIllum2SpecMagenta_entries, RGB2Spec_samples);
-	kRGBSpectrums[kRGBIllum2SpecYellow] = Spectrum(RGB2Spec_wavelengths, RGBIllum2SpecYellow_entries, RGB2Spec_samples);
-	kRGBSpectrums[kRGBIllum2SpecRed] = Spectrum(RGB2Spec_wavelengths, RGBIllum2SpecRed_entries, RGB2Spec_samples);
-	kRGBSpectrums[kRGBIllum2SpecGreen] = Spectrum(RGB2Spec_wavelengths, RGBIllum2SpecGreen_entries, RGB2Spec_samples);
-	kRGBSpectrums[kRGBIllum2SpecBlue] = Spectrum(RGB2Spec_wavelengths, RGBIllum2SpecBlue_entries, RGB2Spec_samples);
+template <typename S>
+static void AppendSpectrumTables(std::string& text, const char* name)
+{
+	SpectrumTables<S> tables;
+	ComputeSpectrumTables(tables);
+
+	char buf[256];
+	sprintf(buf, "static constexpr SpectrumTables<SpectrumT<%u>> %s = {\n", S::kSamples, name);
+	text.append(buf);
+	AppendSpectrumTable(text, tables.cieX);
+	AppendSpectrumTable(text, tables.cieY);
+	AppendSpectrumTable(text, tables.cieZ);
+	sprintf(buf, "    %af,\n", tables.cieNormalization);
+	text.append(buf);
+	AppendSpectrumTable(text, tables.d65);
+	AppendSpectrumTable(text, tables.d65Normalized);
+	text.append("    {\n");
+	for (const S& rgbSpectrum : tables.rgbSpectrums)
+		AppendSpectrumTable(text, rgbSpectrum);
+	text.append("    }};\n\n");
 }
 
 
-const Spectrum& GetCIE_X()
+bool GenerateSpectrumTables(const char* filename)
 {
-	return kCIE_X;
+	std::string text = "// Generated by GenerateSpectrumTables() from CIE.h and the Smits RGB data, do not edit.\n"
+	                   "// Regenerate with \"brdf_playground.exe spectables ..\\code\\SpectrumTables.inl\".\n\n";
+	AppendSpectrumTables<Spectrum16>(text, "kSpectrumTables16");
+	AppendSpectrumTables<Spectrum32>(text, "kSpectrumTables32");
+	AppendSpectrumTables<Spectrum64>(text, "kSpectrumTables64");
+	AppendSpectrumTables<Spectrum>(text, "kSpectrumTables471");
+
+	File file(filename, File::kOpenWrite);
+	return file.IsOpened() && file.Write(text.data(), (uint32_t)text.size()) == (uint32_t)text.size();
 }
 
 
-const Spectrum& GetCIE_Y()
+template <typename S>
+static uint32_t CountTableMismatches()
 {
-	return kCIE_Y;
+	SpectrumTables<S> tables;
+	ComputeSpectrumTables(tables);
+	const SpectrumTables<S>& generated = GetSpectrumTables<S>();
+
+	uint32_t mismatches = 0;
+	auto compare = [&mismatches](const S& a, const S& b) {
+		for (uint32_t i = 0; i < S::kSamples; i++)
+		{
+			float va = a[i], vb = b[i];
+			mismatches += memcmp(&va, &vb, sizeof(float)) != 0 ? 1 : 0;
+		}
+	};
+	compare(tables.cieX, generated.cieX);
+	compare(tables.cieY, generated.cieY);
+	compare(tables.cieZ, generated.cieZ);
+	compare(tables.d65, generated.d65);
+	compare(tables.d65Normalized, generated.d65Normalized);
+	for (uint32_t s = 0; s < kRGBSpectrumsNum; s++)
+		compare(tables.rgbSpectrums[s], generated.rgbSpectrums[s]);
+	mismatches += memcmp(&tables.cieNormalization, &generated.cieNormalization, sizeof(float)) != 0 ? 1 : 0;
+	return mismatches;
 }
 
 
-const Spectrum& GetCIE_Z()
+uint32_t VerifySpectrumTables()
 {
-	return kCIE_Z;
+	return CountTableMismatches<Spectrum16>() + CountTableMismatches<Spectrum32>() + CountTableMismatches<Spectrum64>() +
+	       CountTableMismatches<Spectrum>();
 }
 
 
-const Spectrum& GetD65()
+template <typename S>
+const S& GetCIE_X()
 {
-	return kD65;
+	return GetSpectrumTables<S>().cieX;
 }
 
 
-const Spectrum& GetD65Normalized()
+template <typename S>
+const S& GetCIE_Y()
 {
-	return kD65Normalized;
+	return GetSpectrumTables<S>().cieY;
 }
 
 
-const Spectrum& GetRGBSpectrum(ERGBSpectrums spectrum)
+template <typename S>
+const S& GetCIE_Z()
 {
-	return kRGBSpectrums[spectrum];
+	return GetSpectrumTables<S>().cieZ;
 }
+
+
+template <typename S>
+float GetCIENormalization()
+{
+	return GetSpectrumTables<S>().cieNormalization;
+}
+
+
+template <typename S>
+const S& GetD65()
+{
+	return GetSpectrumTables<S>().d65;
+}
+
+
+template <typename S>
+const S& GetD65Normalized()
+{
+	return GetSpectrumTables<S>().d65Normalized;
+}
+
+
+template <typename S>
+const S& GetRGBSpectrum(ERGBSpectrums spectrum)
+{
+	return GetSpectrumTables<S>().rgbSpectrums[spectrum];
+}
+
+
+#define INSTANTIATE_SPECTRUM(S)                \
+	template class SpectrumT<S::kSamples>;     \
+	template const S& GetCIE_X<S>();           \
+	template const S& GetCIE_Y<S>();           \
+	template const S& GetCIE_Z<S>();           \
+	template float GetCIENormalization<S>();   \
+	template const S& GetD65<S>();             \
+	template const S& GetD65Normalized<S>();   \
+	template const S& GetRGBSpectrum<S>(ERGBSpectrums spectrum);
+
+INSTANTIATE_SPECTRUM(Spectrum16)
+INSTANTIATE_SPECTRUM(Spectrum32)
+INSTANTIATE_SPECTRUM(Spectrum64)
+INSTANTIATE_SPECTRUM(Spectrum)
+
+#undef INSTANTIATE_SPECTRUM
@@ -1,10 +1,13 @@
 #pragma once
 #include <vector>
+#include "Simd.h"
 
-static const float kSpectrumMinWavelength = 360.0f;
-static const float kSpectrumMaxWavelength = 830.0f;
+static const uint32_t kSpectrumMinWavelengthNm = 360;
+static const uint32_t kSpectrumMaxWavelengthNm = 830;
+static const float kSpectrumMinWavelength = (float)kSpectrumMinWavelengthNm;
+static const float kSpectrumMaxWavelength = (float)kSpectrumMaxWavelengthNm;
 static const float kSpectrumRange = kSpectrumMaxWavelength - kSpectrumMinWavelength;
-static const uint32_t kSpectrumSamples = (uint32_t)kSpectrumRange + 1;
+static const uint32_t kSpectrumSamples = kSpectrumMaxWavelengthNm - kSpectrumMinWavelengthNm + 1;
 
 
 class SpectralPowerDistribution
@@ -15,6 +18,13 @@ public:
 
 	bool InitFromFile(const char* filename);
 
+	/**
+	 * \brief Parse the text of a .spd file: one "wavelength value" pair per line,
+	 * blank or whitespace only lines and lines starting with '#' are skipped,
+	 * the first malformed line ends the data.
+	 */
+	void InitFromMemory(const char* data, size_t size);
+
 	const float* Wavelength() const
 	{
 		return m_wavelengths.data();
@@ -30,22 +40,33 @@ public:
 		return m_values.size();
 	}
 
-	float& operator[](uint32_t i)
-	{
-		return m_values[i];
-	}
-
 	const float& operator[](uint32_t i) const
 	{
 		return m_values[i];
 	}
 
+	// Updates the slopes of PrecomputeSlopes() next to the entry, reads through operator[] leave them alone
+	void SetValue(uint32_t i, float value);
+
 	/**
 	 * \brief Return the value of the spectral power distribution
 	 * at the given wavelength.
 	 */
 	float Eval(float lambda) const;
 
+	/**
+	 * \brief Eval() for n wavelengths sorted in ascending order.
+	 *
+	 * The queries are merged with the entries in a single pass instead of a
+	 * binary search each, the results are identical to calling Eval() per
+	 * wavelength. After PrecomputeSlopes() the interpolation multiplies by
+	 * the slope of the segment instead of dividing, which differs by rounding.
+	 */
+	void EvalSorted(const float* lambdas, size_t n, float* out) const;
+
+	// Slopes of every segment for EvalSorted(), dropped when the entries are reloaded
+	void PrecomputeSlopes();
+
 	/**
 	 * \brief Integrate the spectral power distribution
 	 * over a given interval and return the average value
@@ -66,36 +87,119 @@ public:
 	float Average(float lambdaMin, float lambdaMax) const;
 
 private:
+	float GetSlope(size_t segment) const;
+
 	std::vector<float> m_wavelengths;
 	std::vector<float> m_values;
+	std::vector<float> m_slopes;
 };
 
 
-class Spectrum
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+class SpectrumT;
+
+template <typename Op, typename E>
+class SpectrumUnaryExpr;
+
+struct SpectrumOpSafeSqrt;
+
+
+/**
+ * \brief Base of all lazily evaluated spectrum expressions.
+ *
+ * Arithmetic on spectra does not produce a new Spectrum per operator. Instead
+ * every operator returns a lightweight expression node and the whole
+ * expression is evaluated in a single loop when it gets assigned to a Spectrum.
+ * Leaf spectra are captured by reference, so an expression must not outlive
+ * the spectra it was built from.
+ *
+ * Besides operator[] every node provides Packet<P>(i) returning the lanes
+ * [i, i + SimdTraits<P>::kWidth), which is what the assignment loop uses
+ * at the active SIMD level. Both paths perform the same IEEE operations, so
+ * the results are identical whichever one runs.
+ *
+ * Every node also exposes kSamples, the bin count of the spectra it reads
+ * (0 for scalars), so mixing resolutions in one expression fails to compile.
+ */
+template <typename E>
+class SpectrumExpr
 {
 public:
-	Spectrum() = default;
-	Spectrum(const float* wavelength, const float* values, uint32_t entriesNum);
-	Spectrum(const SpectralPowerDistribution& spd);
-	Spectrum(float v);
+	const E& Derived() const
+	{
+		return static_cast<const E&>(*this);
+	}
+
+	float operator[](uint32_t i) const
+	{
+		return Derived()[i];
+	}
+
+	template <typename P>
+	P Packet(uint32_t i) const
+	{
+		return Derived().template Packet<P>(i);
+	}
+
+	SpectrumUnaryExpr<SpectrumOpSafeSqrt, E> safe_sqrt() const;
+};
+
+
+/**
+ * \brief Spectrum sampled into N equally sized bins over [MinNm, MaxNm].
+ *
+ * Each bin holds the average of the source distribution over its interval.
+ * CIE and RGB conversion tables are generated into SpectrumTables.inl for
+ * every instantiated resolution, see the aliases below.
+ */
+template <uint32_t N, uint32_t MinNm = kSpectrumMinWavelengthNm, uint32_t MaxNm = kSpectrumMaxWavelengthNm>
+class SpectrumT : public SpectrumExpr<SpectrumT<N, MinNm, MaxNm>>
+{
+public:
+	static const uint32_t kSamples = N;
+	static constexpr float kMinWavelength = (float)MinNm;
+	static constexpr float kMaxWavelength = (float)MaxNm;
+
+	SpectrumT() = default;
+	// Takes already binned values, usable in constant expressions
+	explicit constexpr SpectrumT(const float (&values)[N]);
+	SpectrumT(const float* wavelength, const float* values, uint32_t entriesNum);
+	SpectrumT(const SpectralPowerDistribution& spd);
+	SpectrumT(float v);
+	template <typename E>
+	SpectrumT(const SpectrumExpr<E>& expr);
+
+	/**
+	 * \brief Resample several distributions sharing one wavelength grid
+	 *
+	 * Bins and input samples are walked together once, so the cost is linear
+	 * in the bin and entry counts, and the per-bin search is shared by the
+	 * whole batch. The results are identical to constructing each spectrum
+	 * separately.
+	 *
+	 * \param values
+	 *     \c count pointers to arrays of \c entriesNum values
+	 */
+	static void Resample(const float* wavelength, const float* const* values, uint32_t entriesNum, uint32_t count, SpectrumT* results);
 
 	uint32_t Size() const;
 
 	float operator[](uint32_t i) const;
 	float& operator[](uint32_t i);
 
-	Spectrum operator+(float x) const;
-	Spectrum operator-(float x) const;
-	Spectrum operator*(float x) const;
-	Spectrum operator/(float x) const;
-	Spectrum& operator*=(float x);
-	Spectrum operator+(const Spectrum& x) const;
-	Spectrum& operator+=(const Spectrum& x);
-	Spectrum operator-(const Spectrum& x) const;
-	Spectrum operator*(const Spectrum& x) const;
-	Spectrum& operator*=(const Spectrum& x);
-	Spectrum operator/(const Spectrum& x) const;
-	Spectrum safe_sqrt() const;
+	template <typename P>
+	P Packet(uint32_t i) const
+	{
+		return SimdTraits<P>::Load(m_values + i);
+	}
+
+	template <typename E>
+	SpectrumT& operator=(const SpectrumExpr<E>& expr);
+	template <typename E>
+	SpectrumT& operator+=(const SpectrumExpr<E>& expr);
+	template <typename E>
+	SpectrumT& operator*=(const SpectrumExpr<E>& expr);
+	SpectrumT& operator*=(float x);
 
 	float Eval(float lambda) const;
 
@@ -108,13 +212,68 @@ public:
 		kIlluminant
 	};
 
-	void FromLinearRGB(float r, float g, float b, ESpectrumType type = kReflectance);
+	enum EUplifting
+	{
+		// smooth sigmoid spectra looked up from the RGBToSpectrumTable, Smits when there is no table
+		kSigmoidUplifting = 0,
+		// sums of the pre-integrated Smits basis spectra
+		kSmitsUplifting
+	};
+
+	void FromLinearRGB(float r, float g, float b, ESpectrumType type = kReflectance, EUplifting uplifting = kSigmoidUplifting);
 
 private:
-	float m_values[kSpectrumSamples] = {};
+	float m_values[N] = {};
 };
 
 
+// 1 nm bins, the reference resolution
+using Spectrum = SpectrumT<kSpectrumSamples>;
+// Coarse resolutions for conversions where speed matters more than accuracy
+using Spectrum16 = SpectrumT<16>;
+using Spectrum32 = SpectrumT<32>;
+using Spectrum64 = SpectrumT<64>;
+
+
+enum ESpectralResolution
+{
+	kSpectralResolution16 = 0,
+	kSpectralResolution32,
+	kSpectralResolution64,
+	kSpectralResolution1nm,
+	kSpectralResolutionsNum
+};
+
+
+static const char* const kSpectralResolutionNames[kSpectralResolutionsNum] = {"16 bins", "32 bins", "64 bins", "1 nm"};
+
+
+/**
+ * \brief Call a generic lambda with a null pointer to the spectrum type of the given resolution, e.g.
+ *
+ *     DispatchSpectralResolution(resolution, [&](auto tag) { using S = std::remove_pointer_t<decltype(tag)>; ... });
+ */
+template <typename LAMBDA>
+inline void DispatchSpectralResolution(ESpectralResolution resolution, const LAMBDA& lambda)
+{
+	switch (resolution)
+	{
+		case kSpectralResolution16:
+			lambda((Spectrum16*)nullptr);
+			return;
+		case kSpectralResolution32:
+			lambda((Spectrum32*)nullptr);
+			return;
+		case kSpectralResolution64:
+			lambda((Spectrum64*)nullptr);
+			return;
+		default:
+			lambda((Spectrum*)nullptr);
+			return;
+	}
+}
+
+
 enum ERGBSpectrums
 {
 	kRGBRefl2SpecWhite,
@@ -135,139 +294,310 @@ enum ERGBSpectrums
 };
 
 
-inline uint32_t Spectrum::Size() const
+// Leaf spectra are held by reference, intermediate nodes by value
+template <typename E>
+struct SpectrumExprOperand
 {
-	return kSpectrumSamples;
-}
+	using Type = const E;
+};
 
 
-inline float& Spectrum::operator[](uint32_t i)
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+struct SpectrumExprOperand<SpectrumT<N, MinNm, MaxNm>>
 {
-	return m_values[i];
-}
+	using Type = const SpectrumT<N, MinNm, MaxNm>&;
+};
 
 
-inline float Spectrum::operator[](uint32_t i) const
+class SpectrumScalar : public SpectrumExpr<SpectrumScalar>
 {
-	return m_values[i];
-}
+public:
+	static const uint32_t kSamples = 0;
+
+	explicit SpectrumScalar(float value) : m_value(value)
+	{
+	}
+
+	float operator[](uint32_t i) const
+	{
+		return m_value;
+	}
+
+	template <typename P>
+	P Packet(uint32_t i) const
+	{
+		return SimdTraits<P>::Set(m_value);
+	}
+
+private:
+	float m_value;
+};
 
 
-inline Spectrum Spectrum::operator+(float x) const
+template <typename Op, typename L, typename R>
+class SpectrumBinaryExpr : public SpectrumExpr<SpectrumBinaryExpr<Op, L, R>>
 {
-	Spectrum ret = *this;
-	for (float& val : ret.m_values)
-		val += x;
-	return ret;
+public:
+	static_assert(L::kSamples == 0 || R::kSamples == 0 || L::kSamples == R::kSamples, "Spectra of different resolutions in one expression");
+	static const uint32_t kSamples = L::kSamples ? L::kSamples : R::kSamples;
+
+	SpectrumBinaryExpr(const L& l, const R& r) : m_l(l), m_r(r)
+	{
+	}
+
+	float operator[](uint32_t i) const
+	{
+		return Op::Apply(m_l[i], m_r[i]);
+	}
+
+	template <typename P>
+	P Packet(uint32_t i) const
+	{
+		return Op::Apply(m_l.template Packet<P>(i), m_r.template Packet<P>(i));
+	}
+
+private:
+	typename SpectrumExprOperand<L>::Type m_l;
+	typename SpectrumExprOperand<R>::Type m_r;
+};
+
+
+template <typename Op, typename E>
+class SpectrumUnaryExpr : public SpectrumExpr<SpectrumUnaryExpr<Op, E>>
+{
+public:
+	static const uint32_t kSamples = E::kSamples;
+
+	explicit SpectrumUnaryExpr(const E& e) : m_e(e)
+	{
+	}
+
+	float operator[](uint32_t i) const
+	{
+		return Op::Apply(m_e[i]);
+	}
+
+	template <typename P>
+	P Packet(uint32_t i) const
+	{
+		return Op::Apply(m_e.template Packet<P>(i));
+	}
+
+private:
+	typename SpectrumExprOperand<E>::Type m_e;
+};
+
+
+struct SpectrumOpAdd
+{
+	template <typename T>
+	static T Apply(T a, T b)
+	{
+		return a + b;
+	}
+};
+
+
+struct SpectrumOpSub
+{
+	template <typename T>
+	static T Apply(T a, T b)
+	{
+		return a - b;
+	}
+};
+
+
+struct SpectrumOpMul
+{
+	template <typename T>
+	static T Apply(T a, T b)
+	{
+		return a * b;
+	}
+};
+
+
+struct SpectrumOpDiv
+{
+	template <typename T>
+	static T Apply(T a, T b)
+	{
+		return a / b;
+	}
+};
+
+
+struct SpectrumOpSafeSqrt
+{
+	template <typename T>
+	static T Apply(T a)
+	{
+		return Sqrt(Max(a, SimdTraits<T>::Set(0.0f)));
+	}
+};
+
+
+#define SPECTRUM_EXPR_BINARY_OPERATOR(op, Op)                                                                                   \
+	template <typename L, typename R>                                                                                           \
+	inline SpectrumBinaryExpr<Op, L, R> operator op(const SpectrumExpr<L>& l, const SpectrumExpr<R>& r)                         \
+	{                                                                                                                           \
+		return SpectrumBinaryExpr<Op, L, R>(l.Derived(), r.Derived());                                                          \
+	}                                                                                                                           \
+	template <typename L>                                                                                                       \
+	inline SpectrumBinaryExpr<Op, L, SpectrumScalar> operator op(const SpectrumExpr<L>& l, float r)                             \
+	{                                                                                                                           \
+		return SpectrumBinaryExpr<Op, L, SpectrumScalar>(l.Derived(), SpectrumScalar(r));                                       \
+	}                                                                                                                           \
+	template <typename R>                                                                                                       \
+	inline SpectrumBinaryExpr<Op, SpectrumScalar, R> operator op(float l, const SpectrumExpr<R>& r)                             \
+	{                                                                                                                           \
+		return SpectrumBinaryExpr<Op, SpectrumScalar, R>(SpectrumScalar(l), r.Derived());                                       \
+	}
+
+SPECTRUM_EXPR_BINARY_OPERATOR(+, SpectrumOpAdd)
+SPECTRUM_EXPR_BINARY_OPERATOR(-, SpectrumOpSub)
+SPECTRUM_EXPR_BINARY_OPERATOR(*, SpectrumOpMul)
+SPECTRUM_EXPR_BINARY_OPERATOR(/, SpectrumOpDiv)
+
+#undef SPECTRUM_EXPR_BINARY_OPERATOR
+
+
+template <typename E>
+inline SpectrumUnaryExpr<SpectrumOpSafeSqrt, E> SpectrumExpr<E>::safe_sqrt() const
+{
+	return SpectrumUnaryExpr<SpectrumOpSafeSqrt, E>(Derived());
 }
 
 
-inline Spectrum Spectrum::operator-(float x) const
+template <typename E>
+inline SpectrumUnaryExpr<SpectrumOpSafeSqrt, E> safe_sqrt(const SpectrumExpr<E>& e)
 {
-	Spectrum ret = *this;
-	for (float& val : ret.m_values)
-		val -= x;
-	return ret;
+	return e.safe_sqrt();
 }
 
 
-inline Spectrum Spectrum::operator*(float x) const
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+template <typename E>
+inline SpectrumT<N, MinNm, MaxNm>::SpectrumT(const SpectrumExpr<E>& expr)
 {
-	Spectrum ret = *this;
-	for (float& val : ret.m_values)
-		val *= x;
-	return ret;
+	*this = expr;
 }
 
 
-inline Spectrum Spectrum::operator/(float x) const
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+constexpr SpectrumT<N, MinNm, MaxNm>::SpectrumT(const float (&values)[N])
 {
-	Spectrum ret = *this;
-	for (float& val : ret.m_values)
-		val /= x;
-	return ret;
+	for (uint32_t i = 0; i < N; i++)
+		m_values[i] = values[i];
 }
 
 
-inline Spectrum& Spectrum::operator*=(float x)
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+inline uint32_t SpectrumT<N, MinNm, MaxNm>::Size() const
 {
-	for (float& val : m_values)
-		val *= x;
-	return *this;
+	return N;
 }
 
 
-inline Spectrum Spectrum::operator+(const Spectrum& x) const
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+inline float& SpectrumT<N, MinNm, MaxNm>::operator[](uint32_t i)
 {
-	Spectrum ret = *this;
-	for (uint32_t i = 0; i < kSpectrumSamples; i++)
-		ret[i] += x[i];
-	return ret;
+	return m_values[i];
 }
 
 
-inline Spectrum& Spectrum::operator+=(const Spectrum& x)
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+inline float SpectrumT<N, MinNm, MaxNm>::operator[](uint32_t i) const
 {
-	for (uint32_t i = 0; i < kSpectrumSamples; i++)
-		m_values[i] += x[i];
-	return *this;
+	return m_values[i];
 }
 
 
-inline Spectrum Spectrum::operator-(const Spectrum& x) const
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+template <typename E>
+inline SpectrumT<N, MinNm, MaxNm>& SpectrumT<N, MinNm, MaxNm>::operator=(const SpectrumExpr<E>& expr)
 {
-	Spectrum ret = *this;
-	for (uint32_t i = 0; i < kSpectrumSamples; i++)
-		ret[i] -= x[i];
-	return ret;
+	static_assert(E::kSamples == N, "Spectra of different resolutions in one expression");
+	const E& e = expr.Derived();
+	DispatchSimd([&](auto packet) {
+		using P = decltype(packet);
+		uint32_t i = 0;
+		for (; i + SimdTraits<P>::kWidth <= N; i += SimdTraits<P>::kWidth)
+			SimdTraits<P>::Store(m_values + i, e.template Packet<P>(i));
+		// N isn't necessarily a multiple of the packet width (471 is odd), finish the last lanes one by one
+		for (; i < N; i++)
+			m_values[i] = e[i];
+	});
+	return *this;
 }
 
 
-inline Spectrum Spectrum::operator*(const Spectrum& x) const
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+template <typename E>
+inline SpectrumT<N, MinNm, MaxNm>& SpectrumT<N, MinNm, MaxNm>::operator+=(const SpectrumExpr<E>& expr)
 {
-	Spectrum ret = *this;
-	for (uint32_t i = 0; i < kSpectrumSamples; i++)
-		ret[i] *= x[i];
-	return ret;
+	return *this = *this + expr;
 }
 
 
-inline Spectrum& Spectrum::operator*=(const Spectrum& x)
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+template <typename E>
+inline SpectrumT<N, MinNm, MaxNm>& SpectrumT<N, MinNm, MaxNm>::operator*=(const SpectrumExpr<E>& expr)
 {
-	for (uint32_t i = 0; i < kSpectrumSamples; i++)
-		m_values[i] *= x[i];
-	return *this;
+	return *this = *this * expr;
 }
 
 
-inline Spectrum Spectrum::operator/(const Spectrum& x) const
+template <uint32_t N, uint32_t MinNm, uint32_t MaxNm>
+inline SpectrumT<N, MinNm, MaxNm>& SpectrumT<N, MinNm, MaxNm>::operator*=(float x)
 {
-	Spectrum ret = *this;
-	for (uint32_t i = 0; i < kSpectrumSamples; i++)
-		ret[i] /= x[i];
-	return ret;
+	return *this = *this * x;
 }
 
 
-inline Spectrum Spectrum::safe_sqrt() const
+// ITU-R Rec. BT.709 linear RGB of XYZ tristimulus values
+inline void XYZToLinearRGB(float x, float y, float z, float& r, float& g, float& b)
 {
-	Spectrum ret = *this;
-	for (uint32_t i = 0; i < kSpectrumSamples; i++)
-		ret[i] = std::sqrt(std::max(0.0f, m_values[i]));
-	return ret;
+	r = 3.240479f * x + -1.537150f * y + -0.498535f * z;
+	g = -0.969256f * x + 1.875991f * y + 0.041556f * z;
+	b = 0.055648f * x + -0.204043f * y + 1.057311f * z;
 }
 
 
-inline Spectrum operator*(float f, const Spectrum& spec)
+// XYZ tristimulus values of ITU-R Rec. BT.709 linear RGB, the inverse of XYZToLinearRGB()
+inline void LinearRGBToXYZ(float r, float g, float b, float& x, float& y, float& z)
 {
-	return spec * f;
+	x = 0.412453f * r + 0.357580f * g + 0.180423f * b;
+	y = 0.212671f * r + 0.715160f * g + 0.072169f * b;
+	z = 0.019334f * r + 0.119193f * g + 0.950227f * b;
 }
 
 
-void InitSpectrum();
-const Spectrum& GetCIE_X();
-const Spectrum& GetCIE_Y();
-const Spectrum& GetCIE_Z();
-const Spectrum& GetD65();
-const Spectrum& GetD65Normalized();
-const Spectrum& GetRGBSpectrum(ERGBSpectrums spectrum);
\ No newline at end of file
+// Tables generated at build time, see GenerateSpectrumTables(). S defaults to the 1 nm spectrum
+template <typename S = Spectrum>
+const S& GetCIE_X();
+template <typename S = Spectrum>
+const S& GetCIE_Y();
+template <typename S = Spectrum>
+const S& GetCIE_Z();
+// 1 / sum of CIE Y, the scale ToXYZ applies to the weighted sums
+template <typename S = Spectrum>
+float GetCIENormalization();
+template <typename S = Spectrum>
+const S& GetD65();
+template <typename S = Spectrum>
+const S& GetD65Normalized();
+template <typename S = Spectrum>
+const S& GetRGBSpectrum(ERGBSpectrums spectrum);
+
+/**
+ * \brief Resample the CIE.h data and the Smits RGB bases for every resolution
+ * and write them to filename as constexpr tables, i.e. regenerate
+ * code\SpectrumTables.inl. Rerun it after changing the data, the resampling or
+ * the set of resolutions.
+ */
+bool GenerateSpectrumTables(const char* filename);
+
+// Number of table values which differ from a fresh resampling, 0 when SpectrumTables.inl is up to date
+uint32_t VerifySpectrumTables();
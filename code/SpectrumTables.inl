@@ -0,0 +1,1904 @@
+// Generated by GenerateSpectrumTables() from CIE.h and the Smits RGB data, do not edit.
+// Regenerate with "brdf_playground.exe spectables ..\code\SpectrumTables.inl".
+
+static constexpr SpectrumTables<SpectrumT<16>> kSpectrumTables16 = {
+    SpectrumT<16>({0x1.20c0d4p-10f, 0x1.15a916p-5f, 0x1.2317e4p-2f, 0x1.03b294p-2f, 0x1.2413fap-5f, 0x1.7ac4d6p-4f,
+       0x1.d0f004p-2f, 0x1.cf0948p-1f, 0x1.f2b96ap-1f, 0x1.e74e4ap-2f, 0x1.c4a3ecp-4f, 0x1.01cbb2p-6f,
+       0x1.0fbd9p-9f, 0x1.06f508p-12f, 0x1.1071e4p-15f, 0x1.17196ep-18f}),
+    SpectrumT<16>({0x1.09f8d8p-15f, 0x1.f32006p-11f, 0x1.0c9958p-6f, 0x1.24d9d4p-4f, 0x1.fa45d8p-3f, 0x1.6f11bp-1f,
+       0x1.f6b5dp-1f, 0x1.b63d64p-1f, 0x1.049342p-1f, 0x1.8675bep-3f, 0x1.4dcf9ep-5f, 0x1.74ef5cp-8f,
+       0x1.88859cp-11f, 0x1.7bd5a6p-14f, 0x1.898a14p-17f, 0x1.9326c8p-20f}),
+    SpectrumT<16>({0x1.5438f8p-8f, 0x1.4b43fap-3f, 0x1.69b2e2p+0f, 0x1.7fee7ap+0f, 0x1.d97238p-2f, 0x1.5a2206p-4f,
+       0x1.531d96p-7f, 0x1.a92c2ap-10f, 0x1.e24c7ep-12f, 0x1.de4e26p-16f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f}),
+    0x1.197f6ep-2f,
+    SpectrumT<16>({0x1.969bb6p+5f, 0x1.46d72ap+6f, 0x1.86683ep+6f, 0x1.d1969cp+6f, 0x1.bad74p+6f, 0x1.aa29c2p+6f,
+       0x1.9a4852p+6f, 0x1.76e164p+6f, 0x1.63b9a8p+6f, 0x1.4acb8cp+6f, 0x1.40e9bp+6f, 0x1.20652ep+6f,
+       0x1.12ebdep+6f, 0x1.ddb25p+5f, 0x1.fb13eap+5f, 0x1.c2f16ep+5f}),
+    SpectrumT<16>({0x1.075c1ap-1f, 0x1.a76378p-1f, 0x1.f9bb96p-1f, 0x1.2d8fa6p+0f, 0x1.1ed3dcp+0f, 0x1.140684p+0f,
+       0x1.09bd56p+0f, 0x1.e59e92p-1f, 0x1.ccce48p-1f, 0x1.ac82e8p-1f, 0x1.9fb5bcp-1f, 0x1.75962ep-1f,
+       0x1.6421f2p-1f, 0x1.356752p-1f, 0x1.486f0ep-1f, 0x1.24134ep-1f}),
+    {
+    SpectrumT<16>({0x1.0fd4e2p+0f, 0x1.0fd03ap+0f, 0x1.0ff782p+0f, 0x1.0ffdfep+0f, 0x1.0fd47cp+0f, 0x1.0fb0bap+0f,
+       0x1.0fedfp+0f, 0x1.0ffdecp+0f, 0x1.10012ap+0f, 0x1.0ffaaap+0f, 0x1.0f8e64p+0f, 0x1.0f6446p+0f,
+       0x1.0f8428p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f}),
+    SpectrumT<16>({0x1.0a5076p+0f, 0x1.065534p+0f, 0x1.081366p+0f, 0x1.09b598p+0f, 0x1.0d1ac6p+0f, 0x1.0da902p+0f,
+       0x1.0ddb5ep+0f, 0x1.affd72p-1f, 0x1.2092dap-4f, -0x1.be385cp-9f, 0x1.2434dap-8f, 0x1.25ffeep-7f,
+       0x1.8220d8p-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f}),
+    SpectrumT<16>({0x1.fcbcc8p-1f, 0x1.fb6764p-1f, 0x1.04a174p+0f, 0x1.021328p+0f, 0x1.e46afp-2f, 0x1.94cfap-9f,
+       -0x1.48616p-9f, 0x1.765ab8p-2f, 0x1.f3a052p-1f, 0x1.e988cp-1f, 0x1.dd805ap-1f, 0x1.d33502p-1f,
+       0x1.b46e6cp-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f}),
+    SpectrumT<16>({0x1.1094e2p-8f, -0x1.6b2a3p-8f, 0x1.1706bcp-9f, 0x1.5a8c1p-3f, 0x1.2e9622p-1f, 0x1.ff130cp-1f,
+       0x1.0d1ecp+0f, 0x1.0d2c94p+0f, 0x1.0d29fap+0f, 0x1.0d2832p+0f, 0x1.0cffb2p+0f, 0x1.0c0caap+0f,
+       0x1.0a23d8p+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f}),
+    SpectrumT<16>({0x1.4641ecp-3f, 0x1.df8882p-4f, 0x1.422c26p-5f, 0x1.31e88ep-7f, -0x1.9b931ap-12f, -0x1.e80b8p-8f,
+       -0x1.ee6e7ep-9f, 0x1.1924d6p-2f, 0x1.f7994ep-1f, 0x1.ff64a8p-1f, 0x1.fe4306p-1f, 0x1.efca64p-1f,
+       0x1.f71542p-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f}),
+    SpectrumT<16>({0x1.a4627ep-10f, -0x1.3cfaaep-7f, -0x1.36e90cp-7f, 0x1.4140a2p-4f, 0x1.83778ap-1f, 0x1.ff05eep-1f,
+       0x1.ffc496p-1f, 0x1.9dae12p-1f, 0x1.999574p-4f, -0x1.8c1606p-8f, -0x1.18183ep-7f, -0x1.124f72p-10f,
+       -0x1.0dcad4p-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f}),
+    SpectrumT<16>({0x1.fbb8a4p-1f, 0x1.fcb734p-1f, 0x1.fe911ep-1f, 0x1.ed401cp-1f, 0x1.054a5ep-1f, 0x1.f79a94p-5f,
+       -0x1.065444p-15f, 0x1.a3424ap-10f, 0x1.586af2p-7f, 0x1.6197c8p-5f, 0x1.6f31e6p-5f, 0x1.4871dep-6f,
+       0x1.217208p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f}),
+    SpectrumT<16>({0x1.2813bp+0f, 0x1.2801b6p+0f, 0x1.2813c8p+0f, 0x1.281798p+0f, 0x1.281372p+0f, 0x1.25962cp+0f,
+       0x1.1dfd9ap+0f, 0x1.05deaep+0f, 0x1.ddcff8p-1f, 0x1.cb8fc2p-1f, 0x1.c3bdd4p-1f, 0x1.c2216p-1f,
+       0x1.c40366p-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f}),
+    SpectrumT<16>({0x1.21ed1ep+0f, 0x1.221846p+0f, 0x1.22cf58p+0f, 0x1.22d61cp+0f, 0x1.22d5bap+0f, 0x1.22c44ep+0f,
+       0x1.21a0e4p+0f, 0x1.9d61d4p-1f, 0x1.2013c2p-3f, -0x1.7f62a2p-7f, -0x1.0020cp-7f, -0x1.b15a48p-8f,
+       -0x1.8410f2p-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f}),
+    SpectrumT<16>({0x1.0a4602p+0f, 0x1.1282dep+0f, 0x1.135e6ap+0f, 0x1.1402dp+0f, 0x1.9782aap-1f, 0x1.709b6ep-5f,
+       -0x1.6cad3ap-11f, 0x1.0acd7cp-3f, 0x1.a45e12p-1f, 0x1.10d40ap+0f, 0x1.0a38e2p+0f, 0x1.0ab30cp+0f,
+       0x1.04f15p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f}),
+    SpectrumT<16>({0x1.811f14p-9f, 0x1.06ffaep-10f, -0x1.3b03d2p-13f, 0x1.70f556p-4f, 0x1.cffe1ap-1f, 0x1.0957e6p+0f,
+       0x1.09615cp+0f, 0x1.095afap+0f, 0x1.062482p+0f, 0x1.930f4ep-1f, 0x1.393ecep-1f, 0x1.25a9e2p-1f,
+       0x1.29296cp-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f}),
+    SpectrumT<16>({0x1.c13284p-5f, 0x1.d4dc58p-5f, 0x1.33e8eep-5f, 0x1.12cc8p-8f, 0x1.aa8804p-13f, -0x1.140a26p-13f,
+       0x1.0b242ap-8f, 0x1.cd8be4p-3f, 0x1.76b8f8p-1f, 0x1.f1ca3ep-1f, 0x1.fb6482p-1f, 0x1.f8b0ccp-1f,
+       0x1.fe27fap-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f}),
+    SpectrumT<16>({0x1.bc3994p-6f, 0x1.cf3c3ap-7f, -0x1.4c78b2p-8f, 0x1.ac2f56p-5f, 0x1.bab95cp-1f, 0x1.076edcp+0f,
+       0x1.088f62p+0f, 0x1.dfff6ep-1f, 0x1.de9692p-6f, 0x1.42b6cep-7f, 0x1.2e72c8p-10f, 0x1.d8ebb8p-7f,
+       0x1.7a6e6cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f}),
+    SpectrumT<16>({0x1.0e7e22p+0f, 0x1.0de4p+0f, 0x1.0ecd2ap+0f, 0x1.0ea666p+0f, 0x1.7b16bcp-1f, 0x1.43836ap-7f,
+       -0x1.29ca74p-10f, -0x1.d88444p-11f, 0x1.2af672p-9f, 0x1.1b5d76p-4f, 0x1.3443b2p-3f, 0x1.525f64p-3f,
+       0x1.80a2f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f}),
+    }};
+
+static constexpr SpectrumTables<SpectrumT<32>> kSpectrumTables32 = {
+    SpectrumT<32>({0x1.670672p-12f, 0x1.e7c008p-10f, 0x1.5ba864p-7f, 0x1.d46812p-5f, 0x1.cecbfp-3f, 0x1.5ec9d4p-2f,
+       0x1.4046aep-2f, 0x1.8e3cf8p-3f, 0x1.02a1ap-4f, 0x1.0b92d2p-7f, 0x1.ef7c7ep-6f, 0x1.3cd546p-3f,
+       0x1.5d939ep-2f, 0x1.222632p-1f, 0x1.9dfaf6p-1f, 0x1.000bccp+0f, 0x1.0c7608p+0f, 0x1.cc86ccp-1f,
+       0x1.384b5ap-1f, 0x1.5e05ep-2f, 0x1.43d68ep-3f, 0x1.019ab4p-4f, 0x1.7aa7a6p-6f, 0x1.11df76p-7f,
+       0x1.91745p-9f, 0x1.1c0d96p-10f, 0x1.832e1ap-12f, 0x1.1577eap-13f, 0x1.90dec2p-15f, 0x1.200a18p-16f,
+       0x1.9b555cp-18f, 0x1.25bafcp-19f}),
+    SpectrumT<32>({0x1.57f5cep-17f, 0x1.bdf442p-15f, 0x1.36273ep-12f, 0x1.a59636p-10f, 0x1.16e93ep-7f, 0x1.8dbe14p-6f,
+       0x1.979f32p-5f, 0x1.7de40ep-4f, 0x1.5eb41ep-3f, 0x1.4aebdp-2f, 0x1.2eb50ep-1f, 0x1.af6e5p-1f,
+       0x1.f08576p-1f, 0x1.fce62ap-1f, 0x1.db2696p-1f, 0x1.91542ap-1f, 0x1.33aa18p-1f, 0x1.aaf8d4p-2f,
+       0x1.00672p-2f, 0x1.0c1d3ap-3f, 0x1.dfa08ep-5f, 0x1.77fd4ep-6f, 0x1.1208acp-7f, 0x1.8b9ac6p-9f,
+       0x1.21f1fp-10f, 0x1.9a4e98p-12f, 0x1.17a2b8p-13f, 0x1.90cbb4p-15f, 0x1.2185e6p-16f, 0x1.a010b2p-18f,
+       0x1.291482p-19f, 0x1.a84928p-21f}),
+    SpectrumT<32>({0x1.a4c976p-10f, 0x1.1f9fc8p-7f, 0x1.9bf02p-5f, 0x1.17c5f6p-2f, 0x1.191eeap+0f, 0x1.ba46dap+0f,
+       0x1.b8cef2p+0f, 0x1.470e04p+0f, 0x1.46a9bep-1f, 0x1.2590f4p-2f, 0x1.f681e4p-4f, 0x1.7b8452p-5f,
+       0x1.056aeap-6f, 0x1.36caap-8f, 0x1.034338p-9f, 0x1.4bd1e2p-10f, 0x1.6e6268p-11f, 0x1.cfa85ap-13f,
+       0x1.9afabp-15f, 0x1.0d4dd6p-17f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f}),
+    0x1.197f68p-3f,
+    SpectrumT<32>({0x1.909a74p+5f, 0x1.9c9cfap+5f, 0x1.21e65cp+6f, 0x1.6bc7fep+6f, 0x1.691a16p+6f, 0x1.a3b66ap+6f,
+       0x1.d4d7f8p+6f, 0x1.ce553ep+6f, 0x1.c1b73ep+6f, 0x1.b3f73cp+6f, 0x1.aa20a6p+6f, 0x1.aa32e4p+6f,
+       0x1.a19eap+6f, 0x1.92f208p+6f, 0x1.817e18p+6f, 0x1.6c44aep+6f, 0x1.670e14p+6f, 0x1.60653ap+6f,
+       0x1.4f838p+6f, 0x1.46139cp+6f, 0x1.42c234p+6f, 0x1.3f1128p+6f, 0x1.1df726p+6f, 0x1.22d338p+6f,
+       0x1.0600fep+6f, 0x1.1fd6c2p+6f, 0x1.fd4364p+5f, 0x1.be214cp+5f, 0x1.018aacp+6f, 0x1.f3127ep+5f,
+       0x1.b5d204p+5f, 0x1.d010dep+5f}),
+    SpectrumT<32>({0x1.034c6ap-1f, 0x1.0b1276p-1f, 0x1.774972p-1f, 0x1.d6ede4p-1f, 0x1.d375f6p-1f, 0x1.0faad4p+0f,
+       0x1.2f77e8p+0f, 0x1.2b4114p+0f, 0x1.231666p+0f, 0x1.1a3002p+0f, 0x1.13d1ccp+0f, 0x1.13dd9cp+0f,
+       0x1.0e5008p+0f, 0x1.04d08p+0f, 0x1.f30914p-1f, 0x1.d78f4ep-1f, 0x1.d0cf9cp-1f, 0x1.c8309cp-1f,
+       0x1.b255f8p-1f, 0x1.a61e8p-1f, 0x1.a1d2e8p-1f, 0x1.9d0b82p-1f, 0x1.723192p-1f, 0x1.787c12p-1f,
+       0x1.532ca8p-1f, 0x1.749e7p-1f, 0x1.49a17ap-1f, 0x1.20c43ep-1f, 0x1.4d65e2p-1f, 0x1.4308dp-1f,
+       0x1.1b635p-1f, 0x1.2c603ap-1f}),
+    {
+    SpectrumT<32>({0x1.0fd868p+0f, 0x1.0fd15ep+0f, 0x1.0fbd4p+0f, 0x1.0fe336p+0f, 0x1.0ff29p+0f, 0x1.0ffc74p+0f,
+       0x1.0ffd28p+0f, 0x1.0ffed4p+0f, 0x1.0fedcep+0f, 0x1.0fbb2ap+0f, 0x1.0fa84cp+0f, 0x1.0fb928p+0f,
+       0x1.0fdd42p+0f, 0x1.0ffe9ep+0f, 0x1.0ffedcp+0f, 0x1.0ffcfap+0f, 0x1.0fffe4p+0f, 0x1.100272p+0f,
+       0x1.0ffa76p+0f, 0x1.0ffadep+0f, 0x1.0fcb04p+0f, 0x1.0f51c2p+0f, 0x1.0f5f8ap+0f, 0x1.0f6904p+0f,
+       0x1.0f812p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f}),
+    SpectrumT<32>({0x1.0a9d4ep+0f, 0x1.0a039cp+0f, 0x1.05d34p+0f, 0x1.06d728p+0f, 0x1.051432p+0f, 0x1.0b1298p+0f,
+       0x1.0c1fdep+0f, 0x1.074b52p+0f, 0x1.0c83acp+0f, 0x1.0db1ep+0f, 0x1.0db438p+0f, 0x1.0d9dcap+0f,
+       0x1.0da08cp+0f, 0x1.0e163p+0f, 0x1.09ea96p+0f, 0x1.4c25b6p-1f, 0x1.273aa2p-3f, -0x1.a9f1fcp-9f,
+       -0x1.5ce4bep-8f, -0x1.854e7ep-10f, 0x1.ccb88cp-8f, 0x1.eec4aap-10f, 0x1.7fe04ap-7f, 0x1.983f24p-8f,
+       0x1.666814p-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f}),
+    SpectrumT<32>({0x1.fd0a96p-1f, 0x1.fc6ef8p-1f, 0x1.f91654p-1f, 0x1.fdb872p-1f, 0x1.045d46p+0f, 0x1.04e5ap+0f,
+       0x1.01033cp+0f, 0x1.032312p+0f, 0x1.9a61e8p-1f, 0x1.282422p-3f, 0x1.4f4742p-8f, 0x1.162174p-10f,
+       -0x1.6b56a2p-8f, 0x1.17a9fep-11f, 0x1.167aecp-3f, 0x1.30bbfep-1f, 0x1.e84b32p-1f, 0x1.fef572p-1f,
+       0x1.fd64aap-1f, 0x1.d5acd6p-1f, 0x1.d1f726p-1f, 0x1.e9098ep-1f, 0x1.e476c8p-1f, 0x1.c1f338p-1f,
+       0x1.b658a4p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f}),
+    SpectrumT<32>({0x1.6d4d4p-8f, 0x1.67b904p-9f, -0x1.45ae0ap-8f, -0x1.90a654p-8f, -0x1.43558cp-8f, 0x1.2d2e26p-7f,
+       0x1.73fb9ep-4f, 0x1.fb1a4ep-3f, 0x1.d8ee4ap-2f, 0x1.70b52p-1f, 0x1.e542a4p-1f, 0x1.0c71bcp+0f,
+       0x1.0d1cb8p+0f, 0x1.0d20cap+0f, 0x1.0d38f6p+0f, 0x1.0d2034p+0f, 0x1.0d23cep+0f, 0x1.0d3028p+0f,
+       0x1.0d2ea6p+0f, 0x1.0d21bep+0f, 0x1.0d1776p+0f, 0x1.0ce7eap+0f, 0x1.0c683ep+0f, 0x1.0bb116p+0f,
+       0x1.0a3cd6p+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f}),
+    SpectrumT<32>({0x1.5377e8p-3f, 0x1.390bfp-3f, 0x1.f21598p-4f, 0x1.ccfb6ep-4f, 0x1.18b106p-4f, 0x1.4bd902p-7f,
+       0x1.44e096p-7f, 0x1.1ef082p-7f, 0x1.8c53bcp-9f, -0x1.f33884p-9f, -0x1.f3411ep-8f, -0x1.dcd5e2p-8f,
+       -0x1.01fa2ap-7f, 0x1.585d9p-12f, 0x1.d6306cp-7f, 0x1.11cc14p-1f, 0x1.ef7fb8p-1f, 0x1.ffb2ep-1f,
+       0x1.fdbbfap-1f, 0x1.0086acp+0f, 0x1.fd283ep-1f, 0x1.ff5dd2p-1f, 0x1.f5cb7ep-1f, 0x1.e9c94cp-1f,
+       0x1.f4c036p-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f}),
+    SpectrumT<32>({0x1.5b43ap-9f, 0x1.247b78p-11f, -0x1.20de0ep-7f, -0x1.59174ep-7f, -0x1.675d0ap-7f, -0x1.06751p-7f,
+       -0x1.2bf482p-11f, 0x1.426c96p-3f, 0x1.2f5d3ap-1f, 0x1.d791d8p-1f, 0x1.fe3b6p-1f, 0x1.ffd07cp-1f,
+       0x1.ffdffcp-1f, 0x1.ffa92ep-1f, 0x1.efd032p-1f, 0x1.4b8beep-1f, 0x1.94b16ap-3f, 0x1.39029ap-9f,
+       -0x1.2c818cp-8f, -0x1.ebaa7ep-8f, -0x1.1f1b0ap-7f, -0x1.111572p-7f, -0x1.4dab4ep-8f, 0x1.890728p-9f,
+       -0x1.5fd5dp-10f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f}),
+    SpectrumT<32>({0x1.fbf43cp-1f, 0x1.fb7d0ap-1f, 0x1.fc04ap-1f, 0x1.fd69c8p-1f, 0x1.fd2e9cp-1f, 0x1.fff39ep-1f,
+       0x1.ff0e4ep-1f, 0x1.db71ecp-1f, 0x1.52d73ep-1f, 0x1.6f7b02p-2f, 0x1.d3cd3ap-4f, 0x1.1e6ac6p-7f,
+       -0x1.5ec974p-12f, 0x1.1d3462p-12f, 0x1.6f0d5ep-9f, 0x1.a1a76ap-12f, 0x1.41d4b8p-9f, 0x1.30305cp-6f,
+       0x1.3274c6p-5f, 0x1.90bac8p-5f, 0x1.94a2e4p-5f, 0x1.49c0e6p-5f, 0x1.c5276ap-6f, 0x1.977898p-7f,
+       0x1.3162ap-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f}),
+    SpectrumT<32>({0x1.2811e8p+0f, 0x1.281576p+0f, 0x1.281a7p+0f, 0x1.27e8fcp+0f, 0x1.2804b4p+0f, 0x1.2822dcp+0f,
+       0x1.281f68p+0f, 0x1.280fc6p+0f, 0x1.2816ccp+0f, 0x1.28101ap+0f, 0x1.276376p+0f, 0x1.23c8ep+0f,
+       0x1.215be2p+0f, 0x1.1a9f54p+0f, 0x1.0bf5b2p+0f, 0x1.ff8f4ep-1f, 0x1.e54c16p-1f, 0x1.d653d6p-1f,
+       0x1.cdbd2cp-1f, 0x1.c9625cp-1f, 0x1.c500c6p-1f, 0x1.c27ae2p-1f, 0x1.c17324p-1f, 0x1.c2cf9ep-1f,
+       0x1.c3e80ap-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f}),
+    SpectrumT<32>({0x1.2229a6p+0f, 0x1.21b094p+0f, 0x1.218238p+0f, 0x1.22ae5p+0f, 0x1.22c29p+0f, 0x1.22dc1ep+0f,
+       0x1.22e542p+0f, 0x1.22c6f8p+0f, 0x1.22de04p+0f, 0x1.22cd6ep+0f, 0x1.22bfc8p+0f, 0x1.22c8d4p+0f,
+       0x1.22a6a8p+0f, 0x1.209b24p+0f, 0x1.f918f2p-1f, 0x1.41aab4p-1f, 0x1.fbba54p-3f, 0x1.11b4c2p-5f,
+       -0x1.862432p-7f, -0x1.78a112p-7f, -0x1.04904cp-7f, -0x1.f76268p-8f, -0x1.06033cp-7f, -0x1.56ae18p-8f,
+       -0x1.6d3036p-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f}),
+    SpectrumT<32>({0x1.09853cp+0f, 0x1.0b06c8p+0f, 0x1.116154p+0f, 0x1.13a464p+0f, 0x1.13ea7cp+0f, 0x1.12d25cp+0f,
+       0x1.12fba6p+0f, 0x1.1509fap+0f, 0x1.01a94ep+0f, 0x1.2bb2bap-1f, 0x1.747fep-4f, -0x1.f2393ap-11f,
+       -0x1.42f09ap-10f, -0x1.4de4f8p-13f, 0x1.da9c1cp-7f, 0x1.f7f138p-3f, 0x1.475234p-1f, 0x1.00b4f8p+0f,
+       0x1.14d348p+0f, 0x1.0cd4ccp+0f, 0x1.068a24p+0f, 0x1.0de7a2p+0f, 0x1.04e61p+0f, 0x1.108008p+0f,
+       0x1.0605d6p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f}),
+    SpectrumT<32>({0x1.6bd0e6p-9f, 0x1.966d4p-9f, 0x1.e0aa48p-10f, 0x1.6aa88ap-13f, -0x1.37a872p-13f, -0x1.3e5f34p-13f,
+       0x1.697928p-8f, 0x1.65a98ep-3f, 0x1.8f22bcp-1f, 0x1.086cbcp+0f, 0x1.0955fcp+0f, 0x1.0959d4p+0f,
+       0x1.0968cp+0f, 0x1.0959f8p+0f, 0x1.095d02p+0f, 0x1.0958fp+0f, 0x1.092714p+0f, 0x1.0321eep+0f,
+       0x1.b78214p-1f, 0x1.6e9c88p-1f, 0x1.40c634p-1f, 0x1.31b76ap-1f, 0x1.2af6cap-1f, 0x1.205cfap-1f,
+       0x1.28316ep-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f}),
+    SpectrumT<32>({0x1.c031acp-5f, 0x1.c2335ap-5f, 0x1.dcd1c8p-5f, 0x1.cce6eap-5f, 0x1.6df3c8p-5f, 0x1.f3bc22p-6f,
+       0x1.0b60fep-7f, 0x1.dae08ap-13f, 0x1.45340ep-11f, -0x1.bfc02ap-13f, -0x1.0932a6p-13f, -0x1.1ee1a2p-13f,
+       -0x1.dc18a2p-13f, 0x1.12948cp-7f, 0x1.bb5002p-4f, 0x1.5eb7e4p-2f, 0x1.3f4038p-1f, 0x1.ae31b4p-1f,
+       0x1.e835a2p-1f, 0x1.fb5ed6p-1f, 0x1.fbaef6p-1f, 0x1.fb1a1p-1f, 0x1.f67d56p-1f, 0x1.fae446p-1f,
+       0x1.fdc6fep-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f}),
+    SpectrumT<32>({0x1.9c5bep-6f, 0x1.dc1746p-6f, 0x1.6a4c4ap-6f, 0x1.93bfc8p-8f, 0x1.77e778p-11f, -0x1.63f72ap-7f,
+       0x1.6c0538p-8f, 0x1.956f04p-4f, 0x1.667f8cp-1f, 0x1.077996p+0f, 0x1.0889d4p+0f, 0x1.0653e6p+0f,
+       0x1.07bfdap+0f, 0x1.095eecp+0f, 0x1.06f8f8p+0f, 0x1.b20ceap-1f, 0x1.bc6c0ap-5f, 0x1.115428p-8f,
+       0x1.3fd578p-8f, 0x1.e582ep-7f, 0x1.7dd0fep-9f, -0x1.3d78dep-11f, -0x1.7be1fcp-13f, 0x1.dbe37cp-6f,
+       0x1.98a87ep-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f}),
+    SpectrumT<32>({0x1.0e9ac4p+0f, 0x1.0e6184p+0f, 0x1.0df18cp+0f, 0x1.0dd674p+0f, 0x1.0ebb72p+0f, 0x1.0edee2p+0f,
+       0x1.0ecf3p+0f, 0x1.0e7d9cp+0f, 0x1.0902bep+0f, 0x1.c84feep-2f, 0x1.5a00fap-6f, -0x1.67d908p-10f,
+       -0x1.70992ap-10f, -0x1.c5f77cp-11f, -0x1.88bc5cp-12f, -0x1.76552cp-10f, -0x1.999032p-10f, 0x1.915a7ep-8f,
+       0x1.22d77p-5f, 0x1.a54f38p-4f, 0x1.2feaa4p-3f, 0x1.389cc2p-3f, 0x1.5570a4p-3f, 0x1.4f4e22p-3f,
+       0x1.7abcf8p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f}),
+    }};
+
+static constexpr SpectrumTables<SpectrumT<64>> kSpectrumTables64 = {
+    SpectrumT<64>({0x1.ae8294p-13f, 0x1.f6cb9ap-12f, 0x1.2e952ap-10f, 0x1.507574p-9f, 0x1.9bb7a4p-8f, 0x1.e974f2p-7f,
+       0x1.15c602p-5f, 0x1.498512p-4f, 0x1.62921ap-3f, 0x1.1d82e6p-2f, 0x1.599766p-2f, 0x1.63fc4p-2f,
+       0x1.5210ccp-2f, 0x1.2e7c8ap-2f, 0x1.dfd096p-3f, 0x1.3ca958p-3f, 0x1.635b26p-4f, 0x1.43d034p-5f,
+       0x1.b04612p-7f, 0x1.9b7e48p-9f, 0x1.8a57c2p-7f, 0x1.8ce692p-5f, 0x1.ceb4a2p-4f, 0x1.92503ap-3f,
+       0x1.28c068p-2f, 0x1.9266d2p-2f, 0x1.03241cp-1f, 0x1.41284cp-1f, 0x1.8017f6p-1f, 0x1.bbddf8p-1f,
+       0x1.ee72e4p-1f, 0x1.08de26p+0f, 0x1.0f9b72p+0f, 0x1.09509ep+0f, 0x1.eb6e46p-1f, 0x1.ad9f52p-1f,
+       0x1.5ebcd6p-1f, 0x1.11d9ep-1f, 0x1.99a00ap-2f, 0x1.226bb6p-2f, 0x1.89d926p-3f, 0x1.fba7eep-4f,
+       0x1.3be4ep-4f, 0x1.8ea114p-5f, 0x1.ddca22p-6f, 0x1.178528p-6f, 0x1.5443c2p-7f, 0x1.9ef652p-8f,
+       0x1.f5e14cp-9f, 0x1.2d075ep-9f, 0x1.66ba0ap-10f, 0x1.a2c24p-11f, 0x1.e62c9cp-12f, 0x1.202f96p-12f,
+       0x1.5aa30cp-13f, 0x1.a0999p-14f, 0x1.f4c648p-15f, 0x1.2cf734p-15f, 0x1.689fdp-16f, 0x1.aee8c2p-17f,
+       0x1.017b48p-17f, 0x1.33b42ap-18f, 0x1.6fbb38p-19f, 0x1.b77588p-20f}),
+    SpectrumT<64>({0x1.9d9b2ep-18f, 0x1.e11e04p-17f, 0x1.16e398p-15f, 0x1.328274p-14f, 0x1.75679p-13f, 0x1.b19ab4p-12f,
+       0x1.ed4b7cp-11f, 0x1.2a4358p-9f, 0x1.6c4312p-8f, 0x1.77b0f2p-7f, 0x1.3e31d2p-6f, 0x1.dd4a5p-6f,
+       0x1.545f32p-5f, 0x1.dadf34p-5f, 0x1.433488p-4f, 0x1.b8939p-4f, 0x1.2b1174p-3f, 0x1.9256c6p-3f,
+       0x1.14487ap-2f, 0x1.818f22p-2f, 0x1.07c01ep-1f, 0x1.55a9fcp-1f, 0x1.9752p-1f, 0x1.c78a9cp-1f,
+       0x1.e791b4p-1f, 0x1.f9793cp-1f, 0x1.ff814ep-1f, 0x1.fa4b06p-1f, 0x1.e92a7p-1f, 0x1.cd22c4p-1f,
+       0x1.a7844ep-1f, 0x1.7b2404p-1f, 0x1.4bc764p-1f, 0x1.1b8ccap-1f, 0x1.d8840ap-2f, 0x1.7d6da2p-2f,
+       0x1.25a06cp-2f, 0x1.b65ba4p-3f, 0x1.3cda7ep-3f, 0x1.b6bffp-4f, 0x1.24c982p-4f, 0x1.75ae14p-5f,
+       0x1.ce034p-6f, 0x1.21f75ep-6f, 0x1.5a0988p-7f, 0x1.940f9cp-8f, 0x1.eb821ep-9f, 0x1.2bb36cp-9f,
+       0x1.6a79e6p-10f, 0x1.b2d3fep-11f, 0x1.0315e8p-11f, 0x1.2e715ep-12f, 0x1.5f2202p-13f, 0x1.a046d6p-14f,
+       0x1.f4b532p-15f, 0x1.2ce238p-15f, 0x1.69ad7cp-16f, 0x1.b2bcap-17f, 0x1.0474cp-17f, 0x1.3737e6p-18f,
+       0x1.73ecdap-19f, 0x1.bc784ap-20f, 0x1.0996ccp-20f, 0x1.3d64bap-21f}),
+    SpectrumT<64>({0x1.f75bfep-11f, 0x1.26f278p-9f, 0x1.646906p-8f, 0x1.8d0b12p-7f, 0x1.e6f868p-6f, 0x1.223206p-4f,
+       0x1.4aac66p-3f, 0x1.8a35b4p-2f, 0x1.ab8d24p-1f, 0x1.5c7742p+0f, 0x1.ada05p+0f, 0x1.c6ed66p+0f,
+       0x1.c356cep+0f, 0x1.ae4712p+0f, 0x1.749d66p+0f, 0x1.197ea2p+0f, 0x1.8886f6p-1f, 0x1.04cc8ap-1f,
+       0x1.5c3d06p-2f, 0x1.ddc9c8p-3f, 0x1.3a2834p-3f, 0x1.78b36p-4f, 0x1.d25858p-5f, 0x1.24b04ep-5f,
+       0x1.52c504p-6f, 0x1.70219cp-7f, 0x1.8c597p-8f, 0x1.c2779cp-9f, 0x1.209b6cp-9f, 0x1.cbd604p-10f,
+       0x1.7c21ep-10f, 0x1.1b81ep-10f, 0x1.c194f4p-11f, 0x1.1b2fe2p-11f, 0x1.19af76p-12f, 0x1.6bf1c8p-13f,
+       0x1.1e2e3p-14f, 0x1.f33206p-16f, 0x1.e90778p-17f, 0x1.8ca19ap-20f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f}),
+    0x1.197f68p-4f,
+    SpectrumT<64>({0x1.851e44p+5f, 0x1.9c16a2p+5f, 0x1.941a6ap+5f, 0x1.a51f86p+5f, 0x1.fa31b8p+5f, 0x1.46b3d6p+6f,
+       0x1.65aa8p+6f, 0x1.71e57cp+6f, 0x1.6ed18ap+6f, 0x1.6362a6p+6f, 0x1.8e55eep+6f, 0x1.b916e2p+6f,
+       0x1.d38636p+6f, 0x1.d629b6p+6f, 0x1.cf9894p+6f, 0x1.cd11e6p+6f, 0x1.caf79cp+6f, 0x1.b876ep+6f,
+       0x1.b48432p+6f, 0x1.b36a48p+6f, 0x1.ae2924p+6f, 0x1.a6182cp+6f, 0x1.a93abep+6f, 0x1.ab2b06p+6f,
+       0x1.a2c03ap+6f, 0x1.a07d08p+6f, 0x1.98b95cp+6f, 0x1.8d2ab8p+6f, 0x1.831ddap+6f, 0x1.7fde54p+6f,
+       0x1.73d524p+6f, 0x1.64b43ap+6f, 0x1.671096p+6f, 0x1.670b9p+6f, 0x1.63d6bap+6f, 0x1.5cf3bep+6f,
+       0x1.50fcd2p+6f, 0x1.4e0a2cp+6f, 0x1.4aaebp+6f, 0x1.417888p+6f, 0x1.40b9cep+6f, 0x1.44ca98p+6f,
+       0x1.4556c4p+6f, 0x1.38cb8ep+6f, 0x1.21eb4p+6f, 0x1.1a030cp+6f, 0x1.202c9ap+6f, 0x1.2579d2p+6f,
+       0x1.09ee8ap+6f, 0x1.021374p+6f, 0x1.18aab2p+6f, 0x1.2702cep+6f, 0x1.12d85p+6f, 0x1.d4d62ap+5f,
+       0x1.8f57eap+5f, 0x1.eceaa8p+5f, 0x1.047bbep+6f, 0x1.fd3334p+5f, 0x1.fec23p+5f, 0x1.e762c6p+5f,
+       0x1.c1dbb8p+5f, 0x1.a9c84ep+5f, 0x1.c6116ep+5f, 0x1.da104ep+5f}),
+    SpectrumT<64>({0x1.f7ae4p-2f, 0x1.0ab4f2p-1f, 0x1.0589e8p-1f, 0x1.108ddcp-1f, 0x1.479ce2p-1f, 0x1.a6e386p-1f,
+       0x1.cef7eap-1f, 0x1.deccb6p-1f, 0x1.dad0c8p-1f, 0x1.cc042cp-1f, 0x1.01ce5p+0f, 0x1.1d79fap+0f,
+       0x1.2e95d8p+0f, 0x1.304b08p+0f, 0x1.2c0afep+0f, 0x1.2a6874p+0f, 0x1.290c12p+0f, 0x1.1d126ap+0f,
+       0x1.1a844cp+0f, 0x1.19cdd6p+0f, 0x1.166742p+0f, 0x1.112ecap+0f, 0x1.133638p+0f, 0x1.14776ap+0f,
+       0x1.0f04dp+0f, 0x1.0d8df4p+0f, 0x1.088786p+0f, 0x1.010caap+0f, 0x1.f516f8p-1f, 0x1.f0e2a2p-1f,
+       0x1.e14e4cp-1f, 0x1.cdb922p-1f, 0x1.d0c76ep-1f, 0x1.d0c0eep-1f, 0x1.cc9a6cp-1f, 0x1.c3b064p-1f,
+       0x1.b433b2p-1f, 0x1.b062dep-1f, 0x1.ac0a56p-1f, 0x1.a01de8p-1f, 0x1.9f2706p-1f, 0x1.a46a3cp-1f,
+       0x1.a51faep-1f, 0x1.94e30ap-1f, 0x1.77468cp-1f, 0x1.6d0a62p-1f, 0x1.750466p-1f, 0x1.7be134p-1f,
+       0x1.5839eap-1f, 0x1.4e0ebcp-1f, 0x1.6b4ca6p-1f, 0x1.7ddde4p-1f, 0x1.63c37ap-1f, 0x1.2f6f46p-1f,
+       0x1.02754ap-1f, 0x1.3f04fap-1f, 0x1.512c78p-1f, 0x1.498ee6p-1f, 0x1.4a912p-1f, 0x1.3b709cp-1f,
+       0x1.2326dap-1f, 0x1.1391d8p-1f, 0x1.25e05ap-1f, 0x1.32d154p-1f}),
+    {
+    SpectrumT<64>({0x1.0fd868p+0f, 0x1.0fd868p+0f, 0x1.0fd7bep+0f, 0x1.0fcafcp+0f, 0x1.0fbe14p+0f, 0x1.0fbc68p+0f,
+       0x1.0fd722p+0f, 0x1.0fef4cp+0f, 0x1.0fede6p+0f, 0x1.0ff73ap+0f, 0x1.0ffe8cp+0f, 0x1.0ffa5ep+0f,
+       0x1.0ffbccp+0f, 0x1.0ffe88p+0f, 0x1.0fffdp+0f, 0x1.0ffdd4p+0f, 0x1.0ff644p+0f, 0x1.0fe558p+0f,
+       0x1.0fc7fap+0f, 0x1.0fae5cp+0f, 0x1.0fa372p+0f, 0x1.0fad24p+0f, 0x1.0fb776p+0f, 0x1.0fbad6p+0f,
+       0x1.0fd0a2p+0f, 0x1.0fe9e2p+0f, 0x1.0ffe8ap+0f, 0x1.0ffebp+0f, 0x1.0ffd2cp+0f, 0x1.10008ep+0f,
+       0x1.0ffdd2p+0f, 0x1.0ffc22p+0f, 0x1.0ffe48p+0f, 0x1.10018p+0f, 0x1.100322p+0f, 0x1.1001cp+0f,
+       0x1.0ffc78p+0f, 0x1.0ff87p+0f, 0x1.0ff802p+0f, 0x1.0ffdbcp+0f, 0x1.0fe886p+0f, 0x1.0fad7ep+0f,
+       0x1.0f61d4p+0f, 0x1.0f41b2p+0f, 0x1.0f58a2p+0f, 0x1.0f667p+0f, 0x1.0f6a36p+0f, 0x1.0f67d2p+0f,
+       0x1.0f7b1p+0f, 0x1.0f872ep+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f}),
+    SpectrumT<64>({0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f, 0x1.0a8eep+0f, 0x1.097858p+0f, 0x1.07624cp+0f, 0x1.044436p+0f,
+       0x1.0643f8p+0f, 0x1.076a54p+0f, 0x1.036a9p+0f, 0x1.06bdd4p+0f, 0x1.0ad132p+0f, 0x1.0b53fcp+0f,
+       0x1.0ca034p+0f, 0x1.0b9f84p+0f, 0x1.063d44p+0f, 0x1.085962p+0f, 0x1.0bca7ep+0f, 0x1.0d3cd8p+0f,
+       0x1.0da99p+0f, 0x1.0dba2cp+0f, 0x1.0daee8p+0f, 0x1.0db988p+0f, 0x1.0db2d8p+0f, 0x1.0d88bcp+0f,
+       0x1.0d8b24p+0f, 0x1.0db5f6p+0f, 0x1.0e0834p+0f, 0x1.0e242cp+0f, 0x1.0d80c2p+0f, 0x1.06546ap+0f,
+       0x1.95f1cp-1f, 0x1.0259acp-1f, 0x1.c6e36ep-3f, 0x1.0f23a6p-4f, -0x1.4c4d74p-8f, -0x1.769216p-10f,
+       -0x1.330cfcp-8f, -0x1.86bc8p-8f, -0x1.508852p-9f, -0x1.a6315ap-12f, 0x1.0c138ap-8f, 0x1.46aec6p-7f,
+       0x1.b5b28cp-10f, 0x1.13eb66p-9f, 0x1.cf818cp-7f, 0x1.303f0ap-7f, 0x1.565ec6p-8f, 0x1.da1f8p-8f,
+       0x1.2f02ep-6f, 0x1.9dcd46p-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f}),
+    SpectrumT<64>({0x1.fd0a96p-1f, 0x1.fd0a96p-1f, 0x1.fcfbfap-1f, 0x1.fbe1f8p-1f, 0x1.fa1e94p-1f, 0x1.f80e16p-1f,
+       0x1.fae014p-1f, 0x1.004868p+0f, 0x1.04155ep+0f, 0x1.04a53p+0f, 0x1.04936ap+0f, 0x1.0537d4p+0f,
+       0x1.021456p+0f, 0x1.ffe446p-1f, 0x1.02198ap+0f, 0x1.042c98p+0f, 0x1.dd624p-1f, 0x1.57619p-1f,
+       0x1.1f8dd8p-2f, 0x1.12c904p-7f, 0x1.7d28ep-8f, 0x1.2165a8p-8f, 0x1.1a40aep-9f, -0x1.07ce2cp-15f,
+       -0x1.590354p-8f, -0x1.7da9ecp-8f, 0x1.848b42p-10f, -0x1.b3851ap-12f, 0x1.cd5a46p-5f, 0x1.b99f46p-3f,
+       0x1.de4bd8p-2f, 0x1.72521p-1f, 0x1.de542ap-1f, 0x1.f24238p-1f, 0x1.f831bcp-1f, 0x1.02dc96p+0f,
+       0x1.0182d8p+0f, 0x1.f7c3a4p-1f, 0x1.e4af96p-1f, 0x1.c6aa18p-1f, 0x1.c32bfap-1f, 0x1.e0c252p-1f,
+       0x1.e56746p-1f, 0x1.ecabd8p-1f, 0x1.f6b5cp-1f, 0x1.d237dp-1f, 0x1.be7208p-1f, 0x1.c5746ap-1f,
+       0x1.ba2c38p-1f, 0x1.b2851p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f}),
+    SpectrumT<64>({0x1.6d4d4p-8f, 0x1.6d4d4p-8f, 0x1.5be416p-8f, 0x1.7a9ddp-13f, -0x1.35e1fap-8f, -0x1.557a1ep-8f,
+       -0x1.820148p-8f, -0x1.9f4b6p-8f, -0x1.84cd6p-8f, -0x1.01ddb6p-8f, 0x1.f9513ap-10f, 0x1.0d9912p-6f,
+       0x1.ec5adcp-5f, 0x1.f1c9cep-4f, 0x1.99c074p-3f, 0x1.2e3a14p-2f, 0x1.9b894ep-2f, 0x1.0b29a4p-1f,
+       0x1.4f4a4cp-1f, 0x1.921ff6p-1f, 0x1.ce165ep-1f, 0x1.fc6ee4p-1f, 0x1.0beb82p+0f, 0x1.0cf7fp+0f,
+       0x1.0d206cp+0f, 0x1.0d19p+0f, 0x1.0d153ap+0f, 0x1.0d2c5cp+0f, 0x1.0d3c46p+0f, 0x1.0d35ap+0f,
+       0x1.0d25dcp+0f, 0x1.0d1a88p+0f, 0x1.0d1adap+0f, 0x1.0d2ccp+0f, 0x1.0d34e2p+0f, 0x1.0d2b72p+0f,
+       0x1.0d307cp+0f, 0x1.0d2ccep+0f, 0x1.0d1c94p+0f, 0x1.0d26e8p+0f, 0x1.0d23c6p+0f, 0x1.0d0b2ap+0f,
+       0x1.0d0728p+0f, 0x1.0cc8bp+0f, 0x1.0c54c4p+0f, 0x1.0c7bb8p+0f, 0x1.0c2b66p+0f, 0x1.0b36c6p+0f,
+       0x1.0a6ec4p+0f, 0x1.0a0ae4p+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f}),
+    SpectrumT<64>({0x1.5377e8p-3f, 0x1.5377e8p-3f, 0x1.50fcd8p-3f, 0x1.211b08p-3f, 0x1.ed017ep-4f, 0x1.f729bp-4f,
+       0x1.e5c916p-4f, 0x1.b42dcap-4f, 0x1.54d3b4p-4f, 0x1.b91cacp-5f, 0x1.7e8afap-6f, -0x1.958fcap-9f,
+       0x1.450294p-8f, 0x1.e73fe2p-7f, 0x1.ef62d4p-8f, 0x1.462f9cp-7f, 0x1.26dde4p-7f, -0x1.82d018p-9f,
+       -0x1.dceed4p-9f, -0x1.04c11ap-8f, -0x1.2805dp-7f, -0x1.96769ap-8f, -0x1.439236p-8f, -0x1.3b0cc4p-7f,
+       -0x1.2cdf7cp-7f, -0x1.ae29b4p-8f, -0x1.4ec8f6p-9f, 0x1.a4e05cp-9f, 0x1.869672p-9f, 0x1.a55dap-6f,
+       0x1.712942p-2f, 0x1.6b0388p-1f, 0x1.e33d0cp-1f, 0x1.fbc262p-1f, 0x1.fe4fb4p-1f, 0x1.008b08p+0f,
+       0x1.fe5bd6p-1f, 0x1.fd1c1ep-1f, 0x1.ff89d4p-1f, 0x1.01487p+0f, 0x1.0047dep+0f, 0x1.f9c0bcp-1f,
+       0x1.ffad78p-1f, 0x1.ff0e28p-1f, 0x1.f50c6ap-1f, 0x1.f68a9p-1f, 0x1.f07848p-1f, 0x1.e31a4ep-1f,
+       0x1.f0172ep-1f, 0x1.f96942p-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f}),
+    SpectrumT<64>({0x1.5b43ap-9f, 0x1.5b43ap-9f, 0x1.41867p-9f, -0x1.5e9164p-10f, -0x1.a63b32p-8f, -0x1.6e9e84p-7f,
+       -0x1.65953cp-7f, -0x1.4c995cp-7f, -0x1.857156p-7f, -0x1.4948bcp-7f, -0x1.05d4ccp-7f, -0x1.07155p-7f,
+       -0x1.1e5896p-7f, 0x1.f1b40ap-8f, 0x1.0ee05ap-4f, 0x1.fd6902p-3f, 0x1.e77944p-2f, 0x1.6afdd2p-1f,
+       0x1.be3c2ep-1f, 0x1.f0e786p-1f, 0x1.fccd9cp-1f, 0x1.ffa924p-1f, 0x1.ffe414p-1f, 0x1.ffbce2p-1f,
+       0x1.ffda44p-1f, 0x1.ffe5b4p-1f, 0x1.ffb7bap-1f, 0x1.ff9aa4p-1f, 0x1.fa4ad8p-1f, 0x1.e5558cp-1f,
+       0x1.86fe38p-1f, 0x1.1019a6p-1f, 0x1.271dbap-2f, 0x1.b64ebcp-4f, 0x1.ac571cp-8f, -0x1.cd521p-10f,
+       -0x1.041bcep-8f, -0x1.54e74cp-8f, -0x1.bbddc2p-8f, -0x1.0dbb9cp-7f, -0x1.23ae64p-7f, -0x1.1a87acp-7f,
+       -0x1.14e84cp-7f, -0x1.0d4296p-7f, -0x1.e2846cp-8f, -0x1.71a45ap-9f, 0x1.ba2928p-10f, 0x1.1a7cdep-8f,
+       0x1.7566ap-14f, -0x1.6b8108p-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f}),
+    SpectrumT<64>({0x1.fbf43cp-1f, 0x1.fbf43cp-1f, 0x1.fbe90cp-1f, 0x1.fb110cp-1f, 0x1.faf882p-1f, 0x1.fd10bcp-1f,
+       0x1.fd9d14p-1f, 0x1.fd367cp-1f, 0x1.fc3b48p-1f, 0x1.fe21fp-1f, 0x1.0001f2p+0f, 0x1.ffe354p-1f,
+       0x1.ffe4cp-1f, 0x1.fe37ep-1f, 0x1.f5e102p-1f, 0x1.c102d8p-1f, 0x1.7a1854p-1f, 0x1.2b9622p-1f,
+       0x1.b9d3c6p-2f, 0x1.25223ap-2f, 0x1.45b73cp-3f, 0x1.1c2bfcp-4f, 0x1.eab06cp-7f, 0x1.489476p-9f,
+       -0x1.0494c8p-12f, -0x1.b8fe2p-12f, -0x1.49f6bep-12f, 0x1.c22fc2p-11f, 0x1.2ac1dap-9f, 0x1.b358e2p-9f,
+       0x1.396388p-10f, -0x1.a23f5p-12f, 0x1.4f5f98p-12f, 0x1.2cdebcp-8f, 0x1.9eb574p-7f, 0x1.9105f8p-6f,
+       0x1.11c2c6p-5f, 0x1.5326c8p-5f, 0x1.8b7ef4p-5f, 0x1.95f69cp-5f, 0x1.96d1b8p-5f, 0x1.927412p-5f,
+       0x1.64519ep-5f, 0x1.2f3032p-5f, 0x1.f8005cp-6f, 0x1.924e78p-6f, 0x1.130896p-6f, 0x1.08e008p-7f,
+       0x1.513cb8p-8f, 0x1.118888p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f}),
+    SpectrumT<64>({0x1.2811e8p+0f, 0x1.2811e8p+0f, 0x1.28123ep+0f, 0x1.2818b4p+0f, 0x1.281d64p+0f, 0x1.28177cp+0f,
+       0x1.27f428p+0f, 0x1.27dddp+0f, 0x1.27f82ap+0f, 0x1.28113cp+0f, 0x1.2821fap+0f, 0x1.2823c2p+0f,
+       0x1.2822f4p+0f, 0x1.281bd8p+0f, 0x1.280bdep+0f, 0x1.2813acp+0f, 0x1.281ab2p+0f, 0x1.2812e4p+0f,
+       0x1.280e5p+0f, 0x1.2811e4p+0f, 0x1.28069cp+0f, 0x1.26c04ep+0f, 0x1.24e09p+0f, 0x1.22b12ep+0f,
+       0x1.219c4cp+0f, 0x1.211b7cp+0f, 0x1.201234p+0f, 0x1.152c74p+0f, 0x1.0cb476p+0f, 0x1.0b36eep+0f,
+       0x1.03c0dep+0f, 0x1.f79ce2p-1f, 0x1.eadc16p-1f, 0x1.dfbc14p-1f, 0x1.d816ecp-1f, 0x1.d490c2p-1f,
+       0x1.cf8ebep-1f, 0x1.cbeb9ap-1f, 0x1.ca75d4p-1f, 0x1.c84eep-1f, 0x1.c60a8cp-1f, 0x1.c3f704p-1f,
+       0x1.c2f902p-1f, 0x1.c1fcc2p-1f, 0x1.c101a4p-1f, 0x1.c1e4a4p-1f, 0x1.c2aa62p-1f, 0x1.c2f4dap-1f,
+       0x1.c3b164p-1f, 0x1.c41ebp-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f}),
+    SpectrumT<64>({0x1.2229a6p+0f, 0x1.2229a6p+0f, 0x1.221e48p+0f, 0x1.2142ep+0f, 0x1.20e094p+0f, 0x1.2223ep+0f,
+       0x1.229f32p+0f, 0x1.22bd7p+0f, 0x1.22bb2cp+0f, 0x1.22c9f6p+0f, 0x1.22d98ap+0f, 0x1.22deb4p+0f,
+       0x1.22e8ap+0f, 0x1.22e1e4p+0f, 0x1.22bc8ep+0f, 0x1.22d164p+0f, 0x1.22e552p+0f, 0x1.22d6bep+0f,
+       0x1.22d264p+0f, 0x1.22c878p+0f, 0x1.22b31cp+0f, 0x1.22cc74p+0f, 0x1.22d862p+0f, 0x1.22b944p+0f,
+       0x1.22ac88p+0f, 0x1.22a0c6p+0f, 0x1.2243bap+0f, 0x1.1ef28cp+0f, 0x1.0e9fd8p+0f, 0x1.d4f22ep-1f,
+       0x1.75a4f4p-1f, 0x1.0db078p-1f, 0x1.49468ep-2f, 0x1.64e79p-3f, 0x1.0fec16p-4f, 0x1.c8abap-12f,
+       -0x1.87be1p-7f, -0x1.848a52p-7f, -0x1.72906cp-7f, -0x1.7eb1b6p-7f, -0x1.45d05ep-7f, -0x1.86a078p-8f,
+       -0x1.c5627cp-8f, -0x1.14b12ap-7f, -0x1.288b9p-7f, -0x1.c6f5ccp-8f, -0x1.5672ecp-8f, -0x1.56e948p-8f,
+       -0x1.3f78eep-7f, -0x1.9ae77ep-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f}),
+    SpectrumT<64>({0x1.09853cp+0f, 0x1.09853cp+0f, 0x1.09a97p+0f, 0x1.0c642p+0f, 0x1.0fe61ap+0f, 0x1.12dc8ep+0f,
+       0x1.139494p+0f, 0x1.13b434p+0f, 0x1.142edep+0f, 0x1.13a61ap+0f, 0x1.12f5ccp+0f, 0x1.12aeeap+0f,
+       0x1.12b00cp+0f, 0x1.13473ep+0f, 0x1.14c04ep+0f, 0x1.1553a4p+0f, 0x1.0ddc88p+0f, 0x1.eaec26p-1f,
+       0x1.74e4b4p-1f, 0x1.c5017ep-2f, 0x1.2aaa36p-3f, 0x1.2756ap-5f, 0x1.1bd4a2p-15f, -0x1.fb17ep-10f,
+       -0x1.a8db2cp-10f, -0x1.ba0c0ep-11f, -0x1.4a71fp-13f, -0x1.5158p-13f, 0x1.d9cc4cp-9f, 0x1.9f6292p-6f,
+       0x1.4932b4p-3f, 0x1.5357dep-2f, 0x1.0968b6p-1f, 0x1.853bb4p-1f, 0x1.e8105p-1f, 0x1.0d61cap+0f,
+       0x1.14c81ep+0f, 0x1.14de74p+0f, 0x1.104f64p+0f, 0x1.095a34p+0f, 0x1.05a31p+0f, 0x1.077136p+0f,
+       0x1.0f290cp+0f, 0x1.0ca636p+0f, 0x1.ff6388p-1f, 0x1.0a1a5ap+0f, 0x1.11836p+0f, 0x1.0f7caep+0f,
+       0x1.082e68p+0f, 0x1.03dd44p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f}),
+    SpectrumT<64>({0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f, 0x1.6fd112p-9f, 0x1.bd097p-9f, 0x1.96dae6p-9f, 0x1.273d7cp-11f,
+       0x1.01016p-13f, 0x1.d44fb6p-13f, -0x1.3c5aeep-13f, -0x1.32f5f6p-13f, -0x1.8f81f2p-14f, -0x1.b4fd6cp-13f,
+       -0x1.41fcecp-13f, 0x1.6e811ep-7f, 0x1.daa546p-5f, 0x1.2a54e4p-2f, 0x1.377bd4p-1f, 0x1.e6c9a4p-1f,
+       0x1.081c8ap+0f, 0x1.08bceep+0f, 0x1.094ba4p+0f, 0x1.096054p+0f, 0x1.095852p+0f, 0x1.095b54p+0f,
+       0x1.0966eep+0f, 0x1.096a92p+0f, 0x1.095e3cp+0f, 0x1.0955b4p+0f, 0x1.0956ccp+0f, 0x1.096336p+0f,
+       0x1.095ecep+0f, 0x1.095314p+0f, 0x1.093f8ep+0f, 0x1.090e98p+0f, 0x1.06bd94p+0f, 0x1.ff0c94p-1f,
+       0x1.cf0f9cp-1f, 0x1.9ff48ep-1f, 0x1.7cdde6p-1f, 0x1.605b28p-1f, 0x1.4929e2p-1f, 0x1.38628ep-1f,
+       0x1.32bcbcp-1f, 0x1.30b216p-1f, 0x1.2f3e4p-1f, 0x1.26af54p-1f, 0x1.20a584p-1f, 0x1.20146cp-1f,
+       0x1.2641e2p-1f, 0x1.2a20fap-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f}),
+    SpectrumT<64>({0x1.c031acp-5f, 0x1.c031acp-5f, 0x1.c061e6p-5f, 0x1.c404cep-5f, 0x1.d0171ep-5f, 0x1.e98c7p-5f,
+       0x1.de1f3cp-5f, 0x1.bbae92p-5f, 0x1.859842p-5f, 0x1.564f4cp-5f, 0x1.1fcffcp-5f, 0x1.a7d852p-6f,
+       0x1.b0f938p-7f, 0x1.972314p-9f, 0x1.5e49d8p-13f, 0x1.2bbb9ep-12f, 0x1.aa3316p-11f, 0x1.c06a06p-12f,
+       -0x1.55d64ep-14f, -0x1.6a4a96p-12f, -0x1.2a35f6p-13f, -0x1.d05eaap-14f, -0x1.0dffccp-13f, -0x1.2fc378p-13f,
+       -0x1.73e978p-13f, -0x1.2223e6p-12f, 0x1.d1365ap-11f, 0x1.040adap-6f, 0x1.fe7f4cp-5f, 0x1.3bb02ep-3f,
+       0x1.1901c6p-2f, 0x1.a46ep-2f, 0x1.1da494p-1f, 0x1.60dbdep-1f, 0x1.99208p-1f, 0x1.c342e6p-1f,
+       0x1.df49dap-1f, 0x1.f12168p-1f, 0x1.f938b2p-1f, 0x1.fd84f6p-1f, 0x1.fd834p-1f, 0x1.f9daacp-1f,
+       0x1.fbdddp-1f, 0x1.fa565p-1f, 0x1.f486c4p-1f, 0x1.f873e4p-1f, 0x1.fb22ccp-1f, 0x1.faa5bcp-1f,
+       0x1.fd0538p-1f, 0x1.fe88c8p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f}),
+    SpectrumT<64>({0x1.9c5bep-6f, 0x1.9c5bep-6f, 0x1.a257b6p-6f, 0x1.0aeb6cp-5f, 0x1.0945f2p-5f, 0x1.84195ap-7f,
+       0x1.b61c7cp-8f, 0x1.71631p-8f, 0x1.5d84f2p-10f, 0x1.a6286cp-14f, -0x1.367aaep-8f, -0x1.16588p-6f,
+       -0x1.48bcep-10f, 0x1.951cd4p-7f, 0x1.0cb13ep-6f, 0x1.73d8dcp-3f, 0x1.ef27e6p-2f, 0x1.d56b2ap-1f,
+       0x1.0698acp+0f, 0x1.085a8p+0f, 0x1.084dp+0f, 0x1.08c6a4p+0f, 0x1.07db52p+0f, 0x1.04cc78p+0f,
+       0x1.06a6b4p+0f, 0x1.08d904p+0f, 0x1.0962a6p+0f, 0x1.095b3p+0f, 0x1.085d44p+0f, 0x1.0594acp+0f,
+       0x1.fb411p-1f, 0x1.68d8c4p-1f, 0x1.c1fb6ep-4f, -0x1.63d8d4p-10f, 0x1.5b4152p-9f, 0x1.7507a6p-8f,
+       0x1.8b4e1p-9f, 0x1.ba03eap-8f, 0x1.2c151ap-6f, 0x1.72db8cp-7f, 0x1.0b2e5ap-8f, 0x1.ca8a9ap-10f,
+       0x1.4e4d14p-11f, -0x1.e49f6ap-10f, -0x1.2fb4b4p-8f, 0x1.17f696p-8f, 0x1.4c3fd4p-6f, 0x1.35c39p-5f,
+       0x1.d50f32p-6f, 0x1.5c41cap-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f}),
+    SpectrumT<64>({0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f, 0x1.0e9564p+0f, 0x1.0e2da4p+0f, 0x1.0ddc64p+0f, 0x1.0e06b4p+0f,
+       0x1.0dd21ep+0f, 0x1.0ddac8p+0f, 0x1.0ea37ep+0f, 0x1.0ed36p+0f, 0x1.0ed5b8p+0f, 0x1.0ee80cp+0f,
+       0x1.0ee16p+0f, 0x1.0ebdp+0f, 0x1.0e764p+0f, 0x1.0e84f8p+0f, 0x1.0dc144p+0f, 0x1.044438p+0f,
+       0x1.470378p-1f, 0x1.0298e8p-2f, 0x1.66d35ep-5f, -0x1.9a4cacp-10f, -0x1.5de262p-10f, -0x1.71cfaep-10f,
+       -0x1.632394p-10f, -0x1.7e0ec2p-10f, -0x1.ba665ep-10f, -0x1.7223ap-15f, 0x1.01a6fap-11f, -0x1.4531acp-10f,
+       -0x1.75d3f8p-10f, -0x1.76d664p-10f, -0x1.b90b8cp-10f, -0x1.7a14d8p-10f, 0x1.053e8p-9f, 0x1.500adep-7f,
+       0x1.7cabb8p-6f, 0x1.875904p-5f, 0x1.5f2344p-4f, 0x1.eb7b28p-4f, 0x1.2610b4p-3f, 0x1.39c494p-3f,
+       0x1.35a394p-3f, 0x1.3b95ecp-3f, 0x1.51811p-3f, 0x1.596038p-3f, 0x1.54418ep-3f, 0x1.4a5abap-3f,
+       0x1.6ef39cp-3f, 0x1.868654p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f}),
+    }};
+
+static constexpr SpectrumTables<SpectrumT<471>> kSpectrumTables471 = {
+    SpectrumT<471>({0x1.211b42p-13f, 0x1.449236p-13f, 0x1.6c79d4p-13f, 0x1.99516cp-13f, 0x1.cb9862p-13f, 0x1.02089ap-12f,
+       0x1.21e27cp-12f, 0x1.45be8ep-12f, 0x1.6ddeaep-12f, 0x1.9a8492p-12f, 0x1.cbba88p-12f, 0x1.01062ap-11f,
+       0x1.1fb494p-11f, 0x1.4331eep-11f, 0x1.6cc8p-11f, 0x1.9e2562p-11f, 0x1.d82c9ep-11f, 0x1.0cabbp-10f,
+       0x1.2f7c32p-10f, 0x1.5331p-10f, 0x1.76a73ep-10f, 0x1.9a769ap-10f, 0x1.c181bcp-10f, 0x1.ef4f8ep-10f,
+       0x1.13b3d2p-9f, 0x1.369582p-9f, 0x1.611b26p-9f, 0x1.92c7bp-9f, 0x1.cab78cp-9f, 0x1.0403ccp-8f,
+       0x1.24e364p-8f, 0x1.483a52p-8f, 0x1.6fa4fcp-8f, 0x1.9d44a2p-8f, 0x1.d33b06p-8f, 0x1.0a0464p-7f,
+       0x1.3077e4p-7f, 0x1.5bd2fap-7f, 0x1.8a1bbp-7f, 0x1.b95722p-7f, 0x1.e7d246p-7f, 0x1.0b0acep-6f,
+       0x1.23ecacp-6f, 0x1.40deb8p-6f, 0x1.6431aap-6f, 0x1.8fee38p-6f, 0x1.c4edfep-6f, 0x1.01669ep-5f,
+       0x1.247e5ep-5f, 0x1.4b764cp-5f, 0x1.761ae6p-5f, 0x1.a4af98p-5f, 0x1.d8178p-5f, 0x1.08ae66p-4f,
+       0x1.28c48cp-4f, 0x1.4c997p-4f, 0x1.741cep-4f, 0x1.9f72eep-4f, 0x1.cf184p-4f, 0x1.01c4fap-3f,
+       0x1.1ea164p-3f, 0x1.3e0986p-3f, 0x1.5f37bp-3f, 0x1.812344p-3f, 0x1.a2c2dcp-3f, 0x1.c33afap-3f,
+       0x1.e2347ap-3f, 0x1.ffa636p-3f, 0x1.0db5b6p-2f, 0x1.1aaf6p-2f, 0x1.26a9cep-2f, 0x1.318efp-2f,
+       0x1.3b5a22p-2f, 0x1.4412cp-2f, 0x1.4bc064p-2f, 0x1.526808p-2f, 0x1.580ac6p-2f, 0x1.5cae84p-2f,
+       0x1.605edp-2f, 0x1.632756p-2f, 0x1.65123cp-2f, 0x1.66297p-2f, 0x1.667ee2p-2f, 0x1.6629f8p-2f,
+       0x1.654248p-2f, 0x1.63db1p-2f, 0x1.61fec4p-2f, 0x1.5fbaaap-2f, 0x1.5d23d4p-2f, 0x1.5a4f7cp-2f,
+       0x1.575202p-2f, 0x1.543408p-2f, 0x1.50e602p-2f, 0x1.4d4f8cp-2f, 0x1.4958p-2f, 0x1.44ea6ep-2f,
+       0x1.3fff84p-2f, 0x1.3a9bfp-2f, 0x1.34c346p-2f, 0x1.2e791ap-2f, 0x1.27c42p-2f, 0x1.20a9ecp-2f,
+       0x1.1917c8p-2f, 0x1.10eab8p-2f, 0x1.07ff38p-2f, 0x1.fc69p-3f, 0x1.e70c92p-3f, 0x1.d05786p-3f,
+       0x1.b8e2d2p-3f, 0x1.a148aep-3f, 0x1.8a0e52p-3f, 0x1.736a1cp-3f, 0x1.5d4c62p-3f, 0x1.47adeap-3f,
+       0x1.328824p-3f, 0x1.1ddc2ap-3f, 0x1.09bfc8p-3f, 0x1.ec8c1p-4f, 0x1.c6e1b6p-4f, 0x1.a2832cp-4f,
+       0x1.7f7136p-4f, 0x1.5db3ep-4f, 0x1.3d711p-4f, 0x1.1ede44p-4f, 0x1.0231f6p-4f, 0x1.cf3c6p-5f,
+       0x1.9e6c3p-5f, 0x1.71a272p-5f, 0x1.4868d6p-5f, 0x1.2247aap-5f, 0x1.fdb21cp-6f, 0x1.bbf2d6p-6f,
+       0x1.7f65b8p-6f, 0x1.47f96ep-6f, 0x1.159b0ap-6f, 0x1.d07006p-7f, 0x1.7f7b42p-7f, 0x1.38252cp-7f,
+       0x1.f4622cp-8f, 0x1.8ac526p-8f, 0x1.3313c8p-8f, 0x1.db0862p-9f, 0x1.76706p-9f, 0x1.3b03c8p-9f,
+       0x1.2b6c78p-9f, 0x1.49fc74p-9f, 0x1.98731ep-9f, 0x1.0d2f72p-8f, 0x1.6a891cp-8f, 0x1.e6fe8cp-8f,
+       0x1.427abap-7f, 0x1.a2cfeep-7f, 0x1.0a656p-6f, 0x1.4c7f1p-6f, 0x1.9801b6p-6f, 0x1.ed375cp-6f,
+       0x1.2621f6p-5f, 0x1.5a6cecp-5f, 0x1.933d5p-5f, 0x1.d0532ep-5f, 0x1.08b89cp-4f, 0x1.2b354ap-4f,
+       0x1.4f92aap-4f, 0x1.75c438p-4f, 0x1.9dbe06p-4f, 0x1.c77614p-4f, 0x1.f2df3ep-4f, 0x1.0fe3b6p-3f,
+       0x1.26f22ap-3f, 0x1.3e74c2p-3f, 0x1.56481ep-3f, 0x1.6e58c4p-3f, 0x1.86ac92p-3f, 0x1.9f4e78p-3f,
+       0x1.b848c8p-3f, 0x1.d1a448p-3f, 0x1.eb605ap-3f, 0x1.02bc36p-2f, 0x1.0ff75cp-2f, 0x1.1d62b8p-2f,
+       0x1.2aff5cp-2f, 0x1.38ce28p-2f, 0x1.46ce5ap-2f, 0x1.54fea2p-2f, 0x1.635d5cp-2f, 0x1.71e8eap-2f,
+       0x1.80a056p-2f, 0x1.8f8508p-2f, 0x1.9e99f2p-2f, 0x1.ade1dcp-2f, 0x1.bd5f16p-2f, 0x1.cd11c8p-2f,
+       0x1.dcf774p-2f, 0x1.ed0dd4p-2f, 0x1.fd52b4p-2f, 0x1.06e22ap-1f, 0x1.0f306ep-1f, 0x1.1791eap-1f,
+       0x1.20030ap-1f, 0x1.28801ep-1f, 0x1.3105aap-1f, 0x1.3990dcp-1f, 0x1.42208ep-1f, 0x1.4ab40ep-1f,
+       0x1.534abap-1f, 0x1.5be3ecp-1f, 0x1.647dd6p-1f, 0x1.6d14fep-1f, 0x1.75a56ap-1f, 0x1.7e2b36p-1f,
+       0x1.86a28ap-1f, 0x1.8f07ccp-1f, 0x1.975802p-1f, 0x1.9f906p-1f, 0x1.a7ae2ap-1f, 0x1.afaec4p-1f,
+       0x1.b78f3p-1f, 0x1.bf4a1cp-1f, 0x1.c6d8dep-1f, 0x1.ce349ep-1f, 0x1.d556bcp-1f, 0x1.dc3a22p-1f,
+       0x1.e2dc1p-1f, 0x1.e93a18p-1f, 0x1.ef51bap-1f, 0x1.f52028p-1f, 0x1.faa0d4p-1f, 0x1.ffd09cp-1f,
+       0x1.02579p+0f, 0x1.049e26p+0f, 0x1.06bc28p+0f, 0x1.08b1a4p+0f, 0x1.0a7a42p+0f, 0x1.0c0e9p+0f,
+       0x1.0d6692p+0f, 0x1.0e7a94p+0f, 0x1.0f456ep+0f, 0x1.0fc98p+0f, 0x1.100c7ap+0f, 0x1.10146p+0f,
+       0x1.0fe6eap+0f, 0x1.0f8726p+0f, 0x1.0ef14p+0f, 0x1.0e1eecp+0f, 0x1.0d0998p+0f, 0x1.0bab08p+0f,
+       0x1.0a0018p+0f, 0x1.080c94p+0f, 0x1.05d67p+0f, 0x1.0363d6p+0f, 0x1.00ba96p+0f, 0x1.fbbb1ep-1f,
+       0x1.f59892p-1f, 0x1.ef0d14p-1f, 0x1.e818b8p-1f, 0x1.e0bc0ap-1f, 0x1.d8fba8p-1f, 0x1.d0d954p-1f,
+       0x1.c84fd8p-1f, 0x1.bf590ap-1f, 0x1.b5ef3ep-1f, 0x1.ac1248p-1f, 0x1.a1cffep-1f, 0x1.973b54p-1f,
+       0x1.8c67ep-1f, 0x1.81682ap-1f, 0x1.764604p-1f, 0x1.6b0d04p-1f, 0x1.5fd37p-1f, 0x1.54b1acp-1f,
+       0x1.49bf6ap-1f, 0x1.3f0e24p-1f, 0x1.349bcap-1f, 0x1.2a5d9cp-1f, 0x1.2047c4p-1f, 0x1.164f2ep-1f,
+       0x1.0c712cp-1f, 0x1.02b248p-1f, 0x1.f2281p-2f, 0x1.df2db4p-2f, 0x1.cc75fap-2f, 0x1.ba0152p-2f,
+       0x1.a7d42cp-2f, 0x1.95f6e6p-2f, 0x1.847274p-2f, 0x1.734f2cp-2f, 0x1.629148p-2f, 0x1.523cd4p-2f,
+       0x1.425aap-2f, 0x1.32f49ep-2f, 0x1.241442p-2f, 0x1.15c0a8p-2f, 0x1.07f73cp-2f, 0x1.f5616p-3f,
+       0x1.dbc9fep-3f, 0x1.c31868p-3f, 0x1.ab45c8p-3f, 0x1.945264p-3f, 0x1.7e3b6p-3f, 0x1.68fd24p-3f,
+       0x1.54935ep-3f, 0x1.40fa9ap-3f, 0x1.2e3144p-3f, 0x1.1c36e8p-3f, 0x1.0b0bc4p-3f, 0x1.f55ebep-4f,
+       0x1.d63b5p-4f, 0x1.b8abd8p-4f, 0x1.9cbb9ep-4f, 0x1.827a46p-4f, 0x1.69f5fap-4f, 0x1.5331d4p-4f,
+       0x1.3e16aap-4f, 0x1.2a82cap-4f, 0x1.185442p-4f, 0x1.076a04p-4f, 0x1.ef662ep-5f, 0x1.d22edcp-5f,
+       0x1.b6c944p-5f, 0x1.9cc376p-5f, 0x1.83ac5cp-5f, 0x1.6b2d48p-5f, 0x1.534ba4p-5f, 0x1.3c3c08p-5f,
+       0x1.263aa8p-5f, 0x1.1180e2p-5f, 0x1.fc4644p-6f, 0x1.d81674p-6f, 0x1.b6539cp-6f, 0x1.96ec68p-6f,
+       0x1.79cf1ep-6f, 0x1.5eef0ap-6f, 0x1.4637ccp-6f, 0x1.2f85ccp-6f, 0x1.1ab19ap-6f, 0x1.07945ap-6f,
+       0x1.ec26f6p-7f, 0x1.cc21a8p-7f, 0x1.aeb53cp-7f, 0x1.93713p-7f, 0x1.79e4a8p-7f, 0x1.61bb8ap-7f,
+       0x1.4add38p-7f, 0x1.354c66p-7f, 0x1.210f5ap-7f, 0x1.0e2ba6p-7f, 0x1.f9295p-8f, 0x1.d85504p-8f,
+       0x1.b9a5b4p-8f, 0x1.9cee68p-8f, 0x1.82029cp-8f, 0x1.68ba92p-8f, 0x1.50fcaap-8f, 0x1.3ab5f4p-8f,
+       0x1.25d3c6p-8f, 0x1.12437ep-8f, 0x1.ffdd6p-9f, 0x1.dd8252p-9f, 0x1.bd5c96p-9f, 0x1.9f57c2p-9f,
+       0x1.835ec4p-9f, 0x1.69598cp-9f, 0x1.51263p-9f, 0x1.3a9e4ap-9f, 0x1.259acap-9f, 0x1.11f49p-9f,
+       0x1.ff1508p-10f, 0x1.dc8f9cp-10f, 0x1.bc3726p-10f, 0x1.9de9f2p-10f, 0x1.818542p-10f, 0x1.66e27ep-10f,
+       0x1.4de34p-10f, 0x1.367632p-10f, 0x1.208e84p-10f, 0x1.0c1e6cp-10f, 0x1.f227bep-11f, 0x1.ceb11ap-11f,
+       0x1.adaf64p-11f, 0x1.8efc82p-11f, 0x1.72711ap-11f, 0x1.57e70cp-11f, 0x1.3f4024p-11f, 0x1.28637cp-11f,
+       0x1.133a3ep-11f, 0x1.ff5ap-12f, 0x1.db4632p-12f, 0x1.ba02eap-12f, 0x1.9b5678p-12f, 0x1.7f085p-12f,
+       0x1.64df5ep-12f, 0x1.4ca8b6p-12f, 0x1.363cc4p-12f, 0x1.217512p-12f, 0x1.0e2aaep-12f, 0x1.f86c44p-13f,
+       0x1.d6e238p-13f, 0x1.b78298p-13f, 0x1.9a2d18p-13f, 0x1.7ec794p-13f, 0x1.65371ap-13f, 0x1.4d5944p-13f,
+       0x1.370b4ap-13f, 0x1.22348ap-13f, 0x1.0ec252p-13f, 0x1.f943aep-14f, 0x1.d77c12p-14f, 0x1.b800aap-14f,
+       0x1.9aa708p-14f, 0x1.7f476cp-14f, 0x1.65b9f8p-14f, 0x1.4dd774p-14f, 0x1.378244p-14f, 0x1.22a4e8p-14f,
+       0x1.0f2b7ap-14f, 0x1.fa0472p-15f, 0x1.d82698p-15f, 0x1.b8906p-15f, 0x1.9b1b44p-15f, 0x1.7fa3dep-15f,
+       0x1.660668p-15f, 0x1.4e2014p-15f, 0x1.37d1aep-15f, 0x1.22ff72p-15f, 0x1.0f8e28p-15f, 0x1.fac498p-16f,
+       0x1.d8c07ap-16f, 0x1.b8e5a2p-16f, 0x1.9b18dp-16f, 0x1.7f438cp-16f, 0x1.654f1p-16f, 0x1.4d202ap-16f,
+       0x1.369822p-16f, 0x1.2199a8p-16f, 0x1.0e09eap-16f, 0x1.f79bc2p-17f, 0x1.d59646p-17f, 0x1.b5d8d6p-17f,
+       0x1.983fbp-17f, 0x1.7ca8aap-17f, 0x1.62f134p-17f, 0x1.4af5f6p-17f, 0x1.349754p-17f, 0x1.1fbacp-17f,
+       0x1.0c488p-17f, 0x1.f450aep-18f, 0x1.d282fcp-18f, 0x1.b2fb48p-18f, 0x1.9593e4p-18f, 0x1.7a2b24p-18f,
+       0x1.609eb4p-18f, 0x1.48cb74p-18f, 0x1.3291fp-18f, 0x1.1dd7ccp-18f, 0x1.0a8594p-18f, 0x1.f106d6p-19f,
+       0x1.cf71bap-19f, 0x1.b01f54p-19f, 0x1.92e9fp-19f, 0x1.77affep-19f, 0x1.5e4f34p-19f, 0x1.46a4bp-19f,
+       0x1.309114p-19f, 0x1.1bfa1ep-19f, 0x1.08c872p-19f, 0x1.edc932p-20f, 0x1.cc6c9p-20f, 0x1.ad4e24p-20f,
+       0x1.9048dp-20f, 0x1.753b4ep-20f, 0x1.5c043p-20f}),
+    SpectrumT<471>({0x1.16d2bap-18f, 0x1.38b852p-18f, 0x1.5ed2b6p-18f, 0x1.899aa4p-18f, 0x1.b988fcp-18f, 0x1.ef35eep-18f,
+       0x1.15bbf6p-17f, 0x1.379abap-17f, 0x1.5da1d8p-17f, 0x1.883bdp-17f, 0x1.b7b9dcp-17f, 0x1.ec9d76p-17f,
+       0x1.13fcep-16f, 0x1.359332p-16f, 0x1.5bbde4p-16f, 0x1.8788c2p-16f, 0x1.b9b816p-16f, 0x1.f18e38p-16f,
+       0x1.16bdaep-15f, 0x1.35f7bp-15f, 0x1.55cee8p-15f, 0x1.76d68cp-15f, 0x1.9b49f6p-15f, 0x1.c5de4ep-15f,
+       0x1.f94962p-15f, 0x1.1c0c8p-14f, 0x1.41cf42p-14f, 0x1.6dc19cp-14f, 0x1.9f7d3p-14f, 0x1.d69bfcp-14f,
+       0x1.095706p-13f, 0x1.2a155cp-13f, 0x1.4ea11ap-13f, 0x1.7866d8p-13f, 0x1.a8d37p-13f, 0x1.e1bdcp-13f,
+       0x1.121fep-12f, 0x1.375816p-12f, 0x1.5efda6p-12f, 0x1.8785cap-12f, 0x1.af9acap-12f, 0x1.d7c434p-12f,
+       0x1.01a5e4p-11f, 0x1.1b26acp-11f, 0x1.3a72f4p-11f, 0x1.6177fap-11f, 0x1.9127c2p-11f, 0x1.c90aecp-11f,
+       0x1.04226ap-10f, 0x1.26fbeap-10f, 0x1.4cdf32p-10f, 0x1.765c9ap-10f, 0x1.a49fbp-10f, 0x1.d8cd1ep-10f,
+       0x1.0a0444p-9f, 0x1.2b8756p-9f, 0x1.51307ap-9f, 0x1.7bd9ep-9f, 0x1.acd672p-9f, 0x1.e579e8p-9f,
+       0x1.137bd2p-8f, 0x1.38d268p-8f, 0x1.6247b8p-8f, 0x1.8f362ep-8f, 0x1.bef7bap-8f, 0x1.f1098cp-8f,
+       0x1.12a846p-7f, 0x1.2df902p-7f, 0x1.4a7fc8p-7f, 0x1.684548p-7f, 0x1.874b2p-7f, 0x1.a78798p-7f,
+       0x1.c8f74ap-7f, 0x1.eba258p-7f, 0x1.07c8bap-6f, 0x1.1a69ap-6f, 0x1.2db7b8p-6f, 0x1.41a12p-6f,
+       0x1.560718p-6f, 0x1.6aca88p-6f, 0x1.7fd0b4p-6f, 0x1.951886p-6f, 0x1.aac85p-6f, 0x1.c11078p-6f,
+       0x1.d8218ep-6f, 0x1.f02498p-6f, 0x1.049542p-5f, 0x1.119b7cp-5f, 0x1.1f2a34p-5f, 0x1.2d46cep-5f,
+       0x1.3bf6c4p-5f, 0x1.4b3f6p-5f, 0x1.5b251ep-5f, 0x1.6bac28p-5f, 0x1.7cd8bep-5f, 0x1.8eb18ap-5f,
+       0x1.a13e0cp-5f, 0x1.b4787ap-5f, 0x1.c85186p-5f, 0x1.dcb96ep-5f, 0x1.f1a3ecp-5f, 0x1.038adep-4f,
+       0x1.0e9536p-4f, 0x1.1a0108p-4f, 0x1.25de74p-4f, 0x1.323ae2p-4f, 0x1.3f1e2cp-4f, 0x1.4c9284p-4f,
+       0x1.5aa7dep-4f, 0x1.696e74p-4f, 0x1.78f4acp-4f, 0x1.894182p-4f, 0x1.9a564p-4f, 0x1.ac357p-4f,
+       0x1.bee184p-4f, 0x1.d26208p-4f, 0x1.e6c24ep-4f, 0x1.fbf44ep-4f, 0x1.08ea88p-3f, 0x1.142056p-3f,
+       0x1.1f8c26p-3f, 0x1.2b2da6p-3f, 0x1.371e96p-3f, 0x1.437fbcp-3f, 0x1.507224p-3f, 0x1.5e12cep-3f,
+       0x1.6c70c4p-3f, 0x1.7b948ap-3f, 0x1.8b8cc4p-3f, 0x1.9c687p-3f, 0x1.ae3806p-3f, 0x1.c10cf4p-3f,
+       0x1.d4ed48p-3f, 0x1.e9d626p-3f, 0x1.ffc40cp-3f, 0x1.0b584ap-2f, 0x1.174c5ap-2f, 0x1.23d0a4p-2f,
+       0x1.3104bcp-2f, 0x1.3f08b4p-2f, 0x1.4dfa4ap-2f, 0x1.5de46cp-2f, 0x1.6eac0cp-2f, 0x1.802a28p-2f,
+       0x1.9236ep-2f, 0x1.a4ad4ep-2f, 0x1.b779fcp-2f, 0x1.caa4fap-2f, 0x1.de3c66p-2f, 0x1.f24eb8p-2f,
+       0x1.03733p-1f, 0x1.0dfd64p-1f, 0x1.18b51ap-1f, 0x1.23884cp-1f, 0x1.2e6512p-1f, 0x1.393c0ep-1f,
+       0x1.440512p-1f, 0x1.4eb0a6p-1f, 0x1.59245ep-1f, 0x1.63452ep-1f, 0x1.6cf93cp-1f, 0x1.763186p-1f,
+       0x1.7ef6bcp-1f, 0x1.8759cp-1f, 0x1.8f6c22p-1f, 0x1.973d1ep-1f, 0x1.9ed0a4p-1f, 0x1.a61ed2p-1f,
+       0x1.ad20fep-1f, 0x1.b3d08cp-1f, 0x1.ba27bcp-1f, 0x1.c0250ep-1f, 0x1.c5ccfcp-1f, 0x1.cb24aep-1f,
+       0x1.d03114p-1f, 0x1.d4f6d8p-1f, 0x1.d9782ap-1f, 0x1.ddb4b4p-1f, 0x1.e1ac6ep-1f, 0x1.e55f4ep-1f,
+       0x1.e8cd7ap-1f, 0x1.ebf838p-1f, 0x1.eee11ep-1f, 0x1.f1891cp-1f, 0x1.f3f118p-1f, 0x1.f619bep-1f,
+       0x1.f80508p-1f, 0x1.f9b73p-1f, 0x1.fb277ap-1f, 0x1.fc696p-1f, 0x1.fd7c1ep-1f, 0x1.fe5dd6p-1f,
+       0x1.ff0ecap-1f, 0x1.ff8ee2p-1f, 0x1.ffdd96p-1f, 0x1.fff9f4p-1f, 0x1.ffe294p-1f, 0x1.ff9596p-1f,
+       0x1.ff10a2p-1f, 0x1.fe50f4p-1f, 0x1.fd5358p-1f, 0x1.fc159ep-1f, 0x1.fa9beep-1f, 0x1.f8e8f4p-1f,
+       0x1.f6ff0ep-1f, 0x1.f4e07ap-1f, 0x1.f28e7ep-1f, 0x1.f008b4p-1f, 0x1.ed4e6ap-1f, 0x1.ea5eecp-1f,
+       0x1.e73994p-1f, 0x1.e3de62p-1f, 0x1.e04ee4p-1f, 0x1.dc8d3ap-1f, 0x1.d89b92p-1f, 0x1.d47bfap-1f,
+       0x1.d0305p-1f, 0x1.cbb8bep-1f, 0x1.c71454p-1f, 0x1.c2421ap-1f, 0x1.bd413p-1f, 0x1.b81222p-1f,
+       0x1.b2b822p-1f, 0x1.ad37p-1f, 0x1.a792a4p-1f, 0x1.a1cebp-1f, 0x1.9bed8ap-1f, 0x1.95f1a6p-1f,
+       0x1.8fdeaep-1f, 0x1.89b88cp-1f, 0x1.83830ap-1f, 0x1.7d414ap-1f, 0x1.76f44ep-1f, 0x1.709bfp-1f,
+       0x1.6a380ep-1f, 0x1.63c88cp-1f, 0x1.5d4e4p-1f, 0x1.56cb46p-1f, 0x1.5041dp-1f, 0x1.49b41ap-1f,
+       0x1.432452p-1f, 0x1.3c945ap-1f, 0x1.3604dp-1f, 0x1.2f7588p-1f, 0x1.28e672p-1f, 0x1.225756p-1f,
+       0x1.1bc84cp-1f, 0x1.153b5ap-1f, 0x1.0eb36cp-1f, 0x1.0833cap-1f, 0x1.01bf6cp-1f, 0x1.f6afacp-2f,
+       0x1.e9f8fp-2f, 0x1.dd5882p-2f, 0x1.d0ccb6p-2f, 0x1.c4541ap-2f, 0x1.b7f078p-2f, 0x1.aba014p-2f,
+       0x1.9f5a76p-2f, 0x1.93165cp-2f, 0x1.86caf4p-2f, 0x1.7a7456p-2f, 0x1.6e1ae8p-2f, 0x1.61cb48p-2f,
+       0x1.5592acp-2f, 0x1.497d68p-2f, 0x1.3d90aap-2f, 0x1.31d1e8p-2f, 0x1.264e6ap-2f, 0x1.1b1518p-2f,
+       0x1.10344ep-2f, 0x1.05b64ep-2f, 0x1.f72e18p-3f, 0x1.e397a4p-3f, 0x1.d09214p-3f, 0x1.be0742p-3f,
+       0x1.abee24p-3f, 0x1.9a496p-3f, 0x1.891758p-3f, 0x1.7854dcp-3f, 0x1.67fe58p-3f, 0x1.580ffcp-3f,
+       0x1.4889dap-3f, 0x1.396ffcp-3f, 0x1.2ac718p-3f, 0x1.1c934ap-3f, 0x1.0ed572p-3f, 0x1.018cf8p-3f,
+       0x1.e9786p-4f, 0x1.d0cc3ap-4f, 0x1.b91af4p-4f, 0x1.a26846p-4f, 0x1.8cacdp-4f, 0x1.77dad6p-4f,
+       0x1.63e398p-4f, 0x1.50b856p-4f, 0x1.3e5066p-4f, 0x1.2ca8c4p-4f, 0x1.1bbd3ap-4f, 0x1.0b895p-4f,
+       0x1.f80ffcp-5f, 0x1.da6976p-5f, 0x1.be17dp-5f, 0x1.a314a6p-5f, 0x1.895abcp-5f, 0x1.70e3cp-5f,
+       0x1.59a4f8p-5f, 0x1.439b76p-5f, 0x1.2ecee4p-5f, 0x1.1b4a44p-5f, 0x1.09177ep-5f, 0x1.f06f56p-6f,
+       0x1.d12ff6p-6f, 0x1.b43c4cp-6f, 0x1.995fcp-6f, 0x1.806708p-6f, 0x1.6936aap-6f, 0x1.53aaa4p-6f,
+       0x1.3f7978p-6f, 0x1.2c5044p-6f, 0x1.19dcbep-6f, 0x1.07df1p-6f, 0x1.ecb4b6p-7f, 0x1.cae9dcp-7f,
+       0x1.aab592p-7f, 0x1.8c6bcep-7f, 0x1.702a62p-7f, 0x1.55cf4ap-7f, 0x1.3d413ep-7f, 0x1.26709ep-7f,
+       0x1.114d8p-7f, 0x1.fb993cp-8f, 0x1.d7bd7cp-8f, 0x1.b6d3c6p-8f, 0x1.98a284p-8f, 0x1.7cf0b8p-8f,
+       0x1.6396aap-8f, 0x1.4c67b6p-8f, 0x1.371bf4p-8f, 0x1.23632ep-8f, 0x1.10edap-8f, 0x1.fef50ep-9f,
+       0x1.ddeca4p-9f, 0x1.bec5f6p-9f, 0x1.a18a14p-9f, 0x1.864108p-9f, 0x1.6cd896p-9f, 0x1.5522b4p-9f,
+       0x1.3ef94ep-9f, 0x1.2a3becp-9f, 0x1.16ca6cp-9f, 0x1.04880ep-9f, 0x1.e6c4c6p-10f, 0x1.c6975cp-10f,
+       0x1.a86cf6p-10f, 0x1.8c2a9ep-10f, 0x1.71aff8p-10f, 0x1.58dfdep-10f, 0x1.41a81p-10f, 0x1.2bf9cep-10f,
+       0x1.17c5ep-10f, 0x1.04fae6p-10f, 0x1.e700c8p-11f, 0x1.c6753p-11f, 0x1.a81aa8p-11f, 0x1.8bb89ap-11f,
+       0x1.711f4ep-11f, 0x1.58309ap-11f, 0x1.40d42p-11f, 0x1.2af19ap-11f, 0x1.166fe4p-11f, 0x1.03332p-11f,
+       0x1.e24ab8p-12f, 0x1.c07426p-12f, 0x1.a0cff6p-12f, 0x1.834a5ap-12f, 0x1.67c932p-12f, 0x1.4e2c48p-12f,
+       0x1.365596p-12f, 0x1.2029ap-12f, 0x1.0b8bfp-12f, 0x1.f0c20ap-13f, 0x1.cd261ep-13f, 0x1.ac201ep-13f,
+       0x1.8d8f0cp-13f, 0x1.71511ap-13f, 0x1.5742acp-13f, 0x1.3f3cap-13f, 0x1.29155p-13f, 0x1.14a3dcp-13f,
+       0x1.01bf12p-13f, 0x1.e0846p-14f, 0x1.c02128p-14f, 0x1.a21dp-14f, 0x1.863f9ep-14f, 0x1.6c5006p-14f,
+       0x1.5416e6p-14f, 0x1.3d6e2ap-14f, 0x1.283e86p-14f, 0x1.14751ap-14f, 0x1.01fe76p-14f, 0x1.e1836ap-15f,
+       0x1.c14b7ap-15f, 0x1.a33192p-15f, 0x1.871abp-15f, 0x1.6ceba8p-15f, 0x1.548602p-15f, 0x1.3dc92ep-15f,
+       0x1.289692p-15f, 0x1.14d16ep-15f, 0x1.025cf6p-15f, 0x1.e239a8p-16f, 0x1.c1f754p-16f, 0x1.a3d3e6p-16f,
+       0x1.87b294p-16f, 0x1.6d76d8p-16f, 0x1.55012ap-16f, 0x1.3e3104p-16f, 0x1.28ea8ap-16f, 0x1.151434p-16f,
+       0x1.02942cp-16f, 0x1.e2a29p-17f, 0x1.c26a0cp-17f, 0x1.a456acp-17f, 0x1.88411cp-17f, 0x1.6e01ap-17f,
+       0x1.55705p-17f, 0x1.3e6e96p-17f, 0x1.28e8c6p-17f, 0x1.14cea2p-17f, 0x1.020fcp-17f, 0x1.e130eep-18f,
+       0x1.c0a52p-18f, 0x1.a251dap-18f, 0x1.86104cp-18f, 0x1.6bb974p-18f, 0x1.532722p-18f, 0x1.3c3aa4p-18f,
+       0x1.26da28p-18f, 0x1.12edp-18f, 0x1.005a2ep-18f, 0x1.de1062p-19f, 0x1.bdc068p-19f, 0x1.9f9e16p-19f,
+       0x1.838724p-19f, 0x1.695892p-19f, 0x1.50ee8cp-19f, 0x1.3a28dcp-19f, 0x1.24ec4cp-19f, 0x1.11208ep-19f,
+       0x1.fd599cp-20f, 0x1.daef66p-20f, 0x1.bad50cp-20f, 0x1.9ce478p-20f, 0x1.80fbc8p-20f, 0x1.66f88ap-20f,
+       0x1.4eb768p-20f, 0x1.38183ap-20f, 0x1.22ffcap-20f, 0x1.0f55dp-20f, 0x1.fa0332p-21f, 0x1.d7d3d8p-21f,
+       0x1.b7f04p-21f, 0x1.9a327cp-21f, 0x1.7e78ccp-21f, 0x1.64a15ap-21f, 0x1.4c88fap-21f, 0x1.360f58p-21f,
+       0x1.21199cp-21f, 0x1.0d8fbep-21f, 0x1.f6b344p-22f}),
+    SpectrumT<471>({0x1.515526p-11f, 0x1.7aed3p-11f, 0x1.a9c2eap-11f, 0x1.de6aeap-11f, 0x1.0cbcf2p-10f, 0x1.2deadp-10f,
+       0x1.535c78p-10f, 0x1.7d88b8p-10f, 0x1.acbc44p-10f, 0x1.e1438ep-10f, 0x1.0d942ap-9f, 0x1.2d87dcp-9f,
+       0x1.51a568p-9f, 0x1.7b77c2p-9f, 0x1.ac8a5cp-9f, 0x1.e6dff4p-9f, 0x1.15c28ep-8f, 0x1.3c525p-8f,
+       0x1.6584dcp-8f, 0x1.8fbf74p-8f, 0x1.b9a652p-8f, 0x1.e3ed92p-8f, 0x1.090174p-7f, 0x1.240b24p-7f,
+       0x1.452c4cp-7f, 0x1.6e6668p-7f, 0x1.a0aefcp-7f, 0x1.db72fcp-7f, 0x1.0ed32cp-6f, 0x1.331eacp-6f,
+       0x1.5a0e52p-6f, 0x1.83ef18p-6f, 0x1.b2aa6ap-6f, 0x1.e8c654p-6f, 0x1.1464cp-5f, 0x1.3ad67p-5f,
+       0x1.68791ap-5f, 0x1.9bf2e4p-5f, 0x1.d2ec98p-5f, 0x1.0586dap-4f, 0x1.2129fap-4f, 0x1.3cb2dap-4f,
+       0x1.5a5994p-4f, 0x1.7cdfaap-4f, 0x1.a7076ap-4f, 0x1.db3fp-4f, 0x1.0d4714p-3f, 0x1.32413p-3f,
+       0x1.5c39b4p-3f, 0x1.8adc2cp-3f, 0x1.bdedf8p-3f, 0x1.f5c53p-3f, 0x1.19bb14p-2f, 0x1.3c2108p-2f,
+       0x1.62b4b2p-2f, 0x1.8dd0f6p-2f, 0x1.bd65c8p-2f, 0x1.f1a8bep-2f, 0x1.159e66p-1f, 0x1.3562b8p-1f,
+       0x1.5870c8p-1f, 0x1.7eaedep-1f, 0x1.a72ffep-1f, 0x1.d0b6eep-1f, 0x1.fa0592p-1f, 0x1.110a56p+0f,
+       0x1.243e4ep+0f, 0x1.369a98p+0f, 0x1.480ae4p+0f, 0x1.587a9ap+0f, 0x1.67d0bcp+0f, 0x1.75f356p+0f,
+       0x1.82da8ep+0f, 0x1.8e8b9cp+0f, 0x1.990c0ep+0f, 0x1.a25f0ap+0f, 0x1.aa857p+0f, 0x1.b1882p+0f,
+       0x1.b776acp+0f, 0x1.bc60cap+0f, 0x1.c053dep+0f, 0x1.c35c3ap+0f, 0x1.c5907ap+0f, 0x1.c70ee4p+0f,
+       0x1.c7f5eap+0f, 0x1.c85e3cp+0f, 0x1.c85484p+0f, 0x1.c7e896p+0f, 0x1.c73472p+0f, 0x1.c65268p+0f,
+       0x1.c55b32p+0f, 0x1.c4579cp+0f, 0x1.c33194p+0f, 0x1.c1c864p+0f, 0x1.bffb08p+0f, 0x1.bdad1ep+0f,
+       0x1.bad1f4p+0f, 0x1.b7688ep+0f, 0x1.b36d2ap+0f, 0x1.aedbfcp+0f, 0x1.a9b678p+0f, 0x1.a3ff1ap+0f,
+       0x1.9d980cp+0f, 0x1.964c04p+0f, 0x1.8de5p+0f, 0x1.8430fep+0f, 0x1.7925e6p+0f, 0x1.6d0b24p+0f,
+       0x1.6044c4p+0f, 0x1.5337aep+0f, 0x1.463aeap+0f, 0x1.397114p+0f, 0x1.2cce88p+0f, 0x1.204d7p+0f,
+       0x1.13e858p+0f, 0x1.079e8cp+0f, 0x1.f6fb6p-1f, 0x1.df2b8p-1f, 0x1.c7dbd8p-1f, 0x1.b11a0ap-1f,
+       0x1.9af24p-1f, 0x1.856ffep-1f, 0x1.70a566p-1f, 0x1.5ca9a6p-1f, 0x1.499454p-1f, 0x1.377b1ap-1f,
+       0x1.266814p-1f, 0x1.1650dcp-1f, 0x1.072538p-1f, 0x1.f1a988p-2f, 0x1.d6a374p-2f, 0x1.bd2ca8p-2f,
+       0x1.a53c64p-2f, 0x1.8ebf8ep-2f, 0x1.79a2d6p-2f, 0x1.65d1fap-2f, 0x1.5337cap-2f, 0x1.41c418p-2f,
+       0x1.316aacp-2f, 0x1.221fc6p-2f, 0x1.13d98ep-2f, 0x1.068c12p-2f, 0x1.f41ee8p-3f, 0x1.dc5276p-3f,
+       0x1.c53c26p-3f, 0x1.ae6fdcp-3f, 0x1.97ba06p-3f, 0x1.81364cp-3f, 0x1.6b0aecp-3f, 0x1.555e7cp-3f,
+       0x1.404e3ep-3f, 0x1.2bda4ep-3f, 0x1.180c54p-3f, 0x1.050ccap-3f, 0x1.e60c38p-4f, 0x1.c43ac4p-4f,
+       0x1.a4bf66p-4f, 0x1.878a8ep-4f, 0x1.6c95fap-4f, 0x1.53dcp-4f, 0x1.3d5b1ep-4f, 0x1.29122p-4f,
+       0x1.16cc5ep-4f, 0x1.062f4cp-4f, 0x1.edbaaep-5f, 0x1.d1040cp-5f, 0x1.b5e3e4p-5f, 0x1.9c428ep-5f,
+       0x1.83f01p-5f, 0x1.6cba24p-5f, 0x1.566bf8p-5f, 0x1.40d31cp-5f, 0x1.2be9f8p-5f, 0x1.17c97p-5f,
+       0x1.048d78p-5f, 0x1.e497f8p-6f, 0x1.c20444p-6f, 0x1.a141e4p-6f, 0x1.824ab4p-6f, 0x1.651bf4p-6f,
+       0x1.49b26p-6f, 0x1.3006fp-6f, 0x1.180d46p-6f, 0x1.01b79ap-6f, 0x1.d9f0dep-7f, 0x1.b385a8p-7f,
+       0x1.901476p-7f, 0x1.6f773p-7f, 0x1.517c5ep-7f, 0x1.35f1e6p-7f, 0x1.1ca77ep-7f, 0x1.057644p-7f,
+       0x1.e0818ep-8f, 0x1.b9cfbcp-8f, 0x1.9697fap-8f, 0x1.769bc4p-8f, 0x1.59a0c2p-8f, 0x1.3f6642p-8f,
+       0x1.27a402p-8f, 0x1.1210d8p-8f, 0x1.fcc9b4p-9f, 0x1.d8ccc8p-9f, 0x1.b7f81p-9f, 0x1.9a2f54p-9f,
+       0x1.7f581ep-9f, 0x1.67522cp-9f, 0x1.51e4a8p-9f, 0x1.3ed8a2p-9f, 0x1.2e105ep-9f, 0x1.1f715ep-9f,
+       0x1.12de62p-9f, 0x1.082c04p-9f, 0x1.fe41fap-10f, 0x1.ef0eaap-10f, 0x1.e25384p-10f, 0x1.d7ae3ap-10f,
+       0x1.cedc46p-10f, 0x1.c756d8p-10f, 0x1.c0457cp-10f, 0x1.b8c57ap-10f, 0x1.b0028ep-10f, 0x1.a58f76p-10f,
+       0x1.99951cp-10f, 0x1.8c49a6p-10f, 0x1.7de26ep-10f, 0x1.6e814cp-10f, 0x1.5df6c8p-10f, 0x1.4caf2p-10f,
+       0x1.3bdc88p-10f, 0x1.2ccc68p-10f, 0x1.20c188p-10f, 0x1.18824ep-10f, 0x1.133fdp-10f, 0x1.0f70e6p-10f,
+       0x1.0b7822p-10f, 0x1.05cfdp-10f, 0x1.fb6756p-11f, 0x1.e75ab2p-11f, 0x1.d10afap-11f, 0x1.ba0d9ap-11f,
+       0x1.a3e34cp-11f, 0x1.8f54fcp-11f, 0x1.7bad7cp-11f, 0x1.67ca2p-11f, 0x1.52807ep-11f, 0x1.3aad76p-11f,
+       0x1.1fa1e6p-11f, 0x1.027ee4p-11f, 0x1.caac8p-12f, 0x1.94b12p-12f, 0x1.67326p-12f, 0x1.4453e2p-12f,
+       0x1.2a8b5p-12f, 0x1.17802p-12f, 0x1.08d27ap-12f, 0x1.f8aaaap-13f, 0x1.e2b50ep-13f, 0x1.cfa314p-13f,
+       0x1.bd2b1ap-13f, 0x1.a88d1cp-13f, 0x1.8f102ep-13f, 0x1.6e9a5ap-13f, 0x1.486854p-13f, 0x1.1fb2dep-13f,
+       0x1.eff504p-14f, 0x1.a91f2p-14f, 0x1.6e048cp-14f, 0x1.3cefa2p-14f, 0x1.140aecp-14f, 0x1.e357c6p-15f,
+       0x1.a894b8p-15f, 0x1.770e6ap-15f, 0x1.4ef316p-15f, 0x1.2eaf68p-15f, 0x1.144378p-15f, 0x1.fb8038p-16f,
+       0x1.d3bc2ap-16f, 0x1.b033bcp-16f, 0x1.8faf1ep-16f, 0x1.70d922p-16f, 0x1.5260d4p-16f, 0x1.333224p-16f,
+       0x1.12f03ep-16f, 0x1.e3226ep-17f, 0x1.9e2aa4p-17f, 0x1.56cc68p-17f, 0x1.0b8dd6p-17f, 0x1.7c5a9ap-18f,
+       0x1.d2117cp-19f, 0x1.a9f546p-20f, 0x1.0ff628p-22f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f, 0x0p+0f,
+       0x0p+0f, 0x0p+0f, 0x0p+0f}),
+    0x1.32007ep-7f,
+    SpectrumT<471>({0x1.77484p+5f, 0x1.7ba23ep+5f, 0x1.7ffc1ep+5f, 0x1.8456p+5f, 0x1.88affep+5f, 0x1.8d0a04p+5f,
+       0x1.9164p+5f, 0x1.95bde8p+5f, 0x1.9a17ccp+5f, 0x1.9e71c6p+5f, 0x1.9fe74ep+5f, 0x1.9e37bap+5f,
+       0x1.9c87ccp+5f, 0x1.9ad7dep+5f, 0x1.9927f2p+5f, 0x1.9777ecp+5f, 0x1.95c7fep+5f, 0x1.941816p+5f,
+       0x1.926826p+5f, 0x1.90b838p+5f, 0x1.9183f2p+5f, 0x1.953d9ap+5f, 0x1.98f87cp+5f, 0x1.9cb37ap+5f,
+       0x1.a06e62p+5f, 0x1.a42942p+5f, 0x1.a7e446p+5f, 0x1.ab9f46p+5f, 0x1.af5a2cp+5f, 0x1.b3150ep+5f,
+       0x1.bf02a8p+5f, 0x1.d568ecp+5f, 0x1.ebd8e6p+5f, 0x1.012482p+6f, 0x1.0c5c84p+6f, 0x1.179478p+6f,
+       0x1.22cc84p+6f, 0x1.2e049p+6f, 0x1.393c92p+6f, 0x1.447492p+6f, 0x1.4c6ffep+6f, 0x1.4ff35p+6f,
+       0x1.536f78p+6f, 0x1.56eba4p+6f, 0x1.5a67cap+6f, 0x1.5de3fcp+6f, 0x1.616034p+6f, 0x1.64dc5ep+6f,
+       0x1.685886p+6f, 0x1.6bd4aap+6f, 0x1.6e3c04p+6f, 0x1.6f06c8p+6f, 0x1.6fcd94p+6f, 0x1.70946p+6f,
+       0x1.715b38p+6f, 0x1.72221p+6f, 0x1.72e8ecp+6f, 0x1.73afb8p+6f, 0x1.747684p+6f, 0x1.753d5cp+6f,
+       0x1.74b21cp+6f, 0x1.7207a8p+6f, 0x1.6f55fep+6f, 0x1.6ca44cp+6f, 0x1.69f29ep+6f, 0x1.6740fp+6f,
+       0x1.648f44p+6f, 0x1.61dd92p+6f, 0x1.5f2be6p+6f, 0x1.5c7a32p+6f, 0x1.5d633p+6f, 0x1.6488e4p+6f,
+       0x1.6bcadap+6f, 0x1.730cd4p+6f, 0x1.7a4ecp+6f, 0x1.8190acp+6f, 0x1.88d2acp+6f, 0x1.90147cp+6f,
+       0x1.975666p+6f, 0x1.9e98b2p+6f, 0x1.a505ecp+6f, 0x1.a9e7b4p+6f, 0x1.aec0dcp+6f, 0x1.b39962p+6f,
+       0x1.b871dep+6f, 0x1.bd4ab2p+6f, 0x1.c223e4p+6f, 0x1.c6fc66p+6f, 0x1.cbd538p+6f, 0x1.d0ae6p+6f,
+       0x1.d40c2ap+6f, 0x1.d4737ep+6f, 0x1.d4c5e8p+6f, 0x1.d51802p+6f, 0x1.d56a6ep+6f, 0x1.d5bc32p+6f,
+       0x1.d60e42p+6f, 0x1.d660aep+6f, 0x1.d6b2c6p+6f, 0x1.d70532p+6f, 0x1.d6e03ap+6f, 0x1.d5bb78p+6f,
+       0x1.d48e06p+6f, 0x1.d36098p+6f, 0x1.d232d8p+6f, 0x1.d104b6p+6f, 0x1.cfd74p+6f, 0x1.cea9dp+6f,
+       0x1.cd7c5ep+6f, 0x1.cc4eeep+6f, 0x1.cb99b2p+6f, 0x1.cbfacap+6f, 0x1.cc6764p+6f, 0x1.ccd468p+6f,
+       0x1.cd40cp+6f, 0x1.cdad1p+6f, 0x1.ce196p+6f, 0x1.ce85fap+6f, 0x1.cef2fep+6f, 0x1.cf5f58p+6f,
+       0x1.cee42cp+6f, 0x1.cc28dap+6f, 0x1.c9520ep+6f, 0x1.c67adap+6f, 0x1.c3a44ep+6f, 0x1.c0cdc4p+6f,
+       0x1.bdf73cp+6f, 0x1.bb2074p+6f, 0x1.b8493cp+6f, 0x1.b572acp+6f, 0x1.b368bp+6f, 0x1.b3823ep+6f,
+       0x1.b3ba22p+6f, 0x1.b3f158p+6f, 0x1.b42886p+6f, 0x1.b45ff8p+6f, 0x1.b497dep+6f, 0x1.b4cf18p+6f,
+       0x1.b50686p+6f, 0x1.b53e6cp+6f, 0x1.b54102p+6f, 0x1.b4ac18p+6f, 0x1.b40d78p+6f, 0x1.b36e5ep+6f,
+       0x1.b2cfeep+6f, 0x1.b2318cp+6f, 0x1.b1932ap+6f, 0x1.b0f48ap+6f, 0x1.b0556cp+6f, 0x1.afb6fcp+6f,
+       0x1.aef606p+6f, 0x1.adca0cp+6f, 0x1.ac964p+6f, 0x1.ab61f2p+6f, 0x1.aa2e54p+6f, 0x1.a8fac2p+6f,
+       0x1.a7c73p+6f, 0x1.a69364p+6f, 0x1.a55f14p+6f, 0x1.a42b74p+6f, 0x1.a37b3cp+6f, 0x1.a48092p+6f,
+       0x1.a5a8e8p+6f, 0x1.a6d13cp+6f, 0x1.a7f956p+6f, 0x1.a920fp+6f, 0x1.aa4934p+6f, 0x1.ab7188p+6f,
+       0x1.ac99dcp+6f, 0x1.adc23p+6f, 0x1.ae69ep+6f, 0x1.ad43d2p+6f, 0x1.abf3eap+6f, 0x1.aaa47ap+6f,
+       0x1.a95492p+6f, 0x1.a80556p+6f, 0x1.a6b5fcp+6f, 0x1.a56612p+6f, 0x1.a416a2p+6f, 0x1.a2c6b8p+6f,
+       0x1.a1b04ap+6f, 0x1.a175ap+6f, 0x1.a150d8p+6f, 0x1.a12c0ep+6f, 0x1.a10746p+6f, 0x1.a0e2acp+6f,
+       0x1.a0bea6p+6f, 0x1.a099fp+6f, 0x1.a07526p+6f, 0x1.a0505cp+6f, 0x1.9fe8acp+6f, 0x1.9e69d2p+6f,
+       0x1.9cccbap+6f, 0x1.9b2f26p+6f, 0x1.999214p+6f, 0x1.97f456p+6f, 0x1.9656acp+6f, 0x1.94b994p+6f,
+       0x1.931cp+6f, 0x1.917eecp+6f, 0x1.8fe7a8p+6f, 0x1.8e6d82p+6f, 0x1.8cf6eap+6f, 0x1.8b8062p+6f,
+       0x1.8a09ccp+6f, 0x1.889332p+6f, 0x1.871c9ap+6f, 0x1.85a604p+6f, 0x1.842f7ap+6f, 0x1.82b8e6p+6f,
+       0x1.817312p+6f, 0x1.811b78p+6f, 0x1.80e3a8p+6f, 0x1.80abcap+6f, 0x1.8073fcp+6f, 0x1.803c32p+6f,
+       0x1.800466p+6f, 0x1.7fcc98p+6f, 0x1.7f94bap+6f, 0x1.7f5cecp+6f, 0x1.7ec65ap+6f, 0x1.7c3a02p+6f,
+       0x1.79643ep+6f, 0x1.768e88p+6f, 0x1.73b8c4p+6f, 0x1.70e308p+6f, 0x1.6e0d5p+6f, 0x1.6b378ap+6f,
+       0x1.6861d4p+6f, 0x1.658c0ep+6f, 0x1.63268cp+6f, 0x1.634676p+6f, 0x1.63cd5ep+6f, 0x1.645454p+6f,
+       0x1.64db3ap+6f, 0x1.656234p+6f, 0x1.65e92cp+6f, 0x1.667016p+6f, 0x1.66f70ap+6f, 0x1.677dfp+6f,
+       0x1.67efc6p+6f, 0x1.67dd32p+6f, 0x1.67b39ep+6f, 0x1.678a08p+6f, 0x1.67606ep+6f, 0x1.6736c4p+6f,
+       0x1.670d2ap+6f, 0x1.66e392p+6f, 0x1.66b9fap+6f, 0x1.669066p+6f, 0x1.665618p+6f, 0x1.65a986p+6f,
+       0x1.64e74cp+6f, 0x1.64251ep+6f, 0x1.6362e6p+6f, 0x1.62a0bep+6f, 0x1.61de94p+6f, 0x1.611c5cp+6f,
+       0x1.605a2ep+6f, 0x1.5f97f6p+6f, 0x1.5ebc32p+6f, 0x1.5d20dp+6f, 0x1.5b5e32p+6f, 0x1.599b9p+6f,
+       0x1.57d8ecp+6f, 0x1.56163ap+6f, 0x1.545396p+6f, 0x1.5290f6p+6f, 0x1.50ce52p+6f, 0x1.4f0bb4p+6f,
+       0x1.4d75aep+6f, 0x1.4d4e6p+6f, 0x1.4d784ep+6f, 0x1.4da246p+6f, 0x1.4dcc32p+6f, 0x1.4df62ep+6f,
+       0x1.4e202cp+6f, 0x1.4e4a16p+6f, 0x1.4e741p+6f, 0x1.4e9df8p+6f, 0x1.4ea5dep+6f, 0x1.4d78b2p+6f,
+       0x1.4c0164p+6f, 0x1.4a8a26p+6f, 0x1.4912dep+6f, 0x1.479ba2p+6f, 0x1.46246ap+6f, 0x1.44ad1ep+6f,
+       0x1.4335ep+6f, 0x1.41be96p+6f, 0x1.406446p+6f, 0x1.402c68p+6f, 0x1.403f9cp+6f, 0x1.4052cp+6f,
+       0x1.4065eep+6f, 0x1.407924p+6f, 0x1.408c5ap+6f, 0x1.409f8ep+6f, 0x1.40b2b2p+6f, 0x1.40c5e4p+6f,
+       0x1.40e5a2p+6f, 0x1.419168p+6f, 0x1.426436p+6f, 0x1.433718p+6f, 0x1.4409eap+6f, 0x1.44dcb6p+6f,
+       0x1.45af84p+6f, 0x1.468254p+6f, 0x1.475534p+6f, 0x1.482806p+6f, 0x1.48d6f6p+6f, 0x1.47c57ap+6f,
+       0x1.462d7p+6f, 0x1.449558p+6f, 0x1.42fd4cp+6f, 0x1.416538p+6f, 0x1.3fcd18p+6f, 0x1.3e351p+6f,
+       0x1.3c9cf6p+6f, 0x1.3b04ecp+6f, 0x1.395512p+6f, 0x1.365646p+6f, 0x1.32eb4ap+6f, 0x1.2f804cp+6f,
+       0x1.2c155p+6f, 0x1.28aa56p+6f, 0x1.253f68p+6f, 0x1.21d472p+6f, 0x1.1e6974p+6f, 0x1.1afe78p+6f,
+       0x1.17c2ep+6f, 0x1.177c8cp+6f, 0x1.183d76p+6f, 0x1.18fe5p+6f, 0x1.19bf32p+6f, 0x1.1a801cp+6f,
+       0x1.1b410ap+6f, 0x1.1c01f8p+6f, 0x1.1cc2cep+6f, 0x1.1d83b2p+6f, 0x1.1e47f2p+6f, 0x1.1f4926p+6f,
+       0x1.206126p+6f, 0x1.21791cp+6f, 0x1.229118p+6f, 0x1.23a8fep+6f, 0x1.24c0f4p+6f, 0x1.25d8fp+6f,
+       0x1.26f0eap+6f, 0x1.2808e2p+6f, 0x1.28ed4cp+6f, 0x1.258db6p+6f, 0x1.20775ep+6f, 0x1.1b611p+6f,
+       0x1.164ac2p+6f, 0x1.113476p+6f, 0x1.0c1e28p+6f, 0x1.0707d2p+6f, 0x1.01f17cp+6f, 0x1.f9b65ep+5f,
+       0x1.efff6ep+5f, 0x1.f1af56p+5f, 0x1.f84bc8p+5f, 0x1.fee84cp+5f, 0x1.02c25ap+6f, 0x1.061096p+6f,
+       0x1.095ed8p+6f, 0x1.0cad1p+6f, 0x1.0ffb5ap+6f, 0x1.13498cp+6f, 0x1.1690ap+6f, 0x1.1905a4p+6f,
+       0x1.1b192ap+6f, 0x1.1d2caep+6f, 0x1.1f403p+6f, 0x1.2153a8p+6f, 0x1.236718p+6f, 0x1.257aa2p+6f,
+       0x1.278e24p+6f, 0x1.29a1a6p+6f, 0x1.2b95d8p+6f, 0x1.292ceep+6f, 0x1.249664p+6f, 0x1.1fffdap+6f,
+       0x1.1b6962p+6f, 0x1.16d2d8p+6f, 0x1.123c4ap+6f, 0x1.0da5d2p+6f, 0x1.090f52p+6f, 0x1.0478c8p+6f,
+       0x1.ffb3bap+5f, 0x1.f38d6ap+5f, 0x1.e5d79ep+5f, 0x1.d821a8p+5f, 0x1.ca6bdep+5f, 0x1.bcb602p+5f,
+       0x1.af001cp+5f, 0x1.a14a4p+5f, 0x1.93945ap+5f, 0x1.85de82p+5f, 0x1.787dd6p+5f, 0x1.7de82ep+5f,
+       0x1.8e2e86p+5f, 0x1.9e751ap+5f, 0x1.aebba4p+5f, 0x1.bf01fcp+5f, 0x1.cf4854p+5f, 0x1.df8eaap+5f,
+       0x1.efd542p+5f, 0x1.000de8p+6f, 0x1.081d3ep+6f, 0x1.0a5d2ep+6f, 0x1.08ff7ap+6f, 0x1.07a1cp+6f,
+       0x1.06440cp+6f, 0x1.04e652p+6f, 0x1.03888cp+6f, 0x1.022ad4p+6f, 0x1.00cd18p+6f, 0x1.fedecap+5f,
+       0x1.fc285cp+5f, 0x1.fb821cp+5f, 0x1.fc3e56p+5f, 0x1.fcfaacp+5f, 0x1.fdb6f8p+5f, 0x1.fe7332p+5f,
+       0x1.ff2f6ap+5f, 0x1.ffeba4p+5f, 0x1.0053fep+6f, 0x1.00b222p+6f, 0x1.010e1ep+6f, 0x1.001536p+6f,
+       0x1.fc4adp+5f, 0x1.f86b38p+5f, 0x1.f48ba8p+5f, 0x1.f0acp+5f, 0x1.eccc4ep+5f, 0x1.e8ecb8p+5f,
+       0x1.e50d1ep+5f, 0x1.e12d8ep+5f, 0x1.dd4ce2p+5f, 0x1.d83e0ep+5f, 0x1.d242c6p+5f, 0x1.cc477p+5f,
+       0x1.c64c26p+5f, 0x1.c050dcp+5f, 0x1.ba55a2p+5f, 0x1.b45a72p+5f, 0x1.ae5f1cp+5f, 0x1.a863d4p+5f,
+       0x1.a26aeep+5f, 0x1.a20be2p+5f, 0x1.a66c18p+5f, 0x1.aacc58p+5f, 0x1.af2c8cp+5f, 0x1.b38cc4p+5f,
+       0x1.b7ed2p+5f, 0x1.bc4d54p+5f, 0x1.c0ad94p+5f, 0x1.c50dcap+5f, 0x1.c96dep+5f, 0x1.ccb84ep+5f,
+       0x1.cf033cp+5f, 0x1.d14e2ep+5f, 0x1.d3992p+5f, 0x1.d5e3f2p+5f, 0x1.d82ecap+5f, 0x1.da79b6p+5f,
+       0x1.dcc4a8p+5f, 0x1.df0f9ap+5f, 0x1.e15a88p+5f}),
+    SpectrumT<471>({0x1.e5c114p-2f, 0x1.eb63p-2f, 0x1.f104c4p-2f, 0x1.f6a68ap-2f, 0x1.fc4876p-2f, 0x1.00f536p-1f,
+       0x1.03c62ap-1f, 0x1.069712p-1f, 0x1.0967f6p-1f, 0x1.0c38e8p-1f, 0x1.0d2aa8p-1f, 0x1.0c1358p-1f,
+       0x1.0afbcep-1f, 0x1.09e444p-1f, 0x1.08ccbcp-1f, 0x1.07b522p-1f, 0x1.069d98p-1f, 0x1.058612p-1f,
+       0x1.046e86p-1f, 0x1.0356fep-1f, 0x1.03dad6p-1f, 0x1.064408p-1f, 0x1.08ae04p-1f, 0x1.0b1812p-1f,
+       0x1.0d8212p-1f, 0x1.0fec0ep-1f, 0x1.12562p-1f, 0x1.14c03p-1f, 0x1.172a3p-1f, 0x1.19942cp-1f,
+       0x1.214c6ap-1f, 0x1.2fcb8cp-1f, 0x1.3e50f8p-1f, 0x1.4cd67ap-1f, 0x1.5b5beap-1f, 0x1.69e14ap-1f,
+       0x1.7866c8p-1f, 0x1.86ec46p-1f, 0x1.9571b6p-1f, 0x1.a3f726p-1f, 0x1.ae4c16p-1f, 0x1.b2d824p-1f,
+       0x1.b75aecp-1f, 0x1.bbddbap-1f, 0x1.c0607ep-1f, 0x1.c4e354p-1f, 0x1.c9663p-1f, 0x1.cde8fap-1f,
+       0x1.d26bc2p-1f, 0x1.d6ee86p-1f, 0x1.da0b04p-1f, 0x1.db1178p-1f, 0x1.dc12c8p-1f, 0x1.dd141ap-1f,
+       0x1.de157ap-1f, 0x1.df16dap-1f, 0x1.e0184p-1f, 0x1.e11992p-1f, 0x1.e21ae2p-1f, 0x1.e31c44p-1f,
+       0x1.e26806p-1f, 0x1.def4acp-1f, 0x1.db77fep-1f, 0x1.d7fb46p-1f, 0x1.d47e92p-1f, 0x1.d101ep-1f,
+       0x1.cd852ep-1f, 0x1.ca0876p-1f, 0x1.c68bc4p-1f, 0x1.c30f0ap-1f, 0x1.c43c9ep-1f, 0x1.cd7ceep-1f,
+       0x1.d6e1d2p-1f, 0x1.e046bap-1f, 0x1.e9ab92p-1f, 0x1.f31068p-1f, 0x1.fc7558p-1f, 0x1.02ed06p+0f,
+       0x1.079f7p+0f, 0x1.0c521ap+0f, 0x1.107adep+0f, 0x1.13a3b4p+0f, 0x1.16c6f6p+0f, 0x1.19e9dp+0f,
+       0x1.1d0ca2p+0f, 0x1.202faep+0f, 0x1.2352f6p+0f, 0x1.2675cep+0f, 0x1.2998d8p+0f, 0x1.2cbc1ap+0f,
+       0x1.2ee9d6p+0f, 0x1.2f2cb6p+0f, 0x1.2f620cp+0f, 0x1.2f972ep+0f, 0x1.2fcc86p+0f, 0x1.300172p+0f,
+       0x1.30368ep+0f, 0x1.306be4p+0f, 0x1.30a106p+0f, 0x1.30d65ep+0f, 0x1.30be7p+0f, 0x1.3000f8p+0f,
+       0x1.2f3de2p+0f, 0x1.2e7accp+0f, 0x1.2db782p+0f, 0x1.2cf3fap+0f, 0x1.2c30ep+0f, 0x1.2b6dcap+0f,
+       0x1.2aaab2p+0f, 0x1.29e79cp+0f, 0x1.297252p+0f, 0x1.29b128p+0f, 0x1.29f772p+0f, 0x1.2a3dfep+0f,
+       0x1.2a841ep+0f, 0x1.2aca36p+0f, 0x1.2b105p+0f, 0x1.2b5698p+0f, 0x1.2b9d26p+0f, 0x1.2be346p+0f,
+       0x1.2b938ep+0f, 0x1.29cef8p+0f, 0x1.27f898p+0f, 0x1.2621f6p+0f, 0x1.244bcp+0f, 0x1.22758cp+0f,
+       0x1.209f58p+0f, 0x1.1ec8fcp+0f, 0x1.1cf256p+0f, 0x1.1b1c1ep+0f, 0x1.19ca4cp+0f, 0x1.19dad6p+0f,
+       0x1.19ff02p+0f, 0x1.1a22bep+0f, 0x1.1a4674p+0f, 0x1.1a6a56p+0f, 0x1.1a8e82p+0f, 0x1.1ab24p+0f,
+       0x1.1ad62p+0f, 0x1.1afa4ep+0f, 0x1.1afbfap+0f, 0x1.1a9b9ap+0f, 0x1.1a34fp+0f, 0x1.19cdf8p+0f,
+       0x1.19677p+0f, 0x1.1900eep+0f, 0x1.189a6ep+0f, 0x1.1833c4p+0f, 0x1.17cccap+0f, 0x1.17664p+0f,
+       0x1.16e95ep+0f, 0x1.16273ap+0f, 0x1.156008p+0f, 0x1.14988p+0f, 0x1.13d16ap+0f, 0x1.130a5cp+0f,
+       0x1.12434ep+0f, 0x1.117c1ap+0f, 0x1.10b49p+0f, 0x1.0fed7ap+0f, 0x1.0f7b6ep+0f, 0x1.10249p+0f,
+       0x1.10e458p+0f, 0x1.11a42p+0f, 0x1.1263c2p+0f, 0x1.132312p+0f, 0x1.13e2cep+0f, 0x1.14a296p+0f,
+       0x1.15625ep+0f, 0x1.162224p+0f, 0x1.168eacp+0f, 0x1.15d05cp+0f, 0x1.14f6f8p+0f, 0x1.141dep+0f,
+       0x1.13447cp+0f, 0x1.126b86p+0f, 0x1.11927ep+0f, 0x1.10b918p+0f, 0x1.0fep+0f, 0x1.0f069ap+0f,
+       0x1.0e5268p+0f, 0x1.0e2c7p+0f, 0x1.0e14a2p+0f, 0x1.0dfcd4p+0f, 0x1.0de506p+0f, 0x1.0dcd56p+0f,
+       0x1.0db606p+0f, 0x1.0d9e44p+0f, 0x1.0d8674p+0f, 0x1.0d6ea4p+0f, 0x1.0d2b8ap+0f, 0x1.0c33c4p+0f,
+       0x1.0b286ap+0f, 0x1.0a1ccp+0f, 0x1.09116cp+0f, 0x1.0805a6p+0f, 0x1.06f9fp+0f, 0x1.05ee96p+0f,
+       0x1.04e2ecp+0f, 0x1.03d796p+0f, 0x1.02d002p+0f, 0x1.01db48p+0f, 0x1.00e8d8p+0f, 0x1.ffeceap-1f,
+       0x1.fe080ep-1f, 0x1.fc233p-1f, 0x1.fa3e52p-1f, 0x1.f85978p-1f, 0x1.f674aep-1f, 0x1.f48fd6p-1f,
+       0x1.f2ea18p-1f, 0x1.f278b4p-1f, 0x1.f23076p-1f, 0x1.f1e826p-1f, 0x1.f19feap-1f, 0x1.f157b4p-1f,
+       0x1.f10f7cp-1f, 0x1.f0c74p-1f, 0x1.f07efp-1f, 0x1.f036b4p-1f, 0x1.ef73dp-1f, 0x1.ec277p-1f,
+       0x1.e87c08p-1f, 0x1.e4d0bp-1f, 0x1.e12548p-1f, 0x1.dd79eap-1f, 0x1.d9ce9p-1f, 0x1.d62324p-1f,
+       0x1.d277cep-1f, 0x1.cecc62p-1f, 0x1.cbb246p-1f, 0x1.cbdb96p-1f, 0x1.cc8a34p-1f, 0x1.cd38e4p-1f,
+       0x1.cde78p-1f, 0x1.ce9636p-1f, 0x1.cf44eap-1f, 0x1.cff38ap-1f, 0x1.d0a238p-1f, 0x1.d150d4p-1f,
+       0x1.d1e42cp-1f, 0x1.d1cc2p-1f, 0x1.d1965p-1f, 0x1.d1607cp-1f, 0x1.d12aa2p-1f, 0x1.d0f4b4p-1f,
+       0x1.d0bedcp-1f, 0x1.d08906p-1f, 0x1.d0532ep-1f, 0x1.d01d5ep-1f, 0x1.cfd1e6p-1f, 0x1.cef286p-1f,
+       0x1.cdf72p-1f, 0x1.ccfbcap-1f, 0x1.cc0064p-1f, 0x1.cb0516p-1f, 0x1.ca09c4p-1f, 0x1.c90e6p-1f,
+       0x1.c81308p-1f, 0x1.c717a4p-1f, 0x1.c5fb2ep-1f, 0x1.c3e6b4p-1f, 0x1.c19f7p-1f, 0x1.bf5826p-1f,
+       0x1.bd10dap-1f, 0x1.bac97cp-1f, 0x1.b88232p-1f, 0x1.b63aeap-1f, 0x1.b3f39ep-1f, 0x1.b1ac5ap-1f,
+       0x1.af9edp-1f, 0x1.af6bfp-1f, 0x1.afa236p-1f, 0x1.afd888p-1f, 0x1.b00eccp-1f, 0x1.b04522p-1f,
+       0x1.b07b7ep-1f, 0x1.b0b1bep-1f, 0x1.b0e814p-1f, 0x1.b11e52p-1f, 0x1.b1288ap-1f, 0x1.afa2b6p-1f,
+       0x1.adbceep-1f, 0x1.abd73ap-1f, 0x1.a9f17ap-1f, 0x1.a80bc8p-1f, 0x1.a6261cp-1f, 0x1.a44056p-1f,
+       0x1.a25aa2p-1f, 0x1.a074ep-1f, 0x1.9eb49ep-1f, 0x1.9e6c4ep-1f, 0x1.9e8528p-1f, 0x1.9e9deep-1f,
+       0x1.9eb6c2p-1f, 0x1.9ecfap-1f, 0x1.9ee87ep-1f, 0x1.9f0158p-1f, 0x1.9f1a2p-1f, 0x1.9f32f8p-1f,
+       0x1.9f5c0ep-1f, 0x1.a03a64p-1f, 0x1.a14b4p-1f, 0x1.a25c36p-1f, 0x1.a36d18p-1f, 0x1.a47dfp-1f,
+       0x1.a58eccp-1f, 0x1.a69facp-1f, 0x1.a7b09ep-1f, 0x1.a8c18p-1f, 0x1.a9a3fp-1f, 0x1.a841f2p-1f,
+       0x1.a631cap-1f, 0x1.a4219p-1f, 0x1.a21166p-1f, 0x1.a00132p-1f, 0x1.9df0eep-1f, 0x1.9be0cap-1f,
+       0x1.99d08ep-1f, 0x1.97c066p-1f, 0x1.95916cp-1f, 0x1.91b0e8p-1f, 0x1.8d445ap-1f, 0x1.88d7cap-1f,
+       0x1.846b3cp-1f, 0x1.7ffebp-1f, 0x1.7b9236p-1f, 0x1.7725aep-1f, 0x1.72b91ep-1f, 0x1.6e4c9p-1f,
+       0x1.6a1d5ap-1f, 0x1.69c252p-1f, 0x1.6abc06p-1f, 0x1.6bb5a6p-1f, 0x1.6caf4ep-1f, 0x1.6da902p-1f,
+       0x1.6ea2bcp-1f, 0x1.6f9c74p-1f, 0x1.70960ep-1f, 0x1.718fbap-1f, 0x1.728dcp-1f, 0x1.73daaap-1f,
+       0x1.754516p-1f, 0x1.76af76p-1f, 0x1.7819dep-1f, 0x1.798428p-1f, 0x1.7aee88p-1f, 0x1.7c58eep-1f,
+       0x1.7dc354p-1f, 0x1.7f2db6p-1f, 0x1.80555cp-1f, 0x1.7bf79p-1f, 0x1.7561d8p-1f, 0x1.6ecc2ep-1f,
+       0x1.683684p-1f, 0x1.61a0dep-1f, 0x1.5b0b32p-1f, 0x1.54757ep-1f, 0x1.4ddfcap-1f, 0x1.474a2p-1f,
+       0x1.41009ep-1f, 0x1.421824p-1f, 0x1.465f78p-1f, 0x1.4aa6d6p-1f, 0x1.4eee24p-1f, 0x1.53357cp-1f,
+       0x1.577cdap-1f, 0x1.5bc42cp-1f, 0x1.600b96p-1f, 0x1.6452ep-1f, 0x1.6890f4p-1f, 0x1.6bbf22p-1f,
+       0x1.6e6f1ep-1f, 0x1.711f18p-1f, 0x1.73cf1p-1f, 0x1.767efcp-1f, 0x1.792edcp-1f, 0x1.7bdedep-1f,
+       0x1.7e8ed6p-1f, 0x1.813ecep-1f, 0x1.83c63ep-1f, 0x1.80a7bap-1f, 0x1.7ab77p-1f, 0x1.74c726p-1f,
+       0x1.6ed6f4p-1f, 0x1.68e6aap-1f, 0x1.62f65ap-1f, 0x1.5d0628p-1f, 0x1.5715ecp-1f, 0x1.5125a2p-1f,
+       0x1.4b2a8p-1f, 0x1.434d8cp-1f, 0x1.3a6e1p-1f, 0x1.318e76p-1f, 0x1.28aefcp-1f, 0x1.1fcf74p-1f,
+       0x1.16efe6p-1f, 0x1.0e105ep-1f, 0x1.0530dp-1f, 0x1.f8a298p-2f, 0x1.e751ccp-2f, 0x1.ee543ep-2f,
+       0x1.01b284p-1f, 0x1.0c3b1p-1f, 0x1.16c396p-1f, 0x1.214bfcp-1f, 0x1.2bd46p-1f, 0x1.365cc4p-1f,
+       0x1.40e554p-1f, 0x1.4b6ddcp-1f, 0x1.55dc94p-1f, 0x1.58c60ep-1f, 0x1.57016ap-1f, 0x1.553cbcp-1f,
+       0x1.537818p-1f, 0x1.51b36ap-1f, 0x1.4feeaep-1f, 0x1.4e2a04p-1f, 0x1.4c6554p-1f, 0x1.4aa0bp-1f,
+       0x1.48df42p-1f, 0x1.4873aap-1f, 0x1.48ed7cp-1f, 0x1.49676p-1f, 0x1.49e13cp-1f, 0x1.4a5b0ep-1f,
+       0x1.4ad4dep-1f, 0x1.4b4eaep-1f, 0x1.4bc894p-1f, 0x1.4c426ep-1f, 0x1.4cb97ep-1f, 0x1.4b775p-1f,
+       0x1.48f59p-1f, 0x1.4673dp-1f, 0x1.43f218p-1f, 0x1.41704ep-1f, 0x1.3eee7ep-1f, 0x1.3c6cc2p-1f,
+       0x1.39eb02p-1f, 0x1.376948p-1f, 0x1.34e6d6p-1f, 0x1.31a0d8p-1f, 0x1.2dc1d2p-1f, 0x1.29e2c4p-1f,
+       0x1.2603bcp-1f, 0x1.2224b6p-1f, 0x1.1e45b8p-1f, 0x1.1a66c2p-1f, 0x1.1687b4p-1f, 0x1.12a8aep-1f,
+       0x1.0ecb32p-1f, 0x1.0e8dbp-1f, 0x1.1162acp-1f, 0x1.1437aep-1f, 0x1.170ca8p-1f, 0x1.19e1a6p-1f,
+       0x1.1cb6bap-1f, 0x1.1f8bb4p-1f, 0x1.2260b6p-1f, 0x1.2535b2p-1f, 0x1.280a9ap-1f, 0x1.2a2bdp-1f,
+       0x1.2ba7aap-1f, 0x1.2d2386p-1f, 0x1.2e9f62p-1f, 0x1.301b2ap-1f, 0x1.3196f6p-1f, 0x1.3312dp-1f,
+       0x1.348eacp-1f, 0x1.360a8ap-1f, 0x1.378664p-1f}),
+    {
+    SpectrumT<471>({0x1.0fd868p+0f, 0x1.0fd868p+0f, 0x1.0fd868p+0f, 0x1.0fd868p+0f, 0x1.0fd868p+0f, 0x1.0fd868p+0f,
+       0x1.0fd868p+0f, 0x1.0fd868p+0f, 0x1.0fd868p+0f, 0x1.0fd868p+0f, 0x1.0fd868p+0f, 0x1.0fd868p+0f,
+       0x1.0fd868p+0f, 0x1.0fd868p+0f, 0x1.0fd868p+0f, 0x1.0fd868p+0f, 0x1.0fd868p+0f, 0x1.0fd868p+0f,
+       0x1.0fd868p+0f, 0x1.0fd868p+0f, 0x1.0fd754p+0f, 0x1.0fd4fcp+0f, 0x1.0fd2a4p+0f, 0x1.0fd048p+0f,
+       0x1.0fcdfp+0f, 0x1.0fcb96p+0f, 0x1.0fc93ep+0f, 0x1.0fc6e4p+0f, 0x1.0fc48cp+0f, 0x1.0fc232p+0f,
+       0x1.0fbfd8p+0f, 0x1.0fbe66p+0f, 0x1.0fbdfep+0f, 0x1.0fbd96p+0f, 0x1.0fbd2ep+0f, 0x1.0fbcc6p+0f,
+       0x1.0fbc5cp+0f, 0x1.0fbbf4p+0f, 0x1.0fbb8cp+0f, 0x1.0fbb24p+0f, 0x1.0fbabcp+0f, 0x1.0fba54p+0f,
+       0x1.0fbc7ep+0f, 0x1.0fc17ap+0f, 0x1.0fc678p+0f, 0x1.0fcb78p+0f, 0x1.0fd074p+0f, 0x1.0fd574p+0f,
+       0x1.0fda74p+0f, 0x1.0fdf7p+0f, 0x1.0fe47p+0f, 0x1.0fe96ep+0f, 0x1.0fee6cp+0f, 0x1.0ff0ccp+0f,
+       0x1.0ff068p+0f, 0x1.0ffp+0f, 0x1.0fef98p+0f, 0x1.0fef32p+0f, 0x1.0feeccp+0f, 0x1.0fee64p+0f,
+       0x1.0fedfcp+0f, 0x1.0fed96p+0f, 0x1.0fed3p+0f, 0x1.0fecc8p+0f, 0x1.0fed76p+0f, 0x1.0fef44p+0f,
+       0x1.0ff112p+0f, 0x1.0ff2ep+0f, 0x1.0ff4acp+0f, 0x1.0ff67cp+0f, 0x1.0ff848p+0f, 0x1.0ffa14p+0f,
+       0x1.0ffbe4p+0f, 0x1.0ffdbp+0f, 0x1.0fff7ep+0f, 0x1.10000ep+0f, 0x1.0fff64p+0f, 0x1.0ffeb8p+0f,
+       0x1.0ffe0cp+0f, 0x1.0ffd64p+0f, 0x1.0ffcb8p+0f, 0x1.0ffc0cp+0f, 0x1.0ffb6p+0f, 0x1.0ffab6p+0f,
+       0x1.0ffa0ap+0f, 0x1.0ff95ep+0f, 0x1.0ff948p+0f, 0x1.0ff9bcp+0f, 0x1.0ffa32p+0f, 0x1.0ffaa8p+0f,
+       0x1.0ffb1cp+0f, 0x1.0ffb9p+0f, 0x1.0ffc08p+0f, 0x1.0ffc7cp+0f, 0x1.0ffcfp+0f, 0x1.0ffd68p+0f,
+       0x1.0ffddcp+0f, 0x1.0ffe3p+0f, 0x1.0ffe62p+0f, 0x1.0ffe98p+0f, 0x1.0ffeccp+0f, 0x1.0fffp+0f,
+       0x1.0fff34p+0f, 0x1.0fff68p+0f, 0x1.0fff9cp+0f, 0x1.0fffdp+0f, 0x1.100004p+0f, 0x1.100038p+0f,
+       0x1.100018p+0f, 0x1.0fffbp+0f, 0x1.0fff48p+0f, 0x1.0ffeep+0f, 0x1.0ffe78p+0f, 0x1.0ffe1p+0f,
+       0x1.0ffda8p+0f, 0x1.0ffd4p+0f, 0x1.0ffcd8p+0f, 0x1.0ffc7p+0f, 0x1.0ffc08p+0f, 0x1.0ffaaap+0f,
+       0x1.0ff87ap+0f, 0x1.0ff648p+0f, 0x1.0ff418p+0f, 0x1.0ff1e8p+0f, 0x1.0fefb8p+0f, 0x1.0fed88p+0f,
+       0x1.0feb58p+0f, 0x1.0fe928p+0f, 0x1.0fe6f6p+0f, 0x1.0fe4c6p+0f, 0x1.0fe154p+0f, 0x1.0fdcd8p+0f,
+       0x1.0fd85ap+0f, 0x1.0fd3dep+0f, 0x1.0fcf6p+0f, 0x1.0fcae4p+0f, 0x1.0fc666p+0f, 0x1.0fc1e8p+0f,
+       0x1.0fbd6cp+0f, 0x1.0fb8fp+0f, 0x1.0fb476p+0f, 0x1.0fb184p+0f, 0x1.0fafd4p+0f, 0x1.0fae22p+0f,
+       0x1.0fac72p+0f, 0x1.0faac2p+0f, 0x1.0fa912p+0f, 0x1.0fa76p+0f, 0x1.0fa5bp+0f, 0x1.0fa4p+0f,
+       0x1.0fa25p+0f, 0x1.0fa0ap+0f, 0x1.0fa112p+0f, 0x1.0fa32ep+0f, 0x1.0fa54ap+0f, 0x1.0fa766p+0f,
+       0x1.0fa98p+0f, 0x1.0fab9cp+0f, 0x1.0fadb8p+0f, 0x1.0fafd4p+0f, 0x1.0fb1fp+0f, 0x1.0fb40ap+0f,
+       0x1.0fb626p+0f, 0x1.0fb72ap+0f, 0x1.0fb76p+0f, 0x1.0fb794p+0f, 0x1.0fb7c8p+0f, 0x1.0fb7fep+0f,
+       0x1.0fb834p+0f, 0x1.0fb868p+0f, 0x1.0fb89cp+0f, 0x1.0fb8d2p+0f, 0x1.0fb908p+0f, 0x1.0fb93ep+0f,
+       0x1.0fbb72p+0f, 0x1.0fbf18p+0f, 0x1.0fc2cp+0f, 0x1.0fc666p+0f, 0x1.0fca0cp+0f, 0x1.0fcdb4p+0f,
+       0x1.0fd158p+0f, 0x1.0fd5p+0f, 0x1.0fd8a4p+0f, 0x1.0fdc4cp+0f, 0x1.0fdff2p+0f, 0x1.0fe342p+0f,
+       0x1.0fe656p+0f, 0x1.0fe96ap+0f, 0x1.0fec7cp+0f, 0x1.0fef9p+0f, 0x1.0ff2a4p+0f, 0x1.0ff5b8p+0f,
+       0x1.0ff8ccp+0f, 0x1.0ffbep+0f, 0x1.0ffef4p+0f, 0x1.100204p+0f, 0x1.1002d6p+0f, 0x1.100222p+0f,
+       0x1.10016ep+0f, 0x1.1000bap+0f, 0x1.100006p+0f, 0x1.0fff52p+0f, 0x1.0ffe9ep+0f, 0x1.0ffde8p+0f,
+       0x1.0ffd34p+0f, 0x1.0ffc8p+0f, 0x1.0ffbcep+0f, 0x1.0ffbdcp+0f, 0x1.0ffc6cp+0f, 0x1.0ffcf8p+0f,
+       0x1.0ffd88p+0f, 0x1.0ffe14p+0f, 0x1.0ffea4p+0f, 0x1.0fff34p+0f, 0x1.0fffcp+0f, 0x1.10005p+0f,
+       0x1.1000dcp+0f, 0x1.10016ap+0f, 0x1.100146p+0f, 0x1.1000b2p+0f, 0x1.10001ep+0f, 0x1.0fff8ap+0f,
+       0x1.0ffef6p+0f, 0x1.0ffe6p+0f, 0x1.0ffdccp+0f, 0x1.0ffd38p+0f, 0x1.0ffca4p+0f, 0x1.0ffc1p+0f,
+       0x1.0ffb7cp+0f, 0x1.0ffb7p+0f, 0x1.0ffbbap+0f, 0x1.0ffc02p+0f, 0x1.0ffc4ap+0f, 0x1.0ffc92p+0f,
+       0x1.0ffcdap+0f, 0x1.0ffd22p+0f, 0x1.0ffd6ap+0f, 0x1.0ffdb2p+0f, 0x1.0ffdfap+0f, 0x1.0ffe42p+0f,
+       0x1.0ffea8p+0f, 0x1.0fff22p+0f, 0x1.0fff9ap+0f, 0x1.100012p+0f, 0x1.10008ap+0f, 0x1.100104p+0f,
+       0x1.10017cp+0f, 0x1.1001f4p+0f, 0x1.10026cp+0f, 0x1.1002e4p+0f, 0x1.10035cp+0f, 0x1.100374p+0f,
+       0x1.100354p+0f, 0x1.100332p+0f, 0x1.100312p+0f, 0x1.1002fp+0f, 0x1.1002dp+0f, 0x1.1002bp+0f,
+       0x1.10029p+0f, 0x1.10027p+0f, 0x1.10025p+0f, 0x1.10022ep+0f, 0x1.100198p+0f, 0x1.1000cp+0f,
+       0x1.0fffecp+0f, 0x1.0fff14p+0f, 0x1.0ffe3ep+0f, 0x1.0ffd68p+0f, 0x1.0ffc92p+0f, 0x1.0ffbbcp+0f,
+       0x1.0ffae4p+0f, 0x1.0ffa1p+0f, 0x1.0ff93ap+0f, 0x1.0ff8d4p+0f, 0x1.0ff8acp+0f, 0x1.0ff882p+0f,
+       0x1.0ff858p+0f, 0x1.0ff83p+0f, 0x1.0ff804p+0f, 0x1.0ff7dcp+0f, 0x1.0ff7b2p+0f, 0x1.0ff788p+0f,
+       0x1.0ff76p+0f, 0x1.0ff738p+0f, 0x1.0ff7ccp+0f, 0x1.0ff8cp+0f, 0x1.0ff9b8p+0f, 0x1.0ffaacp+0f,
+       0x1.0ffbap+0f, 0x1.0ffc96p+0f, 0x1.0ffd8cp+0f, 0x1.0ffe8p+0f, 0x1.0fff74p+0f, 0x1.10006ap+0f,
+       0x1.10013ap+0f, 0x1.0ffc68p+0f, 0x1.0ff4acp+0f, 0x1.0fecfp+0f, 0x1.0fe532p+0f, 0x1.0fdd74p+0f,
+       0x1.0fd5b8p+0f, 0x1.0fcdfcp+0f, 0x1.0fc63ep+0f, 0x1.0fbe8p+0f, 0x1.0fb6c4p+0f, 0x1.0faefap+0f,
+       0x1.0fa538p+0f, 0x1.0f9a78p+0f, 0x1.0f8fbcp+0f, 0x1.0f84fcp+0f, 0x1.0f7a4p+0f, 0x1.0f6f82p+0f,
+       0x1.0f64c4p+0f, 0x1.0f5a06p+0f, 0x1.0f4f48p+0f, 0x1.0f448ap+0f, 0x1.0f3a12p+0f, 0x1.0f38ep+0f,
+       0x1.0f3c2ep+0f, 0x1.0f3f7cp+0f, 0x1.0f42ccp+0f, 0x1.0f461cp+0f, 0x1.0f496ap+0f, 0x1.0f4cb8p+0f,
+       0x1.0f5008p+0f, 0x1.0f5358p+0f, 0x1.0f56a4p+0f, 0x1.0f59ecp+0f, 0x1.0f5c14p+0f, 0x1.0f5db4p+0f,
+       0x1.0f5f58p+0f, 0x1.0f60f8p+0f, 0x1.0f629ap+0f, 0x1.0f643cp+0f, 0x1.0f65dcp+0f, 0x1.0f678p+0f,
+       0x1.0f692p+0f, 0x1.0f6ac2p+0f, 0x1.0f6c58p+0f, 0x1.0f6c4ep+0f, 0x1.0f6b8ap+0f, 0x1.0f6ac6p+0f,
+       0x1.0f6a02p+0f, 0x1.0f693ep+0f, 0x1.0f687ap+0f, 0x1.0f67b6p+0f, 0x1.0f66f2p+0f, 0x1.0f662ep+0f,
+       0x1.0f656ap+0f, 0x1.0f64cp+0f, 0x1.0f66bcp+0f, 0x1.0f69e4p+0f, 0x1.0f6d0ep+0f, 0x1.0f7038p+0f,
+       0x1.0f736p+0f, 0x1.0f7688p+0f, 0x1.0f79b4p+0f, 0x1.0f7cdcp+0f, 0x1.0f8004p+0f, 0x1.0f833p+0f,
+       0x1.0f8644p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f,
+       0x1.0f873p+0f, 0x1.0f873p+0f, 0x1.0f873p+0f}),
+    SpectrumT<471>({0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f,
+       0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f,
+       0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f,
+       0x1.0a9d4ep+0f, 0x1.0a9d4ep+0f, 0x1.0a85dp+0f, 0x1.0a5298p+0f, 0x1.0a1f58p+0f, 0x1.09ec14p+0f,
+       0x1.09b8d2p+0f, 0x1.09859p+0f, 0x1.09524cp+0f, 0x1.091f0cp+0f, 0x1.08ebc8p+0f, 0x1.08b888p+0f,
+       0x1.088544p+0f, 0x1.08318ep+0f, 0x1.07b8d8p+0f, 0x1.074018p+0f, 0x1.06c758p+0f, 0x1.064e98p+0f,
+       0x1.05d5d6p+0f, 0x1.055d14p+0f, 0x1.04e454p+0f, 0x1.046b94p+0f, 0x1.03f2d4p+0f, 0x1.037a12p+0f,
+       0x1.037a5cp+0f, 0x1.040008p+0f, 0x1.0485c8p+0f, 0x1.050b88p+0f, 0x1.05914ap+0f, 0x1.06170ap+0f,
+       0x1.069ccap+0f, 0x1.07228ap+0f, 0x1.07a84ap+0f, 0x1.082e0ap+0f, 0x1.08b3ccp+0f, 0x1.08aa46p+0f,
+       0x1.08083ep+0f, 0x1.07662ep+0f, 0x1.06c41ep+0f, 0x1.06220cp+0f, 0x1.057ffcp+0f, 0x1.04ddeap+0f,
+       0x1.043bdap+0f, 0x1.0399cap+0f, 0x1.02f7bap+0f, 0x1.0255aap+0f, 0x1.02688ep+0f, 0x1.03357p+0f,
+       0x1.040254p+0f, 0x1.04cf38p+0f, 0x1.059c1ap+0f, 0x1.0668fep+0f, 0x1.0735ep+0f, 0x1.0802c4p+0f,
+       0x1.08cfa8p+0f, 0x1.099c8cp+0f, 0x1.0a696ep+0f, 0x1.0ad588p+0f, 0x1.0ae1a8p+0f, 0x1.0aedc4p+0f,
+       0x1.0af9ep+0f, 0x1.0b05fep+0f, 0x1.0b121cp+0f, 0x1.0b1e38p+0f, 0x1.0b2a54p+0f, 0x1.0b3674p+0f,
+       0x1.0b429p+0f, 0x1.0b4eaep+0f, 0x1.0b70d4p+0f, 0x1.0ba81p+0f, 0x1.0bdf4ep+0f, 0x1.0c168ap+0f,
+       0x1.0c4dc8p+0f, 0x1.0c8504p+0f, 0x1.0cbc44p+0f, 0x1.0cf38p+0f, 0x1.0d2abcp+0f, 0x1.0d61f8p+0f,
+       0x1.0d992ap+0f, 0x1.0d45dap+0f, 0x1.0c728p+0f, 0x1.0b9f26p+0f, 0x1.0acbccp+0f, 0x1.09f87p+0f,
+       0x1.092514p+0f, 0x1.0851bcp+0f, 0x1.077e6p+0f, 0x1.06ab08p+0f, 0x1.05d7acp+0f, 0x1.050478p+0f,
+       0x1.04f356p+0f, 0x1.058f88p+0f, 0x1.062bb8p+0f, 0x1.06c7ecp+0f, 0x1.07641cp+0f, 0x1.08004ep+0f,
+       0x1.089c8p+0f, 0x1.0938bp+0f, 0x1.09d4e4p+0f, 0x1.0a7114p+0f, 0x1.0b0d34p+0f, 0x1.0b714p+0f,
+       0x1.0ba4e8p+0f, 0x1.0bd89p+0f, 0x1.0c0c38p+0f, 0x1.0c3fep+0f, 0x1.0c7388p+0f, 0x1.0ca73p+0f,
+       0x1.0cdad8p+0f, 0x1.0d0e8p+0f, 0x1.0d4228p+0f, 0x1.0d75c2p+0f, 0x1.0d8fbap+0f, 0x1.0d944cp+0f,
+       0x1.0d98ep+0f, 0x1.0d9d74p+0f, 0x1.0da208p+0f, 0x1.0da69ap+0f, 0x1.0dab2cp+0f, 0x1.0dafcp+0f,
+       0x1.0db454p+0f, 0x1.0db8e6p+0f, 0x1.0dbd76p+0f, 0x1.0dbe78p+0f, 0x1.0dbc9ap+0f, 0x1.0dbabcp+0f,
+       0x1.0db8dcp+0f, 0x1.0db7p+0f, 0x1.0db522p+0f, 0x1.0db344p+0f, 0x1.0db164p+0f, 0x1.0daf88p+0f,
+       0x1.0dada8p+0f, 0x1.0dabccp+0f, 0x1.0dac48p+0f, 0x1.0dae98p+0f, 0x1.0db0e8p+0f, 0x1.0db33ap+0f,
+       0x1.0db58ap+0f, 0x1.0db7dcp+0f, 0x1.0dba2cp+0f, 0x1.0dbc7cp+0f, 0x1.0dbeccp+0f, 0x1.0dc11cp+0f,
+       0x1.0dc366p+0f, 0x1.0dc0c2p+0f, 0x1.0dba62p+0f, 0x1.0db402p+0f, 0x1.0dada2p+0f, 0x1.0da744p+0f,
+       0x1.0da0e4p+0f, 0x1.0d9a84p+0f, 0x1.0d9424p+0f, 0x1.0d8dc4p+0f, 0x1.0d8764p+0f, 0x1.0d810cp+0f,
+       0x1.0d7f86p+0f, 0x1.0d8186p+0f, 0x1.0d8386p+0f, 0x1.0d8588p+0f, 0x1.0d8788p+0f, 0x1.0d8988p+0f,
+       0x1.0d8b88p+0f, 0x1.0d8d88p+0f, 0x1.0d8f88p+0f, 0x1.0d9188p+0f, 0x1.0d9392p+0f, 0x1.0d9b7p+0f,
+       0x1.0da76ep+0f, 0x1.0db36cp+0f, 0x1.0dbf68p+0f, 0x1.0dcb64p+0f, 0x1.0dd762p+0f, 0x1.0de36p+0f,
+       0x1.0def5cp+0f, 0x1.0dfb58p+0f, 0x1.0e0756p+0f, 0x1.0e1344p+0f, 0x1.0e193cp+0f, 0x1.0e1b18p+0f,
+       0x1.0e1cf4p+0f, 0x1.0e1edp+0f, 0x1.0e20acp+0f, 0x1.0e2288p+0f, 0x1.0e2464p+0f, 0x1.0e264p+0f,
+       0x1.0e281cp+0f, 0x1.0e29f8p+0f, 0x1.0e2b76p+0f, 0x1.0e0874p+0f, 0x1.0dcd34p+0f, 0x1.0d91f6p+0f,
+       0x1.0d56b6p+0f, 0x1.0d1b76p+0f, 0x1.0ce036p+0f, 0x1.0ca4f6p+0f, 0x1.0c69b6p+0f, 0x1.0c2e76p+0f,
+       0x1.0bf336p+0f, 0x1.0ba6ccp+0f, 0x1.058df4p+0f, 0x1.f7742ep-1f, 0x1.e3cc4cp-1f, 0x1.d0246cp-1f,
+       0x1.bc7cb4p-1f, 0x1.a8d4f8p-1f, 0x1.952d3cp-1f, 0x1.81855cp-1f, 0x1.6ddd7ap-1f, 0x1.5a35cp-1f,
+       0x1.468bfcp-1f, 0x1.3247fcp-1f, 0x1.1da3acp-1f, 0x1.08ff5ap-1f, 0x1.e8b666p-2f, 0x1.bf6e16p-2f,
+       0x1.9625c8p-2f, 0x1.6cdd28p-2f, 0x1.439486p-2f, 0x1.1a4c36p-2f, 0x1.e207cep-3f, 0x1.8fe7ep-3f,
+       0x1.5b2284p-3f, 0x1.3819f8p-3f, 0x1.1511b2p-3f, 0x1.e4125p-4f, 0x1.9e01c6p-4f, 0x1.57f13cp-4f,
+       0x1.11e026p-4f, 0x1.979f3cp-5f, 0x1.0b7d12p-5f, 0x1.fd6ff6p-7f, -0x1.679106p-10f, -0x1.d74ce4p-8f,
+       -0x1.aab5fcp-8f, -0x1.7e1ebep-8f, -0x1.5187d8p-8f, -0x1.24f0fp-8f, -0x1.f0b364p-9f, -0x1.978598p-9f,
+       -0x1.3e571ap-9f, -0x1.ca5136p-10f, -0x1.17f5ap-10f, -0x1.a731acp-12f, -0x1.3555a4p-11f, -0x1.4a2a3p-10f,
+       -0x1.f9a98cp-10f, -0x1.5493c4p-9f, -0x1.ac52c4p-9f, -0x1.02093ap-8f, -0x1.2de91p-8f, -0x1.59c89p-8f,
+       -0x1.85a81p-8f, -0x1.b1879p-8f, -0x1.dc65ecp-8f, -0x1.d71516p-8f, -0x1.b73ef6p-8f, -0x1.9768d6p-8f,
+       -0x1.7792b4p-8f, -0x1.57bc54p-8f, -0x1.37e5f2p-8f, -0x1.180fd2p-8f, -0x1.f07364p-9f, -0x1.b0c722p-9f,
+       -0x1.711a6p-9f, -0x1.31dedap-9f, -0x1.05dccp-9f, -0x1.c83a06p-10f, -0x1.84ba8cp-10f, -0x1.413a8cp-10f,
+       -0x1.fb7518p-11f, -0x1.747626p-11f, -0x1.daee64p-12f, -0x1.99e0f8p-13f, 0x1.043e28p-14f, 0x1.4f0f8ap-12f,
+       0x1.35624ep-11f, 0x1.6980b2p-10f, 0x1.3f5148p-9f, 0x1.c9e234p-9f, 0x1.2a3a1cp-8f, 0x1.6f8294p-8f,
+       0x1.b4cb94p-8f, 0x1.fa1496p-8f, 0x1.1fae86p-7f, 0x1.425308p-7f, 0x1.64f744p-7f, 0x1.861558p-7f,
+       0x1.6fe96p-7f, 0x1.3dfcc8p-7f, 0x1.0c0fcep-7f, 0x1.b4466ep-8f, 0x1.506d44p-8f, 0x1.d926ap-9f,
+       0x1.117444p-9f, 0x1.270162p-11f, -0x1.f7c8p-11f, -0x1.45a458p-9f, -0x1.022808p-8f, -0x1.959be8p-9f,
+       -0x1.285986p-10f, 0x1.b50178p-11f, 0x1.6ead8p-9f, 0x1.380e54p-8f, 0x1.b8c4e6p-8f, 0x1.1cbe3cp-7f,
+       0x1.5d1984p-7f, 0x1.9d74ccp-7f, 0x1.ddd096p-7f, 0x1.0dffcap-6f, 0x1.0b9fp-6f, 0x1.f2dfdp-7f,
+       0x1.ce81ap-7f, 0x1.aa22ep-7f, 0x1.85c468p-7f, 0x1.61663ap-7f, 0x1.3d0854p-7f, 0x1.18aa24p-7f,
+       0x1.e896c4p-8f, 0x1.9fd9d4p-8f, 0x1.58f4fp-8f, 0x1.46977p-8f, 0x1.4c4974p-8f, 0x1.51fb8ep-8f,
+       0x1.57ad9ep-8f, 0x1.5d5fa2p-8f, 0x1.6311a6p-8f, 0x1.68c3aap-8f, 0x1.6e75b8p-8f, 0x1.7427c8p-8f,
+       0x1.79d9ccp-8f, 0x1.8257d6p-8f, 0x1.d4f82ap-8f, 0x1.244536p-7f, 0x1.5e0e56p-7f, 0x1.97d704p-7f,
+       0x1.d19fbp-7f, 0x1.05b42ep-6f, 0x1.229886p-6f, 0x1.3f7d16p-6f, 0x1.5c61a6p-6f, 0x1.7945fcp-6f,
+       0x1.955fcap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f,
+       0x1.9dd99ap-6f, 0x1.9dd99ap-6f, 0x1.9dd99ap-6f}),
+    SpectrumT<471>({0x1.fd0a96p-1f, 0x1.fd0a96p-1f, 0x1.fd0a96p-1f, 0x1.fd0a96p-1f, 0x1.fd0a96p-1f, 0x1.fd0a96p-1f,
+       0x1.fd0a96p-1f, 0x1.fd0a96p-1f, 0x1.fd0a96p-1f, 0x1.fd0a96p-1f, 0x1.fd0a96p-1f, 0x1.fd0a96p-1f,
+       0x1.fd0a96p-1f, 0x1.fd0a96p-1f, 0x1.fd0a96p-1f, 0x1.fd0a96p-1f, 0x1.fd0a96p-1f, 0x1.fd0a96p-1f,
+       0x1.fd0a96p-1f, 0x1.fd0a96p-1f, 0x1.fcf2ccp-1f, 0x1.fcbef4p-1f, 0x1.fc8b0cp-1f, 0x1.fc5724p-1f,
+       0x1.fc233ep-1f, 0x1.fbef58p-1f, 0x1.fbbb74p-1f, 0x1.fb878cp-1f, 0x1.fb53a8p-1f, 0x1.fb1fcp-1f,
+       0x1.faebdap-1f, 0x1.faa994p-1f, 0x1.fa56ecp-1f, 0x1.fa044p-1f, 0x1.f9b194p-1f, 0x1.f95ee8p-1f,
+       0x1.f90c38p-1f, 0x1.f8b98cp-1f, 0x1.f866dep-1f, 0x1.f8143p-1f, 0x1.f7c184p-1f, 0x1.f76ed8p-1f,
+       0x1.f78f28p-1f, 0x1.f82e32p-1f, 0x1.f8cd4cp-1f, 0x1.f96c68p-1f, 0x1.fa0b84p-1f, 0x1.faaaap-1f,
+       0x1.fb49bep-1f, 0x1.fbe8d8p-1f, 0x1.fc87f4p-1f, 0x1.fd271p-1f, 0x1.fdc62cp-1f, 0x1.fea0a2p-1f,
+       0x1.ffba4p-1f, 0x1.0069fp+0f, 0x1.00f6c4p+0f, 0x1.018396p+0f, 0x1.021068p+0f, 0x1.029d38p+0f,
+       0x1.032a0ap+0f, 0x1.03b6dcp+0f, 0x1.0443acp+0f, 0x1.04d08p+0f, 0x1.050e4cp+0f, 0x1.04fae4p+0f,
+       0x1.04e778p+0f, 0x1.04d41p+0f, 0x1.04c0a4p+0f, 0x1.04ad3cp+0f, 0x1.0499dp+0f, 0x1.048668p+0f,
+       0x1.0472fcp+0f, 0x1.045f94p+0f, 0x1.044c28p+0f, 0x1.0452dp+0f, 0x1.04735p+0f, 0x1.0493d4p+0f,
+       0x1.04b454p+0f, 0x1.04d4d8p+0f, 0x1.04f558p+0f, 0x1.0515d8p+0f, 0x1.05365cp+0f, 0x1.0556dcp+0f,
+       0x1.05776p+0f, 0x1.0597dep+0f, 0x1.0559dap+0f, 0x1.04c15cp+0f, 0x1.0428ep+0f, 0x1.03906p+0f,
+       0x1.02f7e2p+0f, 0x1.025f64p+0f, 0x1.01c6e4p+0f, 0x1.012e68p+0f, 0x1.0095ecp+0f, 0x1.fffad8p-1f,
+       0x1.fec9f2p-1f, 0x1.fe89a4p-1f, 0x1.ff27c4p-1f, 0x1.ffc5e8p-1f, 0x1.003204p+0f, 0x1.008114p+0f,
+       0x1.00d024p+0f, 0x1.011f34p+0f, 0x1.016e46p+0f, 0x1.01bd56p+0f, 0x1.020c68p+0f, 0x1.025b78p+0f,
+       0x1.02a5d2p+0f, 0x1.02ebf8p+0f, 0x1.03322p+0f, 0x1.037848p+0f, 0x1.03be7p+0f, 0x1.040498p+0f,
+       0x1.044abep+0f, 0x1.0490e6p+0f, 0x1.04d70cp+0f, 0x1.051d34p+0f, 0x1.0561bp+0f, 0x1.00bd78p+0f,
+       0x1.efb8aap-1f, 0x1.ddf664p-1f, 0x1.cc344p-1f, 0x1.ba721cp-1f, 0x1.a8affap-1f, 0x1.96edb2p-1f,
+       0x1.852b6cp-1f, 0x1.736948p-1f, 0x1.61a724p-1f, 0x1.4fe19ap-1f, 0x1.3799d6p-1f, 0x1.19e3a4p-1f,
+       0x1.f85b1cp-2f, 0x1.bceebap-2f, 0x1.818254p-2f, 0x1.4615fp-2f, 0x1.0aa98cp-2f, 0x1.9e7ac4p-3f,
+       0x1.27a1fap-3f, 0x1.619266p-4f, 0x1.d0fde2p-6f, 0x1.628fccp-9f, 0x1.92a728p-9f, 0x1.c2beb4p-9f,
+       0x1.f2d63ep-9f, 0x1.1176ccp-8f, 0x1.298294p-8f, 0x1.418e58p-8f, 0x1.599a1cp-8f, 0x1.71a5fcp-8f,
+       0x1.89b1cp-8f, 0x1.a1a4fp-8f, 0x1.9fc164p-8f, 0x1.89b0b8p-8f, 0x1.73a01p-8f, 0x1.5d8f68p-8f,
+       0x1.477e9p-8f, 0x1.316dbcp-8f, 0x1.1b5d12p-8f, 0x1.054c6ap-8f, 0x1.de778p-9f, 0x1.b255d4p-9f,
+       0x1.863b4cp-9f, 0x1.6000fep-9f, 0x1.3e3708p-9f, 0x1.1c6cccp-9f, 0x1.f54524p-10f, 0x1.b1b138p-10f,
+       0x1.6e1d4cp-10f, 0x1.2a896p-10f, 0x1.cde9d4p-11f, 0x1.46c0ecp-11f, 0x1.7f3228p-12f, 0x1.bb6e1p-14f,
+       -0x1.f75d8cp-12f, -0x1.55e844p-10f, -0x1.16fd6cp-9f, -0x1.8305dep-9f, -0x1.ef0f28p-9f, -0x1.2d8c38p-8f,
+       -0x1.63907p-8f, -0x1.9994acp-8f, -0x1.cf98e4p-8f, -0x1.02cec4p-7f, -0x1.1d8c88p-7f, -0x1.12e5b6p-7f,
+       -0x1.db8b04p-8f, -0x1.914a9ep-8f, -0x1.4709ap-8f, -0x1.f99148p-9f, -0x1.65107ap-9f, -0x1.a11f5cp-10f,
+       -0x1.e06dcp-12f, 0x1.61d102p-11f, 0x1.d9ea2p-10f, 0x1.80536ap-9f, 0x1.8e963ep-9f, 0x1.4193bep-9f,
+       0x1.e92278p-10f, 0x1.4f1eaap-10f, 0x1.6a35bap-11f, 0x1.b170e2p-14f, -0x1.fbb7d4p-12f, -0x1.18f2f8p-10f,
+       -0x1.b2f6c4p-10f, -0x1.267d48p-9f, -0x1.63050cp-9f, 0x1.347c4ep-7f, 0x1.e9cd8p-6f, 0x1.9cad1cp-5f,
+       0x1.2239bcp-4f, 0x1.761cecp-4f, 0x1.ca00c4p-4f, 0x1.0ef24cp-3f, 0x1.38e3e2p-3f, 0x1.62d5dp-3f,
+       0x1.8cc7bcp-3f, 0x1.b6f6cp-3f, 0x1.f5e508p-3f, 0x1.21163p-2f, 0x1.473a28p-2f, 0x1.6d5e24p-2f,
+       0x1.9381dp-2f, 0x1.b9a57cp-2f, 0x1.dfc928p-2f, 0x1.02f69p-1f, 0x1.16088cp-1f, 0x1.291a64p-1f,
+       0x1.3c25dcp-1f, 0x1.4d50a4p-1f, 0x1.5d4fdcp-1f, 0x1.6d4f14p-1f, 0x1.7d4e2ap-1f, 0x1.8d4d4p-1f,
+       0x1.9d4c58p-1f, 0x1.ad4b9p-1f, 0x1.bd4ac8p-1f, 0x1.cd49ep-1f, 0x1.dd48f8p-1f, 0x1.ed21d4p-1f,
+       0x1.f305bp-1f, 0x1.f2e552p-1f, 0x1.f2c4f4p-1f, 0x1.f2a496p-1f, 0x1.f28438p-1f, 0x1.f263d8p-1f,
+       0x1.f2437ap-1f, 0x1.f2231cp-1f, 0x1.f202bep-1f, 0x1.f1e26p-1f, 0x1.f1c808p-1f, 0x1.f312dcp-1f,
+       0x1.f52ed8p-1f, 0x1.f74ad8p-1f, 0x1.f966d8p-1f, 0x1.fb82d4p-1f, 0x1.fd9ed4p-1f, 0x1.ffbad2p-1f,
+       0x1.00eb6ap+0f, 0x1.01f96cp+0f, 0x1.03076ap+0f, 0x1.0410e4p+0f, 0x1.042a3p+0f, 0x1.03bb22p+0f,
+       0x1.034c14p+0f, 0x1.02dd04p+0f, 0x1.026df8p+0f, 0x1.01fee8p+0f, 0x1.018fdcp+0f, 0x1.0120ccp+0f,
+       0x1.00b1cp+0f, 0x1.0042bp+0f, 0x1.ffa206p-1f, 0x1.fdc36p-1f, 0x1.fb5a6ep-1f, 0x1.f8f17cp-1f,
+       0x1.f6888cp-1f, 0x1.f41f94p-1f, 0x1.f1b69cp-1f, 0x1.ef4da8p-1f, 0x1.ece4b8p-1f, 0x1.ea7bc4p-1f,
+       0x1.e812cep-1f, 0x1.e5a25p-1f, 0x1.e1eac6p-1f, 0x1.dd84aap-1f, 0x1.d91e8ep-1f, 0x1.d4b86ap-1f,
+       0x1.d05246p-1f, 0x1.cbec2ap-1f, 0x1.c7860ep-1f, 0x1.c31ff2p-1f, 0x1.beb9cep-1f, 0x1.ba53aap-1f,
+       0x1.b612c6p-1f, 0x1.b794dep-1f, 0x1.bc125cp-1f, 0x1.c08fd8p-1f, 0x1.c50d6p-1f, 0x1.c98adcp-1f,
+       0x1.ce0862p-1f, 0x1.d285e8p-1f, 0x1.d70368p-1f, 0x1.db80ecp-1f, 0x1.dffe6cp-1f, 0x1.e466ep-1f,
+       0x1.e5d47p-1f, 0x1.e5c30cp-1f, 0x1.e5b1a4p-1f, 0x1.e5a03cp-1f, 0x1.e58ed6p-1f, 0x1.e57d7p-1f,
+       0x1.e56c08p-1f, 0x1.e55aap-1f, 0x1.e54938p-1f, 0x1.e537d4p-1f, 0x1.e5323p-1f, 0x1.e6b518p-1f,
+       0x1.e8f722p-1f, 0x1.eb3928p-1f, 0x1.ed7b2cp-1f, 0x1.efbd38p-1f, 0x1.f1ff3cp-1f, 0x1.f44148p-1f,
+       0x1.f6834cp-1f, 0x1.f8c552p-1f, 0x1.fb075cp-1f, 0x1.fd1ab4p-1f, 0x1.f99002p-1f, 0x1.f35e3ep-1f,
+       0x1.ed2c7ap-1f, 0x1.e6fa9ep-1f, 0x1.e0c8dp-1f, 0x1.da970cp-1f, 0x1.d46554p-1f, 0x1.ce3392p-1f,
+       0x1.c801b6p-1f, 0x1.c1cfe6p-1f, 0x1.bbcb5cp-1f, 0x1.bad074p-1f, 0x1.bc2448p-1f, 0x1.bd782p-1f,
+       0x1.becbf4p-1f, 0x1.c01fc8p-1f, 0x1.c1739cp-1f, 0x1.c2c76ep-1f, 0x1.c41b44p-1f, 0x1.c56f18p-1f,
+       0x1.c6c2ecp-1f, 0x1.c80116p-1f, 0x1.c7014p-1f, 0x1.c50254p-1f, 0x1.c30366p-1f, 0x1.c1047ep-1f,
+       0x1.bf0594p-1f, 0x1.bd06acp-1f, 0x1.bb07c4p-1f, 0x1.b908d8p-1f, 0x1.b709ecp-1f, 0x1.b50b04p-1f,
+       0x1.b31a18p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f,
+       0x1.b28436p-1f, 0x1.b28436p-1f, 0x1.b28436p-1f}),
+    SpectrumT<471>({0x1.6d4d4p-8f, 0x1.6d4d4p-8f, 0x1.6d4d4p-8f, 0x1.6d4d4p-8f, 0x1.6d4d4p-8f, 0x1.6d4d4p-8f,
+       0x1.6d4d4p-8f, 0x1.6d4d4p-8f, 0x1.6d4d4p-8f, 0x1.6d4d4p-8f, 0x1.6d4d4p-8f, 0x1.6d4d4p-8f,
+       0x1.6d4d4p-8f, 0x1.6d4d4p-8f, 0x1.6d4d4p-8f, 0x1.6d4d4p-8f, 0x1.6d4d4p-8f, 0x1.6d4d4p-8f,
+       0x1.6d4d4p-8f, 0x1.6d4d4p-8f, 0x1.50f42ep-8f, 0x1.1329b8p-8f, 0x1.aaa1d8p-9f, 0x1.2ef0bcp-9f,
+       0x1.667e4cp-10f, 0x1.bc6c88p-12f, -0x1.10901p-11f, -0x1.7fab3p-10f, -0x1.3b86b4p-9f, -0x1.b7384ap-9f,
+       -0x1.1974eep-8f, -0x1.3bb172p-8f, -0x1.3e711cp-8f, -0x1.412836p-8f, -0x1.43df5p-8f, -0x1.469668p-8f,
+       -0x1.494d8p-8f, -0x1.4c049ap-8f, -0x1.4ebbb4p-8f, -0x1.5172cep-8f, -0x1.5429e6p-8f, -0x1.56e1p-8f,
+       -0x1.5bb732p-8f, -0x1.62e3e8p-8f, -0x1.6a10f8p-8f, -0x1.713e08p-8f, -0x1.786b18p-8f, -0x1.7f9828p-8f,
+       -0x1.86c538p-8f, -0x1.8df24p-8f, -0x1.951f5p-8f, -0x1.9c4c6p-8f, -0x1.a3797p-8f, -0x1.a5c41ap-8f,
+       -0x1.a2dbd6p-8f, -0x1.9ff34p-8f, -0x1.9d0aa8p-8f, -0x1.9a221p-8f, -0x1.973976p-8f, -0x1.9450dep-8f,
+       -0x1.916848p-8f, -0x1.8e7fb4p-8f, -0x1.8b971cp-8f, -0x1.88ae84p-8f, -0x1.7c1362p-8f, -0x1.6580e2p-8f,
+       -0x1.4eee44p-8f, -0x1.385ba4p-8f, -0x1.21c904p-8f, -0x1.0b3664p-8f, -0x1.e947b4p-9f, -0x1.bc2274p-9f,
+       -0x1.8efd08p-9f, -0x1.61d7c8p-9f, -0x1.34b29ep-9f, -0x1.595838p-10f, 0x1.abe9d4p-12f, 0x1.17a694p-9f,
+       0x1.f9cfeep-9f, 0x1.6dfc3p-8f, 0x1.df10dcp-8f, 0x1.2812c4p-7f, 0x1.609d18p-7f, 0x1.99277p-7f,
+       0x1.d1b18cp-7f, 0x1.051f54p-6f, 0x1.4f5b7p-6f, 0x1.c596fap-6f, 0x1.1de908p-5f, 0x1.59069p-5f,
+       0x1.942456p-5f, 0x1.cf4258p-5f, 0x1.05300ep-4f, 0x1.22bed4p-4f, 0x1.404d98p-4f, 0x1.5ddc7ap-4f,
+       0x1.7b6c2ep-4f, 0x1.a019c2p-4f, 0x1.cb5bd4p-4f, 0x1.f69dbep-4f, 0x1.10efd4p-3f, 0x1.2690f2p-3f,
+       0x1.3c31fcp-3f, 0x1.51d306p-3f, 0x1.67741p-3f, 0x1.7d1504p-3f, 0x1.92b60cp-3f, 0x1.a857d6p-3f,
+       0x1.c143c8p-3f, 0x1.dd1fep-3f, 0x1.f8fc14p-3f, 0x1.0a6c24p-2f, 0x1.185a3cp-2f, 0x1.264854p-2f,
+       0x1.34366p-2f, 0x1.422478p-2f, 0x1.50129p-2f, 0x1.5e00acp-2f, 0x1.6bef42p-2f, 0x1.7b491p-2f,
+       0x1.8bdc9cp-2f, 0x1.9c7028p-2f, 0x1.ad0392p-2f, 0x1.bd96fcp-2f, 0x1.ce2a68p-2f, 0x1.debdf4p-2f,
+       0x1.ef518p-2f, 0x1.ffe4eap-2f, 0x1.083c2cp-1f, 0x1.10864p-1f, 0x1.197cd4p-1f, 0x1.23034cp-1f,
+       0x1.2c89bap-1f, 0x1.361034p-1f, 0x1.3f96acp-1f, 0x1.491d24p-1f, 0x1.52a39ap-1f, 0x1.5c2a08p-1f,
+       0x1.65b08p-1f, 0x1.6f36f8p-1f, 0x1.78bcf4p-1f, 0x1.819488p-1f, 0x1.89df4cp-1f, 0x1.922a18p-1f,
+       0x1.9a74e4p-1f, 0x1.a2bfaap-1f, 0x1.ab0a76p-1f, 0x1.b35544p-1f, 0x1.bba01p-1f, 0x1.c3eae6p-1f,
+       0x1.cc35b4p-1f, 0x1.d47f26p-1f, 0x1.db5f46p-1f, 0x1.e12538p-1f, 0x1.e6eb28p-1f, 0x1.ecb11cp-1f,
+       0x1.f27718p-1f, 0x1.f83d18p-1f, 0x1.fe0308p-1f, 0x1.01e47cp+0f, 0x1.04c774p+0f, 0x1.07aa74p+0f,
+       0x1.0a8b8ap+0f, 0x1.0bdaf4p+0f, 0x1.0bfadcp+0f, 0x1.0c1ac8p+0f, 0x1.0c3abp+0f, 0x1.0c5a98p+0f,
+       0x1.0c7a82p+0f, 0x1.0c9a6cp+0f, 0x1.0cba58p+0f, 0x1.0cda4p+0f, 0x1.0cfa2ap+0f, 0x1.0d19f8p+0f,
+       0x1.0d26c4p+0f, 0x1.0d25aep+0f, 0x1.0d2496p+0f, 0x1.0d237ep+0f, 0x1.0d2266p+0f, 0x1.0d214ep+0f,
+       0x1.0d2036p+0f, 0x1.0d1f1ep+0f, 0x1.0d1e06p+0f, 0x1.0d1ceep+0f, 0x1.0d1bd8p+0f, 0x1.0d1aep+0f,
+       0x1.0d1ap+0f, 0x1.0d1922p+0f, 0x1.0d1842p+0f, 0x1.0d1764p+0f, 0x1.0d1684p+0f, 0x1.0d15a6p+0f,
+       0x1.0d14c6p+0f, 0x1.0d13e8p+0f, 0x1.0d1308p+0f, 0x1.0d123p+0f, 0x1.0d1444p+0f, 0x1.0d185ep+0f,
+       0x1.0d1c76p+0f, 0x1.0d208ep+0f, 0x1.0d24a6p+0f, 0x1.0d28bep+0f, 0x1.0d2cd6p+0f, 0x1.0d30eep+0f,
+       0x1.0d3506p+0f, 0x1.0d391ep+0f, 0x1.0d3d2ep+0f, 0x1.0d3e52p+0f, 0x1.0d3d84p+0f, 0x1.0d3cb4p+0f,
+       0x1.0d3be6p+0f, 0x1.0d3b18p+0f, 0x1.0d3a48p+0f, 0x1.0d397ap+0f, 0x1.0d38acp+0f, 0x1.0d37dcp+0f,
+       0x1.0d370cp+0f, 0x1.0d363cp+0f, 0x1.0d346cp+0f, 0x1.0d31fcp+0f, 0x1.0d2f88p+0f, 0x1.0d2d18p+0f,
+       0x1.0d2aa8p+0f, 0x1.0d2834p+0f, 0x1.0d25c4p+0f, 0x1.0d2354p+0f, 0x1.0d20ep+0f, 0x1.0d1e7p+0f,
+       0x1.0d1c02p+0f, 0x1.0d1af2p+0f, 0x1.0d1abcp+0f, 0x1.0d1a86p+0f, 0x1.0d1a5p+0f, 0x1.0d1a1ap+0f,
+       0x1.0d19e4p+0f, 0x1.0d19acp+0f, 0x1.0d1978p+0f, 0x1.0d1942p+0f, 0x1.0d190cp+0f, 0x1.0d18dcp+0f,
+       0x1.0d1aaap+0f, 0x1.0d1da8p+0f, 0x1.0d20a8p+0f, 0x1.0d23a6p+0f, 0x1.0d26a4p+0f, 0x1.0d29a4p+0f,
+       0x1.0d2cap+0f, 0x1.0d2fap+0f, 0x1.0d32ap+0f, 0x1.0d359cp+0f, 0x1.0d389p+0f, 0x1.0d38aep+0f,
+       0x1.0d3726p+0f, 0x1.0d359cp+0f, 0x1.0d3414p+0f, 0x1.0d328cp+0f, 0x1.0d3102p+0f, 0x1.0d2f78p+0f,
+       0x1.0d2dfp+0f, 0x1.0d2c68p+0f, 0x1.0d2aep+0f, 0x1.0d295cp+0f, 0x1.0d298cp+0f, 0x1.0d2aaep+0f,
+       0x1.0d2bdp+0f, 0x1.0d2cf4p+0f, 0x1.0d2e14p+0f, 0x1.0d2f38p+0f, 0x1.0d305cp+0f, 0x1.0d317cp+0f,
+       0x1.0d32ap+0f, 0x1.0d33cp+0f, 0x1.0d34d6p+0f, 0x1.0d338p+0f, 0x1.0d30d4p+0f, 0x1.0d2e28p+0f,
+       0x1.0d2b7cp+0f, 0x1.0d28dp+0f, 0x1.0d2624p+0f, 0x1.0d2378p+0f, 0x1.0d20ccp+0f, 0x1.0d1e2p+0f,
+       0x1.0d1b74p+0f, 0x1.0d18dcp+0f, 0x1.0d196p+0f, 0x1.0d1b8ep+0f, 0x1.0d1dbep+0f, 0x1.0d1fecp+0f,
+       0x1.0d221cp+0f, 0x1.0d244cp+0f, 0x1.0d267ap+0f, 0x1.0d28aap+0f, 0x1.0d2ad8p+0f, 0x1.0d2d08p+0f,
+       0x1.0d2f1ep+0f, 0x1.0d2d6p+0f, 0x1.0d29a6p+0f, 0x1.0d25ecp+0f, 0x1.0d223p+0f, 0x1.0d1e78p+0f,
+       0x1.0d1abcp+0f, 0x1.0d17p+0f, 0x1.0d1348p+0f, 0x1.0d0f8cp+0f, 0x1.0d0bd2p+0f, 0x1.0d0828p+0f,
+       0x1.0d06f6p+0f, 0x1.0d06fep+0f, 0x1.0d0706p+0f, 0x1.0d070ep+0f, 0x1.0d0716p+0f, 0x1.0d071ep+0f,
+       0x1.0d0726p+0f, 0x1.0d072ep+0f, 0x1.0d0736p+0f, 0x1.0d073ep+0f, 0x1.0d06e6p+0f, 0x1.0cfa3p+0f,
+       0x1.0ce77p+0f, 0x1.0cd4b4p+0f, 0x1.0cc1f8p+0f, 0x1.0caf38p+0f, 0x1.0c9c7cp+0f, 0x1.0c89bcp+0f,
+       0x1.0c77p+0f, 0x1.0c644p+0f, 0x1.0c5184p+0f, 0x1.0c3f6p+0f, 0x1.0c3ff4p+0f, 0x1.0c495ep+0f,
+       0x1.0c52c6p+0f, 0x1.0c5c3p+0f, 0x1.0c6598p+0f, 0x1.0c6fp+0f, 0x1.0c7868p+0f, 0x1.0c81d2p+0f,
+       0x1.0c8b3cp+0f, 0x1.0c94a4p+0f, 0x1.0c9d06p+0f, 0x1.0c8838p+0f, 0x1.0c660cp+0f, 0x1.0c43ep+0f,
+       0x1.0c21b4p+0f, 0x1.0bff88p+0f, 0x1.0bdd5cp+0f, 0x1.0bbb32p+0f, 0x1.0b9906p+0f, 0x1.0b76dap+0f,
+       0x1.0b54aep+0f, 0x1.0b32b6p+0f, 0x1.0b163cp+0f, 0x1.0afc3p+0f, 0x1.0ae224p+0f, 0x1.0ac818p+0f,
+       0x1.0aae0cp+0f, 0x1.0a94p+0f, 0x1.0a79f6p+0f, 0x1.0a5feap+0f, 0x1.0a45dep+0f, 0x1.0a2bd2p+0f,
+       0x1.0a127ep+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f,
+       0x1.0a0adap+0f, 0x1.0a0adap+0f, 0x1.0a0adap+0f}),
+    SpectrumT<471>({0x1.5377e8p-3f, 0x1.5377e8p-3f, 0x1.5377e8p-3f, 0x1.5377e8p-3f, 0x1.5377e8p-3f, 0x1.5377e8p-3f,
+       0x1.5377e8p-3f, 0x1.5377e8p-3f, 0x1.5377e8p-3f, 0x1.5377e8p-3f, 0x1.5377e8p-3f, 0x1.5377e8p-3f,
+       0x1.5377e8p-3f, 0x1.5377e8p-3f, 0x1.5377e8p-3f, 0x1.5377e8p-3f, 0x1.5377e8p-3f, 0x1.5377e8p-3f,
+       0x1.5377e8p-3f, 0x1.5377e8p-3f, 0x1.4f6de8p-3f, 0x1.46a014p-3f, 0x1.3dd034p-3f, 0x1.35005ep-3f,
+       0x1.2c307cp-3f, 0x1.23609ep-3f, 0x1.1a90cp-3f, 0x1.11c0ep-3f, 0x1.08f108p-3f, 0x1.002128p-3f,
+       0x1.eea292p-4f, 0x1.e637ccp-4f, 0x1.e84cf4p-4f, 0x1.ea64fap-4f, 0x1.ec7dp-4f, 0x1.ee9504p-4f,
+       0x1.f0ad08p-4f, 0x1.f2c50cp-4f, 0x1.f4dd12p-4f, 0x1.f6f518p-4f, 0x1.f90d1ap-4f, 0x1.fb252p-4f,
+       0x1.fa67b2p-4f, 0x1.f68ad2p-4f, 0x1.f2ad78p-4f, 0x1.eed02p-4f, 0x1.eaf2c8p-4f, 0x1.e7157p-4f,
+       0x1.e33818p-4f, 0x1.df5ac4p-4f, 0x1.db7d6cp-4f, 0x1.d7a01p-4f, 0x1.d3c2b8p-4f, 0x1.cb803p-4f,
+       0x1.be901cp-4f, 0x1.b19fc2p-4f, 0x1.a4af5ap-4f, 0x1.97bef2p-4f, 0x1.8ace7cp-4f, 0x1.7dde12p-4f,
+       0x1.70edb8p-4f, 0x1.63fd5cp-4f, 0x1.570cf4p-4f, 0x1.4a1c8cp-4f, 0x1.3af46cp-4f, 0x1.2984dep-4f,
+       0x1.181548p-4f, 0x1.06a5bp-4f, 0x1.ea6c32p-5f, 0x1.c78d06p-5f, 0x1.a4adfcp-5f, 0x1.81cecep-5f,
+       0x1.5eef7ep-5f, 0x1.3c105p-5f, 0x1.193146p-5f, 0x1.ef78f4p-6f, 0x1.af5e2ep-6f, 0x1.6f4368p-6f,
+       0x1.2f28ap-6f, 0x1.de1c38p-7f, 0x1.5de6acp-7f, 0x1.bb623cp-8f, 0x1.75ee42p-9f, -0x1.15cfdap-10f,
+       -0x1.45de1p-8f, -0x1.232146p-7f, -0x1.35e3bcp-7f, -0x1.bfc114p-8f, -0x1.13bb5cp-8f, -0x1.9ed686p-10f,
+       0x1.114312p-10f, 0x1.e0afacp-9f, 0x1.9c5e3ap-8f, 0x1.2431fap-7f, 0x1.7a34d8p-7f, 0x1.d03808p-7f,
+       0x1.131aa2p-6f, 0x1.1de99p-6f, 0x1.0af6dp-6f, 0x1.f00844p-7f, 0x1.ca22ecp-7f, 0x1.a43d44p-7f,
+       0x1.7e57c4p-7f, 0x1.587244p-7f, 0x1.328cc2p-7f, 0x1.0ca766p-7f, 0x1.cd83ccp-8f, 0x1.81c5d8p-8f,
+       0x1.7839e4p-8f, 0x1.a9ccd8p-8f, 0x1.db5ffep-8f, 0x1.067992p-7f, 0x1.1f4324p-7f, 0x1.380cb8p-7f,
+       0x1.50d63p-7f, 0x1.699fc4p-7f, 0x1.826958p-7f, 0x1.9b32ecp-7f, 0x1.b3ed52p-7f, 0x1.a0011cp-7f,
+       0x1.658916p-7f, 0x1.2b111p-7f, 0x1.e133p-8f, 0x1.6c43ep-8f, 0x1.eea97cp-9f, 0x1.04c962p-9f,
+       0x1.ae94c8p-13f, -0x1.9de9ecp-10f, -0x1.b8d33cp-9f, -0x1.5131c2p-8f, -0x1.78f4d8p-8f, -0x1.60702p-8f,
+       -0x1.47eb84p-8f, -0x1.2f66dp-8f, -0x1.16e218p-8f, -0x1.fcbac4p-9f, -0x1.cbb15ap-9f, -0x1.9aa82p-9f,
+       -0x1.699eb4p-9f, -0x1.38954ap-9f, -0x1.07c874p-9f, -0x1.2b9422p-9f, -0x1.93a7ap-9f, -0x1.fbbb86p-9f,
+       -0x1.31e7b6p-8f, -0x1.65f174p-8f, -0x1.99fb68p-8f, -0x1.ce055cp-8f, -0x1.0107a6p-7f, -0x1.1b0cbap-7f,
+       -0x1.3511b4p-7f, -0x1.4efcaep-7f, -0x1.4d9218p-7f, -0x1.36cf7cp-7f, -0x1.200cdep-7f, -0x1.094a42p-7f,
+       -0x1.e50eeep-8f, -0x1.b78958p-8f, -0x1.8a042p-8f, -0x1.5c7ee6p-8f, -0x1.2ef9acp-8f, -0x1.017416p-8f,
+       -0x1.a85c96p-9f, -0x1.b6bbe6p-9f, -0x1.0a30d6p-8f, -0x1.390418p-8f, -0x1.67d75ap-8f, -0x1.96aa3cp-8f,
+       -0x1.c57d2p-8f, -0x1.f45006p-8f, -0x1.1191a4p-7f, -0x1.28fb44p-7f, -0x1.4064b8p-7f, -0x1.57b2cap-7f,
+       -0x1.5cc6a8p-7f, -0x1.54860cp-7f, -0x1.4c456p-7f, -0x1.4404c4p-7f, -0x1.3bc41ap-7f, -0x1.33836ep-7f,
+       -0x1.2b42d4p-7f, -0x1.230238p-7f, -0x1.1ac19cp-7f, -0x1.1280fp-7f, -0x1.0a36cp-7f, -0x1.f9768ep-8f,
+       -0x1.d72534p-8f, -0x1.b4d3d8p-8f, -0x1.928238p-8f, -0x1.70309ap-8f, -0x1.4ddf4p-8f, -0x1.2b8de6p-8f,
+       -0x1.093c48p-8f, -0x1.cdd55p-9f, -0x1.89329cp-9f, -0x1.4459aap-9f, -0x1.cd4a94p-10f, -0x1.df934p-11f,
+       -0x1.248a98p-14f, 0x1.966d2p-11f, 0x1.a8b5cap-10f, 0x1.431a82p-9f, 0x1.b1dafcp-9f, 0x1.104dbcp-8f,
+       0x1.47ad8ap-8f, 0x1.7f0d58p-8f, 0x1.b58e6p-8f, 0x1.94f19p-8f, 0x1.3a78ap-8f, 0x1.c000ccp-9f,
+       0x1.0b1054p-9f, 0x1.587f7ap-11f, -0x1.7b480cp-11f, -0x1.13c3e2p-9f, -0x1.c8b458p-9f, -0x1.3ed31cp-8f,
+       -0x1.994c0cp-8f, -0x1.d97786p-8f, 0x1.b20038p-6f, 0x1.52041p-4f, 0x1.1bc4fp-3f, 0x1.8e87d6p-3f,
+       0x1.00a4ecp-2f, 0x1.3a05ecp-2f, 0x1.7366eep-2f, 0x1.acc86p-2f, 0x1.e629d4p-2f, 0x1.0fc56ap-1f,
+       0x1.2c5f3ap-1f, 0x1.4246a4p-1f, 0x1.540158p-1f, 0x1.65bc0ep-1f, 0x1.7776ap-1f, 0x1.89313p-1f,
+       0x1.9aebc4p-1f, 0x1.aca678p-1f, 0x1.be612ep-1f, 0x1.d01bcp-1f, 0x1.e1d65p-1f, 0x1.f36778p-1f,
+       0x1.fa2efep-1f, 0x1.fa71cap-1f, 0x1.fab494p-1f, 0x1.faf762p-1f, 0x1.fb3a3p-1f, 0x1.fb7cfcp-1f,
+       0x1.fbbfc8p-1f, 0x1.fc0294p-1f, 0x1.fc456p-1f, 0x1.fc882cp-1f, 0x1.fccb86p-1f, 0x1.fd2fbcp-1f,
+       0x1.fda732p-1f, 0x1.fe1ea8p-1f, 0x1.fe961cp-1f, 0x1.ff0d9p-1f, 0x1.ff8504p-1f, 0x1.fffc78p-1f,
+       0x1.0039f8p+0f, 0x1.0075bp+0f, 0x1.00b16cp+0f, 0x1.00eb9ep+0f, 0x1.00d4ap+0f, 0x1.008f84p+0f,
+       0x1.004a68p+0f, 0x1.00055p+0f, 0x1.ff806ep-1f, 0x1.fef63ap-1f, 0x1.fe6c06p-1f, 0x1.fde1d2p-1f,
+       0x1.fd57ap-1f, 0x1.fccd6cp-1f, 0x1.fc4628p-1f, 0x1.fc4b5cp-1f, 0x1.fc9de4p-1f, 0x1.fcf06ap-1f,
+       0x1.fd42fp-1f, 0x1.fd9578p-1f, 0x1.fde7fcp-1f, 0x1.fe3a84p-1f, 0x1.fe8d0cp-1f, 0x1.fedf94p-1f,
+       0x1.ff321ap-1f, 0x1.ff8506p-1f, 0x1.ffe966p-1f, 0x1.002b88p+0f, 0x1.00626p+0f, 0x1.009936p+0f,
+       0x1.00d00cp+0f, 0x1.0106e4p+0f, 0x1.013db8p+0f, 0x1.01749p+0f, 0x1.01ab68p+0f, 0x1.01e23cp+0f,
+       0x1.0215c2p+0f, 0x1.01c594p+0f, 0x1.01313ap+0f, 0x1.009cep+0f, 0x1.000888p+0f, 0x1.fee86p-1f,
+       0x1.fdbfacp-1f, 0x1.fc96fap-1f, 0x1.fb6e4ap-1f, 0x1.fa4598p-1f, 0x1.f91ce6p-1f, 0x1.f7feecp-1f,
+       0x1.f86532p-1f, 0x1.f98e5cp-1f, 0x1.fab788p-1f, 0x1.fbe0b4p-1f, 0x1.fd09ep-1f, 0x1.fe330cp-1f,
+       0x1.ff5c38p-1f, 0x1.0042b2p+0f, 0x1.00d748p+0f, 0x1.016bdep+0f, 0x1.01f984p+0f, 0x1.019f94p+0f,
+       0x1.00d4e8p+0f, 0x1.000a3cp+0f, 0x1.fe7f1cp-1f, 0x1.fce9cp-1f, 0x1.fb5468p-1f, 0x1.f9bf0ap-1f,
+       0x1.f829bp-1f, 0x1.f69458p-1f, 0x1.f4fefcp-1f, 0x1.f3753p-1f, 0x1.f34f56p-1f, 0x1.f3d194p-1f,
+       0x1.f453dp-1f, 0x1.f4d60ep-1f, 0x1.f5584cp-1f, 0x1.f5da8ap-1f, 0x1.f65cc6p-1f, 0x1.f6df04p-1f,
+       0x1.f76142p-1f, 0x1.f7e38p-1f, 0x1.f8548cp-1f, 0x1.f6db4p-1f, 0x1.f48152p-1f, 0x1.f2275cp-1f,
+       0x1.efcd6cp-1f, 0x1.ed737ep-1f, 0x1.eb199p-1f, 0x1.e8bfa4p-1f, 0x1.e665b4p-1f, 0x1.e40bc4p-1f,
+       0x1.e1b1d4p-1f, 0x1.df7712p-1f, 0x1.e0764cp-1f, 0x1.e2e48ep-1f, 0x1.e552dp-1f, 0x1.e7c11p-1f,
+       0x1.ea2f4cp-1f, 0x1.ec9d8ap-1f, 0x1.ef0bc8p-1f, 0x1.f17a0cp-1f, 0x1.f3e85p-1f, 0x1.f6568cp-1f,
+       0x1.f8b3cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f,
+       0x1.f96a4cp-1f, 0x1.f96a4cp-1f, 0x1.f96a4cp-1f}),
+    SpectrumT<471>({0x1.5b43ap-9f, 0x1.5b43ap-9f, 0x1.5b43ap-9f, 0x1.5b43ap-9f, 0x1.5b43ap-9f, 0x1.5b43ap-9f,
+       0x1.5b43ap-9f, 0x1.5b43ap-9f, 0x1.5b43ap-9f, 0x1.5b43ap-9f, 0x1.5b43ap-9f, 0x1.5b43ap-9f,
+       0x1.5b43ap-9f, 0x1.5b43ap-9f, 0x1.5b43ap-9f, 0x1.5b43ap-9f, 0x1.5b43ap-9f, 0x1.5b43ap-9f,
+       0x1.5b43ap-9f, 0x1.5b43ap-9f, 0x1.315b38p-9f, 0x1.ac045cp-10f, 0x1.ea4fd8p-11f, 0x1.f26188p-13f,
+       -0x1.e241p-12f, -0x1.2f6cbp-10f, -0x1.e6491ep-10f, -0x1.4e92c4p-9f, -0x1.aa00a2p-9f, -0x1.02b76ep-8f,
+       -0x1.306e8ap-8f, -0x1.5dc3dep-8f, -0x1.8aa9b4p-8f, -0x1.b78f68p-8f, -0x1.e4751ep-8f, -0x1.08ad54p-7f,
+       -0x1.1f202ep-7f, -0x1.359308p-7f, -0x1.4c05e4p-7f, -0x1.6278bep-7f, -0x1.78eb82p-7f, -0x1.8f5e5cp-7f,
+       -0x1.96c1dap-7f, -0x1.8d8ca6p-7f, -0x1.8454f8p-7f, -0x1.7b1d48p-7f, -0x1.71e59cp-7f, -0x1.68adecp-7f,
+       -0x1.5f763cp-7f, -0x1.563e98p-7f, -0x1.4d06eap-7f, -0x1.43cf3cp-7f, -0x1.3a978cp-7f, -0x1.3a45d8p-7f,
+       -0x1.436cc4p-7f, -0x1.4c9444p-7f, -0x1.55bbdp-7f, -0x1.5ee35ap-7f, -0x1.680aecp-7f, -0x1.713276p-7f,
+       -0x1.7a59f8p-7f, -0x1.838178p-7f, -0x1.8ca904p-7f, -0x1.95d08ep-7f, -0x1.93adap-7f, -0x1.85f01p-7f,
+       -0x1.78325cp-7f, -0x1.6a74a8p-7f, -0x1.5cb6f4p-7f, -0x1.4ef94p-7f, -0x1.413b9cp-7f, -0x1.337de8p-7f,
+       -0x1.25c028p-7f, -0x1.180274p-7f, -0x1.0a44d2p-7f, -0x1.038b48p-7f, -0x1.03c73p-7f, -0x1.04031cp-7f,
+       -0x1.043f06p-7f, -0x1.047afp-7f, -0x1.04b6dcp-7f, -0x1.04f2c4p-7f, -0x1.052ebp-7f, -0x1.056a9cp-7f,
+       -0x1.05a684p-7f, -0x1.05e28p-7f, -0x1.081246p-7f, -0x1.0c208ap-7f, -0x1.102ec8p-7f, -0x1.143d08p-7f,
+       -0x1.184b4cp-7f, -0x1.1c5992p-7f, -0x1.2067d6p-7f, -0x1.247616p-7f, -0x1.288454p-7f, -0x1.2c9298p-7f,
+       -0x1.30955ap-7f, -0x1.7d31ecp-8f, 0x1.03d5e6p-10f, 0x1.ff1b2p-8f, 0x1.dea06p-7f, 0x1.5eda7cp-6f,
+       0x1.ce6454p-6f, 0x1.1ef718p-5f, 0x1.56bc04p-5f, 0x1.8e80b8p-5f, 0x1.c645a4p-5f, 0x1.fe1f0ep-5f,
+       0x1.4d3f14p-4f, 0x1.c8524ep-4f, 0x1.21b3p-3f, 0x1.5f3cdcp-3f, 0x1.9cc6b4p-3f, 0x1.da508cp-3f,
+       0x1.0bed14p-2f, 0x1.2ab202p-2f, 0x1.4976fp-2f, 0x1.683bdcp-2f, 0x1.87013cp-2f, 0x1.a718d4p-2f,
+       0x1.c854c4p-2f, 0x1.e990b4p-2f, 0x1.05663p-1f, 0x1.160408p-1f, 0x1.26a1ep-1f, 0x1.373fd8p-1f,
+       0x1.47ddcep-1f, 0x1.587ba4p-1f, 0x1.69197cp-1f, 0x1.79b58p-1f, 0x1.86a188p-1f, 0x1.9079a6p-1f,
+       0x1.9a51bap-1f, 0x1.a429d8p-1f, 0x1.ae01f4p-1f, 0x1.b7da14p-1f, 0x1.c1b232p-1f, 0x1.cb8a46p-1f,
+       0x1.d56264p-1f, 0x1.df3a8p-1f, 0x1.e90f5ep-1f, 0x1.ee5904p-1f, 0x1.eff7c4p-1f, 0x1.f19684p-1f,
+       0x1.f33548p-1f, 0x1.f4d408p-1f, 0x1.f672ccp-1f, 0x1.f8118cp-1f, 0x1.f9b05p-1f, 0x1.fb4f12p-1f,
+       0x1.fcedd4p-1f, 0x1.fe8bc2p-1f, 0x1.ff4a88p-1f, 0x1.ff5b0cp-1f, 0x1.ff6b94p-1f, 0x1.ff7c18p-1f,
+       0x1.ff8c9ep-1f, 0x1.ff9d24p-1f, 0x1.ffada8p-1f, 0x1.ffbe3p-1f, 0x1.ffceb4p-1f, 0x1.ffdf38p-1f,
+       0x1.ffefbp-1f, 0x1.fff31cp-1f, 0x1.ffecbp-1f, 0x1.ffe64p-1f, 0x1.ffdfd4p-1f, 0x1.ffd968p-1f,
+       0x1.ffd2fap-1f, 0x1.ffcc8cp-1f, 0x1.ffc62p-1f, 0x1.ffbfbp-1f, 0x1.ffb944p-1f, 0x1.ffb2e4p-1f,
+       0x1.ffb4p-1f, 0x1.ffba98p-1f, 0x1.ffc13p-1f, 0x1.ffc7c8p-1f, 0x1.ffce6p-1f, 0x1.ffd4f8p-1f,
+       0x1.ffdb9p-1f, 0x1.ffe228p-1f, 0x1.ffe8bep-1f, 0x1.ffef56p-1f, 0x1.fff5dep-1f, 0x1.fff4bap-1f,
+       0x1.ffee24p-1f, 0x1.ffe78ep-1f, 0x1.ffe0f6p-1f, 0x1.ffda6p-1f, 0x1.ffd3c8p-1f, 0x1.ffcd3p-1f,
+       0x1.ffc69cp-1f, 0x1.ffc004p-1f, 0x1.ffb96cp-1f, 0x1.ffb2dap-1f, 0x1.ffae34p-1f, 0x1.ffaae2p-1f,
+       0x1.ffa79p-1f, 0x1.ffa43cp-1f, 0x1.ffa0e8p-1f, 0x1.ff9d96p-1f, 0x1.ff9a42p-1f, 0x1.ff96fp-1f,
+       0x1.ff939cp-1f, 0x1.ff9048p-1f, 0x1.ff8a36p-1f, 0x1.fe70e6p-1f, 0x1.fca0ccp-1f, 0x1.fad0b8p-1f,
+       0x1.f900ap-1f, 0x1.f7308ap-1f, 0x1.f5607p-1f, 0x1.f39056p-1f, 0x1.f1c04p-1f, 0x1.eff024p-1f,
+       0x1.ee200cp-1f, 0x1.ec37d6p-1f, 0x1.e22a24p-1f, 0x1.d2deb4p-1f, 0x1.c39328p-1f, 0x1.b4479cp-1f,
+       0x1.a4fc2cp-1f, 0x1.95b0bcp-1f, 0x1.86654ep-1f, 0x1.7719cp-1f, 0x1.67ce34p-1f, 0x1.5882c4p-1f,
+       0x1.4932f2p-1f, 0x1.389732p-1f, 0x1.272c5ep-1f, 0x1.15c188p-1f, 0x1.0456d8p-1f, 0x1.e5d84ap-2f,
+       0x1.c302e8p-2f, 0x1.a02d4p-2f, 0x1.7d5798p-2f, 0x1.5a8234p-2f, 0x1.37acdp-2f, 0x1.14f31cp-2f,
+       0x1.f2de18p-3f, 0x1.c48cap-3f, 0x1.963b88p-3f, 0x1.67ea14p-3f, 0x1.3998fep-3f, 0x1.0b47e4p-3f,
+       0x1.b9ecep-4f, 0x1.5d4ab2p-4f, 0x1.00a7cap-4f, 0x1.480b32p-5f, 0x1.2141cep-6f, 0x1.1c1064p-7f,
+       0x1.edb5p-8f, 0x1.a348ap-8f, 0x1.58dcd8p-8f, 0x1.0e710cp-8f, 0x1.88095ap-9f, 0x1.e6639p-10f,
+       0x1.796426p-11f, -0x1.b3fdacp-12f, -0x1.96ae9p-10f, -0x1.5e9f3p-9f, -0x1.9eef9cp-9f, -0x1.b025ap-9f,
+       -0x1.c15bap-9f, -0x1.d2918p-9f, -0x1.e3c762p-9f, -0x1.f4fd64p-9f, -0x1.0319b4p-8f, -0x1.0bb4a4p-8f,
+       -0x1.144f94p-8f, -0x1.1cea84p-8f, -0x1.25985p-8f, -0x1.31cac8p-8f, -0x1.3fecdep-8f, -0x1.4e0ef4p-8f,
+       -0x1.5c310cp-8f, -0x1.6a534p-8f, -0x1.787572p-8f, -0x1.869788p-8f, -0x1.94b9ap-8f, -0x1.a2dbb6p-8f,
+       -0x1.b0fdeap-8f, -0x1.bf1af4p-8f, -0x1.cc57e8p-8f, -0x1.d91d54p-8f, -0x1.e5e2bcp-8f, -0x1.f2a84p-8f,
+       -0x1.ff6dc6p-8f, -0x1.061998p-7f, -0x1.0c7c4cp-7f, -0x1.12df02p-7f, -0x1.1941c4p-7f, -0x1.1fa484p-7f,
+       -0x1.25e6f2p-7f, -0x1.272a44p-7f, -0x1.25d78p-7f, -0x1.2484cp-7f, -0x1.2331fcp-7f, -0x1.21df3cp-7f,
+       -0x1.208c78p-7f, -0x1.1f39b4p-7f, -0x1.1de6f4p-7f, -0x1.1c943p-7f, -0x1.1b417p-7f, -0x1.19f1bap-7f,
+       -0x1.191094p-7f, -0x1.1866fp-7f, -0x1.17bd48p-7f, -0x1.1713ap-7f, -0x1.1669fcp-7f, -0x1.15c056p-7f,
+       -0x1.1516bp-7f, -0x1.146d0ap-7f, -0x1.13c364p-7f, -0x1.1319bep-7f, -0x1.126be6p-7f, -0x1.11321p-7f,
+       -0x1.0fb41p-7f, -0x1.0e3612p-7f, -0x1.0cb814p-7f, -0x1.0b3a14p-7f, -0x1.09bc16p-7f, -0x1.083e16p-7f,
+       -0x1.06c018p-7f, -0x1.05421ap-7f, -0x1.03c418p-7f, -0x1.01cceep-7f, -0x1.e28154p-8f, -0x1.b3a34ep-8f,
+       -0x1.84c548p-8f, -0x1.55e686p-8f, -0x1.270824p-8f, -0x1.f0543cp-9f, -0x1.9298eap-9f, -0x1.34dcdcp-9f,
+       -0x1.ae3eb4p-10f, -0x1.e58a54p-11f, -0x1.c5424ap-13f, 0x1.6b11e6p-12f, 0x1.b8f474p-11f, 0x1.5e32p-10f,
+       0x1.dfe8c4p-10f, 0x1.30cf42p-9f, 0x1.71aa22p-9f, 0x1.b285p-9f, 0x1.f36062p-9f, 0x1.1a1de4p-8f,
+       0x1.3a8b54p-8f, 0x1.58e6a2p-8f, 0x1.405fp-8f, 0x1.0f736cp-8f, 0x1.bd0fbp-9f, 0x1.5b395p-9f,
+       0x1.f2c5d8p-10f, 0x1.2f1912p-10f, 0x1.adb136p-12f, -0x1.610804p-12f, -0x1.1bf05p-10f, -0x1.df9d14p-10f,
+       -0x1.4ef714p-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f,
+       -0x1.6baacp-9f, -0x1.6baacp-9f, -0x1.6baacp-9f}),
+    SpectrumT<471>({0x1.fbf43cp-1f, 0x1.fbf43cp-1f, 0x1.fbf43cp-1f, 0x1.fbf43cp-1f, 0x1.fbf43cp-1f, 0x1.fbf43cp-1f,
+       0x1.fbf43cp-1f, 0x1.fbf43cp-1f, 0x1.fbf43cp-1f, 0x1.fbf43cp-1f, 0x1.fbf43cp-1f, 0x1.fbf43cp-1f,
+       0x1.fbf43cp-1f, 0x1.fbf43cp-1f, 0x1.fbf43cp-1f, 0x1.fbf43cp-1f, 0x1.fbf43cp-1f, 0x1.fbf43cp-1f,
+       0x1.fbf43cp-1f, 0x1.fbf43cp-1f, 0x1.fbe204p-1f, 0x1.fbba4cp-1f, 0x1.fb928cp-1f, 0x1.fb6accp-1f,
+       0x1.fb4308p-1f, 0x1.fb1b48p-1f, 0x1.faf388p-1f, 0x1.facbc8p-1f, 0x1.faa408p-1f, 0x1.fa7c48p-1f,
+       0x1.fa5486p-1f, 0x1.fa643ap-1f, 0x1.fab33p-1f, 0x1.fb0234p-1f, 0x1.fb5138p-1f, 0x1.fba03ep-1f,
+       0x1.fbef42p-1f, 0x1.fc3e48p-1f, 0x1.fc8d4cp-1f, 0x1.fcdc5p-1f, 0x1.fd2b54p-1f, 0x1.fd7a58p-1f,
+       0x1.fda33ep-1f, 0x1.fda21ap-1f, 0x1.fda0fp-1f, 0x1.fd9fc8p-1f, 0x1.fd9eap-1f, 0x1.fd9d78p-1f,
+       0x1.fd9c5p-1f, 0x1.fd9b24p-1f, 0x1.fd99fcp-1f, 0x1.fd98d4p-1f, 0x1.fd97acp-1f, 0x1.fd82fap-1f,
+       0x1.fd598p-1f, 0x1.fd3004p-1f, 0x1.fd0688p-1f, 0x1.fcdd0cp-1f, 0x1.fcb39p-1f, 0x1.fc8a14p-1f,
+       0x1.fc6098p-1f, 0x1.fc371cp-1f, 0x1.fc0d9ep-1f, 0x1.fbe424p-1f, 0x1.fc00c4p-1f, 0x1.fc6576p-1f,
+       0x1.fcca28p-1f, 0x1.fd2edcp-1f, 0x1.fd938cp-1f, 0x1.fdf84p-1f, 0x1.fe5cf2p-1f, 0x1.fec1a4p-1f,
+       0x1.ff2658p-1f, 0x1.ff8b0ap-1f, 0x1.ffefbcp-1f, 0x1.000f38p+0f, 0x1.000bccp+0f, 0x1.00086p+0f,
+       0x1.0004f4p+0f, 0x1.00018ap+0f, 0x1.fffc3cp-1f, 0x1.fff564p-1f, 0x1.ffee8ep-1f, 0x1.ffe7b8p-1f,
+       0x1.ffe0ep-1f, 0x1.ffda08p-1f, 0x1.ffd7e2p-1f, 0x1.ffda3ap-1f, 0x1.ffdc92p-1f, 0x1.ffdee8p-1f,
+       0x1.ffe14p-1f, 0x1.ffe398p-1f, 0x1.ffe5fp-1f, 0x1.ffe848p-1f, 0x1.ffea9ep-1f, 0x1.ffecf6p-1f,
+       0x1.ffef44p-1f, 0x1.ff946ap-1f, 0x1.fee36ep-1f, 0x1.fe3274p-1f, 0x1.fd8178p-1f, 0x1.fcd07cp-1f,
+       0x1.fc1f8p-1f, 0x1.fb6e84p-1f, 0x1.fabd86p-1f, 0x1.fa0c8cp-1f, 0x1.f95b9p-1f, 0x1.f8a9bp-1f,
+       0x1.f38b0cp-1f, 0x1.ea78b8p-1f, 0x1.e1665cp-1f, 0x1.d854p-1f, 0x1.cf41a4p-1f, 0x1.c62f48p-1f,
+       0x1.bd1cf4p-1f, 0x1.b40a98p-1f, 0x1.aaf83cp-1f, 0x1.a1e5ep-1f, 0x1.98d33ap-1f, 0x1.8ee274p-1f,
+       0x1.8431d4p-1f, 0x1.798134p-1f, 0x1.6ed0a8p-1f, 0x1.64202p-1f, 0x1.596f94p-1f, 0x1.4ebef4p-1f,
+       0x1.440e54p-1f, 0x1.395dc8p-1f, 0x1.2ead4p-1f, 0x1.23fca8p-1f, 0x1.194bf8p-1f, 0x1.0e9b4p-1f,
+       0x1.03ea94p-1f, 0x1.f273bcp-2f, 0x1.dd124ep-2f, 0x1.c7b0ep-2f, 0x1.b24f72p-2f, 0x1.9cee18p-2f,
+       0x1.878cacp-2f, 0x1.722b4p-2f, 0x1.5ccb1cp-2f, 0x1.493932p-2f, 0x1.371c72p-2f, 0x1.24ffap-2f,
+       0x1.12e2dp-2f, 0x1.00c61p-2f, 0x1.dd527cp-3f, 0x1.b918d8p-3f, 0x1.94df34p-3f, 0x1.70a56cp-3f,
+       0x1.4c6bc8p-3f, 0x1.2839b8p-3f, 0x1.0c01dap-3f, 0x1.ec0974p-4f, 0x1.c00f34p-4f, 0x1.9414f4p-4f,
+       0x1.681a5ap-4f, 0x1.3c1fc2p-4f, 0x1.102582p-4f, 0x1.c85684p-5f, 0x1.7062p-5f, 0x1.186cdp-5f,
+       0x1.815542p-6f, 0x1.25ba7cp-6f, 0x1.09868p-6f, 0x1.daa492p-7f, 0x1.a23c24p-7f, 0x1.69d428p-7f,
+       0x1.316c2ep-7f, 0x1.f20866p-8f, 0x1.81378cp-8f, 0x1.1066b2p-8f, 0x1.3f2d7ap-9f, 0x1.792efep-11f,
+       -0x1.ca241p-16f, -0x1.125e28p-14f, -0x1.b2348cp-14f, -0x1.2904d8p-13f, -0x1.78f00ap-13f, -0x1.c8db3cp-13f,
+       -0x1.0c62e6p-12f, -0x1.34583p-12f, -0x1.5c4d7ap-12f, -0x1.844312p-12f, -0x1.ac0d7cp-12f, -0x1.bc49f8p-12f,
+       -0x1.bbd968p-12f, -0x1.bb68d8p-12f, -0x1.baf844p-12f, -0x1.ba87b4p-12f, -0x1.ba1724p-12f, -0x1.b9a692p-12f,
+       -0x1.b936p-12f, -0x1.b8c56ep-12f, -0x1.b854dep-12f, -0x1.b6daa6p-12f, -0x1.3ba174p-12f, -0x1.b3b104p-14f,
+       0x1.8723ccp-14f, 0x1.307c88p-12f, 0x1.ff301cp-12f, 0x1.66f1d8p-11f, 0x1.ce4c74p-11f, 0x1.1ad388p-10f,
+       0x1.4e806cp-10f, 0x1.822d5p-10f, 0x1.b5d61p-10f, 0x1.e7df4cp-10f, 0x1.0c6a28p-9f, 0x1.24e478p-9f,
+       0x1.3d5ec8p-9f, 0x1.55d91ap-9f, 0x1.6e539cp-9f, 0x1.86ce1cp-9f, 0x1.9f486cp-9f, 0x1.b7c2eep-9f,
+       0x1.d03d7p-9f, 0x1.e82f1ep-9f, 0x1.d1fc34p-9f, 0x1.9e1978p-9f, 0x1.6a3654p-9f, 0x1.365334p-9f,
+       0x1.02707ap-9f, 0x1.9d1b8p-10f, 0x1.355608p-10f, 0x1.9b1f88p-11f, 0x1.972602p-12f, -0x1.fbf2ep-18f,
+       -0x1.a3464cp-12f, -0x1.11b6c8p-11f, -0x1.f3079p-12f, -0x1.c2a18cp-12f, -0x1.923becp-12f, -0x1.61d64cp-12f,
+       -0x1.3170aap-12f, -0x1.010aa8p-12f, -0x1.a1494cp-13f, -0x1.407e0ap-13f, -0x1.bf659p-14f, -0x1.c9444p-15f,
+       0x1.a1462ap-12f, 0x1.1e548ap-10f, 0x1.d4561ep-10f, 0x1.452c9p-9f, 0x1.a02d58p-9f, 0x1.fb2e22p-9f,
+       0x1.2b17dp-8f, 0x1.589834p-8f, 0x1.8618f4p-8f, 0x1.b3995ap-8f, 0x1.e1c3a8p-8f, 0x1.1ba4b6p-7f,
+       0x1.51ed6ep-7f, 0x1.883692p-7f, 0x1.be7f48p-7f, 0x1.f4c8p-7f, 0x1.158892p-6f, 0x1.30acecp-6f,
+       0x1.4bd17ep-6f, 0x1.66f61p-6f, 0x1.821a6cp-6f, 0x1.9d245ep-6f, 0x1.b2b2bep-6f, 0x1.c52464p-6f,
+       0x1.d7960ap-6f, 0x1.ea078cp-6f, 0x1.fc790ep-6f, 0x1.07755ap-5f, 0x1.10ae2cp-5f, 0x1.19e6eep-5f,
+       0x1.231fbp-5f, 0x1.2c587p-5f, 0x1.358e98p-5f, 0x1.3e451p-5f, 0x1.46b53p-5f, 0x1.4f255p-5f,
+       0x1.57956cp-5f, 0x1.60059cp-5f, 0x1.6875ccp-5f, 0x1.70e5ecp-5f, 0x1.79560ap-5f, 0x1.81c628p-5f,
+       0x1.8a3658p-5f, 0x1.9286e6p-5f, 0x1.9578d4p-5f, 0x1.958d2p-5f, 0x1.95a17p-5f, 0x1.95b5bcp-5f,
+       0x1.95ca0cp-5f, 0x1.95de58p-5f, 0x1.95f2a6p-5f, 0x1.9606f4p-5f, 0x1.961b4p-5f, 0x1.962f8ep-5f,
+       0x1.964434p-5f, 0x1.9666c4p-5f, 0x1.969084p-5f, 0x1.96ba44p-5f, 0x1.96e408p-5f, 0x1.970dc8p-5f,
+       0x1.973788p-5f, 0x1.976148p-5f, 0x1.978b0ap-5f, 0x1.97b4ccp-5f, 0x1.97de8cp-5f, 0x1.97e54p-5f,
+       0x1.92f46ap-5f, 0x1.8b855cp-5f, 0x1.84164p-5f, 0x1.7ca734p-5f, 0x1.753828p-5f, 0x1.6dc90cp-5f,
+       0x1.6659fcp-5f, 0x1.5eeaep-5f, 0x1.577bd4p-5f, 0x1.500cc8p-5f, 0x1.48a00ep-5f, 0x1.418326p-5f,
+       0x1.3a8d04p-5f, 0x1.3396fp-5f, 0x1.2ca0dcp-5f, 0x1.25aabap-5f, 0x1.1eb4a6p-5f, 0x1.17be84p-5f,
+       0x1.10c87p-5f, 0x1.09d25cp-5f, 0x1.02dc3ap-5f, 0x1.f7ccfap-6f, 0x1.e9f62cp-6f, 0x1.dc2944p-6f,
+       0x1.ce5c5ep-6f, 0x1.c08f42p-6f, 0x1.b2c242p-6f, 0x1.a4f55cp-6f, 0x1.97289p-6f, 0x1.895bacp-6f,
+       0x1.7b8e9p-6f, 0x1.6dc19p-6f, 0x1.5fc7a2p-6f, 0x1.4cc978p-6f, 0x1.377ed6p-6f, 0x1.2233ep-6f,
+       0x1.0ce914p-6f, 0x1.ef3ce6p-7f, 0x1.c4a7a2p-7f, 0x1.9a126p-7f, 0x1.6f7cc8p-7f, 0x1.44e73p-7f,
+       0x1.1a51ecp-7f, 0x1.e13814p-8f, 0x1.bc0d9p-8f, 0x1.ab7098p-8f, 0x1.9ad39ep-8f, 0x1.8a36c8p-8f,
+       0x1.7999fp-8f, 0x1.68fd16p-8f, 0x1.58604p-8f, 0x1.47c346p-8f, 0x1.37264cp-8f, 0x1.268976p-8f,
+       0x1.166114p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f,
+       0x1.118172p-8f, 0x1.118172p-8f, 0x1.118172p-8f}),
+    SpectrumT<471>({0x1.2811e8p+0f, 0x1.2811e8p+0f, 0x1.2811e8p+0f, 0x1.2811e8p+0f, 0x1.2811e8p+0f, 0x1.2811e8p+0f,
+       0x1.2811e8p+0f, 0x1.2811e8p+0f, 0x1.2811e8p+0f, 0x1.2811e8p+0f, 0x1.2811e8p+0f, 0x1.2811e8p+0f,
+       0x1.2811e8p+0f, 0x1.2811e8p+0f, 0x1.2811e8p+0f, 0x1.2811e8p+0f, 0x1.2811e8p+0f, 0x1.2811e8p+0f,
+       0x1.2811e8p+0f, 0x1.2811e8p+0f, 0x1.281274p+0f, 0x1.2813a4p+0f, 0x1.2814d4p+0f, 0x1.281604p+0f,
+       0x1.281734p+0f, 0x1.281864p+0f, 0x1.281994p+0f, 0x1.281ac6p+0f, 0x1.281bf6p+0f, 0x1.281d26p+0f,
+       0x1.281e56p+0f, 0x1.281eaep+0f, 0x1.281e14p+0f, 0x1.281d78p+0f, 0x1.281cdcp+0f, 0x1.281c4p+0f,
+       0x1.281ba2p+0f, 0x1.281b06p+0f, 0x1.281a6ap+0f, 0x1.2819cep+0f, 0x1.281932p+0f, 0x1.281896p+0f,
+       0x1.28155p+0f, 0x1.280f18p+0f, 0x1.2808e4p+0f, 0x1.2802acp+0f, 0x1.27fc76p+0f, 0x1.27f64p+0f,
+       0x1.27f008p+0f, 0x1.27e9d2p+0f, 0x1.27e39cp+0f, 0x1.27dd64p+0f, 0x1.27d72ep+0f, 0x1.27d5d4p+0f,
+       0x1.27d9a2p+0f, 0x1.27dd72p+0f, 0x1.27e142p+0f, 0x1.27e512p+0f, 0x1.27e8e2p+0f, 0x1.27ecb2p+0f,
+       0x1.27f082p+0f, 0x1.27f452p+0f, 0x1.27f82p+0f, 0x1.27fbfp+0f, 0x1.27ff7ep+0f, 0x1.2802c4p+0f,
+       0x1.28060cp+0f, 0x1.280954p+0f, 0x1.280c9ap+0f, 0x1.280fe2p+0f, 0x1.28132ap+0f, 0x1.28167p+0f,
+       0x1.2819b8p+0f, 0x1.281dp+0f, 0x1.282046p+0f, 0x1.282204p+0f, 0x1.282238p+0f, 0x1.28226ep+0f,
+       0x1.2822a4p+0f, 0x1.2822d8p+0f, 0x1.28230ep+0f, 0x1.282344p+0f, 0x1.282378p+0f, 0x1.2823acp+0f,
+       0x1.2823e4p+0f, 0x1.28241ap+0f, 0x1.282418p+0f, 0x1.2823e2p+0f, 0x1.2823aep+0f, 0x1.282378p+0f,
+       0x1.282344p+0f, 0x1.28231p+0f, 0x1.2822dap+0f, 0x1.2822a6p+0f, 0x1.28227p+0f, 0x1.28223cp+0f,
+       0x1.282206p+0f, 0x1.2820a8p+0f, 0x1.281e34p+0f, 0x1.281bcp+0f, 0x1.28194cp+0f, 0x1.2816d8p+0f,
+       0x1.281464p+0f, 0x1.2811fp+0f, 0x1.280f7cp+0f, 0x1.280d08p+0f, 0x1.280a94p+0f, 0x1.28082p+0f,
+       0x1.280812p+0f, 0x1.280a28p+0f, 0x1.280c3cp+0f, 0x1.280e5p+0f, 0x1.281066p+0f, 0x1.28127cp+0f,
+       0x1.28149p+0f, 0x1.2816a4p+0f, 0x1.2818bap+0f, 0x1.281adp+0f, 0x1.281ce4p+0f, 0x1.281d3cp+0f,
+       0x1.281c18p+0f, 0x1.281afp+0f, 0x1.2819ccp+0f, 0x1.2818a8p+0f, 0x1.281784p+0f, 0x1.28165ep+0f,
+       0x1.281538p+0f, 0x1.281414p+0f, 0x1.2812eep+0f, 0x1.2811cap+0f, 0x1.2811p+0f, 0x1.281088p+0f,
+       0x1.28100ep+0f, 0x1.280f94p+0f, 0x1.280f1ap+0f, 0x1.280eap+0f, 0x1.280e26p+0f, 0x1.280dacp+0f,
+       0x1.280d32p+0f, 0x1.280cb8p+0f, 0x1.280c4p+0f, 0x1.280d4p+0f, 0x1.280f74p+0f, 0x1.2811a6p+0f,
+       0x1.2813d8p+0f, 0x1.28160cp+0f, 0x1.28184p+0f, 0x1.281a72p+0f, 0x1.281ca4p+0f, 0x1.281ed8p+0f,
+       0x1.28210ap+0f, 0x1.28231ep+0f, 0x1.280444p+0f, 0x1.27cbbp+0f, 0x1.27931ep+0f, 0x1.275a8cp+0f,
+       0x1.2721fap+0f, 0x1.26e968p+0f, 0x1.26b0d6p+0f, 0x1.267844p+0f, 0x1.263fb2p+0f, 0x1.26072p+0f,
+       0x1.25ce7ap+0f, 0x1.2588aap+0f, 0x1.2538dcp+0f, 0x1.24e91p+0f, 0x1.249942p+0f, 0x1.244976p+0f,
+       0x1.23f9aap+0f, 0x1.23a9ep+0f, 0x1.235a14p+0f, 0x1.230a44p+0f, 0x1.22ba78p+0f, 0x1.226adcp+0f,
+       0x1.223992p+0f, 0x1.221e7ap+0f, 0x1.220362p+0f, 0x1.21e84ap+0f, 0x1.21cd3p+0f, 0x1.21b218p+0f,
+       0x1.2197p+0f, 0x1.217be8p+0f, 0x1.2160dp+0f, 0x1.2145b6p+0f, 0x1.212abap+0f, 0x1.211e5cp+0f,
+       0x1.211c5cp+0f, 0x1.211a5cp+0f, 0x1.211858p+0f, 0x1.211658p+0f, 0x1.211458p+0f, 0x1.211258p+0f,
+       0x1.211056p+0f, 0x1.210e54p+0f, 0x1.210c54p+0f, 0x1.2107fap+0f, 0x1.1ff04ep+0f, 0x1.1e1bd8p+0f,
+       0x1.1c476p+0f, 0x1.1a72ecp+0f, 0x1.189e78p+0f, 0x1.16ca04p+0f, 0x1.14f58cp+0f, 0x1.132116p+0f,
+       0x1.114ca2p+0f, 0x1.0f783p+0f, 0x1.0da65cp+0f, 0x1.0cdc44p+0f, 0x1.0cc158p+0f, 0x1.0ca668p+0f,
+       0x1.0c8b78p+0f, 0x1.0c708ap+0f, 0x1.0c559cp+0f, 0x1.0c3aacp+0f, 0x1.0c1fcp+0f, 0x1.0c04dp+0f,
+       0x1.0be9ep+0f, 0x1.0bccf4p+0f, 0x1.0b03dcp+0f, 0x1.09ccp+0f, 0x1.089422p+0f, 0x1.075c44p+0f,
+       0x1.062468p+0f, 0x1.04ec8cp+0f, 0x1.03b4aep+0f, 0x1.027cdp+0f, 0x1.0144f2p+0f, 0x1.000d16p+0f,
+       0x1.fdabdep-1f, 0x1.fba852p-1f, 0x1.f9e754p-1f, 0x1.f82654p-1f, 0x1.f66556p-1f, 0x1.f4a458p-1f,
+       0x1.f2e35cp-1f, 0x1.f1226p-1f, 0x1.ef616p-1f, 0x1.eda062p-1f, 0x1.ebdf66p-1f, 0x1.ea1f1ep-1f,
+       0x1.e88d44p-1f, 0x1.e7178p-1f, 0x1.e5a1bcp-1f, 0x1.e42bf8p-1f, 0x1.e2b638p-1f, 0x1.e14074p-1f,
+       0x1.dfcabp-1f, 0x1.de54ecp-1f, 0x1.dcdf28p-1f, 0x1.db6966p-1f, 0x1.d9f65ap-1f, 0x1.d9248cp-1f,
+       0x1.d8b12cp-1f, 0x1.d83dc8p-1f, 0x1.d7ca68p-1f, 0x1.d75704p-1f, 0x1.d6e3a2p-1f, 0x1.d6704p-1f,
+       0x1.d5fcep-1f, 0x1.d5897cp-1f, 0x1.d5161cp-1f, 0x1.d4a1e2p-1f, 0x1.d40118p-1f, 0x1.d347p-1f,
+       0x1.d28ce8p-1f, 0x1.d1d2dp-1f, 0x1.d118bcp-1f, 0x1.d05ea4p-1f, 0x1.cfa48ap-1f, 0x1.ceea74p-1f,
+       0x1.ce305cp-1f, 0x1.cd7646p-1f, 0x1.ccbe04p-1f, 0x1.cc5e14p-1f, 0x1.cc2ebcp-1f, 0x1.cbff68p-1f,
+       0x1.cbd01p-1f, 0x1.cba0bap-1f, 0x1.cb7164p-1f, 0x1.cb420cp-1f, 0x1.cb12b8p-1f, 0x1.cae36p-1f,
+       0x1.cab40ap-1f, 0x1.ca8436p-1f, 0x1.ca3f54p-1f, 0x1.c9ef32p-1f, 0x1.c99f1p-1f, 0x1.c94efp-1f,
+       0x1.c8feccp-1f, 0x1.c8aeacp-1f, 0x1.c85e88p-1f, 0x1.c80e66p-1f, 0x1.c7be44p-1f, 0x1.c76e22p-1f,
+       0x1.c71e0cp-1f, 0x1.c6cfd6p-1f, 0x1.c68298p-1f, 0x1.c63558p-1f, 0x1.c5e81cp-1f, 0x1.c59adep-1f,
+       0x1.c54dap-1f, 0x1.c5006p-1f, 0x1.c4b32p-1f, 0x1.c465e4p-1f, 0x1.c418a6p-1f, 0x1.c3cc5p-1f,
+       0x1.c3a0f8p-1f, 0x1.c38634p-1f, 0x1.c36b6cp-1f, 0x1.c350a4p-1f, 0x1.c335ep-1f, 0x1.c31b18p-1f,
+       0x1.c30052p-1f, 0x1.c2e58ap-1f, 0x1.c2cac4p-1f, 0x1.c2affcp-1f, 0x1.c294e4p-1f, 0x1.c26ee4p-1f,
+       0x1.c24398p-1f, 0x1.c2184cp-1f, 0x1.c1edp-1f, 0x1.c1c1b4p-1f, 0x1.c19668p-1f, 0x1.c16b1cp-1f,
+       0x1.c13fdp-1f, 0x1.c11484p-1f, 0x1.c0e938p-1f, 0x1.c0bfccp-1f, 0x1.c0d016p-1f, 0x1.c0fbap-1f,
+       0x1.c1272ap-1f, 0x1.c152b6p-1f, 0x1.c17e42p-1f, 0x1.c1a9ccp-1f, 0x1.c1d556p-1f, 0x1.c200ep-1f,
+       0x1.c22c6cp-1f, 0x1.c257f8p-1f, 0x1.c282acp-1f, 0x1.c2956cp-1f, 0x1.c29d36p-1f, 0x1.c2a5p-1f,
+       0x1.c2accap-1f, 0x1.c2b494p-1f, 0x1.c2bc5cp-1f, 0x1.c2c424p-1f, 0x1.c2cbfp-1f, 0x1.c2d3b8p-1f,
+       0x1.c2db8p-1f, 0x1.c2e3d2p-1f, 0x1.c2fa1cp-1f, 0x1.c3169ep-1f, 0x1.c3332p-1f, 0x1.c34fap-1f,
+       0x1.c36c22p-1f, 0x1.c388a4p-1f, 0x1.c3a524p-1f, 0x1.c3c1a4p-1f, 0x1.c3de26p-1f, 0x1.c3faa8p-1f,
+       0x1.c41662p-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f,
+       0x1.c41ebep-1f, 0x1.c41ebep-1f, 0x1.c41ebep-1f}),
+    SpectrumT<471>({0x1.2229a6p+0f, 0x1.2229a6p+0f, 0x1.2229a6p+0f, 0x1.2229a6p+0f, 0x1.2229a6p+0f, 0x1.2229a6p+0f,
+       0x1.2229a6p+0f, 0x1.2229a6p+0f, 0x1.2229a6p+0f, 0x1.2229a6p+0f, 0x1.2229a6p+0f, 0x1.2229a6p+0f,
+       0x1.2229a6p+0f, 0x1.2229a6p+0f, 0x1.2229a6p+0f, 0x1.2229a6p+0f, 0x1.2229a6p+0f, 0x1.2229a6p+0f,
+       0x1.2229a6p+0f, 0x1.2229a6p+0f, 0x1.221724p+0f, 0x1.21eeccp+0f, 0x1.21c66cp+0f, 0x1.219e0cp+0f,
+       0x1.2175aap+0f, 0x1.214d4ap+0f, 0x1.2124e8p+0f, 0x1.20fc88p+0f, 0x1.20d428p+0f, 0x1.20abc8p+0f,
+       0x1.208366p+0f, 0x1.20842cp+0f, 0x1.20b3dcp+0f, 0x1.20e398p+0f, 0x1.211358p+0f, 0x1.214314p+0f,
+       0x1.2172dp+0f, 0x1.21a29p+0f, 0x1.21d24cp+0f, 0x1.22020cp+0f, 0x1.2231c8p+0f, 0x1.226184p+0f,
+       0x1.227d8cp+0f, 0x1.2283dep+0f, 0x1.228a2cp+0f, 0x1.229078p+0f, 0x1.2296c4p+0f, 0x1.229d12p+0f,
+       0x1.22a36p+0f, 0x1.22a9acp+0f, 0x1.22affap+0f, 0x1.22b646p+0f, 0x1.22bc94p+0f, 0x1.22bf8ap+0f,
+       0x1.22beecp+0f, 0x1.22be5p+0f, 0x1.22bdb4p+0f, 0x1.22bd18p+0f, 0x1.22bc7cp+0f, 0x1.22bbdep+0f,
+       0x1.22bb42p+0f, 0x1.22baa6p+0f, 0x1.22ba0ap+0f, 0x1.22b96ep+0f, 0x1.22ba84p+0f, 0x1.22bd6p+0f,
+       0x1.22c038p+0f, 0x1.22c314p+0f, 0x1.22c5ecp+0f, 0x1.22c8c8p+0f, 0x1.22cbap+0f, 0x1.22ce7cp+0f,
+       0x1.22d154p+0f, 0x1.22d43p+0f, 0x1.22d70ap+0f, 0x1.22d8c2p+0f, 0x1.22d96p+0f, 0x1.22d9fcp+0f,
+       0x1.22da98p+0f, 0x1.22db34p+0f, 0x1.22dbd2p+0f, 0x1.22dc6ep+0f, 0x1.22dd0cp+0f, 0x1.22dda8p+0f,
+       0x1.22de44p+0f, 0x1.22deep+0f, 0x1.22dffcp+0f, 0x1.22e19p+0f, 0x1.22e324p+0f, 0x1.22e4b4p+0f,
+       0x1.22e648p+0f, 0x1.22e7dap+0f, 0x1.22e96ep+0f, 0x1.22eb02p+0f, 0x1.22ec94p+0f, 0x1.22ee28p+0f,
+       0x1.22efbap+0f, 0x1.22ed78p+0f, 0x1.22e7aep+0f, 0x1.22e1e4p+0f, 0x1.22dc1ap+0f, 0x1.22d65p+0f,
+       0x1.22d084p+0f, 0x1.22cab8p+0f, 0x1.22c4eep+0f, 0x1.22bf24p+0f, 0x1.22b958p+0f, 0x1.22b39p+0f,
+       0x1.22b3a8p+0f, 0x1.22b8fep+0f, 0x1.22be54p+0f, 0x1.22c3acp+0f, 0x1.22c902p+0f, 0x1.22ce58p+0f,
+       0x1.22d3bp+0f, 0x1.22d906p+0f, 0x1.22de5cp+0f, 0x1.22e3b4p+0f, 0x1.22e908p+0f, 0x1.22ea52p+0f,
+       0x1.22e81ep+0f, 0x1.22e5eap+0f, 0x1.22e3b6p+0f, 0x1.22e182p+0f, 0x1.22df4ep+0f, 0x1.22dd18p+0f,
+       0x1.22dae4p+0f, 0x1.22d8bp+0f, 0x1.22d67cp+0f, 0x1.22d446p+0f, 0x1.22d334p+0f, 0x1.22d31p+0f,
+       0x1.22d2eap+0f, 0x1.22d2c6p+0f, 0x1.22d2ap+0f, 0x1.22d27cp+0f, 0x1.22d258p+0f, 0x1.22d232p+0f,
+       0x1.22d20ep+0f, 0x1.22d1e8p+0f, 0x1.22d1c4p+0f, 0x1.22cfc4p+0f, 0x1.22cc44p+0f, 0x1.22c8c8p+0f,
+       0x1.22c548p+0f, 0x1.22c1ccp+0f, 0x1.22be4ep+0f, 0x1.22badp+0f, 0x1.22b75p+0f, 0x1.22b3d4p+0f,
+       0x1.22b054p+0f, 0x1.22acdcp+0f, 0x1.22ae4cp+0f, 0x1.22b39p+0f, 0x1.22b8d4p+0f, 0x1.22be18p+0f,
+       0x1.22c35cp+0f, 0x1.22c8ap+0f, 0x1.22cde6p+0f, 0x1.22d32ap+0f, 0x1.22d86ep+0f, 0x1.22ddb2p+0f,
+       0x1.22e2eep+0f, 0x1.22e298p+0f, 0x1.22de08p+0f, 0x1.22d978p+0f, 0x1.22d4e8p+0f, 0x1.22d058p+0f,
+       0x1.22cbcap+0f, 0x1.22c73ap+0f, 0x1.22c2aap+0f, 0x1.22be1ap+0f, 0x1.22b98cp+0f, 0x1.22b4fep+0f,
+       0x1.22b27cp+0f, 0x1.22b174p+0f, 0x1.22b07p+0f, 0x1.22af68p+0f, 0x1.22ae64p+0f, 0x1.22ad5cp+0f,
+       0x1.22ac58p+0f, 0x1.22ab5p+0f, 0x1.22aa48p+0f, 0x1.22a944p+0f, 0x1.22a83ap+0f, 0x1.22a654p+0f,
+       0x1.22a3ccp+0f, 0x1.22a148p+0f, 0x1.229ecp+0f, 0x1.229c38p+0f, 0x1.2299b4p+0f, 0x1.22972cp+0f,
+       0x1.2294a6p+0f, 0x1.22922p+0f, 0x1.228f98p+0f, 0x1.228c5ep+0f, 0x1.2236bcp+0f, 0x1.21a898p+0f,
+       0x1.211a74p+0f, 0x1.208c5p+0f, 0x1.1ffe2ep+0f, 0x1.1f700ap+0f, 0x1.1ee1e4p+0f, 0x1.1e53cp+0f,
+       0x1.1dc59ep+0f, 0x1.1d377ap+0f, 0x1.1ca2e4p+0f, 0x1.19889cp+0f, 0x1.14c18p+0f, 0x1.0ffa7p+0f,
+       0x1.0b335cp+0f, 0x1.066c4ap+0f, 0x1.01a52ep+0f, 0x1.f9bc26p-1f, 0x1.f02e02p-1f, 0x1.e69fcap-1f,
+       0x1.dd1192p-1f, 0x1.d37bfep-1f, 0x1.c7634p-1f, 0x1.b9acb8p-1f, 0x1.abf614p-1f, 0x1.9e3f7p-1f,
+       0x1.9088eap-1f, 0x1.82d262p-1f, 0x1.751bd8p-1f, 0x1.676534p-1f, 0x1.59ae92p-1f, 0x1.4bf80ap-1f,
+       0x1.3e3f68p-1f, 0x1.2fe7b4p-1f, 0x1.212cbap-1f, 0x1.1271cp-1f, 0x1.03b6ep-1f, 0x1.e9f804p-2f,
+       0x1.cc8248p-2f, 0x1.af0c54p-2f, 0x1.91965ep-2f, 0x1.7420a2p-2f, 0x1.56aae6p-2f, 0x1.394ef6p-2f,
+       0x1.22aac4p-2f, 0x1.1015d4p-2f, 0x1.fb021p-3f, 0x1.d5d83p-3f, 0x1.b0ae98p-3f, 0x1.8b84fep-3f,
+       0x1.665b1cp-3f, 0x1.413184p-3f, 0x1.1c07a2p-3f, 0x1.edbc14p-4f, 0x1.a3c518p-4f, 0x1.6f290ap-4f,
+       0x1.470f5cp-4f, 0x1.1ef56p-4f, 0x1.edb764p-5f, 0x1.9d840ap-5f, 0x1.4d500ep-5f, 0x1.fa396ap-6f,
+       0x1.59d174p-6f, 0x1.72d2fap-7f, 0x1.902cb2p-10f, -0x1.0afe3ep-7f, -0x1.7ebc6ep-7f, -0x1.803558p-7f,
+       -0x1.81ae44p-7f, -0x1.83272cp-7f, -0x1.84a014p-7f, -0x1.8618fcp-7f, -0x1.8791e8p-7f, -0x1.890adp-7f,
+       -0x1.8a83b6p-7f, -0x1.8bfc9ep-7f, -0x1.8d666ap-7f, -0x1.8bfc56p-7f, -0x1.8903d2p-7f, -0x1.860b5p-7f,
+       -0x1.8312ccp-7f, -0x1.801a42p-7f, -0x1.7d21b8p-7f, -0x1.7a2936p-7f, -0x1.7730b2p-7f, -0x1.74382ep-7f,
+       -0x1.713fa4p-7f, -0x1.6e5becp-7f, -0x1.6f013ap-7f, -0x1.718988p-7f, -0x1.7411d4p-7f, -0x1.769a28p-7f,
+       -0x1.792278p-7f, -0x1.7baac8p-7f, -0x1.7e3314p-7f, -0x1.80bb6p-7f, -0x1.8343b4p-7f, -0x1.85cc04p-7f,
+       -0x1.87f2fep-7f, -0x1.7b091ep-7f, -0x1.665324p-7f, -0x1.519d2cp-7f, -0x1.3ce70cp-7f, -0x1.28311p-7f,
+       -0x1.137aeep-7f, -0x1.fd8998p-8f, -0x1.d41da6p-8f, -0x1.aab162p-8f, -0x1.81457p-8f, -0x1.58e9aep-8f,
+       -0x1.57205p-8f, -0x1.68b394p-8f, -0x1.7a46fcp-8f, -0x1.8bda4p-8f, -0x1.9d6d84p-8f, -0x1.af00eep-8f,
+       -0x1.c09434p-8f, -0x1.d2279cp-8f, -0x1.e3baep-8f, -0x1.f54e24p-8f, -0x1.035a8ep-7f, -0x1.092884p-7f,
+       -0x1.0d8d88p-7f, -0x1.11f282p-7f, -0x1.16577cp-7f, -0x1.1abc8p-7f, -0x1.1f217cp-7f, -0x1.23867ep-7f,
+       -0x1.27eb78p-7f, -0x1.2c5074p-7f, -0x1.30b578p-7f, -0x1.34c152p-7f, -0x1.2e136p-7f, -0x1.2254d6p-7f,
+       -0x1.16964cp-7f, -0x1.0ad79p-7f, -0x1.fe31ep-8f, -0x1.e6b4ccp-8f, -0x1.cf37e4p-8f, -0x1.b7bacep-8f,
+       -0x1.a03d5ap-8f, -0x1.88c016p-8f, -0x1.71acb6p-8f, -0x1.66607ap-8f, -0x1.607938p-8f, -0x1.5a91ep-8f,
+       -0x1.54aa94p-8f, -0x1.4ec35p-8f, -0x1.48dc1p-8f, -0x1.42f4dp-8f, -0x1.3d0d82p-8f, -0x1.372634p-8f,
+       -0x1.313ef4p-8f, -0x1.2cb4f2p-8f, -0x1.4c53ap-8f, -0x1.7c03ecp-8f, -0x1.abb434p-8f, -0x1.db642p-8f,
+       -0x1.058a04p-7f, -0x1.1d61f8p-7f, -0x1.3539fp-7f, -0x1.4d1214p-7f, -0x1.64ea3ap-7f, -0x1.7cc22ep-7f,
+       -0x1.93f2fcp-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f,
+       -0x1.9af1aap-7f, -0x1.9af1aap-7f, -0x1.9af1aap-7f}),
+    SpectrumT<471>({0x1.09853cp+0f, 0x1.09853cp+0f, 0x1.09853cp+0f, 0x1.09853cp+0f, 0x1.09853cp+0f, 0x1.09853cp+0f,
+       0x1.09853cp+0f, 0x1.09853cp+0f, 0x1.09853cp+0f, 0x1.09853cp+0f, 0x1.09853cp+0f, 0x1.09853cp+0f,
+       0x1.09853cp+0f, 0x1.09853cp+0f, 0x1.09853cp+0f, 0x1.09853cp+0f, 0x1.09853cp+0f, 0x1.09853cp+0f,
+       0x1.09853cp+0f, 0x1.09853cp+0f, 0x1.09c02ep+0f, 0x1.0a40a4p+0f, 0x1.0ac13ap+0f, 0x1.0b41dp+0f,
+       0x1.0bc264p+0f, 0x1.0c42fcp+0f, 0x1.0cc39p+0f, 0x1.0d4428p+0f, 0x1.0dc4bcp+0f, 0x1.0e4554p+0f,
+       0x1.0ec5e8p+0f, 0x1.0f3c7cp+0f, 0x1.0fa7acp+0f, 0x1.1012d4p+0f, 0x1.107ep+0f, 0x1.10e92cp+0f,
+       0x1.115454p+0f, 0x1.11bf8p+0f, 0x1.122aacp+0f, 0x1.1295d4p+0f, 0x1.1301p+0f, 0x1.136c28p+0f,
+       0x1.13a31p+0f, 0x1.13a06p+0f, 0x1.139da8p+0f, 0x1.139aeep+0f, 0x1.139836p+0f, 0x1.13957cp+0f,
+       0x1.1392c4p+0f, 0x1.13900cp+0f, 0x1.138d52p+0f, 0x1.138a9ap+0f, 0x1.1387ep+0f, 0x1.138fe4p+0f,
+       0x1.13a35p+0f, 0x1.13b6bcp+0f, 0x1.13ca2cp+0f, 0x1.13dd98p+0f, 0x1.13f106p+0f, 0x1.140474p+0f,
+       0x1.1417ep+0f, 0x1.142b4cp+0f, 0x1.143ebcp+0f, 0x1.145228p+0f, 0x1.144cd4p+0f, 0x1.142e08p+0f,
+       0x1.140f3cp+0f, 0x1.13f07p+0f, 0x1.13d1a4p+0f, 0x1.13b2dap+0f, 0x1.13940ep+0f, 0x1.137544p+0f,
+       0x1.135678p+0f, 0x1.1337acp+0f, 0x1.1318ep+0f, 0x1.130492p+0f, 0x1.12faaap+0f, 0x1.12f0c2p+0f,
+       0x1.12e6dap+0f, 0x1.12dcf2p+0f, 0x1.12d30ap+0f, 0x1.12c92p+0f, 0x1.12bf38p+0f, 0x1.12b55p+0f,
+       0x1.12ab68p+0f, 0x1.12a182p+0f, 0x1.129e5p+0f, 0x1.12a18ap+0f, 0x1.12a4c4p+0f, 0x1.12a8p+0f,
+       0x1.12ab3ap+0f, 0x1.12ae76p+0f, 0x1.12b1bp+0f, 0x1.12b4ecp+0f, 0x1.12b828p+0f, 0x1.12bb62p+0f,
+       0x1.12be9ep+0f, 0x1.12dc78p+0f, 0x1.1312ecp+0f, 0x1.13495ep+0f, 0x1.137fdp+0f, 0x1.13b644p+0f,
+       0x1.13ecb4p+0f, 0x1.142328p+0f, 0x1.14599cp+0f, 0x1.14900cp+0f, 0x1.14c68p+0f, 0x1.14fceep+0f,
+       0x1.151be4p+0f, 0x1.1525e8p+0f, 0x1.152fe8p+0f, 0x1.1539ecp+0f, 0x1.1543ecp+0f, 0x1.154dfp+0f,
+       0x1.1557fp+0f, 0x1.1561f4p+0f, 0x1.156bf4p+0f, 0x1.1575f8p+0f, 0x1.157f6ep+0f, 0x1.13ea44p+0f,
+       0x1.10ef28p+0f, 0x1.0df40cp+0f, 0x1.0af8f6p+0f, 0x1.07fdep+0f, 0x1.0502ccp+0f, 0x1.0207bp+0f,
+       0x1.fe192ap-1f, 0x1.f822fep-1f, 0x1.f22cd4p-1f, 0x1.ec330ep-1f, 0x1.df3854p-1f, 0x1.cc6556p-1f,
+       0x1.b9926cp-1f, 0x1.a6bf7p-1f, 0x1.93ec72p-1f, 0x1.811974p-1f, 0x1.6e4678p-1f, 0x1.5b738cp-1f,
+       0x1.48a09p-1f, 0x1.35cd94p-1f, 0x1.22f968p-1f, 0x1.0e819ap-1f, 0x1.f16e54p-2f, 0x1.c5d944p-2f,
+       0x1.9a4438p-2f, 0x1.6eaf58p-2f, 0x1.431a48p-2f, 0x1.17853cp-2f, 0x1.d7e05cp-3f, 0x1.80b5e8p-3f,
+       0x1.298bccp-3f, 0x1.a50f9ap-4f, 0x1.472738p-4f, 0x1.27cfa6p-4f, 0x1.087816p-4f, 0x1.d24108p-5f,
+       0x1.93916ap-5f, 0x1.54e1ccp-5f, 0x1.1632aap-5f, 0x1.af0714p-6f, 0x1.31a8cep-6f, 0x1.68932p-7f,
+       0x1.b9f3a2p-9f, -0x1.373876p-15f, -0x1.0b8a3ap-12f, -0x1.f02f2ep-12f, -0x1.6a6a12p-11f, -0x1.dcbba8p-11f,
+       -0x1.27869ep-10f, -0x1.60af68p-10f, -0x1.99d8a4p-10f, -0x1.d301e4p-10f, -0x1.061556p-9f, -0x1.2284cep-9f,
+       -0x1.26603cp-9f, -0x1.184232p-9f, -0x1.0a240ap-9f, -0x1.f80bfep-10f, -0x1.dbcfbp-10f, -0x1.bf936p-10f,
+       -0x1.a3574cp-10f, -0x1.871b34p-10f, -0x1.6adf1cp-10f, -0x1.4ea2cep-10f, -0x1.3268p-10f, -0x1.16ff8p-10f,
+       -0x1.f85774p-11f, -0x1.c2afecp-11f, -0x1.8d07f4p-11f, -0x1.576p-11f, -0x1.21b878p-11f, -0x1.d821dcp-12f,
+       -0x1.6cd1f4p-12f, -0x1.01820ap-12f, -0x1.2c65eap-13f, -0x1.5c7cd4p-15f, -0x1.f3c87cp-17f, -0x1.4d15f8p-15f,
+       -0x1.0e9ceap-14f, -0x1.76ae06p-14f, -0x1.debf24p-14f, -0x1.23682p-13f, -0x1.577116p-13f, -0x1.8b7a0cp-13f,
+       -0x1.bf829cp-13f, -0x1.f38b28p-13f, -0x1.0b3e3p-12f, 0x1.1d6248p-11f, 0x1.ee3cd4p-10f, 0x1.a6e2e2p-9f,
+       0x1.2b53aep-8f, 0x1.8335eap-8f, 0x1.db18d8p-8f, 0x1.197de2p-7f, 0x1.456fp-7f, 0x1.716074p-7f,
+       0x1.9d51ecp-7f, 0x1.ce0bfap-7f, 0x1.ce37b2p-6f, 0x1.9d3d5ap-5f, 0x1.29b024p-4f, 0x1.84c19cp-4f,
+       0x1.dfd26p-4f, 0x1.1d719p-3f, 0x1.4af9fp-3f, 0x1.7882acp-3f, 0x1.a60b68p-3f, 0x1.d393c8p-3f,
+       0x1.009312p-2f, 0x1.18d572p-2f, 0x1.32032cp-2f, 0x1.4b30e8p-2f, 0x1.645e7p-2f, 0x1.7d8bf8p-2f,
+       0x1.96b98p-2f, 0x1.afe73cp-2f, 0x1.c914f8p-2f, 0x1.e24282p-2f, 0x1.fb7008p-2f, 0x1.0a5af8p-1f,
+       0x1.1a2aa8p-1f, 0x1.2be55cp-1f, 0x1.3d9fecp-1f, 0x1.4f5aap-1f, 0x1.61153p-1f, 0x1.72cfcp-1f,
+       0x1.848a72p-1f, 0x1.964502p-1f, 0x1.a7ffb6p-1f, 0x1.b9ba46p-1f, 0x1.cb5914p-1f, 0x1.d689eep-1f,
+       0x1.ddf6b2p-1f, 0x1.e56384p-1f, 0x1.ecd048p-1f, 0x1.f43d0cp-1f, 0x1.fba9dep-1f, 0x1.018b52p+0f,
+       0x1.0541bcp+0f, 0x1.08f824p+0f, 0x1.0cae88p+0f, 0x1.105b06p+0f, 0x1.11fa74p+0f, 0x1.126fc6p+0f,
+       0x1.12e518p+0f, 0x1.135a68p+0f, 0x1.13cfbap+0f, 0x1.14450cp+0f, 0x1.14ba6p+0f, 0x1.152fbp+0f,
+       0x1.15a5p+0f, 0x1.161a54p+0f, 0x1.168c1ap+0f, 0x1.165478p+0f, 0x1.15bf94p+0f, 0x1.152abp+0f,
+       0x1.1495cep+0f, 0x1.1400e8p+0f, 0x1.136c04p+0f, 0x1.12d72p+0f, 0x1.12423cp+0f, 0x1.11ad5ap+0f,
+       0x1.111874p+0f, 0x1.1081ecp+0f, 0x1.0fa41cp+0f, 0x1.0ea04p+0f, 0x1.0d9c68p+0f, 0x1.0c988ap+0f,
+       0x1.0b94acp+0f, 0x1.0a90d4p+0f, 0x1.098cf8p+0f, 0x1.08891cp+0f, 0x1.07854p+0f, 0x1.068162p+0f,
+       0x1.05826p+0f, 0x1.05432p+0f, 0x1.05672p+0f, 0x1.058b2p+0f, 0x1.05af24p+0f, 0x1.05d324p+0f,
+       0x1.05f724p+0f, 0x1.061b28p+0f, 0x1.063f28p+0f, 0x1.066328p+0f, 0x1.06872ap+0f, 0x1.06b01ep+0f,
+       0x1.078c98p+0f, 0x1.08c33p+0f, 0x1.09f9c8p+0f, 0x1.0b305cp+0f, 0x1.0c66fp+0f, 0x1.0d9d88p+0f,
+       0x1.0ed42p+0f, 0x1.100ab8p+0f, 0x1.11414cp+0f, 0x1.1277e4p+0f, 0x1.139d28p+0f, 0x1.128054p+0f,
+       0x1.104a0cp+0f, 0x1.0e13c6p+0f, 0x1.0bdd82p+0f, 0x1.09a738p+0f, 0x1.0770f4p+0f, 0x1.053aacp+0f,
+       0x1.030466p+0f, 0x1.00ce22p+0f, 0x1.fd2fb2p-1f, 0x1.f8f212p-1f, 0x1.fa59bp-1f, 0x1.fe6bc8p-1f,
+       0x1.013efp+0f, 0x1.034804p+0f, 0x1.055114p+0f, 0x1.075a22p+0f, 0x1.09632ap+0f, 0x1.0b6c36p+0f,
+       0x1.0d754ap+0f, 0x1.0f7e5ap+0f, 0x1.117a24p+0f, 0x1.11fbdp+0f, 0x1.11d04ap+0f, 0x1.11a4c4p+0f,
+       0x1.11793cp+0f, 0x1.114db4p+0f, 0x1.11222ep+0f, 0x1.10f6a8p+0f, 0x1.10cb2p+0f, 0x1.109f9cp+0f,
+       0x1.107414p+0f, 0x1.104252p+0f, 0x1.0f6b7cp+0f, 0x1.0e4b46p+0f, 0x1.0d2b1p+0f, 0x1.0c0adcp+0f,
+       0x1.0aeaa8p+0f, 0x1.09ca74p+0f, 0x1.08aa42p+0f, 0x1.078a0cp+0f, 0x1.0669d6p+0f, 0x1.0549a4p+0f,
+       0x1.043152p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f,
+       0x1.03dcc8p+0f, 0x1.03dcc8p+0f, 0x1.03dcc8p+0f}),
+    SpectrumT<471>({0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f,
+       0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f,
+       0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f,
+       0x1.6bd0e6p-9f, 0x1.6bd0e6p-9f, 0x1.72547p-9f, 0x1.80873cp-9f, 0x1.8ebd5p-9f, 0x1.9cf354p-9f,
+       0x1.ab296ap-9f, 0x1.b95f8p-9f, 0x1.c79594p-9f, 0x1.d5cba8p-9f, 0x1.e401bp-9f, 0x1.f237c4p-9f,
+       0x1.0036ecp-8f, 0x1.f1198p-9f, 0x1.c014c4p-9f, 0x1.8f06ep-9f, 0x1.5df8fap-9f, 0x1.2ceb44p-9f,
+       0x1.f7babep-10f, 0x1.959ef4p-10f, 0x1.338328p-10f, 0x1.a2cebap-11f, 0x1.bd2fd2p-12f, 0x1.a60514p-15f,
+       -0x1.03fcacp-13f, -0x1.46a244p-14f, -0x1.0982bp-15f, 0x1.e8fc9ap-17f, 0x1.fe00fap-15f, 0x1.c0e166p-14f,
+       0x1.416128p-13f, 0x1.a2513cp-13f, 0x1.01a0d8p-12f, 0x1.321914p-12f, 0x1.62915p-12f, 0x1.5ee77cp-12f,
+       0x1.23c088p-12f, 0x1.d12c44p-13f, 0x1.5ad706p-13f, 0x1.c9039p-14f, 0x1.b8b042p-15f, -0x1.0525fcp-18f,
+       -0x1.f9f7dcp-15f, -0x1.e9a58p-14f, -0x1.6b28p-13f, -0x1.e17d4p-13f, -0x1.04f1c4p-12f, -0x1.e23198p-13f,
+       -0x1.ba7ebp-13f, -0x1.92cbc8p-13f, -0x1.6b18ep-13f, -0x1.4365f8p-13f, -0x1.1bb338p-13f, -0x1.e800ap-14f,
+       -0x1.989a84p-14f, -0x1.4934b4p-14f, -0x1.f39e94p-15f, -0x1.eef9f2p-15f, -0x1.419ca8p-14f, -0x1.8bbc58p-14f,
+       -0x1.d5dc08p-14f, -0x1.0ffdb8p-13f, -0x1.350d9p-13f, -0x1.5a1d66p-13f, -0x1.7f2d4p-13f, -0x1.a43d16p-13f,
+       -0x1.c94cc8p-13f, -0x1.ee5b92p-13f, -0x1.f0456p-13f, -0x1.d089b8p-13f, -0x1.b0ce3p-13f, -0x1.9112a8p-13f,
+       -0x1.7156fep-13f, -0x1.519b38p-13f, -0x1.31df9p-13f, -0x1.122408p-13f, -0x1.e4d0fcp-14f, -0x1.a559bp-14f,
+       -0x1.6221c6p-14f, 0x1.2a550ap-9f, 0x1.bdeb14p-8f, 0x1.73553cp-7f, 0x1.03da78p-6f, 0x1.4e0ae6p-6f,
+       0x1.983b0ap-6f, 0x1.e26b2cp-6f, 0x1.164da8p-5f, 0x1.3b6594p-5f, 0x1.607da8p-5f, 0x1.85b47ap-5f,
+       0x1.215a56p-4f, 0x1.c3a2a8p-4f, 0x1.32f5ccp-3f, 0x1.841a46p-3f, 0x1.d53ecp-3f, 0x1.13319cp-2f,
+       0x1.3bc3bp-2f, 0x1.6455ecp-2f, 0x1.8ce82ap-2f, 0x1.b57a68p-2f, 0x1.de0e7ep-2f, 0x1.0609f8p-1f,
+       0x1.1f666p-1f, 0x1.38c2c8p-1f, 0x1.521efcp-1f, 0x1.6b7b3p-1f, 0x1.84d768p-1f, 0x1.9e33cep-1f,
+       0x1.b79034p-1f, 0x1.d0ec6cp-1f, 0x1.ea48ap-1f, 0x1.01cef4p+0f, 0x1.079e4cp+0f, 0x1.07b4a4p+0f,
+       0x1.07cafep+0f, 0x1.07e158p+0f, 0x1.07f7b2p+0f, 0x1.080e0cp+0f, 0x1.082464p+0f, 0x1.083acp+0f,
+       0x1.085118p+0f, 0x1.086774p+0f, 0x1.087dcep+0f, 0x1.08934cp+0f, 0x1.08a818p+0f, 0x1.08bce8p+0f,
+       0x1.08d1b4p+0f, 0x1.08e684p+0f, 0x1.08fb5p+0f, 0x1.09102p+0f, 0x1.0924ecp+0f, 0x1.0939bcp+0f,
+       0x1.094e88p+0f, 0x1.09634cp+0f, 0x1.096b5p+0f, 0x1.096964p+0f, 0x1.09677ap+0f, 0x1.09658ep+0f,
+       0x1.0963a4p+0f, 0x1.0961b8p+0f, 0x1.095fccp+0f, 0x1.095de2p+0f, 0x1.095bf6p+0f, 0x1.095a0cp+0f,
+       0x1.095822p+0f, 0x1.09577ep+0f, 0x1.0957dp+0f, 0x1.095824p+0f, 0x1.095876p+0f, 0x1.0958cap+0f,
+       0x1.09591cp+0f, 0x1.09597p+0f, 0x1.0959c2p+0f, 0x1.095a14p+0f, 0x1.095a68p+0f, 0x1.095abcp+0f,
+       0x1.095bf8p+0f, 0x1.095ddcp+0f, 0x1.095fcp+0f, 0x1.0961a2p+0f, 0x1.096386p+0f, 0x1.096568p+0f,
+       0x1.09674cp+0f, 0x1.09693p+0f, 0x1.096b14p+0f, 0x1.096cf8p+0f, 0x1.096ed6p+0f, 0x1.096e96p+0f,
+       0x1.096cd4p+0f, 0x1.096b12p+0f, 0x1.09695p+0f, 0x1.09678cp+0f, 0x1.0965ccp+0f, 0x1.096408p+0f,
+       0x1.096248p+0f, 0x1.096084p+0f, 0x1.095ec4p+0f, 0x1.095d02p+0f, 0x1.095bbp+0f, 0x1.095aacp+0f,
+       0x1.0959a8p+0f, 0x1.0958a2p+0f, 0x1.09579ep+0f, 0x1.095698p+0f, 0x1.095594p+0f, 0x1.09549p+0f,
+       0x1.09538cp+0f, 0x1.095286p+0f, 0x1.095186p+0f, 0x1.09524cp+0f, 0x1.09543ep+0f, 0x1.09563p+0f,
+       0x1.095824p+0f, 0x1.095a16p+0f, 0x1.095c08p+0f, 0x1.095dfcp+0f, 0x1.095fecp+0f, 0x1.0961ep+0f,
+       0x1.0963d4p+0f, 0x1.0965cp+0f, 0x1.0965ccp+0f, 0x1.09649ep+0f, 0x1.096372p+0f, 0x1.096246p+0f,
+       0x1.09611ap+0f, 0x1.095feep+0f, 0x1.095ec2p+0f, 0x1.095d96p+0f, 0x1.095c6ap+0f, 0x1.095b3ep+0f,
+       0x1.095a1p+0f, 0x1.09584p+0f, 0x1.095608p+0f, 0x1.0953d4p+0f, 0x1.09519cp+0f, 0x1.094f68p+0f,
+       0x1.094d3p+0f, 0x1.094afcp+0f, 0x1.0948c4p+0f, 0x1.09469p+0f, 0x1.094458p+0f, 0x1.094214p+0f,
+       0x1.093c8p+0f, 0x1.0934e4p+0f, 0x1.092d4cp+0f, 0x1.0925b2p+0f, 0x1.091e18p+0f, 0x1.09168p+0f,
+       0x1.090ee4p+0f, 0x1.09074cp+0f, 0x1.08ffb2p+0f, 0x1.08f818p+0f, 0x1.08eea6p+0f, 0x1.087814p+0f,
+       0x1.07c198p+0f, 0x1.070b18p+0f, 0x1.06549cp+0f, 0x1.059e1ep+0f, 0x1.04e7ap+0f, 0x1.043124p+0f,
+       0x1.037aa4p+0f, 0x1.02c426p+0f, 0x1.020da8p+0f, 0x1.014ddep+0f, 0x1.fd3fe4p-1f, 0x1.f5b2e8p-1f,
+       0x1.ee25eap-1f, 0x1.e698fcp-1f, 0x1.df0c0ep-1f, 0x1.d77f1p-1f, 0x1.cff214p-1f, 0x1.c86524p-1f,
+       0x1.c0d838p-1f, 0x1.b94b48p-1f, 0x1.b1c768p-1f, 0x1.abf7e8p-1f, 0x1.a718a4p-1f, 0x1.a2396p-1f,
+       0x1.9d5a1cp-1f, 0x1.987accp-1f, 0x1.939b8p-1f, 0x1.8ebc3cp-1f, 0x1.89dcf8p-1f, 0x1.84fdb4p-1f,
+       0x1.801e68p-1f, 0x1.7b439ap-1f, 0x1.772c64p-1f, 0x1.737d8ep-1f, 0x1.6fceb8p-1f, 0x1.6c1fdcp-1f,
+       0x1.6871p-1f, 0x1.64c22ap-1f, 0x1.611354p-1f, 0x1.5d648p-1f, 0x1.59b5a2p-1f, 0x1.5606c4p-1f,
+       0x1.525cfap-1f, 0x1.4f7af4p-1f, 0x1.4d005cp-1f, 0x1.4a85c4p-1f, 0x1.480b26p-1f, 0x1.45908cp-1f,
+       0x1.4315fp-1f, 0x1.409b52p-1f, 0x1.3e20bap-1f, 0x1.3ba61cp-1f, 0x1.392b84p-1f, 0x1.36ba3cp-1f,
+       0x1.359b5p-1f, 0x1.352638p-1f, 0x1.34b12p-1f, 0x1.343c08p-1f, 0x1.33c6fp-1f, 0x1.3351d8p-1f,
+       0x1.32dccp-1f, 0x1.3267a8p-1f, 0x1.31f29p-1f, 0x1.317d78p-1f, 0x1.310a62p-1f, 0x1.30da3cp-1f,
+       0x1.30caaap-1f, 0x1.30bb18p-1f, 0x1.30ab88p-1f, 0x1.309bf8p-1f, 0x1.308c66p-1f, 0x1.307cd4p-1f,
+       0x1.306d44p-1f, 0x1.305db4p-1f, 0x1.304e22p-1f, 0x1.30377p-1f, 0x1.2f452p-1f, 0x1.2deb1ap-1f,
+       0x1.2c9114p-1f, 0x1.2b370cp-1f, 0x1.29dd04p-1f, 0x1.2883p-1f, 0x1.2728fcp-1f, 0x1.25cef8p-1f,
+       0x1.2474fp-1f, 0x1.231ae8p-1f, 0x1.21c7bcp-1f, 0x1.2137d8p-1f, 0x1.210168p-1f, 0x1.20caf8p-1f,
+       0x1.209488p-1f, 0x1.205e16p-1f, 0x1.2027a6p-1f, 0x1.1ff136p-1f, 0x1.1fbac4p-1f, 0x1.1f8454p-1f,
+       0x1.1f4de4p-1f, 0x1.1f1f6cp-1f, 0x1.1fc41p-1f, 0x1.20c688p-1f, 0x1.21c8fep-1f, 0x1.22cb74p-1f,
+       0x1.23cde8p-1f, 0x1.24d05cp-1f, 0x1.25d2dp-1f, 0x1.26d548p-1f, 0x1.27d7cp-1f, 0x1.28da34p-1f,
+       0x1.29d596p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f,
+       0x1.2a2168p-1f, 0x1.2a2168p-1f, 0x1.2a2168p-1f}),
+    SpectrumT<471>({0x1.c031acp-5f, 0x1.c031acp-5f, 0x1.c031acp-5f, 0x1.c031acp-5f, 0x1.c031acp-5f, 0x1.c031acp-5f,
+       0x1.c031acp-5f, 0x1.c031acp-5f, 0x1.c031acp-5f, 0x1.c031acp-5f, 0x1.c031acp-5f, 0x1.c031acp-5f,
+       0x1.c031acp-5f, 0x1.c031acp-5f, 0x1.c031acp-5f, 0x1.c031acp-5f, 0x1.c031acp-5f, 0x1.c031acp-5f,
+       0x1.c031acp-5f, 0x1.c031acp-5f, 0x1.c08032p-5f, 0x1.c12b5ep-5f, 0x1.c1d6bp-5f, 0x1.c282p-5f,
+       0x1.c32d5p-5f, 0x1.c3d8a4p-5f, 0x1.c483f8p-5f, 0x1.c52f48p-5f, 0x1.c5da9ap-5f, 0x1.c685ecp-5f,
+       0x1.c7314p-5f, 0x1.c9571cp-5f, 0x1.cd2cbp-5f, 0x1.d102bcp-5f, 0x1.d4d8c6p-5f, 0x1.d8aeccp-5f,
+       0x1.dc84d6p-5f, 0x1.e05aep-5f, 0x1.e430e8p-5f, 0x1.e806f4p-5f, 0x1.ebdcf8p-5f, 0x1.efb304p-5f,
+       0x1.f01b94p-5f, 0x1.ecbd24p-5f, 0x1.e95e24p-5f, 0x1.e5ff24p-5f, 0x1.e2a024p-5f, 0x1.df4124p-5f,
+       0x1.dbe224p-5f, 0x1.d88328p-5f, 0x1.d52428p-5f, 0x1.d1c528p-5f, 0x1.ce6628p-5f, 0x1.c90728p-5f,
+       0x1.c1873cp-5f, 0x1.ba073p-5f, 0x1.b2871ep-5f, 0x1.ab070cp-5f, 0x1.a386fp-5f, 0x1.9c06dcp-5f,
+       0x1.9486dp-5f, 0x1.8d06c4p-5f, 0x1.8586bp-5f, 0x1.7e069ep-5f, 0x1.7739e2p-5f, 0x1.71257p-5f,
+       0x1.6b1104p-5f, 0x1.64fc98p-5f, 0x1.5ee82ap-5f, 0x1.58d3bep-5f, 0x1.52bf58p-5f, 0x1.4caaecp-5f,
+       0x1.469678p-5f, 0x1.40820cp-5f, 0x1.3a6da2p-5f, 0x1.3250eap-5f, 0x1.283024p-5f, 0x1.1e0f5cp-5f,
+       0x1.13ee98p-5f, 0x1.09cddcp-5f, 0x1.ff5a2cp-6f, 0x1.eb189ep-6f, 0x1.d6d712p-6f, 0x1.c29586p-6f,
+       0x1.ae540cp-6f, 0x1.9a1256p-6f, 0x1.80882p-6f, 0x1.61ef3cp-6f, 0x1.435678p-6f, 0x1.24bdbp-6f,
+       0x1.0624ccp-6f, 0x1.cf1794p-7f, 0x1.91e5ccp-7f, 0x1.54b442p-7f, 0x1.1782b8p-7f, 0x1.b4a1ep-8f,
+       0x1.3a42bp-8f, 0x1.e35194p-9f, 0x1.ae2434p-9f, 0x1.78f70cp-9f, 0x1.43c9e4p-9f, 0x1.0e9c5p-9f,
+       0x1.b2dde4p-10f, 0x1.488328p-10f, 0x1.bc50d8p-11f, 0x1.cf3868p-12f, 0x1.2e6bep-15f, -0x1.83625ap-12f,
+       -0x1.ff1664p-12f, -0x1.6d8728p-12f, -0x1.b7eebcp-13f, -0x1.299e44p-14f, 0x1.1ca0eep-14f, 0x1.b1700ap-13f,
+       0x1.6a474p-12f, 0x1.fbd70ep-12f, 0x1.46b36cp-11f, 0x1.8f7b54p-11f, 0x1.d830dp-11f, 0x1.eabb9cp-11f,
+       0x1.ce840ap-11f, 0x1.b24c7ap-11f, 0x1.961522p-11f, 0x1.79ddccp-11f, 0x1.5da674p-11f, 0x1.416ee4p-11f,
+       0x1.253752p-11f, 0x1.08fffap-11f, 0x1.d99144p-12f, 0x1.a11ca2p-12f, 0x1.5d753p-12f, 0x1.1075a8p-12f,
+       0x1.86ecep-13f, 0x1.d9dba6p-14f, 0x1.4bbb16p-15f, -0x1.1c4122p-15f, -0x1.c21ea8p-14f, -0x1.7b0dc8p-13f,
+       -0x1.0a866cp-12f, -0x1.5785fp-12f, -0x1.a45a28p-12f, -0x1.b4b6p-12f, -0x1.9442dcp-12f, -0x1.73cf98p-12f,
+       -0x1.535c54p-12f, -0x1.32e93p-12f, -0x1.1275ecp-12f, -0x1.e4055p-13f, -0x1.a31ecap-13f, -0x1.6238p-13f,
+       -0x1.215178p-13f, -0x1.c1212ap-14f, -0x1.8ec6aep-14f, -0x1.9a3af2p-14f, -0x1.a5af38p-14f, -0x1.b1237cp-14f,
+       -0x1.bc97d8p-14f, -0x1.c80c34p-14f, -0x1.d38078p-14f, -0x1.def4bcp-14f, -0x1.ea6904p-14f, -0x1.f5dd5ep-14f,
+       -0x1.00a7c4p-13f, -0x1.0579f4p-13f, -0x1.099dbp-13f, -0x1.0dc178p-13f, -0x1.11e53cp-13f, -0x1.1608fcp-13f,
+       -0x1.1a2cbcp-13f, -0x1.1e5078p-13f, -0x1.22744p-13f, -0x1.269806p-13f, -0x1.2abbc4p-13f, -0x1.2ee51ep-13f,
+       -0x1.36bd54p-13f, -0x1.414724p-13f, -0x1.4bd108p-13f, -0x1.565ad8p-13f, -0x1.60e4bep-13f, -0x1.6b6ea2p-13f,
+       -0x1.75f87p-13f, -0x1.80824p-13f, -0x1.8b0c1p-13f, -0x1.9595f6p-13f, -0x1.a0518ep-13f, -0x1.c628ap-13f,
+       -0x1.ff31p-13f, -0x1.1c1cbp-12f, -0x1.38a118p-12f, -0x1.552582p-12f, -0x1.71a9b2p-12f, -0x1.8e2de2p-12f,
+       -0x1.aab24ap-12f, -0x1.c736b4p-12f, -0x1.e3bae4p-12f, -0x1.f2c7f8p-12f, 0x1.0a77d6p-10f, 0x1.d038acp-9f,
+       0x1.8d9ab8p-8f, 0x1.198be6p-7f, 0x1.6c4a7p-7f, 0x1.bf08fcp-7f, 0x1.08e416p-6f, 0x1.3243aep-6f,
+       0x1.5ba2f2p-6f, 0x1.850238p-6f, 0x1.af5216p-6f, 0x1.1bdc26p-5f, 0x1.7f4daap-5f, 0x1.e2be66p-5f,
+       0x1.231792p-4f, 0x1.54cffp-4f, 0x1.8688b4p-4f, 0x1.b84174p-4f, 0x1.e9f9dp-4f, 0x1.0dd94ap-3f,
+       0x1.26b5acp-3f, 0x1.3fa4bap-3f, 0x1.5ef354p-3f, 0x1.825b9ap-3f, 0x1.a5c428p-3f, 0x1.c92cb6p-3f,
+       0x1.ec94fcp-3f, 0x1.07feap-2f, 0x1.19b2c4p-2f, 0x1.2b670cp-2f, 0x1.3d1b54p-2f, 0x1.4ecf76p-2f,
+       0x1.6089fp-2f, 0x1.742328p-2f, 0x1.88e704p-2f, 0x1.9daadep-2f, 0x1.b26e9p-2f, 0x1.c7324p-2f,
+       0x1.dbf5f4p-2f, 0x1.f0b9cep-2f, 0x1.02bed4p-1f, 0x1.0d20aep-1f, 0x1.178288p-1f, 0x1.21e0c6p-1f,
+       0x1.2b4f88p-1f, 0x1.342d84p-1f, 0x1.3d0b6cp-1f, 0x1.45e968p-1f, 0x1.4ec754p-1f, 0x1.57a53cp-1f,
+       0x1.608338p-1f, 0x1.696124p-1f, 0x1.723f1ep-1f, 0x1.7b1d08p-1f, 0x1.83f31p-1f, 0x1.8af5a6p-1f,
+       0x1.90e664p-1f, 0x1.96d73p-1f, 0x1.9cc7fp-1f, 0x1.a2b8acp-1f, 0x1.a8a978p-1f, 0x1.ae9a36p-1f,
+       0x1.b48bp-1f, 0x1.ba7bccp-1f, 0x1.c06c8ap-1f, 0x1.c6557ep-1f, 0x1.caa0e4p-1f, 0x1.ce0184p-1f,
+       0x1.d16222p-1f, 0x1.d4c2bap-1f, 0x1.d82352p-1f, 0x1.db83fp-1f, 0x1.dee49p-1f, 0x1.e24528p-1f,
+       0x1.e5a5cp-1f, 0x1.e90658p-1f, 0x1.ec5f66p-1f, 0x1.ee4ecep-1f, 0x1.ef772p-1f, 0x1.f09f74p-1f,
+       0x1.f1c7c8p-1f, 0x1.f2f01cp-1f, 0x1.f4187p-1f, 0x1.f540c4p-1f, 0x1.f66918p-1f, 0x1.f7916ap-1f,
+       0x1.f8b9cp-1f, 0x1.f9df7ep-1f, 0x1.fa94dcp-1f, 0x1.fb0e42p-1f, 0x1.fb87a8p-1f, 0x1.fc010ep-1f,
+       0x1.fc7a74p-1f, 0x1.fcf3dcp-1f, 0x1.fd6d4p-1f, 0x1.fde6a4p-1f, 0x1.fe600cp-1f, 0x1.fed972p-1f,
+       0x1.ff4e54p-1f, 0x1.ff10a8p-1f, 0x1.fe768ap-1f, 0x1.fddc6ep-1f, 0x1.fd4252p-1f, 0x1.fca834p-1f,
+       0x1.fc0e16p-1f, 0x1.fb73f8p-1f, 0x1.fad9dcp-1f, 0x1.fa3fcp-1f, 0x1.f9a5a4p-1f, 0x1.f9104cp-1f,
+       0x1.f92804p-1f, 0x1.f9969cp-1f, 0x1.fa0534p-1f, 0x1.fa73cap-1f, 0x1.fae262p-1f, 0x1.fb50fcp-1f,
+       0x1.fbbf9p-1f, 0x1.fc2e28p-1f, 0x1.fc9ccp-1f, 0x1.fd0b56p-1f, 0x1.fd72ccp-1f, 0x1.fcec54p-1f,
+       0x1.fbf2p-1f, 0x1.faf7bp-1f, 0x1.f9fd62p-1f, 0x1.f9031p-1f, 0x1.f808cp-1f, 0x1.f70e6cp-1f,
+       0x1.f6141cp-1f, 0x1.f519ccp-1f, 0x1.f41f7ap-1f, 0x1.f32ef2p-1f, 0x1.f36b9p-1f, 0x1.f43666p-1f,
+       0x1.f5013cp-1f, 0x1.f5cc14p-1f, 0x1.f696ecp-1f, 0x1.f761cp-1f, 0x1.f82c94p-1f, 0x1.f8f768p-1f,
+       0x1.f9c24p-1f, 0x1.fa8d18p-1f, 0x1.fb526ap-1f, 0x1.fb7a7cp-1f, 0x1.fb5a84p-1f, 0x1.fb3a8cp-1f,
+       0x1.fb1a94p-1f, 0x1.fafa9ap-1f, 0x1.fadaa2p-1f, 0x1.fabaaap-1f, 0x1.fa9ab4p-1f, 0x1.fa7abcp-1f,
+       0x1.fa5ac4p-1f, 0x1.fa3e2ep-1f, 0x1.fa7b5cp-1f, 0x1.fae07p-1f, 0x1.fb4582p-1f, 0x1.fbaa94p-1f,
+       0x1.fc0fa4p-1f, 0x1.fc74b6p-1f, 0x1.fcd9c8p-1f, 0x1.fd3edcp-1f, 0x1.fda3eep-1f, 0x1.fe08fep-1f,
+       0x1.fe6b4ap-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f,
+       0x1.fe88f2p-1f, 0x1.fe88f2p-1f, 0x1.fe88f2p-1f}),
+    SpectrumT<471>({0x1.9c5bep-6f, 0x1.9c5bep-6f, 0x1.9c5bep-6f, 0x1.9c5bep-6f, 0x1.9c5bep-6f, 0x1.9c5bep-6f,
+       0x1.9c5bep-6f, 0x1.9c5bep-6f, 0x1.9c5bep-6f, 0x1.9c5bep-6f, 0x1.9c5bep-6f, 0x1.9c5bep-6f,
+       0x1.9c5bep-6f, 0x1.9c5bep-6f, 0x1.9c5bep-6f, 0x1.9c5bep-6f, 0x1.9c5bep-6f, 0x1.9c5bep-6f,
+       0x1.9c5bep-6f, 0x1.9c5bep-6f, 0x1.a619fap-6f, 0x1.bb5678p-6f, 0x1.d097ep-6f, 0x1.e5d93p-6f,
+       0x1.fb1a98p-6f, 0x1.082ep-5f, 0x1.12ceb4p-5f, 0x1.1d6f68p-5f, 0x1.28101p-5f, 0x1.32b0c4p-5f,
+       0x1.3d5178p-5f, 0x1.376bfap-5f, 0x1.1eae44p-5f, 0x1.05eb6ep-5f, 0x1.da5132p-6f, 0x1.a8cbb8p-6f,
+       0x1.77460cp-6f, 0x1.45c06p-6f, 0x1.143ab4p-6f, 0x1.c56a0ep-7f, 0x1.625f18p-7f, 0x1.fea78p-8f,
+       0x1.9957fap-8f, 0x1.9eaf3cp-8f, 0x1.a41662p-8f, 0x1.a97d88p-8f, 0x1.aee4bp-8f, 0x1.b44bd8p-8f,
+       0x1.b9b2fep-8f, 0x1.bf1a2p-8f, 0x1.c48148p-8f, 0x1.c9e87p-8f, 0x1.cf4f98p-8f, 0x1.be2f7ep-8f,
+       0x1.951518p-8f, 0x1.6bf938p-8f, 0x1.42dd3p-8f, 0x1.19c128p-8f, 0x1.e149e8p-9f, 0x1.8f11d2p-9f,
+       0x1.3cda14p-9f, 0x1.d544a4p-10f, 0x1.30d47cp-10f, 0x1.18c8bp-11f, 0x1.b3e5a6p-13f, 0x1.8a58fcp-13f,
+       0x1.60d40ap-13f, 0x1.374f18p-13f, 0x1.0dca24p-13f, 0x1.c88a64p-14f, 0x1.7580d2p-14f, 0x1.2276ecp-14f,
+       0x1.9ed966p-15f, 0x1.f18b3cp-16f, 0x1.4aa6cap-17f, -0x1.02ec46p-10f, -0x1.8352e2p-9f, -0x1.4297dp-8f,
+       -0x1.c3863p-8f, -0x1.223a08p-7f, -0x1.62b138p-7f, -0x1.a32866p-7f, -0x1.e39f98p-7f, -0x1.120b64p-6f,
+       -0x1.3246dap-6f, -0x1.528118p-6f, -0x1.45dd98p-6f, -0x1.0e4616p-6f, -0x1.ad5d94p-7f, -0x1.3e2efcp-7f,
+       -0x1.9dffe8p-8f, -0x1.7f41f6p-9f, 0x1.ebd0f4p-12f, 0x1.fa347cp-9f, 0x1.db776cp-8f, 0x1.5ceabcp-7f,
+       0x1.cc129cp-7f, 0x1.ed892p-7f, 0x1.c72bcep-7f, 0x1.a0cea4p-7f, 0x1.7a7178p-7f, 0x1.5413fcp-7f,
+       0x1.2db6aap-7f, 0x1.075958p-7f, 0x1.c1f808p-8f, 0x1.753dbp-8f, 0x1.28830ap-8f, 0x1.b9397cp-9f,
+       0x1.2bdbcep-6f, 0x1.860818p-5f, 0x1.3b119ep-4f, 0x1.b31f3p-4f, 0x1.159662p-3f, 0x1.519d2ap-3f,
+       0x1.8da3b8p-3f, 0x1.c9aa8p-3f, 0x1.02d8a4p-2f, 0x1.20dc08p-2f, 0x1.3ee5b2p-2f, 0x1.6f6452p-2f,
+       0x1.afd25cp-2f, 0x1.f04064p-2f, 0x1.1856f8p-1f, 0x1.388dbcp-1f, 0x1.58c482p-1f, 0x1.78fb88p-1f,
+       0x1.99328cp-1f, 0x1.b9695p-1f, 0x1.d9a014p-1f, 0x1.f9ce36p-1f, 0x1.046e72p+0f, 0x1.04d09p+0f,
+       0x1.0532bp+0f, 0x1.0594dp+0f, 0x1.05f6ecp+0f, 0x1.06590cp+0f, 0x1.06bb2cp+0f, 0x1.071d48p+0f,
+       0x1.077f68p+0f, 0x1.07e188p+0f, 0x1.08437ep+0f, 0x1.086ca4p+0f, 0x1.0867fp+0f, 0x1.08633cp+0f,
+       0x1.085e88p+0f, 0x1.0859d4p+0f, 0x1.08552p+0f, 0x1.08506cp+0f, 0x1.084bb8p+0f, 0x1.084704p+0f,
+       0x1.08425p+0f, 0x1.083da8p+0f, 0x1.08480ap+0f, 0x1.085e24p+0f, 0x1.08744p+0f, 0x1.088a5cp+0f,
+       0x1.08a078p+0f, 0x1.08b696p+0f, 0x1.08ccb2p+0f, 0x1.08e2cep+0f, 0x1.08f8eap+0f, 0x1.090f06p+0f,
+       0x1.0924bep+0f, 0x1.08e7a4p+0f, 0x1.086bf4p+0f, 0x1.07f044p+0f, 0x1.077494p+0f, 0x1.06f8e4p+0f,
+       0x1.067d36p+0f, 0x1.060188p+0f, 0x1.0585d8p+0f, 0x1.050a28p+0f, 0x1.048e78p+0f, 0x1.041396p+0f,
+       0x1.042008p+0f, 0x1.048f7p+0f, 0x1.04fed8p+0f, 0x1.056e3ep+0f, 0x1.05dda8p+0f, 0x1.064d1p+0f,
+       0x1.06bc78p+0f, 0x1.072bdep+0f, 0x1.079b46p+0f, 0x1.080abp+0f, 0x1.0879b4p+0f, 0x1.08b35cp+0f,
+       0x1.08c736p+0f, 0x1.08db1p+0f, 0x1.08eeecp+0f, 0x1.0902c4p+0f, 0x1.0916ap+0f, 0x1.092a7cp+0f,
+       0x1.093e54p+0f, 0x1.09523p+0f, 0x1.09660ap+0f, 0x1.0979c4p+0f, 0x1.097e4p+0f, 0x1.09784cp+0f,
+       0x1.097254p+0f, 0x1.096c6p+0f, 0x1.096668p+0f, 0x1.096074p+0f, 0x1.095a7cp+0f, 0x1.095488p+0f,
+       0x1.094e9p+0f, 0x1.09489cp+0f, 0x1.094238p+0f, 0x1.091088p+0f, 0x1.08c216p+0f, 0x1.0873a4p+0f,
+       0x1.082534p+0f, 0x1.07d6c4p+0f, 0x1.07885p+0f, 0x1.0739ep+0f, 0x1.06eb7p+0f, 0x1.069cfep+0f,
+       0x1.064e8cp+0f, 0x1.05fe6cp+0f, 0x1.051b8cp+0f, 0x1.03da4cp+0f, 0x1.029906p+0f, 0x1.0157c2p+0f,
+       0x1.00168p+0f, 0x1.fdaa7cp-1f, 0x1.fb27f8p-1f, 0x1.f8a56ep-1f, 0x1.f622e4p-1f, 0x1.f3a06p-1f,
+       0x1.f0c51ep-1f, 0x1.d3b79cp-1f, 0x1.a654c4p-1f, 0x1.78f1ecp-1f, 0x1.4b8f6cp-1f, 0x1.1e2cecp-1f,
+       0x1.e194ep-2f, 0x1.86cf3p-2f, 0x1.2c097ep-2f, 0x1.a28904p-3f, 0x1.d9fe1ap-4f, 0x1.c93206p-6f,
+       -0x1.3b852p-8f, -0x1.160102p-8f, -0x1.e0fa5cp-9f, -0x1.95f21cp-9f, -0x1.4aea76p-9f, -0x1.ffc59cp-10f,
+       -0x1.69b51cp-10f, -0x1.a74b9cp-11f, -0x1.ecaaa2p-13f, 0x1.61e7f4p-12f, 0x1.dcb3dcp-11f, 0x1.7941dp-10f,
+       0x1.fdbb6cp-10f, 0x1.411b0ap-9f, 0x1.8357d8p-9f, 0x1.c594a8p-9f, 0x1.03e8fep-8f, 0x1.250766p-8f,
+       0x1.46261p-8f, 0x1.6744bap-8f, 0x1.88632p-8f, 0x1.a8b1aap-8f, 0x1.9dd9acp-8f, 0x1.7a81dp-8f,
+       0x1.5729f4p-8f, 0x1.33d25ep-8f, 0x1.107acap-8f, 0x1.da45dcp-9f, 0x1.939626p-9f, 0x1.4ce6fcp-9f,
+       0x1.0637dp-9f, 0x1.7f114ep-10f, 0x1.f45beep-11f, 0x1.05e2cp-9f, 0x1.fe8aaap-9f, 0x1.7b9948p-8f,
+       0x1.f7ed3cp-8f, 0x1.3a2116p-7f, 0x1.784b8ep-7f, 0x1.b67588p-7f, 0x1.f49f8p-7f, 0x1.1964bep-6f,
+       0x1.3879fcp-6f, 0x1.56bcd8p-6f, 0x1.514944p-6f, 0x1.38c65cp-6f, 0x1.204376p-6f, 0x1.07c05ep-6f,
+       0x1.de7a8cp-7f, 0x1.ad74cp-7f, 0x1.7c6ef2p-7f, 0x1.4b6924p-7f, 0x1.1a62f4p-7f, 0x1.d2b988p-8f,
+       0x1.71ec4ep-8f, 0x1.4266ap-8f, 0x1.2c631cp-8f, 0x1.165f9ap-8f, 0x1.005becp-8f, 0x1.d4b0d4p-9f,
+       0x1.a8a976p-9f, 0x1.7ca218p-9f, 0x1.509b14p-9f, 0x1.2493b8p-9f, 0x1.f11964p-10f, 0x1.9a136ep-10f,
+       0x1.687942p-10f, 0x1.49a868p-10f, 0x1.2ad75p-10f, 0x1.0c0678p-10f, 0x1.da6b3cp-11f, 0x1.9cc91p-11f,
+       0x1.5f275cp-11f, 0x1.21852cp-11f, 0x1.c7c6f6p-12f, 0x1.4c8392p-12f, 0x1.8e615ap-13f, -0x1.0db03ap-12f,
+       -0x1.c2fa2cp-11f, -0x1.7f8cep-10f, -0x1.0ece54p-9f, -0x1.5dd6d8p-9f, -0x1.acdecp-9f, -0x1.fbe744p-9f,
+       -0x1.257794p-8f, -0x1.4cfb88p-8f, -0x1.747fc8p-8f, -0x1.99031ap-8f, -0x1.6107fp-8f, -0x1.fabeccp-9f,
+       -0x1.336db6p-9f, -0x1.b0661p-11f, 0x1.6ce47ap-11f, 0x1.228a34p-9f, 0x1.e9d9bcp-9f, 0x1.589568p-8f,
+       0x1.bc3f82p-8f, 0x1.0ff468p-7f, 0x1.42dd12p-7f, 0x1.949066p-7f, 0x1.f45f64p-7f, 0x1.2a17fp-6f,
+       0x1.59ffdp-6f, 0x1.89e74cp-6f, 0x1.b9ceccp-6f, 0x1.e9b64cp-6f, 0x1.0ccf14p-5f, 0x1.24c304p-5f,
+       0x1.3cb6c4p-5f, 0x1.53a7c4p-5f, 0x1.4fcec4p-5f, 0x1.400e4ap-5f, 0x1.304ddp-5f, 0x1.208d74p-5f,
+       0x1.10cd18p-5f, 0x1.010cbcp-5f, 0x1.e298c4p-6f, 0x1.c317ccp-6f, 0x1.a396d8p-6f, 0x1.84162p-6f,
+       0x1.65723ep-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f,
+       0x1.5c345cp-6f, 0x1.5c345cp-6f, 0x1.5c345cp-6f}),
+    SpectrumT<471>({0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f,
+       0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f,
+       0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f,
+       0x1.0e9ac4p+0f, 0x1.0e9ac4p+0f, 0x1.0e9204p+0f, 0x1.0e7efp+0f, 0x1.0e6bd8p+0f, 0x1.0e58cp+0f,
+       0x1.0e45a6p+0f, 0x1.0e329p+0f, 0x1.0e1f78p+0f, 0x1.0e0c6p+0f, 0x1.0df946p+0f, 0x1.0de62ep+0f,
+       0x1.0dd316p+0f, 0x1.0dcc4p+0f, 0x1.0dd36ap+0f, 0x1.0dda96p+0f, 0x1.0de1c2p+0f, 0x1.0de8eep+0f,
+       0x1.0df01ap+0f, 0x1.0df744p+0f, 0x1.0dfe7p+0f, 0x1.0e059cp+0f, 0x1.0e0cc8p+0f, 0x1.0e13f4p+0f,
+       0x1.0e1204p+0f, 0x1.0e060cp+0f, 0x1.0dfa12p+0f, 0x1.0dee18p+0f, 0x1.0de22p+0f, 0x1.0dd624p+0f,
+       0x1.0dca2ap+0f, 0x1.0dbe3p+0f, 0x1.0db234p+0f, 0x1.0da63cp+0f, 0x1.0d9a4p+0f, 0x1.0da262p+0f,
+       0x1.0dbfe8p+0f, 0x1.0ddd7p+0f, 0x1.0dfaf6p+0f, 0x1.0e187ep+0f, 0x1.0e3606p+0f, 0x1.0e538cp+0f,
+       0x1.0e7114p+0f, 0x1.0e8e9cp+0f, 0x1.0eac24p+0f, 0x1.0ec9aap+0f, 0x1.0ed83p+0f, 0x1.0ed74ep+0f,
+       0x1.0ed66ap+0f, 0x1.0ed586p+0f, 0x1.0ed4a2p+0f, 0x1.0ed3cp+0f, 0x1.0ed2dcp+0f, 0x1.0ed1f8p+0f,
+       0x1.0ed114p+0f, 0x1.0ed032p+0f, 0x1.0ecf4ep+0f, 0x1.0ed044p+0f, 0x1.0ed31p+0f, 0x1.0ed5dcp+0f,
+       0x1.0ed8a8p+0f, 0x1.0edb76p+0f, 0x1.0ede42p+0f, 0x1.0ee10ep+0f, 0x1.0ee3dap+0f, 0x1.0ee6a8p+0f,
+       0x1.0ee974p+0f, 0x1.0eec4p+0f, 0x1.0eec94p+0f, 0x1.0eea88p+0f, 0x1.0ee88p+0f, 0x1.0ee674p+0f,
+       0x1.0ee46cp+0f, 0x1.0ee26p+0f, 0x1.0ee058p+0f, 0x1.0ede4cp+0f, 0x1.0edc44p+0f, 0x1.0eda38p+0f,
+       0x1.0ed82ep+0f, 0x1.0ed1acp+0f, 0x1.0ec70cp+0f, 0x1.0ebc6ap+0f, 0x1.0eb1cap+0f, 0x1.0ea728p+0f,
+       0x1.0e9c88p+0f, 0x1.0e91e6p+0f, 0x1.0e8744p+0f, 0x1.0e7ca4p+0f, 0x1.0e7202p+0f, 0x1.0e6764p+0f,
+       0x1.0e655ep+0f, 0x1.0e6b0ap+0f, 0x1.0e70b8p+0f, 0x1.0e7664p+0f, 0x1.0e7c1p+0f, 0x1.0e81bcp+0f,
+       0x1.0e8768p+0f, 0x1.0e8d14p+0f, 0x1.0e92cp+0f, 0x1.0e986cp+0f, 0x1.0e9e06p+0f, 0x1.0e7208p+0f,
+       0x1.0e1b38p+0f, 0x1.0dc464p+0f, 0x1.0d6d94p+0f, 0x1.0d16c2p+0f, 0x1.0cbffp+0f, 0x1.0c692p+0f,
+       0x1.0c124ep+0f, 0x1.0bbb7cp+0f, 0x1.0b64acp+0f, 0x1.0b094cp+0f, 0x1.01c6ccp+0f, 0x1.e22c82p-1f,
+       0x1.c0cb8ep-1f, 0x1.9f6a78p-1f, 0x1.7e0964p-1f, 0x1.5ca85p-1f, 0x1.3b473ap-1f, 0x1.19e646p-1f,
+       0x1.f10a62p-2f, 0x1.ae4838p-2f, 0x1.6b946p-2f, 0x1.3ce134p-2f, 0x1.1e5358p-2f, 0x1.ff8abcp-3f,
+       0x1.c26ec6p-3f, 0x1.85531p-3f, 0x1.483718p-3f, 0x1.0b1b22p-3f, 0x1.9bfe5cp-4f, 0x1.21c5f8p-4f,
+       0x1.4f1c14p-5f, 0x1.6cbb12p-7f, -0x1.f04c1p-10f, -0x1.e147a8p-10f, -0x1.d24344p-10f, -0x1.c33eep-10f,
+       -0x1.b43a5cp-10f, -0x1.a535dap-10f, -0x1.963176p-10f, -0x1.872d1p-10f, -0x1.7828acp-10f, -0x1.692428p-10f,
+       -0x1.5a2c52p-10f, -0x1.55a166p-10f, -0x1.58f70ep-10f, -0x1.5c4cbcp-10f, -0x1.5fa26cp-10f, -0x1.62f814p-10f,
+       -0x1.664dbep-10f, -0x1.69a368p-10f, -0x1.6cf916p-10f, -0x1.704ec4p-10f, -0x1.73a47p-10f, -0x1.76f454p-10f,
+       -0x1.766efcp-10f, -0x1.731c1p-10f, -0x1.6fc91cp-10f, -0x1.6c763p-10f, -0x1.69233cp-10f, -0x1.65d048p-10f,
+       -0x1.627d5cp-10f, -0x1.5f2a6ep-10f, -0x1.5bd78p-10f, -0x1.58848cp-10f, -0x1.55452p-10f, -0x1.5cab7cp-10f,
+       -0x1.6b9bb6p-10f, -0x1.7a8bfp-10f, -0x1.897c48p-10f, -0x1.986ca2p-10f, -0x1.a75cdep-10f, -0x1.b64d1ap-10f,
+       -0x1.c53d74p-10f, -0x1.d42dccp-10f, -0x1.e31e08p-10f, -0x1.f1992ep-10f, -0x1.ca6d5cp-10f, -0x1.7e7734p-10f,
+       -0x1.32810cp-10f, -0x1.cd16fcp-11f, -0x1.352bdep-11f, -0x1.3a817ep-12f, -0x1.551c1p-17f, 0x1.252fcp-12f,
+       0x1.2a82fep-11f, 0x1.c26e1cp-11f, 0x1.2c4ff8p-10f, 0x1.212084p-10f, 0x1.b9454p-11f, 0x1.304a8ap-11f,
+       0x1.4e9fa4p-12f, 0x1.e55198p-15f, -0x1.aa9ac2p-13f, -0x1.e744fp-12f, -0x1.7c9d3p-11f, -0x1.02cc7cp-10f,
+       -0x1.474a64p-10f, -0x1.8b401ep-10f, -0x1.a16854p-10f, -0x1.9a18c6p-10f, -0x1.92c928p-10f, -0x1.8b798cp-10f,
+       -0x1.8429fcp-10f, -0x1.7cda6ep-10f, -0x1.758aep-10f, -0x1.6e3b42p-10f, -0x1.66eba4p-10f, -0x1.5f9c16p-10f,
+       -0x1.58728cp-10f, -0x1.5c823cp-10f, -0x1.67914cp-10f, -0x1.72a05cp-10f, -0x1.7daf54p-10f, -0x1.88be5p-10f,
+       -0x1.93cd48p-10f, -0x1.9edc58p-10f, -0x1.a9eb68p-10f, -0x1.b4fa64p-10f, -0x1.c0095ep-10f, -0x1.cadfecp-10f,
+       -0x1.c704p-10f, -0x1.ba46a6p-10f, -0x1.ad8966p-10f, -0x1.a0cc0ep-10f, -0x1.940edp-10f, -0x1.87519p-10f,
+       -0x1.7a9436p-10f, -0x1.6dd6f8p-10f, -0x1.6119ap-10f, -0x1.545c6p-10f, -0x1.44db5p-10f, -0x1.22d08p-11f,
+       0x1.0418f4p-11f, 0x1.95835cp-10f, 0x1.547c0cp-9f, 0x1.de366ap-9f, 0x1.33f8ecp-8f, 0x1.78d61cp-8f,
+       0x1.bdb3d6p-8f, 0x1.0148c8p-7f, 0x1.23b75cp-7f, 0x1.467b38p-7f, 0x1.7af1cp-7f, 0x1.b9750ap-7f,
+       0x1.f7f854p-7f, 0x1.1b3d9p-6f, 0x1.3a7ef6p-6f, 0x1.59c09cp-6f, 0x1.79024p-6f, 0x1.9843a6p-6f,
+       0x1.b7850cp-6f, 0x1.d6c672p-6f, 0x1.f6c13cp-6f, 0x1.1cb0fep-5f, 0x1.478a22p-5f, 0x1.726346p-5f,
+       0x1.9d3c6ap-5f, 0x1.c815e4p-5f, 0x1.f2ef5ep-5f, 0x1.0ee44p-4f, 0x1.2450d4p-4f, 0x1.39bd64p-4f,
+       0x1.4f2a22p-4f, 0x1.648c42p-4f, 0x1.7820eep-4f, 0x1.8abf6ap-4f, 0x1.9d5de4p-4f, 0x1.affc84p-4f,
+       0x1.c29b26p-4f, 0x1.d539a2p-4f, 0x1.e7d81cp-4f, 0x1.fa7698p-4f, 0x1.068a9cp-3f, 0x1.0fd9ecp-3f,
+       0x1.190f26p-3f, 0x1.1e3d5cp-3f, 0x1.2155e2p-3f, 0x1.246e68p-3f, 0x1.2786f4p-3f, 0x1.2a9f78p-3f,
+       0x1.2db804p-3f, 0x1.30d09p-3f, 0x1.33e914p-3f, 0x1.3701a2p-3f, 0x1.3a1a28p-3f, 0x1.3d1ebep-3f,
+       0x1.3d507p-3f, 0x1.3c173cp-3f, 0x1.3ade06p-3f, 0x1.39a4d4p-3f, 0x1.386bap-3f, 0x1.37326cp-3f,
+       0x1.35f938p-3f, 0x1.34c004p-3f, 0x1.3386dp-3f, 0x1.324d9ep-3f, 0x1.312b0ep-3f, 0x1.32fbfcp-3f,
+       0x1.363cc2p-3f, 0x1.397d82p-3f, 0x1.3cbe42p-3f, 0x1.3fff08p-3f, 0x1.433fc8p-3f, 0x1.46809p-3f,
+       0x1.49c15p-3f, 0x1.4d021p-3f, 0x1.5042d4p-3f, 0x1.537574p-3f, 0x1.54f506p-3f, 0x1.55a71ep-3f,
+       0x1.565936p-3f, 0x1.570b52p-3f, 0x1.57bd6cp-3f, 0x1.586f84p-3f, 0x1.59219cp-3f, 0x1.59d3b4p-3f,
+       0x1.5a85cep-3f, 0x1.5b37e8p-3f, 0x1.5bd81p-3f, 0x1.5a78bp-3f, 0x1.582efcp-3f, 0x1.55e54p-3f,
+       0x1.539b88p-3f, 0x1.5151d4p-3f, 0x1.4f082p-3f, 0x1.4cbe6ap-3f, 0x1.4a74b2p-3f, 0x1.482afap-3f,
+       0x1.45e146p-3f, 0x1.43ce8ap-3f, 0x1.476cd8p-3f, 0x1.4d92ap-3f, 0x1.53b868p-3f, 0x1.59de24p-3f,
+       0x1.6003ep-3f, 0x1.66299cp-3f, 0x1.6c4f58p-3f, 0x1.72752p-3f, 0x1.789ae8p-3f, 0x1.7ec0a4p-3f,
+       0x1.84bb46p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f,
+       0x1.8688f4p-3f, 0x1.8688f4p-3f, 0x1.8688f4p-3f}),
+    }};
+
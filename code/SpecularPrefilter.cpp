@@ -0,0 +1,187 @@
+#include "Precompiled.h"
+#include "SpecularPrefilter.h"
+#include "Parallel.h"
+
+
+void SpecularPrefilter::Hammersley(uint32_t i, uint32_t samplesNum, float& u0, float& u1)
+{
+	uint32_t bits = (i << 16) | (i >> 16);
+	bits = ((bits & 0x55555555u) << 1) | ((bits & 0xaaaaaaaau) >> 1);
+	bits = ((bits & 0x33333333u) << 2) | ((bits & 0xccccccccu) >> 2);
+	bits = ((bits & 0x0f0f0f0fu) << 4) | ((bits & 0xf0f0f0f0u) >> 4);
+	bits = ((bits & 0x00ff00ffu) << 8) | ((bits & 0xff00ff00u) >> 8);
+	u0 = (float)i / samplesNum;
+	u1 = bits * 2.3283064365386963e-10f;
+}
+
+
+// D_GGX() of lighting.h
+static float DistributionGGX(float NoH, float roughness)
+{
+	float a2 = roughness * roughness;
+	float d = (NoH * a2 - NoH) * NoH + 1.0f;
+	return a2 / (XM_PI * d * d);
+}
+
+
+// Vis_SmithJointGGX() of lighting.h
+static float VisibilitySmithJointGGX(float NoL, float NoV, float roughness)
+{
+	float lambdaV = NoL * (NoV * (1.0f - roughness) + roughness);
+	float lambdaL = NoV * (NoL * (1.0f - roughness) + roughness);
+	return 0.5f / (lambdaV + lambdaL);
+}
+
+
+void SpecularPrefilter::Init(uint32_t resolution, uint32_t sourceResolution, uint32_t samplesNum)
+{
+	Assert(resolution > 0 && sourceResolution > 0 && samplesNum > 0);
+	uint32_t mipLevels = 1;
+	while ((resolution >> mipLevels) > 0)
+		mipLevels++;
+
+	m_resolution = resolution;
+	m_sourceResolution = sourceResolution;
+	m_mips.resize(mipLevels);
+	float solidAngleTexel = 4.0f * XM_PI / (6.0f * sourceResolution * sourceResolution);
+	for (uint32_t mip = 0; mip < mipLevels; mip++)
+	{
+		float roughness = GetMipRoughness(mip, mipLevels);
+		MipSamples& mipSamples = m_mips[mip];
+		mipSamples.samples.clear();
+
+		// a mirror reads every sample along N, one of them gives the same average
+		uint32_t count = roughness == 0.0f ? 1 : samplesNum;
+		double weight = 0.0;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			// ImportanceSampleGGX() with N = V = (0, 0, 1), so NoH = VoH
+			float u0, u1;
+			Hammersley(i, count, u0, u1);
+			float m2 = roughness * roughness;
+			float phi = 2.0f * XM_PI * u0;
+			float cosTheta = sqrtf((1.0f - u1) / (1.0f + (m2 - 1.0f) * u1));
+			float sinTheta = sqrtf(1.0f - cosTheta * cosTheta);
+			XMFLOAT3 half = {sinTheta * cosf(phi), sinTheta * sinf(phi), cosTheta};
+			XMFLOAT3 toLight = {2.0f * cosTheta * half.x, 2.0f * cosTheta * half.y, 2.0f * cosTheta * half.z - 1.0f};
+			float NoL = std::min(std::max(toLight.z, 0.0f), 1.0f);
+			if (NoL <= 0.0f)
+				continue;
+
+			float lod = 0.0f;
+			if (roughness > 0.0f)
+			{
+				float pdf = DistributionGGX(cosTheta, roughness) * 0.25f;
+				float solidAngleSample = 1.0f / (samplesNum * pdf);
+				lod = std::max(0.5f * log2f(solidAngleSample / solidAngleTexel), 0.0f);
+			}
+			mipSamples.samples.push_back({toLight, NoL, lod});
+			weight += NoL;
+		}
+		mipSamples.invWeight = (float)(1.0 / weight);
+	}
+}
+
+
+void SpecularPrefilter::Release()
+{
+	m_resolution = 0;
+	m_sourceResolution = 0;
+	m_mips.clear();
+}
+
+
+void SpecularPrefilter::Prefilter(const Cubemap& source, Cubemap& destination, uint32_t threadsNum) const
+{
+	Assert(IsInitialized() && source.GetResolution() == m_sourceResolution);
+	Assert(destination.GetResolution() == m_resolution && destination.GetMipLevels() == GetMipLevels());
+
+	// a task per row of a face of a mip, the rows of the larger mips first so the small ones balance the end
+	std::vector<uint32_t> firstRows(GetMipLevels() + 1, 0);
+	for (uint32_t mip = 0; mip < GetMipLevels(); mip++)
+		firstRows[mip + 1] = firstRows[mip] + Cubemap::kFacesNum * destination.GetMipResolution(mip);
+
+	ParallelFor(
+	    firstRows.back(),
+	    [&](uint32_t task) {
+		    uint32_t mip = 0;
+		    while (task >= firstRows[mip + 1])
+			    mip++;
+		    uint32_t resolution = destination.GetMipResolution(mip);
+		    uint32_t face = (task - firstRows[mip]) / resolution;
+		    uint32_t y = (task - firstRows[mip]) % resolution;
+		    const MipSamples& mipSamples = m_mips[mip];
+		    XMFLOAT4* texels = destination.GetFace(mip, face) + (size_t)y * resolution;
+
+		    for (uint32_t x = 0; x < resolution; x++)
+		    {
+			    XMFLOAT3 N = Cubemap::GetDirection(face, (x + 0.5f) / resolution, (y + 0.5f) / resolution);
+			    float invLength = 1.0f / sqrtf(N.x * N.x + N.y * N.y + N.z * N.z);
+			    N = {N.x * invLength, N.y * invLength, N.z * invLength};
+
+			    // the tangent frame of ImportanceSampleGGX()
+			    XMFLOAT3 up = fabsf(N.z) < 0.999f ? XMFLOAT3{0.0f, 0.0f, 1.0f} : XMFLOAT3{1.0f, 0.0f, 0.0f};
+			    XMFLOAT3 tangentX = {up.y * N.z - up.z * N.y, up.z * N.x - up.x * N.z, up.x * N.y - up.y * N.x};
+			    invLength = 1.0f / sqrtf(tangentX.x * tangentX.x + tangentX.y * tangentX.y + tangentX.z * tangentX.z);
+			    tangentX = {tangentX.x * invLength, tangentX.y * invLength, tangentX.z * invLength};
+			    XMFLOAT3 tangentY = {N.y * tangentX.z - N.z * tangentX.y, N.z * tangentX.x - N.x * tangentX.z, N.x * tangentX.y - N.y * tangentX.x};
+
+			    XMFLOAT3 sum = {0.0f, 0.0f, 0.0f};
+			    for (const Sample& sample : mipSamples.samples)
+			    {
+				    const XMFLOAT3& l = sample.toLight;
+				    XMFLOAT3 L = {tangentX.x * l.x + tangentY.x * l.y + N.x * l.z, tangentX.y * l.x + tangentY.y * l.y + N.y * l.z,
+				                  tangentX.z * l.x + tangentY.z * l.y + N.z * l.z};
+				    XMFLOAT4 radiance = source.Sample(L, sample.lod);
+				    sum.x += radiance.x * sample.NoL;
+				    sum.y += radiance.y * sample.NoL;
+				    sum.z += radiance.z * sample.NoL;
+			    }
+			    // alpha is 0 like in the cube envmapprefilter.hlsl writes
+			    texels[x] = {sum.x * mipSamples.invWeight, sum.y * mipSamples.invWeight, sum.z * mipSamples.invWeight, 0.0f};
+		    }
+	    },
+	    threadsNum);
+}
+
+
+void SpecularPrefilter::GenerateBRDFLut(uint32_t size, uint32_t samplesNum, XMFLOAT4* texels, uint32_t threadsNum)
+{
+	Assert(size > 1 && samplesNum > 0);
+	ParallelFor(
+	    size,
+	    [&](uint32_t y) {
+		    // GenerateBRDFLut() of lighting.h, N = (0, 0, 1) and V in the xz plane
+		    float NoV = (float)y / (size - 1);
+		    XMFLOAT3 V = {sqrtf(1.0f - NoV * NoV), 0.0f, NoV};
+		    for (uint32_t x = 0; x < size; x++)
+		    {
+			    float roughness = (float)x / (size - 1);
+			    float m2 = roughness * roughness;
+			    float scale = 0.0f;
+			    float bias = 0.0f;
+			    for (uint32_t i = 0; i < samplesNum; i++)
+			    {
+				    float u0, u1;
+				    Hammersley(i, samplesNum, u0, u1);
+				    float phi = 2.0f * XM_PI * u0;
+				    float cosTheta = sqrtf((1.0f - u1) / (1.0f + (m2 - 1.0f) * u1));
+				    float sinTheta = sqrtf(1.0f - cosTheta * cosTheta);
+				    XMFLOAT3 H = {sinTheta * cosf(phi), sinTheta * sinf(phi), cosTheta};
+				    float VoH = V.x * H.x + V.z * H.z;
+				    float NoL = std::min(std::max(2.0f * VoH * H.z - V.z, 0.0f), 1.0f);
+				    float NoH = std::min(std::max(H.z, 0.0f), 1.0f);
+				    VoH = std::min(std::max(VoH, 0.0f), 1.0f);
+				    if (NoL > 0.0f)
+				    {
+					    float vis = VisibilitySmithJointGGX(NoL, NoV, roughness) * NoL * (4.0f * VoH / NoH);
+					    float fc = powf(1.0f - VoH, 5.0f);
+					    scale += vis * (1.0f - fc);
+					    bias += vis * fc;
+				    }
+			    }
+			    texels[(size_t)y * size + x] = {scale / samplesNum, bias / samplesNum, 0.0f, 0.0f};
+		    }
+	    },
+	    threadsNum);
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "Cubemap.h"
+#include "EnvFilterConstants.h"
+
+
+/**
+ * \brief CPU reference of the split sum specular prefilter of EnvMapFilter,
+ * PrefilterSpecularEnvMap() of lighting.h run by envmapprefilter.hlsl.
+ *
+ * Every mip is filtered with the roughness the shader gives it, N = V = R
+ * is the direction of the texel and GGX samples read the source at the
+ * same solid angle based lod. The samples of a mip are the same for every
+ * texel, so they are precomputed in the tangent frame of lighting.h once.
+ * They come from the plain Hammersley set instead of the per texel
+ * scrambled one of the GPU. No texel depends on another or on the thread
+ * computing it, so the output is the same bits for any number of threads.
+ */
+class SpecularPrefilter
+{
+public:
+	// resolution of the prefiltered specular cube of EnvMapFilter
+	static const uint32_t kDefaultResolution = kSpecularEnvMapResolution;
+	// default "Samples count" of the UI, the TotalSamples of the GPU bake
+	static const uint32_t kDefaultSamplesNum = kEnvFilterSamplesNum;
+
+	// Samples of every mip of a destination with the full mip chain, for a source cube of sourceResolution
+	void Init(uint32_t resolution, uint32_t sourceResolution, uint32_t samplesNum = kDefaultSamplesNum);
+	void Release();
+
+	bool IsInitialized() const;
+	uint32_t GetResolution() const;
+	uint32_t GetMipLevels() const;
+
+	// Filter every mip of the destination, initialized with the resolution and mips of Init(), from a source with its mip chain
+	void Prefilter(const Cubemap& source, Cubemap& destination, uint32_t threadsNum = 0) const;
+
+	// Roughness of a mip, as envmapprefilter.hlsl computes it and ApproximatedIndirectLight() inverts it
+	static float GetMipRoughness(uint32_t mip, uint32_t mipLevels);
+	// Point i of the Hammersley set of samplesNum points, Hammersley_v2() of hammersley.h
+	static void Hammersley(uint32_t i, uint32_t samplesNum, float& u0, float& u1);
+
+	/**
+	 * \brief The other half of the split sum, the scale and bias of F0 that
+	 * brdflutgen.hlsl stores in x and y. Roughness goes along the rows and
+	 * NoV down the columns of a size x size image, from 0 to 1 at the texel
+	 * centers of the edges. Plain Hammersley samples like Prefilter().
+	 */
+	static void GenerateBRDFLut(uint32_t size, uint32_t samplesNum, XMFLOAT4* texels, uint32_t threadsNum = 0);
+
+private:
+	struct Sample
+	{
+		// in the tangent frame, z along N
+		XMFLOAT3 toLight;
+		float NoL;
+		float lod;
+	};
+
+	struct MipSamples
+	{
+		std::vector<Sample> samples;
+		// reciprocal of the sum of NoL, the normalization of the shader
+		float invWeight;
+	};
+
+	uint32_t m_resolution = 0;
+	uint32_t m_sourceResolution = 0;
+	std::vector<MipSamples> m_mips;
+};
+
+
+inline bool SpecularPrefilter::IsInitialized() const
+{
+	return !m_mips.empty();
+}
+
+
+inline uint32_t SpecularPrefilter::GetResolution() const
+{
+	return m_resolution;
+}
+
+
+inline uint32_t SpecularPrefilter::GetMipLevels() const
+{
+	return (uint32_t)m_mips.size();
+}
+
+
+inline float SpecularPrefilter::GetMipRoughness(uint32_t mip, uint32_t mipLevels)
+{
+	float roughness = (float)mip / mipLevels;
+	return roughness * roughness;
+}
@@ -0,0 +1,323 @@
+#include "Precompiled.h"
+#include "SphericalHarmonics.h"
+#include "Parallel.h"
+#include "Simd.h"
+
+
+// normalization constants of the real basis functions
+static const float kSHBand0 = 0.282094792f;
+static const float kSHBand1 = 0.488602512f;
+static const float kSHBand2 = 1.092548431f;
+static const float kSHBand2Zonal = 0.315391565f;
+static const float kSHBand2XY = 0.546274215f;
+
+// clamped cosine over pi per band, a pi, 2 pi / 3 and pi / 4 convolution
+static const float kDiffuseBandScales[kSHCoefficientsNum] = {1.0f, 2.0f / 3.0f, 2.0f / 3.0f, 2.0f / 3.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.25f};
+
+
+// Planes of a row of texels, the directions need not be normalized
+struct SHRow
+{
+	std::vector<float> storage;
+	float* x;
+	float* y;
+	float* z;
+	// solid angle of the texels
+	float* weights;
+	float* r;
+	float* g;
+	float* b;
+
+	explicit SHRow(uint32_t count) : storage((size_t)count * 7)
+	{
+		float* planes[7];
+		for (uint32_t i = 0; i < 7; i++)
+			planes[i] = storage.data() + (size_t)i * count;
+		x = planes[0];
+		y = planes[1];
+		z = planes[2];
+		weights = planes[3];
+		r = planes[4];
+		g = planes[5];
+		b = planes[6];
+	}
+};
+
+
+template <typename P>
+static void Normalize(P& x, P& y, P& z)
+{
+	P invLength = SimdTraits<P>::Set(1.0f) / Sqrt(MulAdd(x, x, MulAdd(y, y, z * z)));
+	x = x * invLength;
+	y = y * invLength;
+	z = z * invLength;
+}
+
+
+// Basis functions of a normalized direction
+template <typename P>
+static void EvalBasis(P x, P y, P z, P basis[kSHCoefficientsNum])
+{
+	using T = SimdTraits<P>;
+	basis[0] = T::Set(kSHBand0);
+	basis[1] = T::Set(kSHBand1) * y;
+	basis[2] = T::Set(kSHBand1) * z;
+	basis[3] = T::Set(kSHBand1) * x;
+	basis[4] = T::Set(kSHBand2) * x * y;
+	basis[5] = T::Set(kSHBand2) * y * z;
+	basis[6] = T::Set(kSHBand2Zonal) * MulAdd(T::Set(3.0f), z * z, T::Set(-1.0f));
+	basis[7] = T::Set(kSHBand2) * x * z;
+	basis[8] = T::Set(kSHBand2XY) * (x * x - y * y);
+}
+
+
+// Add whole packets of a row from first on to sums, returns where they stopped
+template <typename P>
+static uint32_t ProjectPackets(const SHRow& row, uint32_t first, uint32_t count, double* sums)
+{
+	using T = SimdTraits<P>;
+	P packetSums[3][kSHCoefficientsNum];
+	for (uint32_t c = 0; c < 3; c++)
+		for (uint32_t i = 0; i < kSHCoefficientsNum; i++)
+			packetSums[c][i] = T::Set(0.0f);
+
+	uint32_t i = first;
+	for (; i + T::kWidth <= count; i += T::kWidth)
+	{
+		P x = T::Load(row.x + i);
+		P y = T::Load(row.y + i);
+		P z = T::Load(row.z + i);
+		Normalize(x, y, z);
+		P basis[kSHCoefficientsNum];
+		EvalBasis(x, y, z, basis);
+
+		P weight = T::Load(row.weights + i);
+		P radiance[3] = {T::Load(row.r + i) * weight, T::Load(row.g + i) * weight, T::Load(row.b + i) * weight};
+		for (uint32_t c = 0; c < 3; c++)
+			for (uint32_t k = 0; k < kSHCoefficientsNum; k++)
+				packetSums[c][k] = MulAdd(basis[k], radiance[c], packetSums[c][k]);
+	}
+
+	for (uint32_t c = 0; c < 3; c++)
+		for (uint32_t k = 0; k < kSHCoefficientsNum; k++)
+			sums[c * kSHCoefficientsNum + k] += ReduceAdd(packetSums[c][k]);
+	return i;
+}
+
+
+static void ProjectRow(const SHRow& row, uint32_t count, double* sums)
+{
+	DispatchSimd([&](auto packet) {
+		using P = decltype(packet);
+		uint32_t i = ProjectPackets<P>(row, 0, count, sums);
+		ProjectPackets<float>(row, i, count, sums);
+	});
+}
+
+
+// Sum the coefficients of every row in order, so the threads do not change the rounding
+static SHColor SumRows(const std::vector<double>& rowSums, uint32_t rowsNum)
+{
+	double sums[3 * kSHCoefficientsNum] = {};
+	for (uint32_t row = 0; row < rowsNum; row++)
+		for (uint32_t i = 0; i < 3 * kSHCoefficientsNum; i++)
+			sums[i] += rowSums[(size_t)row * 3 * kSHCoefficientsNum + i];
+
+	SHColor sh;
+	for (uint32_t c = 0; c < 3; c++)
+		for (uint32_t k = 0; k < kSHCoefficientsNum; k++)
+			sh.coefficients[c][k] = (float)sums[c * kSHCoefficientsNum + k];
+	return sh;
+}
+
+
+// Solid angle of the part of a face at unit distance over [0, x] x [0, y]
+static double AreaElement(double x, double y)
+{
+	return atan2(x * y, sqrt(x * x + y * y + 1.0));
+}
+
+
+SHColor ProjectToSH(const Cubemap& cubemap, uint32_t threadsNum)
+{
+	uint32_t resolution = cubemap.GetResolution();
+	Assert(resolution > 0);
+
+	// every face has the same solid angles, texels share their corners with the neighbors
+	std::vector<double> corners((size_t)(resolution + 1) * (resolution + 1));
+	for (uint32_t y = 0; y <= resolution; y++)
+		for (uint32_t x = 0; x <= resolution; x++)
+			corners[(size_t)y * (resolution + 1) + x] = AreaElement(2.0 * x / resolution - 1.0, 2.0 * y / resolution - 1.0);
+	std::vector<float> solidAngles((size_t)resolution * resolution);
+	for (uint32_t y = 0; y < resolution; y++)
+	{
+		const double* top = &corners[(size_t)y * (resolution + 1)];
+		const double* bottom = top + resolution + 1;
+		for (uint32_t x = 0; x < resolution; x++)
+			solidAngles[(size_t)y * resolution + x] = (float)fabs(top[x] - top[x + 1] - bottom[x] + bottom[x + 1]);
+	}
+
+	uint32_t rowsNum = Cubemap::kFacesNum * resolution;
+	std::vector<double> rowSums((size_t)rowsNum * 3 * kSHCoefficientsNum);
+	ParallelFor(
+	    rowsNum,
+	    [&](uint32_t task) {
+		    uint32_t face = task / resolution;
+		    uint32_t y = task % resolution;
+		    const XMFLOAT4* texels = cubemap.GetFace(0, face) + (size_t)y * resolution;
+		    float t = (y + 0.5f) / resolution;
+
+		    SHRow row(resolution);
+		    memcpy(row.weights, &solidAngles[(size_t)y * resolution], resolution * sizeof(float));
+		    for (uint32_t x = 0; x < resolution; x++)
+		    {
+			    XMFLOAT3 direction = Cubemap::GetDirection(face, (x + 0.5f) / resolution, t);
+			    row.x[x] = direction.x;
+			    row.y[x] = direction.y;
+			    row.z[x] = direction.z;
+			    row.r[x] = texels[x].x;
+			    row.g[x] = texels[x].y;
+			    row.b[x] = texels[x].z;
+		    }
+		    ProjectRow(row, resolution, &rowSums[(size_t)task * 3 * kSHCoefficientsNum]);
+	    },
+	    threadsNum);
+	return SumRows(rowSums, rowsNum);
+}
+
+
+SHColor ProjectToSH(const EquirectImage& image, uint32_t threadsNum)
+{
+	Assert(image.pixels && image.width > 0 && image.height > 0);
+	// the columns share their azimuth across rows
+	std::vector<float> sinPhi(image.width);
+	std::vector<float> cosPhi(image.width);
+	for (uint32_t x = 0; x < image.width; x++)
+	{
+		float phi = (x + 0.5f) * (2.0f * XM_PI / image.width);
+		sinPhi[x] = sinf(phi);
+		cosPhi[x] = cosf(phi);
+	}
+
+	std::vector<double> rowSums((size_t)image.height * 3 * kSHCoefficientsNum);
+	ParallelFor(
+	    image.height,
+	    [&](uint32_t y) {
+		    // directions of env_emitter.hlsl, the pixels of a row cover the same band of latitude
+		    double theta0 = y * XM_PI / image.height;
+		    double theta1 = (y + 1) * XM_PI / image.height;
+		    float weight = (float)(2.0 * XM_PI / image.width * (cos(theta0) - cos(theta1)));
+		    float theta = (y + 0.5f) * (XM_PI / image.height);
+		    float sinTheta = sinf(theta);
+		    float cosTheta = cosf(theta);
+		    const XMFLOAT4* pixels = image.pixels + (size_t)y * image.width;
+
+		    SHRow row(image.width);
+		    for (uint32_t x = 0; x < image.width; x++)
+		    {
+			    row.x[x] = sinTheta * sinPhi[x];
+			    row.y[x] = cosTheta;
+			    row.z[x] = sinTheta * cosPhi[x];
+			    row.weights[x] = weight;
+			    row.r[x] = pixels[x].x;
+			    row.g[x] = pixels[x].y;
+			    row.b[x] = pixels[x].z;
+		    }
+		    ProjectRow(row, image.width, &rowSums[(size_t)y * 3 * kSHCoefficientsNum]);
+	    },
+	    threadsNum);
+	return SumRows(rowSums, image.height);
+}
+
+
+SHColor ConvolveDiffuse(const SHColor& radiance)
+{
+	SHColor irradiance;
+	for (uint32_t c = 0; c < 3; c++)
+		for (uint32_t k = 0; k < kSHCoefficientsNum; k++)
+			irradiance.coefficients[c][k] = radiance.coefficients[c][k] * kDiffuseBandScales[k];
+	return irradiance;
+}
+
+
+// Evaluate whole packets from first on, returns where they stopped
+template <typename P>
+static uint32_t EvalPackets(const SHColor& sh, const float* x, const float* y, const float* z, uint32_t first, uint32_t count, float* r, float* g, float* b)
+{
+	using T = SimdTraits<P>;
+	P coefficients[3][kSHCoefficientsNum];
+	for (uint32_t c = 0; c < 3; c++)
+		for (uint32_t k = 0; k < kSHCoefficientsNum; k++)
+			coefficients[c][k] = T::Set(sh.coefficients[c][k]);
+
+	float* outputs[3] = {r, g, b};
+	uint32_t i = first;
+	for (; i + T::kWidth <= count; i += T::kWidth)
+	{
+		P dx = T::Load(x + i);
+		P dy = T::Load(y + i);
+		P dz = T::Load(z + i);
+		Normalize(dx, dy, dz);
+		P basis[kSHCoefficientsNum];
+		EvalBasis(dx, dy, dz, basis);
+		for (uint32_t c = 0; c < 3; c++)
+		{
+			P sum = basis[0] * coefficients[c][0];
+			for (uint32_t k = 1; k < kSHCoefficientsNum; k++)
+				sum = MulAdd(basis[k], coefficients[c][k], sum);
+			T::Store(outputs[c] + i, sum);
+		}
+	}
+	return i;
+}
+
+
+XMFLOAT3 EvalSH(const SHColor& sh, const XMFLOAT3& direction)
+{
+	XMFLOAT3 result;
+	EvalPackets<float>(sh, &direction.x, &direction.y, &direction.z, 0, 1, &result.x, &result.y, &result.z);
+	return result;
+}
+
+
+void EvalSH(const SHColor& sh, const float* x, const float* y, const float* z, uint32_t count, float* r, float* g, float* b)
+{
+	DispatchSimd([&](auto packet) {
+		using P = decltype(packet);
+		uint32_t i = EvalPackets<P>(sh, x, y, z, 0, count, r, g, b);
+		EvalPackets<float>(sh, x, y, z, i, count, r, g, b);
+	});
+}
+
+
+void EvalSH(const SHColor& sh, Cubemap& cubemap, uint32_t threadsNum)
+{
+	Assert(cubemap.GetResolution() > 0);
+	for (uint32_t mip = 0; mip < cubemap.GetMipLevels(); mip++)
+	{
+		uint32_t resolution = cubemap.GetMipResolution(mip);
+		ParallelFor(
+		    Cubemap::kFacesNum * resolution,
+		    [&](uint32_t task) {
+			    uint32_t face = task / resolution;
+			    uint32_t y = task % resolution;
+			    float t = (y + 0.5f) / resolution;
+
+			    SHRow row(resolution);
+			    for (uint32_t x = 0; x < resolution; x++)
+			    {
+				    XMFLOAT3 direction = Cubemap::GetDirection(face, (x + 0.5f) / resolution, t);
+				    row.x[x] = direction.x;
+				    row.y[x] = direction.y;
+				    row.z[x] = direction.z;
+			    }
+			    EvalSH(sh, row.x, row.y, row.z, resolution, row.r, row.g, row.b);
+
+			    // alpha is 0 like in the diffuse cube envmapprefilter.hlsl writes
+			    XMFLOAT4* texels = cubemap.GetFace(mip, face) + (size_t)y * resolution;
+			    for (uint32_t x = 0; x < resolution; x++)
+				    texels[x] = {std::max(row.r[x], 0.0f), std::max(row.g[x], 0.0f), std::max(row.b[x], 0.0f), 0.0f};
+		    },
+		    threadsNum);
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "Cubemap.h"
+
+
+static const uint32_t kSHCoefficientsNum = 9;
+
+
+// Real L2 spherical harmonics of an RGB function of the direction, a plane of coefficients per channel
+struct SHColor
+{
+	float coefficients[3][kSHCoefficientsNum] = {};
+};
+
+
+/**
+ * \brief Project radiance onto L2 spherical harmonics in one pass over the
+ * texels, packets of the active SIMD level and rows split across threads.
+ *
+ * Cube texels are weighted by their exact solid angle, equirect pixels by
+ * the band of latitude they cover, so the texels of any resolution
+ * integrate to 4 pi. Rows are summed in a fixed order, the result does not
+ * depend on the number of threads. The cubemap is projected from its first
+ * mip.
+ */
+SHColor ProjectToSH(const Cubemap& cubemap, uint32_t threadsNum = 0);
+SHColor ProjectToSH(const EquirectImage& image, uint32_t threadsNum = 0);
+
+/**
+ * \brief Convolve radiance with the clamped cosine over pi (Ramamoorthi and
+ * Hanrahan), what PrefilterDiffuseEnvMap() in lighting.h estimates for
+ * every texel of the diffuse cube. Projections are linear, a change of the
+ * emitter scale only scales the coefficients.
+ */
+SHColor ConvolveDiffuse(const SHColor& radiance);
+
+// Directions need not be normalized
+XMFLOAT3 EvalSH(const SHColor& sh, const XMFLOAT3& direction);
+void EvalSH(const SHColor& sh, const float* x, const float* y, const float* z, uint32_t count, float* r, float* g, float* b);
+// Every texel of every mip of an initialized cubemap, clamped to 0 where the truncated series rings below it
+void EvalSH(const SHColor& sh, Cubemap& cubemap, uint32_t threadsNum = 0);
@@ -147,30 +147,6 @@ static bool ColorDialog(XMVECTOR& color)
 }
 
 
-static void EnumerateFiles(const char* searchDir, std::vector<FilePath>& list, bool dir = false)
-{
-	WIN32_FIND_DATAA ffd;
-	HANDLE hFind = INVALID_HANDLE_VALUE;
-
-	hFind = FindFirstFileA(searchDir, &ffd);
-	if (INVALID_HANDLE_VALUE == hFind)
-		return;
-
-	do
-	{
-		if ((ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0 && !dir)
-			continue;
-		if ((ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0 && dir)
-			continue;
-		if (ffd.cFileName[0] == '.' || strcmp(ffd.cFileName, "..") == 0)
-			continue;
-		list.push_back(std::move(ffd.cFileName));
-	} while (FindNextFileA(hFind, &ffd) != 0);
-
-	FindClose(hFind);
-}
-
-
 static bool SamplesCountCombo(const char* label, uint32_t& samplesCount, uint32_t maxSamples)
 {
 	const uint32_t samplesCountArr[] = {16, 32, 64, 128, 256, 512, 1024, 1536, 2048};
@@ -225,20 +201,22 @@ static void Combo(const char* labal, const std::vector<FilePath>& files, const c
 }
 
 
-static bool FileNameEndingMatch(const FilePath& name, const char* ending)
-{
-	size_t len = strlen(ending);
-	if (name.length() <= len)
-		return false;
-	size_t offset = name.length() - len;
-	return strcmp(name.data() + offset, ending) == 0;
-}
-
-
 void App::InitUI()
 {
 	EnumerateFiles("data\\HDRs\\*.dds", m_hdrFiles);
 	EnumerateFiles("data\\HDRs\\*.hdr", m_hdrFiles);
+	// products of the cubemap, irradiance and prefilter commands are not environments, skip any left here from before data\EnvMaps
+	const char* kDerivedSuffixes[] = {".cube.dds", ".irradiance.dds", ".specular.dds"};
+	auto isDerived = [&kDerivedSuffixes](const FilePath& file) {
+		for (const char* suffix : kDerivedSuffixes)
+		{
+			size_t length = strlen(suffix);
+			if (file.size() >= length && _stricmp(file.c_str() + file.size() - length, suffix) == 0)
+				return true;
+		}
+		return false;
+	};
+	m_hdrFiles.erase(std::remove_if(m_hdrFiles.begin(), m_hdrFiles.end(), isDerived), m_hdrFiles.end());
 	if (m_hdrFiles.empty())
 	{
 		m_envEmitter.SetType(EnvEmitter::kTypeConstLuminance);
@@ -254,24 +232,13 @@ void App::InitUI()
 	if (!m_materials.empty())
 		m_singleObjScene.textureMaterial = m_materials[0].c_str();
 
-	std::vector<FilePath> spdFiles;
-	EnumerateFiles("data\\SPDs\\*", spdFiles);
-	for (size_t i = 0; i < spdFiles.size();)
-	{
-		const char* eta = ".eta.spd";
-		const char* k = ".k.spd";
-		if (i + 1 < spdFiles.size() && FileNameEndingMatch(spdFiles[i], eta) && FileNameEndingMatch(spdFiles[i + 1], k))
-		{
-			m_spdFiles.push_back({spdFiles[i].data(), (uint32_t)(spdFiles[i].length() - strlen(eta))});
-			i += 2;
-		}
-		else
-			i++;
-	}
+	const SpectralArchive& spectralArchive = GetSpectralArchive();
+	for (uint32_t i = 0; i < spectralArchive.GetMaterialsNum(); i++)
+		m_spdFiles.push_back(spectralArchive.GetMaterial(i).name);
 	if (!m_spdFiles.empty())
 		m_singleObjScene.ior = m_spdFiles[0].c_str();
 
-	EnumerateFiles("data\\MERL\\*", m_merlMaterials);
+	EnumerateFiles("data\\MERL\\*.binary", m_merlMaterials);
 	if (!m_merlMaterials.empty())
 		m_singleObjScene.merlMaterial = m_merlMaterials[0].c_str();
 
@@ -488,6 +455,11 @@ void App::UpdateUI()
 						m_singleObjInstanceData.BaseColor = ComputeF0(selected);
 						m_resetSampling = true;
 					});
+					if (ImGui::Combo("Spectral resolution", (int*)&m_spectralResolution, kSpectralResolutionNames, kSpectralResolutionsNum))
+					{
+						m_singleObjInstanceData.BaseColor = ComputeF0(m_singleObjScene.ior);
+						m_resetSampling = true;
+					}
 				}
 				if (exportMitsubaButton && ImGui::Button("Export to Mitsuba"))
 					ExportToMitsuba();
@@ -525,6 +497,8 @@ void App::UpdateUI()
 void PlotsWindow::Init(const std::vector<FilePath>& spdFiles)
 {
 	m_spdFiles = spdFiles;
+	std::shared_ptr<const Spectrum> zero = std::make_shared<const Spectrum>(0.0f);
+	m_ior = {zero, zero};
 	if (!m_spdFiles.empty())
 		LoadSPDs(m_spdFiles.front().c_str());
 
@@ -586,23 +560,54 @@ void PlotsWindow::Update()
 }
 
 
+// Fresnel of an IOR at pointsNum angles spread evenly over [0, 90] degrees, only touches thread safe data
+static std::vector<XMVECTOR> ComputeFresnelRGBPlot(const std::string& ior, ESpectralResolution resolution, EColorSpace colorSpace, uint32_t pointsNum)
+{
+	pointsNum = std::max(pointsNum, 2u);
+	std::vector<float> cosThetas(pointsNum);
+	float angleStep = XM_PI * 0.5f / (pointsNum - 1);
+	for (uint32_t i = 0; i < pointsNum; i++)
+		cosThetas[i] = cosf(angleStep * i) - 1e-06f;
+
+	std::vector<XMVECTOR> plot(pointsNum, XMVectorZero());
+	DispatchSpectralResolution(resolution, [&](auto tag) {
+		using S = std::remove_pointer_t<decltype(tag)>;
+		SpectralIOR<S> spectralIOR;
+		if (GetSpectralLibrary().Get(ior.c_str(), spectralIOR))
+			FresnelConductorXYZ(cosThetas.data(), pointsNum, *spectralIOR.eta, *spectralIOR.k, plot.data());
+	});
+	// one conversion from the XYZ sums to the working color space
+	ConvertColors(kColorSpaceXYZ, colorSpace, (float*)plot.data(), pointsNum);
+	return plot;
+}
+
+
 void PlotsWindow::BuildFresnelRGBPlot(uint32_t pointsNum)
 {
-	if (m_fresnelRGBPlot.size() != (size_t)pointsNum)
+	// a new IOR, resolution or color space is built right away, so there is something to draw this frame
+	if (m_fresnelRGBPlot.empty())
 	{
-		m_fresnelRGBPlot.resize(pointsNum);
-		float angleStep = XM_PI * 0.5f / (pointsNum - 1);
-		for (uint32_t i = 0; i < pointsNum; i++)
-		{
-			float angle = angleStep * i;
-			float cosTheta = cosf(angle);
+		m_fresnelRGBPlot = ComputeFresnelRGBPlot(selectorIOR, m_fresnelRGBPlotResolution, GetWorkingColorSpace(), pointsNum);
+		m_fresnelRGBPlotVersion++;
+		return;
+	}
 
-			Spectrum spectrum = FresnelConductorExact(cosTheta - 1e-06f, m_etaSpectrum, m_kSpectrum);
-			spectrum *= GetD65Normalized();
-			XMFLOAT3 color;
-			spectrum.ToLinearRGB(color.x, color.y, color.z);
-			m_fresnelRGBPlot[i] = XMLoadFloat3(&color);
-		}
+	if (m_fresnelRGBPlotJob.valid())
+	{
+		if (m_fresnelRGBPlotJob.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			return;
+
+		std::vector<XMVECTOR> plot = m_fresnelRGBPlotJob.get();
+		if (m_fresnelRGBPlotJobVersion == m_fresnelRGBPlotVersion)
+			m_fresnelRGBPlot = std::move(plot);
+	}
+
+	// canvas resizes are rebuilt on a worker thread, the current plot is drawn meanwhile
+	if (m_fresnelRGBPlot.size() != (size_t)std::max(pointsNum, 2u))
+	{
+		m_fresnelRGBPlotJobVersion = m_fresnelRGBPlotVersion;
+		m_fresnelRGBPlotJob =
+		    std::async(std::launch::async, ComputeFresnelRGBPlot, std::string(selectorIOR), m_fresnelRGBPlotResolution, GetWorkingColorSpace(), pointsNum);
 	}
 }
 
@@ -616,6 +621,14 @@ void PlotsWindow::DrawFresnelRGBPlot()
 	ImGui::Checkbox("G", &m_fresnelDrawRGB[1]);
 	ImGui::SameLine();
 	ImGui::Checkbox("B", &m_fresnelDrawRGB[2]);
+	if (ImGui::Combo("Spectral resolution", (int*)&m_fresnelRGBPlotResolution, kSpectralResolutionNames, kSpectralResolutionsNum))
+		m_fresnelRGBPlot.clear();
+	int colorSpace = GetWorkingColorSpace();
+	if (ImGui::Combo("Color space", &colorSpace, kColorSpaceNames, kColorSpacesNum))
+	{
+		SetWorkingColorSpace((EColorSpace)colorSpace);
+		m_fresnelRGBPlot.clear();
+	}
 
 	// start with 100 points, later adjust depending on canvas width
 	if (m_fresnelRGBPlot.empty())
@@ -675,8 +688,8 @@ void PlotsWindow::BuildFresnelSpectralPlot(uint32_t pointsNum)
 		{
 			float angle = angleStep * i;
 			float cosTheta = cosf(angle);
-			float eta = m_etaSpectrum.Eval(m_fresnelSpectralPlotLambda);
-			float k = m_kSpectrum.Eval(m_fresnelSpectralPlotLambda);
+			float eta = m_ior.eta->Eval(m_fresnelSpectralPlotLambda);
+			float k = m_ior.k->Eval(m_fresnelSpectralPlotLambda);
 			m_fresnelSpectralPlot[i] = FresnelConductorExact(cosTheta - 1e-06f, eta, k);
 		}
 	}
@@ -713,12 +726,14 @@ void PlotsWindow::DrawIORPlot()
 	maxY = std::ceilf(maxY);
 	ImGuiPlot plot(kSpectrumMinWavelength, kSpectrumMaxWavelength, "%.0f", 0.0f, maxY, "%.1f");
 
-	plot.DrawPlot(kSpectrumSamples, IM_COL32(0xff, 0xff, 0, 0xff), [this](uint32_t i) { return m_etaSpectrum[i]; });
-	plot.DrawPlot(kSpectrumSamples, IM_COL32(0, 0xff, 0xff, 0xff), [this](uint32_t i) { return m_kSpectrum[i]; });
+	const Spectrum& eta = *m_ior.eta;
+	const Spectrum& k = *m_ior.k;
+	plot.DrawPlot(kSpectrumSamples, IM_COL32(0xff, 0xff, 0, 0xff), [&eta](uint32_t i) { return eta[i]; });
+	plot.DrawPlot(kSpectrumSamples, IM_COL32(0, 0xff, 0xff, 0xff), [&k](uint32_t i) { return k[i]; });
 
-	plot.DrawLineAndTooltip([this](float x) {
-		ImGui::Text("eta: %.2f", m_etaSpectrum.Eval(x));
-		ImGui::Text("k:   %.2f", m_kSpectrum.Eval(x));
+	plot.DrawLineAndTooltip([&eta, &k](float x) {
+		ImGui::Text("eta: %.2f", eta.Eval(x));
+		ImGui::Text("k:   %.2f", k.Eval(x));
 	});
 }
 
@@ -789,8 +804,10 @@ void PlotsWindow::DrawSpectrumPlot()
 		ImGui::SliderFloat("B", &m_customRGB.z, 0.0f, 1.0f, "%.2f");
 		const char* specType[] = {"Reflectance", "Illuminant"};
 		ImGui::Combo("Type", (int*)&m_customRGBSpectrumType, specType, _countof(specType));
+		const char* uplifting[] = {"Sigmoid", "Smits"};
+		ImGui::Combo("Uplifting", (int*)&m_customRGBUplifting, uplifting, _countof(uplifting));
 
-		m_customRGBSpectrum.FromLinearRGB(m_customRGB.x, m_customRGB.y, m_customRGB.z, m_customRGBSpectrumType);
+		m_customRGBSpectrum.FromLinearRGB(m_customRGB.x, m_customRGB.y, m_customRGB.z, m_customRGBSpectrumType, m_customRGBUplifting);
 
 		spectrum = &m_customRGBSpectrum;
 		minMax = {0.0f, 1.0f};
@@ -811,25 +828,16 @@ void PlotsWindow::LoadSPDs(const char* path)
 {
 	selectorIOR = path;
 
-	FilePath filename = path;
-	filename.SetExtension(".eta.spd");
-	SpectralPowerDistribution etaSPD;
-	etaSPD.InitFromFile(filename.c_str());
+	if (!GetSpectralLibrary().Get(path, m_ior))
+		return;
 
-	m_etaSpectrum = Spectrum(etaSPD);
 	m_etaSpectrumMaxVal = -FLT_MAX;
-	for (uint32_t i = 0; i < m_etaSpectrum.Size(); i++)
-		m_etaSpectrumMaxVal = std::max(m_etaSpectrumMaxVal, m_etaSpectrum[i]);
-
-	filename = path;
-	filename.SetExtension(".k.spd");
-	SpectralPowerDistribution kSPD;
-	kSPD.InitFromFile(filename.c_str());
+	for (uint32_t i = 0; i < m_ior.eta->Size(); i++)
+		m_etaSpectrumMaxVal = std::max(m_etaSpectrumMaxVal, (*m_ior.eta)[i]);
 
-	m_kSpectrum = Spectrum(kSPD);
 	m_kSpectrumMaxVal = -FLT_MAX;
-	for (uint32_t i = 0; i < m_kSpectrum.Size(); i++)
-		m_kSpectrumMaxVal = std::max(m_kSpectrumMaxVal, m_kSpectrum[i]);
+	for (uint32_t i = 0; i < m_ior.k->Size(); i++)
+		m_kSpectrumMaxVal = std::max(m_kSpectrumMaxVal, (*m_ior.k)[i]);
 
 	m_fresnelRGBPlot.clear();
 	m_fresnelSpectralPlot.clear();